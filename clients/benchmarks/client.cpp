@@ -55,6 +55,14 @@ try
          value<rocblas_int>(&argus.k2)->default_value(2),
          "Last index for row interchange, used with laswp. ")
 
+        ("oversample",
+         value<rocblas_int>(&argus.oversample)->default_value(10),
+         "Oversampling parameter for randomized routines, used with gesvd_randomized. ")
+
+        ("poweriters",
+         value<rocblas_int>(&argus.power_iters)->default_value(2),
+         "Number of power iterations for randomized routines, used with gesvd_randomized. ")
+
         ("lda",
          value<rocblas_int>(&argus.lda)->default_value(1024),
          "Specific leading dimension of matrix A, is only applicable to "
@@ -116,6 +124,36 @@ try
         ("beta",
          value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
 
+        ("tol",
+         value<double>(&argus.tol)->default_value(-1.0),
+         "Tolerance to determine the rank in pivoted factorizations, used with pstrf. "
+         "Negative values select the default tolerance. ")
+
+        ("vl",
+         value<double>(&argus.vl)->default_value(0.0),
+         "Lower bound of the eigenvalue interval (vl, vu]. Only applicable when erange = V")
+
+        ("vu",
+         value<double>(&argus.vu)->default_value(1.0),
+         "Upper bound of the eigenvalue interval (vl, vu]. Only applicable when erange = V")
+
+        ("il",
+         value<rocblas_int>(&argus.il)->default_value(1),
+         "Index of the smallest eigenvalue to be computed. Only applicable when erange = I")
+
+        ("iu",
+         value<rocblas_int>(&argus.iu)->default_value(1),
+         "Index of the largest eigenvalue to be computed. Only applicable when erange = I")
+
+        ("abstol",
+         value<double>(&argus.abstol)->default_value(0.0),
+         "Absolute tolerance at which eigenvalues are considered converged. "
+         "Non-positive values select the default tolerance. ")
+
+        ("max_sweeps",
+         value<rocblas_int>(&argus.max_sweeps)->default_value(100),
+         "Maximum number of sweeps (iterations) of Jacobi methods.")
+
         ("function,f",
          value<std::string>(&function)->default_value("potf2"),
          "LAPACK function to test. Options: potf2, getf2, getrf, getrs")
@@ -143,6 +181,14 @@ try
          value<char>(&argus.uplo_option)->default_value('U'),
          "U = upper, L = lower. Only applicable to certain routines")
 
+        ("diag",
+         value<char>(&argus.diag_option)->default_value('N'),
+         "N = non-unit, U = unit diagonal. Only applicable to certain routines")
+
+        ("norm",
+         value<char>(&argus.norm_type)->default_value('1'),
+         "1 = one, I = infinity, M = max, F = frobenius. Only applicable to certain routines")
+
         ("direct",
          value<char>(&argus.direct_option)->default_value('F'),
          "F = forward, B = backward. Only applicable to certain routines")
@@ -193,7 +239,15 @@ try
 
         ("itype",
          value<char>(&argus.itype)->default_value('1'),
-         "Only applicable to certain routines");
+         "Only applicable to certain routines")
+
+        ("erange",
+         value<char>(&argus.erange)->default_value('A'),
+         "A = all, V = value interval, I = index interval. Only applicable to certain routines")
+
+        ("eorder",
+         value<char>(&argus.eorder)->default_value('E'),
+         "B = by blocks, E = entire matrix. Only applicable to certain routines");
     // clang-format on
 
     variables_map vm;
@@ -242,6 +296,15 @@ try
     if(argus.uplo_option != 'U' && argus.uplo_option != 'L' && argus.uplo_option != 'F')
         throw std::invalid_argument("Invalid value for --uplo");
 
+    // diag
+    if(argus.diag_option != 'N' && argus.diag_option != 'U')
+        throw std::invalid_argument("Invalid value for --diag");
+
+    // norm
+    if(argus.norm_type != '1' && argus.norm_type != 'I' && argus.norm_type != 'M'
+       && argus.norm_type != 'F')
+        throw std::invalid_argument("Invalid value for --norm");
+
     // direct
     if(argus.direct_option != 'F' && argus.direct_option != 'B')
         throw std::invalid_argument("Invalid value for --direct");
@@ -264,6 +327,14 @@ try
     if(argus.evect != 'V' && argus.evect != 'I' && argus.evect != 'N')
         throw std::invalid_argument("Invalid value for --evect");
 
+    // erange
+    if(argus.erange != 'A' && argus.erange != 'V' && argus.erange != 'I')
+        throw std::invalid_argument("Invalid value for --erange");
+
+    // eorder
+    if(argus.eorder != 'B' && argus.eorder != 'E')
+        throw std::invalid_argument("Invalid value for --eorder");
+
     // workmode
     if(argus.workmode != 'O' && argus.workmode != 'I')
         throw std::invalid_argument("Invalid value for --workmode");
@@ -113,6 +113,146 @@ void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
 void ctrtri_(char* uplo, char* diag, int* n, rocblas_float_complex* A, int* lda, int* info);
 void ztrtri_(char* uplo, char* diag, int* n, rocblas_double_complex* A, int* lda, int* info);
 
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* info);
+
+void slauum_(char* uplo, int* n, float* A, int* lda, int* info);
+void dlauum_(char* uplo, int* n, double* A, int* lda, int* info);
+void clauum_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* info);
+void zlauum_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* info);
+
+float slange_(char* norm_type, int* m, int* n, float* A, int* lda, float* work);
+double dlange_(char* norm_type, int* m, int* n, double* A, int* lda, double* work);
+float clange_(char* norm_type, int* m, int* n, rocblas_float_complex* A, int* lda, float* work);
+double zlange_(char* norm_type, int* m, int* n, rocblas_double_complex* A, int* lda, double* work);
+
+float slansy_(char* norm_type, char* uplo, int* n, float* A, int* lda, float* work);
+double dlansy_(char* norm_type, char* uplo, int* n, double* A, int* lda, double* work);
+float clanhe_(char* norm_type, char* uplo, int* n, rocblas_float_complex* A, int* lda, float* work);
+double zlanhe_(char* norm_type,
+               char* uplo,
+               int* n,
+               rocblas_double_complex* A,
+               int* lda,
+               double* work);
+
+void sgecon_(char* norm_type,
+             int* n,
+             float* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dgecon_(char* norm_type,
+             int* n,
+             double* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void cgecon_(char* norm_type,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zgecon_(char* norm_type,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
+void spocon_(char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dpocon_(char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void cpocon_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zpocon_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
+void strcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             float* A,
+             int* lda,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dtrcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             double* A,
+             int* lda,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void ctrcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void ztrcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void sgetrf_(int* m, int* n, float* A, int* lda, int* ipiv, int* info);
 void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetrf_(int* m, int* n, rocblas_float_complex* A, int* lda, int* ipiv, int* info);
@@ -123,6 +263,11 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, rocblas_float_complex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, rocblas_double_complex* A, int* lda, int* info);
 
+void spstrf_(char* uplo, int* n, float* A, int* lda, int* piv, int* rank, float* tol, float* work, int* info);
+void dpstrf_(char* uplo, int* n, double* A, int* lda, int* piv, int* rank, double* tol, double* work, int* info);
+void cpstrf_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* piv, int* rank, float* tol, float* work, int* info);
+void zpstrf_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* piv, int* rank, double* tol, double* work, int* info);
+
 void spotf2_(char* uplo, int* n, float* A, int* lda, int* info);
 void dpotf2_(char* uplo, int* n, double* A, int* lda, int* info);
 void cpotf2_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* info);
@@ -133,6 +278,181 @@ void dgetf2_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetf2_(int* m, int* n, rocblas_float_complex* A, int* lda, int* ipiv, int* info);
 void zgetf2_(int* m, int* n, rocblas_double_complex* A, int* lda, int* ipiv, int* info);
 
+void ssytf2_(char* uplo, int* n, float* A, int* lda, int* ipiv, int* info);
+void dsytf2_(char* uplo, int* n, double* A, int* lda, int* ipiv, int* info);
+void csytf2_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* ipiv, int* info);
+void zsytf2_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* ipiv, int* info);
+
+void chetf2_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* ipiv, int* info);
+void zhetf2_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* ipiv, int* info);
+
+void ssytrf_(char* uplo, int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dsytrf_(char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             int* ipiv,
+             double* work,
+             int* lwork,
+             int* info);
+void csytrf_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zsytrf_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void chetrf_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zhetrf_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void ssytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             int* info);
+void dsytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             int* info);
+void csytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zsytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void chetrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zhetrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void ssysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            float* A,
+            int* lda,
+            int* ipiv,
+            float* B,
+            int* ldb,
+            float* work,
+            int* lwork,
+            int* info);
+void dsysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            double* A,
+            int* lda,
+            int* ipiv,
+            double* B,
+            int* ldb,
+            double* work,
+            int* lwork,
+            int* info);
+void csysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_float_complex* B,
+            int* ldb,
+            rocblas_float_complex* work,
+            int* lwork,
+            int* info);
+void zsysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_double_complex* B,
+            int* ldb,
+            rocblas_double_complex* work,
+            int* lwork,
+            int* info);
+
+void chesv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_float_complex* B,
+            int* ldb,
+            rocblas_float_complex* work,
+            int* lwork,
+            int* info);
+void zhesv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_double_complex* B,
+            int* ldb,
+            rocblas_double_complex* work,
+            int* lwork,
+            int* info);
+
 void sgetrs_(char* trans, int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
 void dgetrs_(char* trans, int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
 void cgetrs_(char* trans,
@@ -348,6 +668,35 @@ void zbdsqr_(char* uplo,
              double* W,
              int* info);
 
+void sbdsdc_(char* uplo,
+             char* compq,
+             int* n,
+             float* D,
+             float* E,
+             float* U,
+             int* ldu,
+             float* V,
+             int* ldv,
+             float* Q,
+             int* iq,
+             float* work,
+             int* iwork,
+             int* info);
+void dbdsdc_(char* uplo,
+             char* compq,
+             int* n,
+             double* D,
+             double* E,
+             double* U,
+             int* ldu,
+             double* V,
+             int* ldv,
+             double* Q,
+             int* iq,
+             double* work,
+             int* iwork,
+             int* info);
+
 void slarfb_(char* side,
              char* trans,
              char* direct,
@@ -519,14 +868,53 @@ void zgeqrf_(int* m,
              int* lwork,
              int* info);
 
-void sgeql2_(int* m, int* n, float* A, int* lda, float* ipiv, float* work, int* info);
-void dgeql2_(int* m, int* n, double* A, int* lda, double* ipiv, double* work, int* info);
-void cgeql2_(int* m,
+void sgeqp3_(int* m,
              int* n,
-             rocblas_float_complex* A,
+             float* A,
              int* lda,
-             rocblas_float_complex* ipiv,
-             rocblas_float_complex* work,
+             int* jpvt,
+             float* ipiv,
+             float* work,
+             int* lwork,
+             int* info);
+void dgeqp3_(int* m,
+             int* n,
+             double* A,
+             int* lda,
+             int* jpvt,
+             double* ipiv,
+             double* work,
+             int* lwork,
+             int* info);
+void cgeqp3_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgeqp3_(int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgeql2_(int* m, int* n, float* A, int* lda, float* ipiv, float* work, int* info);
+void dgeql2_(int* m, int* n, double* A, int* lda, double* ipiv, double* work, int* info);
+void cgeql2_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
              int* info);
 void zgeql2_(int* m,
              int* n,
@@ -1436,6 +1824,65 @@ void zgesvd_(char* jobu,
              double* E,
              int* info);
 
+void sgesdd_(char* jobz,
+             int* m,
+             int* n,
+             float* A,
+             int* lda,
+             float* S,
+             float* U,
+             int* ldu,
+             float* V,
+             int* ldv,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* info);
+void dgesdd_(char* jobz,
+             int* m,
+             int* n,
+             double* A,
+             int* lda,
+             double* S,
+             double* U,
+             int* ldu,
+             double* V,
+             int* ldv,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* info);
+void cgesdd_(char* jobz,
+             int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* S,
+             rocblas_float_complex* U,
+             int* ldu,
+             rocblas_float_complex* V,
+             int* ldv,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* iwork,
+             int* info);
+void zgesdd_(char* jobz,
+             int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* S,
+             rocblas_double_complex* U,
+             int* ldu,
+             rocblas_double_complex* V,
+             int* ldv,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* iwork,
+             int* info);
+
 void ssterf_(int* n, float* D, float* E, int* info);
 void dsterf_(int* n, double* D, double* E, int* info);
 
@@ -1458,6 +1905,145 @@ void zsteqr_(char* compc,
              double* work,
              int* info);
 
+void sstedc_(char* evect,
+             int* n,
+             float* D,
+             float* E,
+             float* C,
+             int* ldc,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void dstedc_(char* evect,
+             int* n,
+             double* D,
+             double* E,
+             double* C,
+             int* ldc,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void cstedc_(char* evect,
+             int* n,
+             float* D,
+             float* E,
+             rocblas_float_complex* C,
+             int* ldc,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void zstedc_(char* evect,
+             int* n,
+             double* D,
+             double* E,
+             rocblas_double_complex* C,
+             int* ldc,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+
+void sstebz_(char* erange,
+             char* eorder,
+             int* n,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             float* D,
+             float* E,
+             int* nev,
+             int* nsplit,
+             float* W,
+             int* iblock,
+             int* isplit,
+             float* work,
+             int* iwork,
+             int* info);
+void dstebz_(char* erange,
+             char* eorder,
+             int* n,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             double* D,
+             double* E,
+             int* nev,
+             int* nsplit,
+             double* W,
+             int* iblock,
+             int* isplit,
+             double* work,
+             int* iwork,
+             int* info);
+
+void sstein_(int* n,
+             float* D,
+             float* E,
+             int* nev,
+             float* W,
+             int* iblock,
+             int* isplit,
+             float* Z,
+             int* ldz,
+             float* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+void dstein_(int* n,
+             double* D,
+             double* E,
+             int* nev,
+             double* W,
+             int* iblock,
+             int* isplit,
+             double* Z,
+             int* ldz,
+             double* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+void cstein_(int* n,
+             float* D,
+             float* E,
+             int* nev,
+             float* W,
+             int* iblock,
+             int* isplit,
+             rocblas_float_complex* Z,
+             int* ldz,
+             float* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+void zstein_(int* n,
+             double* D,
+             double* E,
+             int* nev,
+             double* W,
+             int* iblock,
+             int* isplit,
+             rocblas_double_complex* Z,
+             int* ldz,
+             double* work,
+             int* iwork,
+             int* ifail,
+             int* info);
+
 void ssygs2_(int* itype, char* uplo, int* n, float* A, int* lda, float* B, int* ldb, int* info);
 void dsygs2_(int* itype, char* uplo, int* n, double* A, int* lda, double* B, int* ldb, int* info);
 void chegs2_(int* itype,
@@ -1519,94 +2105,34 @@ void zheev_(char* jobz,
             double* E,
             int* info);
 
-void ssygv_(int* itype,
-            char* jobz,
-            char* uplo,
-            int* n,
-            float* A,
-            int* lda,
-            float* B,
-            int* ldb,
-            float* W,
-            float* work,
-            int* lwork,
-            int* info);
-void dsygv_(int* itype,
-            char* jobz,
-            char* uplo,
-            int* n,
-            double* A,
-            int* lda,
-            double* B,
-            int* ldb,
-            double* W,
-            double* work,
-            int* lwork,
-            int* info);
-void chegv_(int* itype,
-            char* jobz,
-            char* uplo,
-            int* n,
-            rocblas_float_complex* A,
-            int* lda,
-            rocblas_float_complex* B,
-            int* ldb,
-            float* W,
-            rocblas_float_complex* work,
-            int* lwork,
-            float* rwork,
-            int* info);
-void zhegv_(int* itype,
-            char* jobz,
-            char* uplo,
-            int* n,
-            rocblas_double_complex* A,
-            int* lda,
-            rocblas_double_complex* B,
-            int* ldb,
-            double* W,
-            rocblas_double_complex* work,
-            int* lwork,
-            double* rwork,
-            int* info);
-
-void ssygvd_(int* itype,
-             char* jobz,
+void ssyevd_(char* evect,
              char* uplo,
              int* n,
              float* A,
              int* lda,
-             float* B,
-             int* ldb,
-             float* W,
+             float* D,
              float* work,
              int* lwork,
              int* iwork,
              int* liwork,
              int* info);
-void dsygvd_(int* itype,
-             char* jobz,
+void dsyevd_(char* evect,
              char* uplo,
              int* n,
              double* A,
              int* lda,
-             double* B,
-             int* ldb,
-             double* W,
+             double* D,
              double* work,
              int* lwork,
              int* iwork,
              int* liwork,
              int* info);
-void chegvd_(int* itype,
-             char* jobz,
+void cheevd_(char* evect,
              char* uplo,
              int* n,
              rocblas_float_complex* A,
              int* lda,
-             rocblas_float_complex* B,
-             int* ldb,
-             float* W,
+             float* D,
              rocblas_float_complex* work,
              int* lwork,
              float* rwork,
@@ -1614,15 +2140,12 @@ void chegvd_(int* itype,
              int* iwork,
              int* liwork,
              int* info);
-void zhegvd_(int* itype,
-             char* jobz,
+void zheevd_(char* evect,
              char* uplo,
              int* n,
              rocblas_double_complex* A,
              int* lda,
-             rocblas_double_complex* B,
-             int* ldb,
-             double* W,
+             double* D,
              rocblas_double_complex* work,
              int* lwork,
              double* rwork,
@@ -1631,14 +2154,304 @@ void zhegvd_(int* itype,
              int* liwork,
              int* info);
 
-#ifdef __cplusplus
-}
-#endif
-/************************************************************************/
-
-/************************************************************************/
-// These are templated functions used in rocSOLVER clients code
-
+void ssyevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             int* nev,
+             float* W,
+             float* Z,
+             int* ldz,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void dsyevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             int* nev,
+             double* W,
+             double* Z,
+             int* ldz,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void cheevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             int* nev,
+             float* W,
+             rocblas_float_complex* Z,
+             int* ldz,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void zheevx_(char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             int* nev,
+             double* W,
+             rocblas_double_complex* Z,
+             int* ldz,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+
+void ssygv_(int* itype,
+            char* jobz,
+            char* uplo,
+            int* n,
+            float* A,
+            int* lda,
+            float* B,
+            int* ldb,
+            float* W,
+            float* work,
+            int* lwork,
+            int* info);
+void dsygv_(int* itype,
+            char* jobz,
+            char* uplo,
+            int* n,
+            double* A,
+            int* lda,
+            double* B,
+            int* ldb,
+            double* W,
+            double* work,
+            int* lwork,
+            int* info);
+void chegv_(int* itype,
+            char* jobz,
+            char* uplo,
+            int* n,
+            rocblas_float_complex* A,
+            int* lda,
+            rocblas_float_complex* B,
+            int* ldb,
+            float* W,
+            rocblas_float_complex* work,
+            int* lwork,
+            float* rwork,
+            int* info);
+void zhegv_(int* itype,
+            char* jobz,
+            char* uplo,
+            int* n,
+            rocblas_double_complex* A,
+            int* lda,
+            rocblas_double_complex* B,
+            int* ldb,
+            double* W,
+            rocblas_double_complex* work,
+            int* lwork,
+            double* rwork,
+            int* info);
+
+void ssygvd_(int* itype,
+             char* jobz,
+             char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* W,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void dsygvd_(int* itype,
+             char* jobz,
+             char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* W,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void chegvd_(int* itype,
+             char* jobz,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             float* W,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void zhegvd_(int* itype,
+             char* jobz,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             double* W,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+
+void ssygvx_(int* itype,
+             char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             int* nev,
+             float* W,
+             float* Z,
+             int* ldz,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void dsygvx_(int* itype,
+             char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             int* nev,
+             double* W,
+             double* Z,
+             int* ldz,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void chegvx_(int* itype,
+             char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             float* vl,
+             float* vu,
+             int* il,
+             int* iu,
+             float* abstol,
+             int* nev,
+             float* W,
+             rocblas_float_complex* Z,
+             int* ldz,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+void zhegvx_(int* itype,
+             char* evect,
+             char* erange,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             double* vl,
+             double* vu,
+             int* il,
+             int* iu,
+             double* abstol,
+             int* nev,
+             double* W,
+             rocblas_double_complex* Z,
+             int* ldz,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* iwork,
+             int* ifail,
+             int* info);
+
+#ifdef __cplusplus
+}
+#endif
+/************************************************************************/
+
+/************************************************************************/
+// These are templated functions used in rocSOLVER clients code
+
 // lacgv
 
 template <>
@@ -1703,60 +2516,204 @@ void cblas_laswp<rocblas_double_complex>(rocblas_int n,
     zlaswp_(&n, A, &lda, &k1, &k2, ipiv, &inc);
 }
 
-// larfg
+// lauum
 
 template <>
-void cblas_larfg<float>(rocblas_int n, float* alpha, float* x, rocblas_int incx, float* tau)
+void cblas_lauum(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda)
 {
-    slarfg_(&n, alpha, x, &incx, tau);
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    int info;
+    slauum_(&uploC, &n, A, &lda, &info);
 }
 
 template <>
-void cblas_larfg<double>(rocblas_int n, double* alpha, double* x, rocblas_int incx, double* tau)
+void cblas_lauum(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda)
 {
-    dlarfg_(&n, alpha, x, &incx, tau);
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    int info;
+    dlauum_(&uploC, &n, A, &lda, &info);
 }
 
 template <>
-void cblas_larfg<rocblas_float_complex>(rocblas_int n,
-                                        rocblas_float_complex* alpha,
-                                        rocblas_float_complex* x,
-                                        rocblas_int incx,
-                                        rocblas_float_complex* tau)
+void cblas_lauum(rocblas_fill uplo, rocblas_int n, rocblas_float_complex* A, rocblas_int lda)
 {
-    clarfg_(&n, alpha, x, &incx, tau);
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    int info;
+    clauum_(&uploC, &n, A, &lda, &info);
 }
 
 template <>
-void cblas_larfg<rocblas_double_complex>(rocblas_int n,
-                                         rocblas_double_complex* alpha,
-                                         rocblas_double_complex* x,
-                                         rocblas_int incx,
-                                         rocblas_double_complex* tau)
+void cblas_lauum(rocblas_fill uplo, rocblas_int n, rocblas_double_complex* A, rocblas_int lda)
 {
-    zlarfg_(&n, alpha, x, &incx, tau);
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    int info;
+    zlauum_(&uploC, &n, A, &lda, &info);
 }
 
-// larf
+// lange
+template <>
+void cblas_lange(rocblas_norm_type norm_type,
+                 rocblas_int m,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 float* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    float work[m];
+    *norm = slange_(&normC, &m, &n, A, &lda, work);
+}
 
 template <>
-void cblas_larf<float>(rocblas_side sideR,
-                       rocblas_int m,
-                       rocblas_int n,
-                       float* x,
-                       rocblas_int incx,
-                       float* alpha,
-                       float* A,
-                       rocblas_int lda,
-                       float* work)
+void cblas_lange(rocblas_norm_type norm_type,
+                 rocblas_int m,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 double* norm)
 {
-    char side = rocblas2char_side(sideR);
-    slarf_(&side, &m, &n, x, &incx, alpha, A, &lda, work);
+    char normC = rocblas2char_norm(norm_type);
+    double work[m];
+    *norm = dlange_(&normC, &m, &n, A, &lda, work);
 }
 
 template <>
-void cblas_larf<double>(rocblas_side sideR,
-                        rocblas_int m,
+void cblas_lange(rocblas_norm_type norm_type,
+                 rocblas_int m,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 float* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    float work[m];
+    *norm = clange_(&normC, &m, &n, A, &lda, work);
+}
+
+template <>
+void cblas_lange(rocblas_norm_type norm_type,
+                 rocblas_int m,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 double* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    double work[m];
+    *norm = zlange_(&normC, &m, &n, A, &lda, work);
+}
+
+// lansy & lanhe
+template <>
+void cblas_lansy_lanhe(rocblas_norm_type norm_type,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       float* A,
+                       rocblas_int lda,
+                       float* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    float work[n];
+    *norm = slansy_(&normC, &uploC, &n, A, &lda, work);
+}
+
+template <>
+void cblas_lansy_lanhe(rocblas_norm_type norm_type,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       double* A,
+                       rocblas_int lda,
+                       double* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    double work[n];
+    *norm = dlansy_(&normC, &uploC, &n, A, &lda, work);
+}
+
+template <>
+void cblas_lansy_lanhe(rocblas_norm_type norm_type,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_float_complex* A,
+                       rocblas_int lda,
+                       float* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    float work[n];
+    *norm = clanhe_(&normC, &uploC, &n, A, &lda, work);
+}
+
+template <>
+void cblas_lansy_lanhe(rocblas_norm_type norm_type,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_double_complex* A,
+                       rocblas_int lda,
+                       double* norm)
+{
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    double work[n];
+    *norm = zlanhe_(&normC, &uploC, &n, A, &lda, work);
+}
+
+// larfg
+
+template <>
+void cblas_larfg<float>(rocblas_int n, float* alpha, float* x, rocblas_int incx, float* tau)
+{
+    slarfg_(&n, alpha, x, &incx, tau);
+}
+
+template <>
+void cblas_larfg<double>(rocblas_int n, double* alpha, double* x, rocblas_int incx, double* tau)
+{
+    dlarfg_(&n, alpha, x, &incx, tau);
+}
+
+template <>
+void cblas_larfg<rocblas_float_complex>(rocblas_int n,
+                                        rocblas_float_complex* alpha,
+                                        rocblas_float_complex* x,
+                                        rocblas_int incx,
+                                        rocblas_float_complex* tau)
+{
+    clarfg_(&n, alpha, x, &incx, tau);
+}
+
+template <>
+void cblas_larfg<rocblas_double_complex>(rocblas_int n,
+                                         rocblas_double_complex* alpha,
+                                         rocblas_double_complex* x,
+                                         rocblas_int incx,
+                                         rocblas_double_complex* tau)
+{
+    zlarfg_(&n, alpha, x, &incx, tau);
+}
+
+// larf
+
+template <>
+void cblas_larf<float>(rocblas_side sideR,
+                       rocblas_int m,
+                       rocblas_int n,
+                       float* x,
+                       rocblas_int incx,
+                       float* alpha,
+                       float* A,
+                       rocblas_int lda,
+                       float* work)
+{
+    char side = rocblas2char_side(sideR);
+    slarf_(&side, &m, &n, x, &incx, alpha, A, &lda, work);
+}
+
+template <>
+void cblas_larf<double>(rocblas_side sideR,
+                        rocblas_int m,
                         rocblas_int n,
                         double* x,
                         rocblas_int incx,
@@ -2048,6 +3005,45 @@ void cblas_bdsqr(rocblas_fill uplo,
     zbdsqr_(&uploC, &n, &nv, &nu, &nc, D, E, V, &ldv, U, &ldu, C, &ldc, work, info);
 }
 
+// bdsdc
+template <>
+void cblas_bdsdc(rocblas_fill uplo,
+                 rocblas_svect svect,
+                 rocblas_int n,
+                 float* D,
+                 float* E,
+                 float* U,
+                 rocblas_int ldu,
+                 float* V,
+                 rocblas_int ldv,
+                 float* work,
+                 rocblas_int* iwork,
+                 rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    char compq = (svect == rocblas_svect_none) ? 'N' : 'I';
+    sbdsdc_(&uploC, &compq, &n, D, E, U, &ldu, V, &ldv, nullptr, nullptr, work, iwork, info);
+}
+
+template <>
+void cblas_bdsdc(rocblas_fill uplo,
+                 rocblas_svect svect,
+                 rocblas_int n,
+                 double* D,
+                 double* E,
+                 double* U,
+                 rocblas_int ldu,
+                 double* V,
+                 rocblas_int ldv,
+                 double* work,
+                 rocblas_int* iwork,
+                 rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    char compq = (svect == rocblas_svect_none) ? 'N' : 'I';
+    dbdsdc_(&uploC, &compq, &n, D, E, U, &ldu, V, &ldv, nullptr, nullptr, work, iwork, info);
+}
+
 // gesvd
 template <>
 void cblas_gesvd(rocblas_svect leftv,
@@ -2137,6 +3133,91 @@ void cblas_gesvd(rocblas_svect leftv,
     zgesvd_(&jobu, &jobv, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, E, info);
 }
 
+// gesdd
+template <>
+void cblas_gesdd(rocblas_svect svect,
+                 rocblas_int m,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 float* S,
+                 float* U,
+                 rocblas_int ldu,
+                 float* V,
+                 rocblas_int ldv,
+                 float* work,
+                 rocblas_int lwork,
+                 float* rwork,
+                 rocblas_int* iwork,
+                 rocblas_int* info)
+{
+    char jobz = rocblas2char_svect(svect);
+    sgesdd_(&jobz, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, iwork, info);
+}
+
+template <>
+void cblas_gesdd(rocblas_svect svect,
+                 rocblas_int m,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 double* S,
+                 double* U,
+                 rocblas_int ldu,
+                 double* V,
+                 rocblas_int ldv,
+                 double* work,
+                 rocblas_int lwork,
+                 double* rwork,
+                 rocblas_int* iwork,
+                 rocblas_int* info)
+{
+    char jobz = rocblas2char_svect(svect);
+    dgesdd_(&jobz, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, iwork, info);
+}
+
+template <>
+void cblas_gesdd(rocblas_svect svect,
+                 rocblas_int m,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 float* S,
+                 rocblas_float_complex* U,
+                 rocblas_int ldu,
+                 rocblas_float_complex* V,
+                 rocblas_int ldv,
+                 rocblas_float_complex* work,
+                 rocblas_int lwork,
+                 float* rwork,
+                 rocblas_int* iwork,
+                 rocblas_int* info)
+{
+    char jobz = rocblas2char_svect(svect);
+    cgesdd_(&jobz, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, rwork, iwork, info);
+}
+
+template <>
+void cblas_gesdd(rocblas_svect svect,
+                 rocblas_int m,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 double* S,
+                 rocblas_double_complex* U,
+                 rocblas_int ldu,
+                 rocblas_double_complex* V,
+                 rocblas_int ldv,
+                 rocblas_double_complex* work,
+                 rocblas_int lwork,
+                 double* rwork,
+                 rocblas_int* iwork,
+                 rocblas_int* info)
+{
+    char jobz = rocblas2char_svect(svect);
+    zgesdd_(&jobz, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work, &lwork, rwork, iwork, info);
+}
+
 // latrd
 template <>
 void cblas_latrd<float, float>(rocblas_fill uplo,
@@ -4032,406 +5113,1106 @@ void cblas_trsm<double>(rocblas_side side, rocblas_fill uplo,
 }
 
 template <>
-void cblas_trsm<rocblas_float_complex>(
-    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
-    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-    rocblas_float_complex alpha, const rocblas_float_complex *A,
-    rocblas_int lda, rocblas_float_complex *B, rocblas_int ldb) {
-  // just directly cast, since transA, transB are integers in the enum
-  cblas_ctrsm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
-              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
-              B, ldb);
+void cblas_trsm<rocblas_float_complex>(
+    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
+    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+    rocblas_float_complex alpha, const rocblas_float_complex *A,
+    rocblas_int lda, rocblas_float_complex *B, rocblas_int ldb) {
+  // just directly cast, since transA, transB are integers in the enum
+  cblas_ctrsm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
+              B, ldb);
+}
+
+template <>
+void cblas_trsm<rocblas_double_complex>(
+    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
+    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+    rocblas_double_complex alpha, const rocblas_double_complex *A,
+    rocblas_int lda, rocblas_double_complex *B, rocblas_int ldb) {
+  // just directly cast, since transA, transB are integers in the enum
+  cblas_ztrsm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
+              B, ldb);
+}
+*/
+
+// potf2
+template <>
+void cblas_potf2(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda, rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    spotf2_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potf2(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda, rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dpotf2_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    cpotf2_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zpotf2_(&uploC, &n, A, &lda, info);
+}
+
+// potrf
+template <>
+void cblas_potrf(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda, rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    spotrf_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potrf(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda, rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dpotrf_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    cpotrf_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zpotrf_(&uploC, &n, A, &lda, info);
+}
+
+// pstrf
+template <>
+void cblas_pstrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 rocblas_int* piv,
+                 rocblas_int* rank,
+                 float tol,
+                 float* work,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    spstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
+}
+
+template <>
+void cblas_pstrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 rocblas_int* piv,
+                 rocblas_int* rank,
+                 double tol,
+                 double* work,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dpstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
+}
+
+template <>
+void cblas_pstrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* piv,
+                 rocblas_int* rank,
+                 float tol,
+                 float* work,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    cpstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
+}
+
+template <>
+void cblas_pstrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* piv,
+                 rocblas_int* rank,
+                 double tol,
+                 double* work,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zpstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
+}
+
+// sytf2
+template <>
+void cblas_sytf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    ssytf2_(&uploC, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_sytf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dsytf2_(&uploC, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_sytf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    csytf2_(&uploC, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_sytf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zsytf2_(&uploC, &n, A, &lda, ipiv, info);
+}
+
+// hetf2
+template <>
+void cblas_hetf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    chetf2_(&uploC, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_hetf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zhetf2_(&uploC, &n, A, &lda, ipiv, info);
+}
+
+// sytrf
+template <>
+void cblas_sytrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 float* work,
+                 rocblas_int lwork,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    ssytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 double* work,
+                 rocblas_int lwork,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_float_complex* work,
+                 rocblas_int lwork,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    csytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_double_complex* work,
+                 rocblas_int lwork,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+// hetrf
+template <>
+void cblas_hetrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_float_complex* work,
+                 rocblas_int lwork,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    chetrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_hetrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_double_complex* work,
+                 rocblas_int lwork,
+                 rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zhetrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+// getf2
+template <>
+void cblas_getf2(rocblas_int m,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    sgetf2_(&m, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_getf2(rocblas_int m,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    dgetf2_(&m, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_getf2(rocblas_int m,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    cgetf2_(&m, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_getf2(rocblas_int m,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info)
+{
+    zgetf2_(&m, &n, A, &lda, ipiv, info);
+}
+
+/*
+// trtri
+template <>
+rocblas_int cblas_trtri<float>(rocblas_fill uplo, rocblas_diagonal diag,
+rocblas_int n, float *A, rocblas_int lda) { rocblas_int info; char uploC =
+rocblas2char_fill(uplo); char diagC = rocblas2char_diagonal(diag);
+  strtri_(&uploC, &diagC, &n, A, &lda, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_trtri<double>(rocblas_fill uplo, rocblas_diagonal diag,
+rocblas_int n, double *A, rocblas_int lda) { rocblas_int info; char uploC =
+rocblas2char_fill(uplo); char diagC = rocblas2char_diagonal(diag);
+  dtrtri_(&uploC, &diagC, &n, A, &lda, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_trtri<rocblas_float_complex>(rocblas_fill uplo,
+rocblas_diagonal diag, rocblas_int n, rocblas_float_complex *A, rocblas_int lda)
+{ rocblas_int info; char uploC = rocblas2char_fill(uplo); char diagC =
+rocblas2char_diagonal(diag); ctrtri_(&uploC, &diagC, &n, A, &lda, &info); return
+info;
+}
+
+template <>
+rocblas_int cblas_trtri<rocblas_double_complex>(rocblas_fill uplo,
+rocblas_diagonal diag, rocblas_int n, rocblas_double_complex *A, rocblas_int
+lda) { rocblas_int info; char uploC = rocblas2char_fill(uplo); char diagC =
+rocblas2char_diagonal(diag); ztrtri_(&uploC, &diagC, &n, A, &lda, &info); return
+info;
+}
+
+// trmm
+template <>
+void cblas_trmm<float>(rocblas_side side, rocblas_fill uplo,
+                       rocblas_operation transA, rocblas_diagonal diag,
+                       rocblas_int m, rocblas_int n, float alpha,
+                       const float *A, rocblas_int lda, float *B,
+                       rocblas_int ldb) {
+  // just directly cast, since transA, transB are integers in the enum
+  cblas_strmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, alpha, A, lda, B,
+              ldb);
+}
+
+template <>
+void cblas_trmm<double>(rocblas_side side, rocblas_fill uplo,
+                        rocblas_operation transA, rocblas_diagonal diag,
+                        rocblas_int m, rocblas_int n, double alpha,
+                        const double *A, rocblas_int lda, double *B,
+                        rocblas_int ldb) {
+  // just directly cast, since transA, transB are integers in the enum
+  cblas_dtrmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, alpha, A, lda, B,
+              ldb);
+}
+
+template <>
+void cblas_trmm<rocblas_float_complex>(
+    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
+    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+    rocblas_float_complex alpha, const rocblas_float_complex *A,
+    rocblas_int lda, rocblas_float_complex *B, rocblas_int ldb) {
+  // just directly cast, since transA, transB are integers in the enum
+  cblas_ctrmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
+              B, ldb);
+}
+
+template <>
+void cblas_trmm<rocblas_double_complex>(
+    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
+    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+    rocblas_double_complex alpha, const rocblas_double_complex *A,
+    rocblas_int lda, rocblas_double_complex *B, rocblas_int ldb) {
+  // just directly cast, since transA, transB are integers in the enum
+  cblas_ztrmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
+              B, ldb);
+}
+*/
+
+// getrf
+template <>
+void cblas_getrf<float>(rocblas_int m,
+                        rocblas_int n,
+                        float* A,
+                        rocblas_int lda,
+                        rocblas_int* ipiv,
+                        rocblas_int* info)
+{
+    sgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_getrf<double>(rocblas_int m,
+                         rocblas_int n,
+                         double* A,
+                         rocblas_int lda,
+                         rocblas_int* ipiv,
+                         rocblas_int* info)
+{
+    dgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_getrf<rocblas_float_complex>(rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_float_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_int* ipiv,
+                                        rocblas_int* info)
+{
+    cgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+template <>
+void cblas_getrf<rocblas_double_complex>(rocblas_int m,
+                                         rocblas_int n,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_int* ipiv,
+                                         rocblas_int* info)
+{
+    zgetrf_(&m, &n, A, &lda, ipiv, info);
+}
+
+// getrs
+template <>
+void cblas_getrs<float>(rocblas_operation trans,
+                        rocblas_int n,
+                        rocblas_int nrhs,
+                        float* A,
+                        rocblas_int lda,
+                        rocblas_int* ipiv,
+                        float* B,
+                        rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    sgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_getrs<double>(rocblas_operation trans,
+                         rocblas_int n,
+                         rocblas_int nrhs,
+                         double* A,
+                         rocblas_int lda,
+                         rocblas_int* ipiv,
+                         double* B,
+                         rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    dgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_getrs<rocblas_float_complex>(rocblas_operation trans,
+                                        rocblas_int n,
+                                        rocblas_int nrhs,
+                                        rocblas_float_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_int* ipiv,
+                                        rocblas_float_complex* B,
+                                        rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    cgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_getrs<rocblas_double_complex>(rocblas_operation trans,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_int* ipiv,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+// sytrs
+template <>
+void cblas_sytrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 float* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 float* B,
+                 rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    ssytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 double* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 double* B,
+                 rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_float_complex* B,
+                 rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    csytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_double_complex* B,
+                 rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+// hetrs
+template <>
+void cblas_hetrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_float_complex* B,
+                 rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    chetrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_hetrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_double_complex* B,
+                 rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zhetrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+// sysv
+template <>
+void cblas_sysv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                float* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                float* B,
+                rocblas_int ldb,
+                float* work,
+                rocblas_int lwork,
+                rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    ssysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_sysv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                double* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                double* B,
+                rocblas_int ldb,
+                double* work,
+                rocblas_int lwork,
+                rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    dsysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_sysv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                rocblas_float_complex* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                rocblas_float_complex* B,
+                rocblas_int ldb,
+                rocblas_float_complex* work,
+                rocblas_int lwork,
+                rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    csysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_sysv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                rocblas_double_complex* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                rocblas_double_complex* B,
+                rocblas_int ldb,
+                rocblas_double_complex* work,
+                rocblas_int lwork,
+                rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zsysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+// hesv
+template <>
+void cblas_hesv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                rocblas_float_complex* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                rocblas_float_complex* B,
+                rocblas_int ldb,
+                rocblas_float_complex* work,
+                rocblas_int lwork,
+                rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    chesv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_hesv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                rocblas_double_complex* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                rocblas_double_complex* B,
+                rocblas_int ldb,
+                rocblas_double_complex* work,
+                rocblas_int lwork,
+                rocblas_int* info)
+{
+    char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+    zhesv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+// gels
+template <>
+void cblas_gels<float>(rocblas_operation transR,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int nrhs,
+                       float* A,
+                       rocblas_int lda,
+                       float* B,
+                       rocblas_int ldb,
+                       float* work,
+                       rocblas_int lwork,
+                       rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<double>(rocblas_operation transR,
+                        rocblas_int m,
+                        rocblas_int n,
+                        rocblas_int nrhs,
+                        double* A,
+                        rocblas_int lda,
+                        double* B,
+                        rocblas_int ldb,
+                        double* work,
+                        rocblas_int lwork,
+                        rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<rocblas_float_complex>(rocblas_operation transR,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int nrhs,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_float_complex* B,
+                                       rocblas_int ldb,
+                                       rocblas_float_complex* work,
+                                       rocblas_int lwork,
+                                       rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
 }
 
 template <>
-void cblas_trsm<rocblas_double_complex>(
-    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
-    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-    rocblas_double_complex alpha, const rocblas_double_complex *A,
-    rocblas_int lda, rocblas_double_complex *B, rocblas_int ldb) {
-  // just directly cast, since transA, transB are integers in the enum
-  cblas_ztrsm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
-              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
-              B, ldb);
+void cblas_gels<rocblas_double_complex>(rocblas_operation transR,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int nrhs,
+                                        rocblas_double_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_double_complex* B,
+                                        rocblas_int ldb,
+                                        rocblas_double_complex* work,
+                                        rocblas_int lwork,
+                                        rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
 }
-*/
 
-// potf2
+// trtri
 template <>
-void cblas_potf2(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda, rocblas_int* info)
+void cblas_trtri(rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    spotf2_(&uploC, &n, A, &lda, info);
+    char diagC = (diag == rocblas_diagonal_unit) ? 'U' : 'N';
+    strtri_(&uploC, &diagC, &n, A, &lda, info);
 }
 
 template <>
-void cblas_potf2(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda, rocblas_int* info)
+void cblas_trtri(rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    dpotf2_(&uploC, &n, A, &lda, info);
+    char diagC = (diag == rocblas_diagonal_unit) ? 'U' : 'N';
+    dtrtri_(&uploC, &diagC, &n, A, &lda, info);
 }
 
 template <>
-void cblas_potf2(rocblas_fill uplo,
+void cblas_trtri(rocblas_fill uplo,
+                 rocblas_diagonal diag,
                  rocblas_int n,
                  rocblas_float_complex* A,
                  rocblas_int lda,
                  rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    cpotf2_(&uploC, &n, A, &lda, info);
+    char diagC = (diag == rocblas_diagonal_unit) ? 'U' : 'N';
+    ctrtri_(&uploC, &diagC, &n, A, &lda, info);
 }
 
 template <>
-void cblas_potf2(rocblas_fill uplo,
+void cblas_trtri(rocblas_fill uplo,
+                 rocblas_diagonal diag,
                  rocblas_int n,
                  rocblas_double_complex* A,
                  rocblas_int lda,
                  rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    zpotf2_(&uploC, &n, A, &lda, info);
+    char diagC = (diag == rocblas_diagonal_unit) ? 'U' : 'N';
+    ztrtri_(&uploC, &diagC, &n, A, &lda, info);
 }
 
-// potrf
+// potri
 template <>
-void cblas_potrf(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda, rocblas_int* info)
+void cblas_potri(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda, rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    spotrf_(&uploC, &n, A, &lda, info);
+    spotri_(&uploC, &n, A, &lda, info);
 }
 
 template <>
-void cblas_potrf(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda, rocblas_int* info)
+void cblas_potri(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda, rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    dpotrf_(&uploC, &n, A, &lda, info);
+    dpotri_(&uploC, &n, A, &lda, info);
 }
 
 template <>
-void cblas_potrf(rocblas_fill uplo,
+void cblas_potri(rocblas_fill uplo,
                  rocblas_int n,
                  rocblas_float_complex* A,
                  rocblas_int lda,
                  rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    cpotrf_(&uploC, &n, A, &lda, info);
+    cpotri_(&uploC, &n, A, &lda, info);
 }
 
 template <>
-void cblas_potrf(rocblas_fill uplo,
+void cblas_potri(rocblas_fill uplo,
                  rocblas_int n,
                  rocblas_double_complex* A,
                  rocblas_int lda,
                  rocblas_int* info)
 {
     char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
-    zpotrf_(&uploC, &n, A, &lda, info);
+    zpotri_(&uploC, &n, A, &lda, info);
 }
 
-// getf2
+// gecon
 template <>
-void cblas_getf2(rocblas_int m,
+void cblas_gecon(rocblas_norm_type norm_type,
                  rocblas_int n,
                  float* A,
                  rocblas_int lda,
-                 rocblas_int* ipiv,
-                 rocblas_int* info)
+                 float anorm,
+                 float* rcond)
 {
-    sgetf2_(&m, &n, A, &lda, ipiv, info);
+    char normC = rocblas2char_norm(norm_type);
+    float work[4 * n];
+    int iwork[n];
+    int info;
+    sgecon_(&normC, &n, A, &lda, &anorm, rcond, work, iwork, &info);
 }
 
 template <>
-void cblas_getf2(rocblas_int m,
+void cblas_gecon(rocblas_norm_type norm_type,
                  rocblas_int n,
                  double* A,
                  rocblas_int lda,
-                 rocblas_int* ipiv,
-                 rocblas_int* info)
+                 double anorm,
+                 double* rcond)
 {
-    dgetf2_(&m, &n, A, &lda, ipiv, info);
+    char normC = rocblas2char_norm(norm_type);
+    double work[4 * n];
+    int iwork[n];
+    int info;
+    dgecon_(&normC, &n, A, &lda, &anorm, rcond, work, iwork, &info);
 }
 
 template <>
-void cblas_getf2(rocblas_int m,
+void cblas_gecon(rocblas_norm_type norm_type,
                  rocblas_int n,
                  rocblas_float_complex* A,
                  rocblas_int lda,
-                 rocblas_int* ipiv,
-                 rocblas_int* info)
+                 float anorm,
+                 float* rcond)
 {
-    cgetf2_(&m, &n, A, &lda, ipiv, info);
+    char normC = rocblas2char_norm(norm_type);
+    rocblas_float_complex work[2 * n];
+    float rwork[2 * n];
+    int info;
+    cgecon_(&normC, &n, A, &lda, &anorm, rcond, work, rwork, &info);
 }
 
 template <>
-void cblas_getf2(rocblas_int m,
+void cblas_gecon(rocblas_norm_type norm_type,
                  rocblas_int n,
                  rocblas_double_complex* A,
                  rocblas_int lda,
-                 rocblas_int* ipiv,
-                 rocblas_int* info)
-{
-    zgetf2_(&m, &n, A, &lda, ipiv, info);
-}
-
-/*
-// trtri
-template <>
-rocblas_int cblas_trtri<float>(rocblas_fill uplo, rocblas_diagonal diag,
-rocblas_int n, float *A, rocblas_int lda) { rocblas_int info; char uploC =
-rocblas2char_fill(uplo); char diagC = rocblas2char_diagonal(diag);
-  strtri_(&uploC, &diagC, &n, A, &lda, &info);
-  return info;
-}
-
-template <>
-rocblas_int cblas_trtri<double>(rocblas_fill uplo, rocblas_diagonal diag,
-rocblas_int n, double *A, rocblas_int lda) { rocblas_int info; char uploC =
-rocblas2char_fill(uplo); char diagC = rocblas2char_diagonal(diag);
-  dtrtri_(&uploC, &diagC, &n, A, &lda, &info);
-  return info;
-}
-
-template <>
-rocblas_int cblas_trtri<rocblas_float_complex>(rocblas_fill uplo,
-rocblas_diagonal diag, rocblas_int n, rocblas_float_complex *A, rocblas_int lda)
-{ rocblas_int info; char uploC = rocblas2char_fill(uplo); char diagC =
-rocblas2char_diagonal(diag); ctrtri_(&uploC, &diagC, &n, A, &lda, &info); return
-info;
-}
-
-template <>
-rocblas_int cblas_trtri<rocblas_double_complex>(rocblas_fill uplo,
-rocblas_diagonal diag, rocblas_int n, rocblas_double_complex *A, rocblas_int
-lda) { rocblas_int info; char uploC = rocblas2char_fill(uplo); char diagC =
-rocblas2char_diagonal(diag); ztrtri_(&uploC, &diagC, &n, A, &lda, &info); return
-info;
-}
-
-// trmm
-template <>
-void cblas_trmm<float>(rocblas_side side, rocblas_fill uplo,
-                       rocblas_operation transA, rocblas_diagonal diag,
-                       rocblas_int m, rocblas_int n, float alpha,
-                       const float *A, rocblas_int lda, float *B,
-                       rocblas_int ldb) {
-  // just directly cast, since transA, transB are integers in the enum
-  cblas_strmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
-              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, alpha, A, lda, B,
-              ldb);
-}
-
-template <>
-void cblas_trmm<double>(rocblas_side side, rocblas_fill uplo,
-                        rocblas_operation transA, rocblas_diagonal diag,
-                        rocblas_int m, rocblas_int n, double alpha,
-                        const double *A, rocblas_int lda, double *B,
-                        rocblas_int ldb) {
-  // just directly cast, since transA, transB are integers in the enum
-  cblas_dtrmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
-              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, alpha, A, lda, B,
-              ldb);
-}
-
-template <>
-void cblas_trmm<rocblas_float_complex>(
-    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
-    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-    rocblas_float_complex alpha, const rocblas_float_complex *A,
-    rocblas_int lda, rocblas_float_complex *B, rocblas_int ldb) {
-  // just directly cast, since transA, transB are integers in the enum
-  cblas_ctrmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
-              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
-              B, ldb);
-}
-
-template <>
-void cblas_trmm<rocblas_double_complex>(
-    rocblas_side side, rocblas_fill uplo, rocblas_operation transA,
-    rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-    rocblas_double_complex alpha, const rocblas_double_complex *A,
-    rocblas_int lda, rocblas_double_complex *B, rocblas_int ldb) {
-  // just directly cast, since transA, transB are integers in the enum
-  cblas_ztrmm(CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
-              (CBLAS_TRANSPOSE)transA, (CBLAS_DIAG)diag, m, n, &alpha, A, lda,
-              B, ldb);
-}
-*/
-
-// getrf
-template <>
-void cblas_getrf<float>(rocblas_int m,
-                        rocblas_int n,
-                        float* A,
-                        rocblas_int lda,
-                        rocblas_int* ipiv,
-                        rocblas_int* info)
-{
-    sgetrf_(&m, &n, A, &lda, ipiv, info);
-}
-
-template <>
-void cblas_getrf<double>(rocblas_int m,
-                         rocblas_int n,
-                         double* A,
-                         rocblas_int lda,
-                         rocblas_int* ipiv,
-                         rocblas_int* info)
-{
-    dgetrf_(&m, &n, A, &lda, ipiv, info);
-}
-
-template <>
-void cblas_getrf<rocblas_float_complex>(rocblas_int m,
-                                        rocblas_int n,
-                                        rocblas_float_complex* A,
-                                        rocblas_int lda,
-                                        rocblas_int* ipiv,
-                                        rocblas_int* info)
-{
-    cgetrf_(&m, &n, A, &lda, ipiv, info);
-}
-
-template <>
-void cblas_getrf<rocblas_double_complex>(rocblas_int m,
-                                         rocblas_int n,
-                                         rocblas_double_complex* A,
-                                         rocblas_int lda,
-                                         rocblas_int* ipiv,
-                                         rocblas_int* info)
+                 double anorm,
+                 double* rcond)
 {
-    zgetrf_(&m, &n, A, &lda, ipiv, info);
+    char normC = rocblas2char_norm(norm_type);
+    rocblas_double_complex work[2 * n];
+    double rwork[2 * n];
+    int info;
+    zgecon_(&normC, &n, A, &lda, &anorm, rcond, work, rwork, &info);
 }
 
-// getrs
+// pocon
 template <>
-void cblas_getrs<float>(rocblas_operation trans,
-                        rocblas_int n,
-                        rocblas_int nrhs,
-                        float* A,
-                        rocblas_int lda,
-                        rocblas_int* ipiv,
-                        float* B,
-                        rocblas_int ldb)
+void cblas_pocon(rocblas_fill uplo,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 float anorm,
+                 float* rcond)
 {
-    rocblas_int info;
-    char transC = rocblas2char_operation(trans);
-    sgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+    char uploC = rocblas2char_fill(uplo);
+    float work[3 * n];
+    int iwork[n];
+    int info;
+    spocon_(&uploC, &n, A, &lda, &anorm, rcond, work, iwork, &info);
 }
 
 template <>
-void cblas_getrs<double>(rocblas_operation trans,
-                         rocblas_int n,
-                         rocblas_int nrhs,
-                         double* A,
-                         rocblas_int lda,
-                         rocblas_int* ipiv,
-                         double* B,
-                         rocblas_int ldb)
+void cblas_pocon(rocblas_fill uplo,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 double anorm,
+                 double* rcond)
 {
-    rocblas_int info;
-    char transC = rocblas2char_operation(trans);
-    dgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+    char uploC = rocblas2char_fill(uplo);
+    double work[3 * n];
+    int iwork[n];
+    int info;
+    dpocon_(&uploC, &n, A, &lda, &anorm, rcond, work, iwork, &info);
 }
 
 template <>
-void cblas_getrs<rocblas_float_complex>(rocblas_operation trans,
-                                        rocblas_int n,
-                                        rocblas_int nrhs,
-                                        rocblas_float_complex* A,
-                                        rocblas_int lda,
-                                        rocblas_int* ipiv,
-                                        rocblas_float_complex* B,
-                                        rocblas_int ldb)
+void cblas_pocon(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 float anorm,
+                 float* rcond)
 {
-    rocblas_int info;
-    char transC = rocblas2char_operation(trans);
-    cgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+    char uploC = rocblas2char_fill(uplo);
+    rocblas_float_complex work[2 * n];
+    float rwork[n];
+    int info;
+    cpocon_(&uploC, &n, A, &lda, &anorm, rcond, work, rwork, &info);
 }
 
 template <>
-void cblas_getrs<rocblas_double_complex>(rocblas_operation trans,
-                                         rocblas_int n,
-                                         rocblas_int nrhs,
-                                         rocblas_double_complex* A,
-                                         rocblas_int lda,
-                                         rocblas_int* ipiv,
-                                         rocblas_double_complex* B,
-                                         rocblas_int ldb)
+void cblas_pocon(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 double anorm,
+                 double* rcond)
 {
-    rocblas_int info;
-    char transC = rocblas2char_operation(trans);
-    zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+    char uploC = rocblas2char_fill(uplo);
+    rocblas_double_complex work[2 * n];
+    double rwork[n];
+    int info;
+    zpocon_(&uploC, &n, A, &lda, &anorm, rcond, work, rwork, &info);
 }
 
-// gels
+// trcon
 template <>
-void cblas_gels<float>(rocblas_operation transR,
-                       rocblas_int m,
-                       rocblas_int n,
-                       rocblas_int nrhs,
-                       float* A,
-                       rocblas_int lda,
-                       float* B,
-                       rocblas_int ldb,
-                       float* work,
-                       rocblas_int lwork,
-                       rocblas_int* info)
+void cblas_trcon(rocblas_norm_type norm_type,
+                 rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 float* A,
+                 rocblas_int lda,
+                 float* rcond)
 {
-    char trans = rocblas2char_operation(transR);
-    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    float work[3 * n];
+    int iwork[n];
+    int info;
+    strcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, iwork, &info);
 }
 
 template <>
-void cblas_gels<double>(rocblas_operation transR,
-                        rocblas_int m,
-                        rocblas_int n,
-                        rocblas_int nrhs,
-                        double* A,
-                        rocblas_int lda,
-                        double* B,
-                        rocblas_int ldb,
-                        double* work,
-                        rocblas_int lwork,
-                        rocblas_int* info)
+void cblas_trcon(rocblas_norm_type norm_type,
+                 rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 double* A,
+                 rocblas_int lda,
+                 double* rcond)
 {
-    char trans = rocblas2char_operation(transR);
-    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    double work[3 * n];
+    int iwork[n];
+    int info;
+    dtrcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, iwork, &info);
 }
 
 template <>
-void cblas_gels<rocblas_float_complex>(rocblas_operation transR,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_int nrhs,
-                                       rocblas_float_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_float_complex* B,
-                                       rocblas_int ldb,
-                                       rocblas_float_complex* work,
-                                       rocblas_int lwork,
-                                       rocblas_int* info)
+void cblas_trcon(rocblas_norm_type norm_type,
+                 rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 float* rcond)
 {
-    char trans = rocblas2char_operation(transR);
-    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    rocblas_float_complex work[2 * n];
+    float rwork[n];
+    int info;
+    ctrcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, rwork, &info);
 }
 
 template <>
-void cblas_gels<rocblas_double_complex>(rocblas_operation transR,
-                                        rocblas_int m,
-                                        rocblas_int n,
-                                        rocblas_int nrhs,
-                                        rocblas_double_complex* A,
-                                        rocblas_int lda,
-                                        rocblas_double_complex* B,
-                                        rocblas_int ldb,
-                                        rocblas_double_complex* work,
-                                        rocblas_int lwork,
-                                        rocblas_int* info)
+void cblas_trcon(rocblas_norm_type norm_type,
+                 rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 rocblas_double_complex* A,
+                 rocblas_int lda,
+                 double* rcond)
 {
-    char trans = rocblas2char_operation(transR);
-    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    char normC = rocblas2char_norm(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    rocblas_double_complex work[2 * n];
+    double rwork[n];
+    int info;
+    ztrcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, rwork, &info);
 }
 
 // getri
@@ -4536,6 +6317,67 @@ void cblas_geqrf<rocblas_double_complex>(rocblas_int m,
     zgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
 }
 
+// geqp3
+template <>
+void cblas_geqp3<float, float>(rocblas_int m,
+                               rocblas_int n,
+                               float* A,
+                               rocblas_int lda,
+                               rocblas_int* jpvt,
+                               float* ipiv,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork)
+{
+    int info;
+    sgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<double, double>(rocblas_int m,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 rocblas_int* jpvt,
+                                 double* ipiv,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork)
+{
+    int info;
+    dgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<float, rocblas_float_complex>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_int* jpvt,
+                                               rocblas_float_complex* ipiv,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork)
+{
+    int info;
+    cgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
+template <>
+void cblas_geqp3<double, rocblas_double_complex>(rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_int* jpvt,
+                                                 rocblas_double_complex* ipiv,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork)
+{
+    int info;
+    zgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
 // geqr2
 template <>
 void cblas_geqr2<float>(rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* ipiv, float* work)
@@ -5114,80 +6956,283 @@ void cblas_sytd2_hetd2<double, rocblas_double_complex>(rocblas_fill uplo,
                                                        double* E,
                                                        rocblas_double_complex* tau)
 {
-    int info;
-    char uploC = rocblas2char_fill(uplo);
-    zhetd2_(&uploC, &n, A, &lda, D, E, tau, &info);
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    zhetd2_(&uploC, &n, A, &lda, D, E, tau, &info);
+}
+
+// sterf
+template <>
+void cblas_sterf<float>(rocblas_int n, float* D, float* E)
+{
+    int info;
+    ssterf_(&n, D, E, &info);
+}
+
+template <>
+void cblas_sterf<double>(rocblas_int n, double* D, double* E)
+{
+    int info;
+    dsterf_(&n, D, E, &info);
+}
+
+// steqr
+template <>
+void cblas_steqr<float, float>(rocblas_evect compc,
+                               rocblas_int n,
+                               float* D,
+                               float* E,
+                               float* C,
+                               rocblas_int ldc,
+                               float* work)
+{
+    rocblas_int info;
+    char compcC = rocblas2char_evect(compc);
+    ssteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+}
+
+template <>
+void cblas_steqr<double, double>(rocblas_evect compc,
+                                 rocblas_int n,
+                                 double* D,
+                                 double* E,
+                                 double* C,
+                                 rocblas_int ldc,
+                                 double* work)
+{
+    rocblas_int info;
+    char compcC = rocblas2char_evect(compc);
+    dsteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+}
+template <>
+void cblas_steqr<float, rocblas_float_complex>(rocblas_evect compc,
+                                               rocblas_int n,
+                                               float* D,
+                                               float* E,
+                                               rocblas_float_complex* C,
+                                               rocblas_int ldc,
+                                               float* work)
+{
+    rocblas_int info;
+    char compcC = rocblas2char_evect(compc);
+    csteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+}
+
+template <>
+void cblas_steqr<double, rocblas_double_complex>(rocblas_evect compc,
+                                                 rocblas_int n,
+                                                 double* D,
+                                                 double* E,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 double* work)
+{
+    rocblas_int info;
+    char compcC = rocblas2char_evect(compc);
+    zsteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+}
+
+// stedc
+template <>
+void cblas_stedc<float, float>(rocblas_evect evect,
+                               rocblas_int n,
+                               float* D,
+                               float* E,
+                               float* C,
+                               rocblas_int ldc,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork,
+                               rocblas_int lrwork,
+                               rocblas_int* iwork,
+                               rocblas_int liwork,
+                               rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    sstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_stedc<double, double>(rocblas_evect evect,
+                                 rocblas_int n,
+                                 double* D,
+                                 double* E,
+                                 double* C,
+                                 rocblas_int ldc,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork,
+                                 rocblas_int lrwork,
+                                 rocblas_int* iwork,
+                                 rocblas_int liwork,
+                                 rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    dstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_stedc<float, rocblas_float_complex>(rocblas_evect evect,
+                                               rocblas_int n,
+                                               float* D,
+                                               float* E,
+                                               rocblas_float_complex* C,
+                                               rocblas_int ldc,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork,
+                                               rocblas_int lrwork,
+                                               rocblas_int* iwork,
+                                               rocblas_int liwork,
+                                               rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    cstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_stedc<double, rocblas_double_complex>(rocblas_evect evect,
+                                                 rocblas_int n,
+                                                 double* D,
+                                                 double* E,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork,
+                                                 rocblas_int lrwork,
+                                                 rocblas_int* iwork,
+                                                 rocblas_int liwork,
+                                                 rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    zstedc_(&evectC, &n, D, E, C, &ldc, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
 }
 
-// sterf
+// stebz
 template <>
-void cblas_sterf<float>(rocblas_int n, float* D, float* E)
+void cblas_stebz<float>(rocblas_erange erange,
+                        rocblas_eorder eorder,
+                        rocblas_int n,
+                        float vl,
+                        float vu,
+                        rocblas_int il,
+                        rocblas_int iu,
+                        float abstol,
+                        float* D,
+                        float* E,
+                        rocblas_int* nev,
+                        rocblas_int* nsplit,
+                        float* W,
+                        rocblas_int* iblock,
+                        rocblas_int* isplit,
+                        float* work,
+                        rocblas_int* iwork,
+                        rocblas_int* info)
 {
-    int info;
-    ssterf_(&n, D, E, &info);
+    char erangeC = rocblas2char_erange(erange);
+    char eorderC = rocblas2char_eorder(eorder);
+    sstebz_(&erangeC, &eorderC, &n, &vl, &vu, &il, &iu, &abstol, D, E, nev, nsplit, W, iblock,
+            isplit, work, iwork, info);
 }
 
 template <>
-void cblas_sterf<double>(rocblas_int n, double* D, double* E)
+void cblas_stebz<double>(rocblas_erange erange,
+                         rocblas_eorder eorder,
+                         rocblas_int n,
+                         double vl,
+                         double vu,
+                         rocblas_int il,
+                         rocblas_int iu,
+                         double abstol,
+                         double* D,
+                         double* E,
+                         rocblas_int* nev,
+                         rocblas_int* nsplit,
+                         double* W,
+                         rocblas_int* iblock,
+                         rocblas_int* isplit,
+                         double* work,
+                         rocblas_int* iwork,
+                         rocblas_int* info)
 {
-    int info;
-    dsterf_(&n, D, E, &info);
+    char erangeC = rocblas2char_erange(erange);
+    char eorderC = rocblas2char_eorder(eorder);
+    dstebz_(&erangeC, &eorderC, &n, &vl, &vu, &il, &iu, &abstol, D, E, nev, nsplit, W, iblock,
+            isplit, work, iwork, info);
 }
 
-// steqr
+// stein
 template <>
-void cblas_steqr<float, float>(rocblas_evect compc,
-                               rocblas_int n,
+void cblas_stein<float, float>(rocblas_int n,
                                float* D,
                                float* E,
-                               float* C,
-                               rocblas_int ldc,
-                               float* work)
+                               rocblas_int* nev,
+                               float* W,
+                               rocblas_int* iblock,
+                               rocblas_int* isplit,
+                               float* Z,
+                               rocblas_int ldz,
+                               float* work,
+                               rocblas_int* iwork,
+                               rocblas_int* ifail,
+                               rocblas_int* info)
 {
-    rocblas_int info;
-    char compcC = rocblas2char_evect(compc);
-    ssteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+    sstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
 }
 
 template <>
-void cblas_steqr<double, double>(rocblas_evect compc,
-                                 rocblas_int n,
+void cblas_stein<double, double>(rocblas_int n,
                                  double* D,
                                  double* E,
-                                 double* C,
-                                 rocblas_int ldc,
-                                 double* work)
+                                 rocblas_int* nev,
+                                 double* W,
+                                 rocblas_int* iblock,
+                                 rocblas_int* isplit,
+                                 double* Z,
+                                 rocblas_int ldz,
+                                 double* work,
+                                 rocblas_int* iwork,
+                                 rocblas_int* ifail,
+                                 rocblas_int* info)
 {
-    rocblas_int info;
-    char compcC = rocblas2char_evect(compc);
-    dsteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+    dstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
 }
+
 template <>
-void cblas_steqr<float, rocblas_float_complex>(rocblas_evect compc,
-                                               rocblas_int n,
+void cblas_stein<float, rocblas_float_complex>(rocblas_int n,
                                                float* D,
                                                float* E,
-                                               rocblas_float_complex* C,
-                                               rocblas_int ldc,
-                                               float* work)
+                                               rocblas_int* nev,
+                                               float* W,
+                                               rocblas_int* iblock,
+                                               rocblas_int* isplit,
+                                               rocblas_float_complex* Z,
+                                               rocblas_int ldz,
+                                               float* work,
+                                               rocblas_int* iwork,
+                                               rocblas_int* ifail,
+                                               rocblas_int* info)
 {
-    rocblas_int info;
-    char compcC = rocblas2char_evect(compc);
-    csteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+    cstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
 }
 
 template <>
-void cblas_steqr<double, rocblas_double_complex>(rocblas_evect compc,
-                                                 rocblas_int n,
+void cblas_stein<double, rocblas_double_complex>(rocblas_int n,
                                                  double* D,
                                                  double* E,
-                                                 rocblas_double_complex* C,
-                                                 rocblas_int ldc,
-                                                 double* work)
+                                                 rocblas_int* nev,
+                                                 double* W,
+                                                 rocblas_int* iblock,
+                                                 rocblas_int* isplit,
+                                                 rocblas_double_complex* Z,
+                                                 rocblas_int ldz,
+                                                 double* work,
+                                                 rocblas_int* iwork,
+                                                 rocblas_int* ifail,
+                                                 rocblas_int* info)
 {
-    rocblas_int info;
-    char compcC = rocblas2char_evect(compc);
-    zsteqr_(&compcC, &n, D, E, C, &ldc, work, &info);
+    zstein_(&n, D, E, nev, W, iblock, isplit, Z, &ldz, work, iwork, ifail, info);
 }
 
 // sygs2 & hegs2
@@ -5380,6 +7425,210 @@ void cblas_syev_heev<rocblas_double_complex, double>(rocblas_evect evect,
     zheev_(&jobz, &uploC, &n, A, &lda, D, work, &sizeW, E, info);
 }
 
+// syevd & heevd
+template <>
+void cblas_syevd_heevd<float, float>(rocblas_evect evect,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float* D,
+                                     float* work,
+                                     rocblas_int lwork,
+                                     float* rwork,
+                                     rocblas_int lrwork,
+                                     rocblas_int* iwork,
+                                     rocblas_int liwork,
+                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    ssyevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_syevd_heevd<double, double>(rocblas_evect evect,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double* D,
+                                       double* work,
+                                       rocblas_int lwork,
+                                       double* rwork,
+                                       rocblas_int lrwork,
+                                       rocblas_int* iwork,
+                                       rocblas_int liwork,
+                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    dsyevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_syevd_heevd<rocblas_float_complex, float>(rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     float* D,
+                                                     rocblas_float_complex* work,
+                                                     rocblas_int lwork,
+                                                     float* rwork,
+                                                     rocblas_int lrwork,
+                                                     rocblas_int* iwork,
+                                                     rocblas_int liwork,
+                                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    cheevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, rwork, &lrwork, iwork, &liwork,
+            info);
+}
+
+template <>
+void cblas_syevd_heevd<rocblas_double_complex, double>(rocblas_evect evect,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       double* D,
+                                                       rocblas_double_complex* work,
+                                                       rocblas_int lwork,
+                                                       double* rwork,
+                                                       rocblas_int lrwork,
+                                                       rocblas_int* iwork,
+                                                       rocblas_int liwork,
+                                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    zheevd_(&evectC, &uploC, &n, A, &lda, D, work, &lwork, rwork, &lrwork, iwork, &liwork,
+            info);
+}
+
+// syevx & heevx
+template <>
+void cblas_syevx_heevx<float, float>(rocblas_evect evect,
+                                     rocblas_erange erange,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float vl,
+                                     float vu,
+                                     rocblas_int il,
+                                     rocblas_int iu,
+                                     float abstol,
+                                     rocblas_int* nev,
+                                     float* W,
+                                     float* Z,
+                                     rocblas_int ldz,
+                                     float* work,
+                                     rocblas_int lwork,
+                                     float* rwork,
+                                     rocblas_int* iwork,
+                                     rocblas_int* ifail,
+                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    ssyevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_syevx_heevx<double, double>(rocblas_evect evect,
+                                       rocblas_erange erange,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       double abstol,
+                                       rocblas_int* nev,
+                                       double* W,
+                                       double* Z,
+                                       rocblas_int ldz,
+                                       double* work,
+                                       rocblas_int lwork,
+                                       double* rwork,
+                                       rocblas_int* iwork,
+                                       rocblas_int* ifail,
+                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    dsyevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_syevx_heevx<rocblas_float_complex, float>(rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     float abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_float_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_float_complex* work,
+                                                     rocblas_int lwork,
+                                                     float* rwork,
+                                                     rocblas_int* iwork,
+                                                     rocblas_int* ifail,
+                                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    cheevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, rwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_syevx_heevx<rocblas_double_complex, double>(rocblas_evect evect,
+                                                       rocblas_erange erange,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       double vl,
+                                                       double vu,
+                                                       rocblas_int il,
+                                                       rocblas_int iu,
+                                                       double abstol,
+                                                       rocblas_int* nev,
+                                                       double* W,
+                                                       rocblas_double_complex* Z,
+                                                       rocblas_int ldz,
+                                                       rocblas_double_complex* work,
+                                                       rocblas_int lwork,
+                                                       double* rwork,
+                                                       rocblas_int* iwork,
+                                                       rocblas_int* ifail,
+                                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    zheevx_(&evectC, &erangeC, &uploC, &n, A, &lda, &vl, &vu, &il, &iu, &abstol, nev, W, Z, &ldz,
+            work, &lwork, rwork, iwork, ifail, info);
+}
+
 // sygv & hegv
 template <>
 void cblas_sygv_hegv<float, float>(rocblas_eform itype,
@@ -5563,3 +7812,140 @@ void cblas_sygvd_hegvd<double, rocblas_double_complex>(rocblas_eform itype,
     zhegvd_(&itypeI, &jobzC, &uploC, &n, A, &lda, B, &ldb, W, work, &lwork, rwork, &lrwork, iwork,
             &liwork, info);
 }
+
+// sygvx & hegvx
+template <>
+void cblas_sygvx_hegvx<float, float>(rocblas_eform itype,
+                                     rocblas_evect evect,
+                                     rocblas_erange erange,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     float vl,
+                                     float vu,
+                                     rocblas_int il,
+                                     rocblas_int iu,
+                                     float abstol,
+                                     rocblas_int* nev,
+                                     float* W,
+                                     float* Z,
+                                     rocblas_int ldz,
+                                     float* work,
+                                     rocblas_int lwork,
+                                     float* rwork,
+                                     rocblas_int* iwork,
+                                     rocblas_int* ifail,
+                                     rocblas_int* info)
+{
+    int itypeI = rocblas2char_eform(itype) - '0';
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    ssygvx_(&itypeI, &evectC, &erangeC, &uploC, &n, A, &lda, B, &ldb, &vl, &vu, &il, &iu, &abstol,
+            nev, W, Z, &ldz, work, &lwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_sygvx_hegvx<double, double>(rocblas_eform itype,
+                                       rocblas_evect evect,
+                                       rocblas_erange erange,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double* B,
+                                       rocblas_int ldb,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       double abstol,
+                                       rocblas_int* nev,
+                                       double* W,
+                                       double* Z,
+                                       rocblas_int ldz,
+                                       double* work,
+                                       rocblas_int lwork,
+                                       double* rwork,
+                                       rocblas_int* iwork,
+                                       rocblas_int* ifail,
+                                       rocblas_int* info)
+{
+    int itypeI = rocblas2char_eform(itype) - '0';
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    dsygvx_(&itypeI, &evectC, &erangeC, &uploC, &n, A, &lda, B, &ldb, &vl, &vu, &il, &iu, &abstol,
+            nev, W, Z, &ldz, work, &lwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_sygvx_hegvx<float, rocblas_float_complex>(rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     rocblas_float_complex* B,
+                                                     rocblas_int ldb,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     float abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_float_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_float_complex* work,
+                                                     rocblas_int lwork,
+                                                     float* rwork,
+                                                     rocblas_int* iwork,
+                                                     rocblas_int* ifail,
+                                                     rocblas_int* info)
+{
+    int itypeI = rocblas2char_eform(itype) - '0';
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    chegvx_(&itypeI, &evectC, &erangeC, &uploC, &n, A, &lda, B, &ldb, &vl, &vu, &il, &iu, &abstol,
+            nev, W, Z, &ldz, work, &lwork, rwork, iwork, ifail, info);
+}
+
+template <>
+void cblas_sygvx_hegvx<double, rocblas_double_complex>(rocblas_eform itype,
+                                                       rocblas_evect evect,
+                                                       rocblas_erange erange,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       rocblas_double_complex* B,
+                                                       rocblas_int ldb,
+                                                       double vl,
+                                                       double vu,
+                                                       rocblas_int il,
+                                                       rocblas_int iu,
+                                                       double abstol,
+                                                       rocblas_int* nev,
+                                                       double* W,
+                                                       rocblas_double_complex* Z,
+                                                       rocblas_int ldz,
+                                                       rocblas_double_complex* work,
+                                                       rocblas_int lwork,
+                                                       double* rwork,
+                                                       rocblas_int* iwork,
+                                                       rocblas_int* ifail,
+                                                       rocblas_int* info)
+{
+    int itypeI = rocblas2char_eform(itype) - '0';
+    char evectC = rocblas2char_evect(evect);
+    char erangeC = rocblas2char_erange(erange);
+    char uploC = rocblas2char_fill(uplo);
+    zhegvx_(&itypeI, &evectC, &erangeC, &uploC, &n, A, &lda, B, &ldb, &vl, &vu, &il, &iu, &abstol,
+            nev, W, Z, &ldz, work, &lwork, rwork, iwork, ifail, info);
+}
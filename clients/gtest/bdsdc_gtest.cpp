@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_bdsdc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> bdsdc_tuple;
+
+// each size_range is a {n, ldu, ldv, singular}
+// if ldx = -1, then ldx < n (invalid size)
+// if ldx = 0, then ldx = n
+// if ldx = 1, then ldx > n
+// if singular = 1, then the tests are also run with graded matrices and with
+// matrices having a cluster of tiny singular values
+
+// each opt_range is a {uplo, svect}
+// if uplo = 0, then is upper bidiagonal
+// if uplo = 1, then is lower bidiagonal
+// if svect = 0, then svect = 'N'
+// if svect = 1, then svect = 'S'
+
+// case when n = 0, uplo = 'L' and svect = 'N' will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 0, 0, 0},
+    // invalid
+    {-1, 0, 0, 0},
+    {20, -1, 0, 0},
+    {20, 0, -1, 0},
+    // normal (valid) samples
+    {1, 0, 0, 0},
+    {15, 0, 0, 1},
+    {20, 1, 0, 0},
+    {40, 0, 1, 1},
+    {64, 0, 0, 0},
+    {100, 1, 1, 1}};
+
+const vector<vector<int>> opt_range = {{0, 0}, {0, 1}, {1, 0}, {1, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{152, 0, 0, 1}, {640, 1, 0, 0}, {1000, 0, 1, 1}};
+
+const vector<vector<int>> large_opt_range = {{0, 1}, {1, 1}, {0, 0}};
+
+Arguments bdsdc_setup_arguments(bdsdc_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = size[0];
+    arg.uplo_option = opt[0] ? 'L' : 'U';
+    arg.left_svect = opt[1] ? 'S' : 'N';
+
+    // leading dimensions are only restricted when the singular vectors are computed
+    rocblas_int ld = (opt[1] && arg.N > 0) ? arg.N : 1;
+    arg.ldb = ld + size[1] * (opt[1] ? 10 : 0); // ldu
+    arg.ldv = ld + size[2] * (opt[1] ? 10 : 0); // ldv
+
+    arg.timing = 0;
+    arg.singular = size[3];
+
+    return arg;
+}
+
+class BDSDC : public ::TestWithParam<bdsdc_tuple>
+{
+protected:
+    BDSDC() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = bdsdc_setup_arguments(GetParam());
+
+        if(arg.N == 0 && arg.uplo_option == 'L' && arg.left_svect == 'N')
+            testing_bdsdc_bad_arg<T>();
+
+        if(arg.singular == 1)
+        {
+            testing_bdsdc<T>(arg);
+            arg.singular = 2;
+            testing_bdsdc<T>(arg);
+        }
+
+        arg.singular = 0;
+        testing_bdsdc<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(BDSDC, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(BDSDC, __double)
+{
+    run_tests<double>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         BDSDC,
+                         Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, BDSDC, Combine(ValuesIn(size_range), ValuesIn(opt_range)));
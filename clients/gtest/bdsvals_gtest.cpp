@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_bdsvals.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> bdsvals_tuple;
+
+// each size_range vector is a {N}
+
+// case when N == 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0},
+    // invalid
+    {-1},
+    // normal (valid) samples
+    {1},
+    {2},
+    {12},
+    {20},
+    {35}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {{192}, {256}, {300}};
+
+Arguments bdsvals_setup_arguments(bdsvals_tuple tup)
+{
+    Arguments arg;
+
+    arg.N = tup[0];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class BDSVALS : public ::TestWithParam<bdsvals_tuple>
+{
+protected:
+    BDSVALS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = bdsvals_setup_arguments(GetParam());
+
+        if(arg.N == 0)
+            testing_bdsvals_bad_arg<T>();
+
+        testing_bdsvals<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(BDSVALS, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(BDSVALS, __double)
+{
+    run_tests<double>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, BDSVALS, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, BDSVALS, ValuesIn(matrix_size_range));
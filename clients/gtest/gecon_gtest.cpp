@@ -0,0 +1,163 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gecon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> gecon_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// each norm_range is a {norm_type}
+
+// case when n = 0 and norm_type = '1' will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> norm_range = {'1', 'I'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {10, 10, 1},
+    {32, 32, 0},
+    {50, 50, 1},
+    {70, 100, 0},
+    {100, 150, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192, 1}, {500, 600, 1}, {640, 640, 0}, {1000, 1024, 0}};
+
+Arguments gecon_setup_arguments(gecon_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char norm_type = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.norm_type = norm_type;
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N;
+
+    return arg;
+}
+
+class GECON : public ::TestWithParam<gecon_tuple>
+{
+protected:
+    GECON() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gecon_setup_arguments(GetParam());
+
+        if(arg.norm_type == '1' && arg.N == 0)
+            testing_gecon_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gecon<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gecon<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GECON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GECON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GECON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GECON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GECON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GECON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GECON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GECON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GECON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GECON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GECON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GECON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GECON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GECON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(norm_range)));
@@ -48,6 +48,15 @@ const vector<vector<int>> large_matrix_size_range = {
 
 const vector<int> large_n_size_range = {64, 98, 130, 220, 400};
 
+// for daily_lapack tests of the look-ahead variant
+// (min(m, n) >= GExQF_LOOKAHEAD_MINSIZE)
+const vector<vector<int>> lookahead_matrix_size_range = {
+    {1024, 1024},
+    {1536, 1600},
+};
+
+const vector<int> lookahead_n_size_range = {1024, 1300};
+
 Arguments gelqf_setup_arguments(gelqf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -239,3 +248,8 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELQF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack_lookahead,
+                         GELQF,
+                         Combine(ValuesIn(lookahead_matrix_size_range),
+                                 ValuesIn(lookahead_n_size_range)));
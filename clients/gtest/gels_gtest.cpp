@@ -33,25 +33,28 @@ const vector<gels_params_A> matrix_sizeA_range = {
     {1, -1, 1, 1, 0},
     {10, 10, 10, 1, 0},
     {10, 10, 1, 10, 0},
-    // not yet implemented
-    {10, 1, 10, 10, 0},
     // normal (valid) samples
+    {10, 1, 10, 10, 0},
     {20, 20, 20, 20, 1},
     {30, 20, 40, 30, 0},
     {40, 20, 40, 40, 1},
+    {20, 30, 20, 30, 0},
+    {20, 40, 30, 40, 1},
 };
 const vector<gels_params_B> matrix_sizeB_range = {
     // quick return
     {0, 'N'},
     // invalid
     {-1, 'N'},
-    // not yet implemented
+    // normal (valid) samples
+    // ('T' is invalid for complex types and 'C' is invalid for real types)
     {1, 'T'},
     {1, 'C'},
-    // normal (valid) samples
     {10, 'N'},
     {20, 'N'},
     {30, 'N'},
+    {20, 'T'},
+    {20, 'C'},
 };
 
 // for daily_lapack tests
@@ -60,12 +63,16 @@ const vector<gels_params_A> large_matrix_sizeA_range = {
     {150, 150, 150, 150, 1},
     {500, 50, 600, 600, 0},
     {1000, 500, 1000, 1000, 1},
+    {50, 75, 50, 75, 0},
+    {500, 1000, 600, 1000, 1},
 };
 const vector<gels_params_B> large_matrix_sizeB_range = {
     {100, 'N'},
     {200, 'N'},
     {500, 'N'},
     {1000, 'N'},
+    {200, 'T'},
+    {200, 'C'},
 };
 
 Arguments gels_setup_arguments(gels_tuple tup)
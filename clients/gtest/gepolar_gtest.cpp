@@ -0,0 +1,198 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gepolar.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gepolar_tuple;
+
+// each size_range vector is a {m, n, ill_cond};
+// if ill_cond = 1, then the matrix is also tested with graded columns
+// (condition number beyond 1/eps)
+
+// each opt_range vector is a {lda, ldh, svect};
+// if ldx = -1 then ldx < limit (invalid size)
+// if ldx = 0 then ldx = limit
+// if ldx = 1 then ldx > limit
+// if svect = 0 then only the polar decomposition is computed
+// if svect = 1 then the singular value decomposition is also computed
+// if svect = 2 then svect is set to all (invalid value)
+
+// case when m = n = 0 and svect = 0 will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 0, 0},
+    {1, 0, 0},
+    // invalid
+    {-1, 1, 0},
+    {1, -1, 0},
+    {10, 20, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {20, 20, 1},
+    {40, 30, 0},
+    {75, 25, 1},
+    {100, 60, 1}};
+
+const vector<vector<int>> opt_range = {
+    // invalid
+    {-1, 0, 0},
+    {0, -1, 0},
+    {0, 0, 2},
+    // normal (valid) samples
+    {0, 0, 0},
+    {1, 1, 0},
+    {0, 0, 1},
+    {1, 1, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range
+    = {{150, 150, 0}, {300, 200, 1}, {500, 250, 0}, {640, 640, 0}};
+
+const vector<vector<int>> large_opt_range = {{0, 0, 0}, {1, 1, 0}, {0, 0, 1}};
+
+Arguments gepolar_setup_arguments(gepolar_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt = std::get<1>(tup);
+
+    Arguments arg;
+
+    // sizes
+    arg.M = size[0];
+    arg.N = size[1];
+    arg.singular = size[2];
+
+    // leading dimensions
+    arg.lda = arg.M + opt[0] * 10; // lda
+    arg.ldb = max(arg.N, 1) + opt[1] * 10; // ldh
+
+    // vector options
+    if(opt[2] == 1)
+        arg.left_svect = 'S';
+    else if(opt[2] == 2)
+        arg.left_svect = 'A';
+    else
+        arg.left_svect = 'N';
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N; // strideA
+    arg.bsb = arg.ldb * arg.N; // strideH
+    arg.bsc = arg.N; // strideS
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GEPOLAR : public ::TestWithParam<gepolar_tuple>
+{
+protected:
+    GEPOLAR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gepolar_setup_arguments(GetParam());
+
+        if(arg.M == 0 && arg.N == 0 && arg.left_svect == 'N')
+            testing_gepolar_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gepolar<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gepolar<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GEPOLAR, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEPOLAR, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEPOLAR, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEPOLAR, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEPOLAR, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEPOLAR, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEPOLAR, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEPOLAR, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEPOLAR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEPOLAR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEPOLAR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEPOLAR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEPOLAR,
+                         Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEPOLAR,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesdd.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesdd_tuple;
+
+// each size_range vector is a {m, n};
+
+// each opt_range vector is a {lda, ldu, ldv, svect};
+// if ldx = -1 then ldx < limit (invalid size)
+// if ldx = 0 then ldx = limit
+// if ldx = 1 then ldx > limit
+// if svect = 0 then svect = 'O' (not supported)
+// if svect = 1 then compute singular vectors
+// if svect = 2 then compute all orthogonal matrices
+// if svect = 3 then no singular vectors are computed
+
+// case when m = n = 0 and svect = 3 will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 0},
+    {0, 1},
+    {1, 0},
+    // invalid
+    {-1, 1},
+    {1, -1},
+    // normal (valid) samples
+    {1, 1},
+    {3, 2},
+    {2, 3},
+    {20, 20},
+    {40, 30},
+    {60, 30},
+    {30, 40},
+    {30, 60}};
+
+const vector<vector<int>> opt_range = {
+    // invalid
+    {-1, 0, 0, 2},
+    {0, -1, 0, 1},
+    {0, 0, -1, 2},
+    {0, 0, 0, 0},
+    // normal (valid) samples
+    {1, 1, 1, 3},
+    {0, 0, 0, 3},
+    {0, 0, 0, 2},
+    {1, 0, 1, 2},
+    {0, 0, 0, 1},
+    {0, 1, 1, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range
+    = {{120, 100}, {300, 120}, {100, 120}, {120, 300}, {512, 512}};
+
+const vector<vector<int>> large_opt_range = {{0, 0, 0, 3}, {1, 0, 0, 1}, {0, 1, 1, 2}};
+
+Arguments gesdd_setup_arguments(gesdd_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt = std::get<1>(tup);
+
+    Arguments arg;
+
+    // sizes
+    arg.M = size[0];
+    arg.N = size[1];
+
+    // leading dimensions
+    arg.lda = arg.M; // lda
+    arg.ldb = arg.M; // ldu
+    arg.ldv = opt[3] == 2 ? arg.N : min(arg.M, arg.N); // ldv
+    arg.lda += opt[0] * 10;
+    arg.ldb += opt[1] * 10;
+    arg.ldv += opt[2] * 10;
+
+    // vector options
+    if(opt[3] == 0)
+        arg.left_svect = 'O';
+    else if(opt[3] == 1)
+        arg.left_svect = 'S';
+    else if(opt[3] == 2)
+        arg.left_svect = 'A';
+    else
+        arg.left_svect = 'N';
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N; // strideA
+    arg.bsb = min(arg.M, arg.N); // strideS
+    arg.bsc = arg.ldb * arg.M; // strideU
+    arg.bsp = arg.ldv * arg.N; // strideV
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESDD : public ::TestWithParam<gesdd_tuple>
+{
+protected:
+    GESDD() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesdd_setup_arguments(GetParam());
+
+        if(arg.M == 0 && arg.N == 0 && arg.left_svect == 'N')
+            testing_gesdd_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gesdd<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GESDD, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GESDD, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESDD, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GESDD, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GESDD, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GESDD, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GESDD, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GESDD, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GESDD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESDD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESDD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESDD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESDD,
+                         Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GESDD, Combine(ValuesIn(size_range), ValuesIn(opt_range)));
@@ -40,6 +40,10 @@ const vector<vector<int>> size_range = {
     {1, -1, 0},
     // normal (valid) samples
     {1, 1, 0},
+    {2, 2, 0},
+    {3, 2, 0},
+    {2, 3, 0},
+    {3, 3, 0},
     {20, 20, 0},
     {40, 30, 0},
     {60, 30, 0},
@@ -153,6 +157,11 @@ protected:
 
         arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
         testing_gesvd<BATCHED, STRIDED, T>(arg);
+
+        // when only singular values are computed, also disable the dqds iterations
+        // to check the fallback to BDSQR
+        if(arg.M > 0 && arg.N > 0 && arg.left_svect == 'N' && arg.right_svect == 'N')
+            testing_gesvd<BATCHED, STRIDED, T, true>(arg);
     }
 };
 
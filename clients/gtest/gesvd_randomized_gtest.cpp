@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvd_randomized.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesvd_randomized_tuple;
+
+// each size_range vector is a {m, n, k, p, q, decay};
+// k is the number of singular triplets, p the oversampling parameter
+// and q the number of power iterations
+// if decay = 0 then the matrix has rank k + p
+// if decay = 1 then the matrix has full rank and slowly decaying singular values
+
+// each opt_range vector is a {lda, ldu, ldv, leftsv, rightsv};
+// if ldx = -1 then ldx < limit (invalid size)
+// if ldx = 0 then ldx = limit
+// if ldx = 1 then ldx > limit
+// if leftsv (rightsv) = 1 then compute singular vectors
+// if leftsv (rightsv) = 2 then compute all orthogonal matrix (invalid value)
+// if leftsv (rightsv) = 3 then no singular vectors are computed
+
+// case when m = n = 0 and rightsv = leftsv = 3 will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 0, 0, 0, 0, 0},
+    {0, 1, 0, 0, 0, 0},
+    {1, 0, 0, 0, 0, 0},
+    {20, 20, 0, 5, 1, 0},
+    // invalid
+    {-1, 1, 0, 0, 0, 0},
+    {1, -1, 0, 0, 0, 0},
+    {20, 20, -1, 5, 1, 0},
+    {20, 20, 5, -1, 1, 0},
+    {20, 20, 5, 5, -1, 0},
+    {20, 20, 15, 10, 1, 0},
+    // normal (valid) samples
+    {1, 1, 1, 0, 0, 0},
+    {20, 20, 5, 5, 0, 0},
+    {20, 20, 5, 5, 2, 0},
+    {40, 30, 10, 5, 1, 0},
+    {30, 40, 10, 5, 1, 0},
+    {60, 30, 20, 10, 2, 0},
+    {30, 60, 20, 10, 2, 0},
+    // slowly decaying singular values
+    {60, 40, 10, 5, 0, 1},
+    {40, 60, 10, 10, 2, 1}};
+
+const vector<vector<int>> opt_range = {
+    // invalid
+    {-1, 0, 0, 1, 1},
+    {0, -1, 0, 1, 3},
+    {0, 0, -1, 3, 1},
+    {0, 0, 0, 2, 3},
+    {0, 0, 0, 3, 2},
+    // normal (valid) samples
+    {1, 1, 1, 3, 3},
+    {0, 0, 0, 1, 1},
+    {1, 1, 1, 1, 1},
+    {0, 0, 0, 1, 3},
+    {0, 0, 0, 3, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{120, 100, 20, 10, 2, 0},
+                                              {300, 120, 50, 10, 2, 0},
+                                              {120, 300, 50, 10, 2, 0},
+                                              {300, 300, 100, 20, 1, 0},
+                                              {200, 150, 20, 20, 0, 1},
+                                              {200, 150, 20, 20, 1, 1},
+                                              {150, 300, 30, 5, 2, 1}};
+
+const vector<vector<int>> large_opt_range
+    = {{0, 0, 0, 3, 3}, {0, 0, 0, 1, 1}, {1, 1, 1, 1, 3}, {0, 0, 0, 3, 1}};
+
+Arguments gesvd_randomized_setup_arguments(gesvd_randomized_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt = std::get<1>(tup);
+
+    Arguments arg;
+
+    // sizes
+    arg.M = size[0];
+    arg.N = size[1];
+    arg.K = size[2];
+    arg.oversample = size[3];
+    arg.power_iters = size[4];
+    arg.singular = size[5];
+
+    // leading dimensions
+    arg.lda = arg.M; // lda
+    arg.ldb = max(arg.M, 1); // ldu
+    arg.ldv = max(arg.K, 1); // ldv
+    arg.lda += opt[0] * 10;
+    arg.ldb += opt[1] * 10;
+    arg.ldv += opt[2] * 10;
+
+    // vector options
+    if(opt[3] == 1)
+        arg.left_svect = 'S';
+    else if(opt[3] == 2)
+        arg.left_svect = 'A';
+    else
+        arg.left_svect = 'N';
+
+    if(opt[4] == 1)
+        arg.right_svect = 'S';
+    else if(opt[4] == 2)
+        arg.right_svect = 'A';
+    else
+        arg.right_svect = 'N';
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N; // strideA
+    arg.bsb = arg.K; // strideS
+    arg.bsc = arg.ldb * arg.K; // strideU
+    arg.bsp = arg.ldv * arg.N; // strideV
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESVD_RANDOMIZED : public ::TestWithParam<gesvd_randomized_tuple>
+{
+protected:
+    GESVD_RANDOMIZED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesvd_randomized_setup_arguments(GetParam());
+
+        if(arg.M == 0 && arg.N == 0 && arg.left_svect == 'N' && arg.right_svect == 'N')
+            testing_gesvd_randomized_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gesvd_randomized<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GESVD_RANDOMIZED, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GESVD_RANDOMIZED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESVD_RANDOMIZED, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_RANDOMIZED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GESVD_RANDOMIZED, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GESVD_RANDOMIZED, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GESVD_RANDOMIZED, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_RANDOMIZED, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GESVD_RANDOMIZED, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESVD_RANDOMIZED, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESVD_RANDOMIZED, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_RANDOMIZED, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESVD_RANDOMIZED,
+                         Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVD_RANDOMIZED,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
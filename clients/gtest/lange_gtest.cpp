@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lange.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> lange_tuple;
+
+// each matrix_size_range vector is a {m, n, lda}
+
+// each norm_range is a {norm_type}
+
+// case when m = 0 and norm_type = '1' will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> norm_range = {'1', 'I', 'M', 'F'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 10, 1},
+    {10, 0, 10},
+    // invalid
+    {-1, 10, 1},
+    {10, -1, 10},
+    {20, 10, 5},
+    // normal (valid) samples
+    {1, 1, 1},
+    {10, 10, 10},
+    {20, 30, 20},
+    {40, 25, 50},
+    {70, 100, 100},
+    {130, 90, 150}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192, 192}, {640, 300, 700}, {300, 640, 300}, {1000, 1000, 1024}, {2000, 1500, 2000}};
+
+Arguments lange_setup_arguments(lange_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char norm_type = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_size[0];
+    arg.N = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.norm_type = norm_type;
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N;
+
+    return arg;
+}
+
+class LANGE : public ::TestWithParam<lange_tuple>
+{
+protected:
+    LANGE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = lange_setup_arguments(GetParam());
+
+        if(arg.norm_type == '1' && arg.M == 0)
+            testing_lange_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_lange<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(LANGE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(LANGE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(LANGE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(LANGE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(LANGE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(LANGE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(LANGE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(LANGE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(LANGE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(LANGE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(LANGE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(LANGE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LANGE,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LANGE,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(norm_range)));
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lansy_lanhe.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> lansy_lanhe_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+
+// each norm_range is a {norm_type, uplo}
+
+// case when n = 0, norm_type = '1' and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<char>> norm_range = {{'1', 'U'}, {'1', 'L'}, {'I', 'U'}, {'M', 'L'},
+                                         {'F', 'U'}, {'F', 'L'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {1, 1},
+    {10, 10},
+    {32, 32},
+    {50, 50},
+    {70, 100},
+    {100, 150}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192}, {500, 600}, {640, 640}, {1000, 1024}, {2000, 2000}};
+
+Arguments lansy_lanhe_setup_arguments(lansy_lanhe_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<char> norm = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.norm_type = norm[0];
+    arg.uplo_option = norm[1];
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N;
+
+    return arg;
+}
+
+class LANSY_LANHE : public ::TestWithParam<lansy_lanhe_tuple>
+{
+protected:
+    LANSY_LANHE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = lansy_lanhe_setup_arguments(GetParam());
+
+        if(arg.norm_type == '1' && arg.uplo_option == 'U' && arg.N == 0)
+            testing_lansy_lanhe_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_lansy_lanhe<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class LANSY : public LANSY_LANHE
+{
+};
+
+class LANHE : public LANSY_LANHE
+{
+};
+
+// non-batch tests
+
+TEST_P(LANSY, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(LANSY, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(LANHE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(LANHE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(LANSY, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(LANSY, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(LANHE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(LANHE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(LANSY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(LANSY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(LANHE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(LANHE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LANSY,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LANHE,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LANSY,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(norm_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LANHE,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(norm_range)));
@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lauum.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> lauum_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+
+// each uplo_range is a {uplo}
+
+// case when n = 0 and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'U', 'L'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {10, 10},
+    {32, 32},
+    {50, 50},
+    {70, 100},
+    {100, 150}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192}, {500, 600}, {640, 640}, {1000, 1024}, {1200, 1230}};
+
+Arguments lauum_setup_arguments(lauum_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.uplo_option = uplo;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class LAUUM : public ::TestWithParam<lauum_tuple>
+{
+protected:
+    LAUUM() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = lauum_setup_arguments(GetParam());
+
+        if(arg.uplo_option == 'U' && arg.N == 0)
+            testing_lauum_bad_arg<T>();
+
+        testing_lauum<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(LAUUM, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(LAUUM, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(LAUUM, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(LAUUM, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LAUUM,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LAUUM,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
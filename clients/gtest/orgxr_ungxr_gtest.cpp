@@ -51,7 +51,7 @@ const vector<vector<int>> n_size_range = {
 const vector<vector<int>> large_m_size_range = {{400, 410}, {640, 640}, {1000, 1024}, {2000, 2000}};
 
 const vector<vector<int>> large_n_size_range
-    = {{164, 162}, {198, 140}, {130, 130}, {220, 220}, {400, 200}};
+    = {{164, 162}, {198, 140}, {130, 130}, {220, 220}, {260, 260}, {400, 200}};
 
 Arguments orgqr_setup_arguments(orgqr_tuple tup)
 {
@@ -61,7 +61,11 @@ const vector<vector<int>> size_range = {
     // normal (valid) samples
     {40, 40, 40},
     {45, 40, 30},
-    {50, 50, 20}};
+    {50, 50, 20},
+    // (largest size kept in LDS by the fused kernel for all precisions)
+    {63, 63, 63},
+    {64, 64, 64},
+    {70, 60, 50}};
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range
@@ -0,0 +1,163 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pocon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> pocon_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// each uplo_range is a {uplo}
+
+// case when n = 0 and uplo = U will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'U', 'L'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {10, 10, 1},
+    {32, 32, 0},
+    {50, 50, 1},
+    {70, 100, 0},
+    {100, 150, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192, 1}, {500, 600, 1}, {640, 640, 0}, {1000, 1024, 0}};
+
+Arguments pocon_setup_arguments(pocon_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.uplo_option = uplo;
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N;
+
+    return arg;
+}
+
+class POCON : public ::TestWithParam<pocon_tuple>
+{
+protected:
+    POCON() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pocon_setup_arguments(GetParam());
+
+        if(arg.uplo_option == 'U' && arg.N == 0)
+            testing_pocon_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_pocon<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_pocon<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(POCON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POCON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POCON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POCON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(POCON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POCON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POCON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POCON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(POCON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POCON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POCON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POCON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POCON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POCON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
@@ -0,0 +1,266 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_potrf_update.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, char> potrf_update_tuple;
+
+// each matrix_size_range vector is a {N, lda, ldx, singular}
+// if singular = 1, then the downdated matrices used for the tests are not positive definite
+
+// each k_range is a {k}
+
+// each uplo_range is a {uplo}
+
+// case when n = 0, k = 1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'L', 'U'};
+
+const vector<int> k_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    5,
+    16};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 1, 0},
+    // invalid
+    {-1, 1, 1, 0},
+    {10, 2, 10, 0},
+    {10, 10, 2, 0},
+    // normal (valid) samples
+    {10, 10, 10, 1},
+    {20, 30, 20, 0},
+    {50, 50, 60, 1},
+    {70, 80, 70, 0}};
+
+// for daily_lapack tests
+const vector<int> large_k_range = {1, 32};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 192, 0}, {640, 960, 640, 1}, {1000, 1000, 1024, 0}, {2000, 2000, 2000, 1},
+};
+
+Arguments potrf_update_setup_arguments(potrf_update_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int k = std::get<1>(tup);
+    char uplo = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+    arg.ldb = matrix_size[2];
+    arg.K = k;
+
+    arg.uplo_option = uplo;
+
+    arg.timing = 0;
+    arg.singular = matrix_size[3];
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N;
+    arg.bsb = arg.ldb * arg.K;
+
+    return arg;
+}
+
+template <bool DOWNDATE>
+class POTRF_UPDATE_DOWNDATE : public ::TestWithParam<potrf_update_tuple>
+{
+protected:
+    POTRF_UPDATE_DOWNDATE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_update_setup_arguments(GetParam());
+
+        if(arg.uplo_option == 'L' && arg.N == 0 && arg.K == 1)
+            testing_potrf_update_bad_arg<BATCHED, STRIDED, DOWNDATE, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(DOWNDATE && arg.singular == 1)
+            testing_potrf_update<BATCHED, STRIDED, DOWNDATE, T>(arg);
+
+        arg.singular = 0;
+        testing_potrf_update<BATCHED, STRIDED, DOWNDATE, T>(arg);
+    }
+};
+
+class POTRF_UPDATE : public POTRF_UPDATE_DOWNDATE<false>
+{
+};
+
+class POTRF_DOWNDATE : public POTRF_UPDATE_DOWNDATE<true>
+{
+};
+
+// non-batch tests
+
+TEST_P(POTRF_UPDATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_UPDATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_UPDATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_DOWNDATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_DOWNDATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(POTRF_UPDATE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRF_UPDATE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRF_UPDATE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(POTRF_UPDATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_UPDATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_UPDATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_UPDATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_DOWNDATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_UPDATE,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_k_range),
+                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_UPDATE,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(k_range),
+                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_DOWNDATE,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_k_range),
+                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_DOWNDATE,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(k_range),
+                                 ValuesIn(uplo_range)));
@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pstrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> pstrf_tuple;
+
+// each matrix_size_range vector is a {N, lda, singular}
+// if singular = 1, then the used matrices for the tests are rank deficient
+
+// each uplo_range is a {uplo}
+
+// case when n = 0 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {10, 2, 0},
+    // normal (valid) samples
+    {1, 1, 1},
+    {10, 10, 1},
+    {20, 30, 0},
+    {50, 50, 1},
+    {70, 80, 0},
+    {150, 150, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 0}, {640, 960, 1}, {1000, 1000, 0}, {2000, 2000, 1},
+};
+
+Arguments pstrf_setup_arguments(pstrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.uplo_option = uplo;
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N;
+    arg.bsp = arg.N;
+
+    return arg;
+}
+
+class PSTRF : public ::TestWithParam<pstrf_tuple>
+{
+protected:
+    PSTRF() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pstrf_setup_arguments(GetParam());
+
+        if(arg.uplo_option == 'L' && arg.N == 0)
+            testing_pstrf_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_pstrf<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_pstrf<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(PSTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PSTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PSTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PSTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(PSTRF, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(PSTRF, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(PSTRF, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(PSTRF, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(PSTRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PSTRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PSTRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PSTRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         PSTRF,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PSTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
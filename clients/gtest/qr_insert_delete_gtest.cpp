@@ -0,0 +1,398 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_qr_insert_delete.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> qr_insert_delete_tuple;
+
+// each matrix_size_range is a {m, lda}
+// each n_size_range is a {n, idx, incx}
+// (idx is the position of the inserted/deleted row or column)
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return (only for column updates)
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {1, 2},
+    {50, 51},
+    {70, 100},
+    {130, 131}};
+
+const vector<vector<int>> n_size_range = {
+    // quick return (only for column updates)
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {20, 0, 1},
+    {20, 1, 0},
+    // normal (valid) samples
+    {1, 1, 1},
+    {16, 7, 1},
+    {20, 1, 2},
+    {20, 21, 1},
+    {100, 20, 3}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {152, 153},
+    {640, 641},
+    {1000, 1024},
+};
+
+const vector<vector<int>> large_n_size_range = {{64, 1, 1}, {98, 50, 1}, {400, 152, 2}};
+
+Arguments qr_insert_delete_setup_arguments(qr_insert_delete_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_size[0];
+    arg.N = n_size[0];
+    arg.k1 = n_size[1];
+    arg.lda = matrix_size[1];
+    arg.ldb = matrix_size[1];
+    arg.incx = n_size[2];
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    // (they are big enough to hold the inserted row/column)
+    arg.bsa = arg.lda * (arg.M + 1);
+    arg.bsb = arg.ldb * (arg.N + 1);
+    arg.bsc = max(arg.M, arg.N) * arg.incx;
+
+    return arg;
+}
+
+template <bool ROW, bool INSERT>
+class QR_INSERT_DELETE : public ::TestWithParam<qr_insert_delete_tuple>
+{
+protected:
+    QR_INSERT_DELETE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = qr_insert_delete_setup_arguments(GetParam());
+
+        if(arg.M == 0 && arg.N == 0)
+            testing_qr_insert_delete_bad_arg<BATCHED, STRIDED, ROW, INSERT, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_qr_insert_delete<BATCHED, STRIDED, ROW, INSERT, T>(arg);
+    }
+};
+
+class QR_INSERT_COL : public QR_INSERT_DELETE<false, true>
+{
+};
+
+class QR_DELETE_COL : public QR_INSERT_DELETE<false, false>
+{
+};
+
+class QR_INSERT_ROW : public QR_INSERT_DELETE<true, true>
+{
+};
+
+class QR_DELETE_ROW : public QR_INSERT_DELETE<true, false>
+{
+};
+
+// non-batch tests
+
+TEST_P(QR_INSERT_COL, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QR_INSERT_COL, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QR_INSERT_COL, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QR_INSERT_COL, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(QR_DELETE_COL, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QR_DELETE_COL, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QR_DELETE_COL, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QR_DELETE_COL, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(QR_INSERT_ROW, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QR_INSERT_ROW, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QR_INSERT_ROW, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QR_INSERT_ROW, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(QR_DELETE_ROW, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QR_DELETE_ROW, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QR_DELETE_ROW, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QR_DELETE_ROW, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(QR_INSERT_COL, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QR_INSERT_COL, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QR_INSERT_COL, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_INSERT_COL, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(QR_DELETE_COL, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QR_DELETE_COL, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QR_DELETE_COL, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_DELETE_COL, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(QR_INSERT_ROW, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QR_INSERT_ROW, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QR_INSERT_ROW, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_INSERT_ROW, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(QR_DELETE_ROW, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QR_DELETE_ROW, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QR_DELETE_ROW, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_DELETE_ROW, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(QR_INSERT_COL, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QR_INSERT_COL, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QR_INSERT_COL, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_INSERT_COL, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(QR_DELETE_COL, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QR_DELETE_COL, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QR_DELETE_COL, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_DELETE_COL, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(QR_INSERT_ROW, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QR_INSERT_ROW, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QR_INSERT_ROW, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_INSERT_ROW, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(QR_DELETE_ROW, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QR_DELETE_ROW, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QR_DELETE_ROW, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_DELETE_ROW, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QR_INSERT_COL,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QR_INSERT_COL,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QR_DELETE_COL,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QR_DELETE_COL,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QR_INSERT_ROW,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QR_INSERT_ROW,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QR_DELETE_ROW,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QR_DELETE_ROW,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
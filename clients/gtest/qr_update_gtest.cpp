@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_qr_update.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> qr_update_tuple;
+
+// each matrix_size_range is a {m, lda}
+// each n_size_range is a {n, k}
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {70, 100},
+    {130, 130}};
+
+const vector<vector<int>> n_size_range = {
+    // quick return
+    {0, 1},
+    {20, 0},
+    // invalid
+    {-1, 1},
+    {20, -1},
+    // normal (valid) samples
+    {16, 1},
+    {20, 3},
+    {100, 2},
+    {150, 5}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {152, 152},
+    {640, 640},
+    {1000, 1024},
+};
+
+const vector<vector<int>> large_n_size_range = {{64, 1}, {98, 4}, {400, 10}};
+
+Arguments qr_update_setup_arguments(qr_update_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_size[0];
+    arg.N = n_size[0];
+    arg.K = n_size[1];
+    arg.lda = matrix_size[1];
+    arg.ldb = matrix_size[1];
+    arg.ldc = matrix_size[1];
+    arg.ldv = max(arg.N, 1);
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.M;
+    arg.bsb = arg.ldb * arg.N;
+    arg.bsc = arg.ldc * arg.K;
+    arg.bsp = arg.ldv * arg.K;
+
+    return arg;
+}
+
+class QR_UPDATE : public ::TestWithParam<qr_update_tuple>
+{
+protected:
+    QR_UPDATE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = qr_update_setup_arguments(GetParam());
+
+        if(arg.M == 0 && arg.N == 0)
+            testing_qr_update_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_qr_update<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(QR_UPDATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(QR_UPDATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(QR_UPDATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(QR_UPDATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(QR_UPDATE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(QR_UPDATE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(QR_UPDATE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_UPDATE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(QR_UPDATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(QR_UPDATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(QR_UPDATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(QR_UPDATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         QR_UPDATE,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         QR_UPDATE,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
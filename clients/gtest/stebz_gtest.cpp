@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_stebz.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<rocsolver_op_char>> stebz_tuple;
+
+// each size_range vector is a {N, vl, vu, il, iu}
+
+// each op_range vector is a {erange, eorder}
+
+// case when N == 0, erange == A and eorder == E will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<rocsolver_op_char>> op_range
+    = {{'A', 'E'}, {'A', 'B'}, {'V', 'E'}, {'V', 'B'}, {'I', 'E'}, {'I', 'B'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 10, 1, 0},
+    // invalid
+    {-1, 0, 10, 1, 1},
+    // invalid for case erange == V
+    {5, 10, 0, 1, 1},
+    // invalid for case erange == I
+    {5, 0, 10, 0, 1},
+    {5, 0, 10, 3, 2},
+    {5, 0, 10, 1, 6},
+    // normal (valid) samples
+    {1, -10, 10, 1, 1},
+    {2, -5, 5, 1, 2},
+    {12, -10, 10, 2, 7},
+    {20, 0, 15, 1, 20},
+    {35, -15, 5, 10, 25},
+    {100, -20, -5, 50, 80}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, -30, 30, 1, 100}, {256, -5, 5, 100, 200}, {300, 10, 20, 150, 300}};
+
+Arguments stebz_setup_arguments(stebz_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<rocsolver_op_char> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = size[0];
+    arg.vl = size[1];
+    arg.vu = size[2];
+    arg.il = size[3];
+    arg.iu = size[4];
+
+    arg.erange = op[0];
+    arg.eorder = op[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class STEBZ : public ::TestWithParam<stebz_tuple>
+{
+protected:
+    STEBZ() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = stebz_setup_arguments(GetParam());
+
+        if(arg.N == 0 && arg.erange == 'A' && arg.eorder == 'E')
+            testing_stebz_bad_arg<T>();
+
+        testing_stebz<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(STEBZ, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(STEBZ, __double)
+{
+    run_tests<double>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         STEBZ,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         STEBZ,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(op_range)));
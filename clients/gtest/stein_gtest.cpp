@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_stein.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<rocsolver_op_char>> stein_tuple;
+
+// each size_range vector is a {N, ldz, vl, vu, il, iu}
+// (vl, vu, il and iu are used to select the eigenvalues passed to STEIN)
+
+// each op_range vector is a {erange}
+
+// case when N == 0 and erange == A will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<rocsolver_op_char>> op_range = {{'A'}, {'V'}, {'I'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0, 10, 1, 0},
+    // invalid
+    {-1, 1, 0, 10, 1, 1},
+    {10, 5, 0, 10, 1, 1},
+    // normal (valid) samples
+    {1, 1, -10, 10, 1, 1},
+    {2, 2, -5, 5, 1, 2},
+    {12, 20, -10, 10, 2, 7},
+    {20, 20, 0, 15, 1, 20},
+    {35, 40, -15, 5, 10, 25},
+    {100, 100, -20, -5, 50, 80}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192, -30, 30, 1, 100}, {256, 270, -5, 5, 100, 200}, {300, 300, 10, 20, 150, 300}};
+
+Arguments stein_setup_arguments(stein_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<rocsolver_op_char> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = size[0];
+    arg.ldc = size[1];
+    arg.vl = size[2];
+    arg.vu = size[3];
+    arg.il = size[4];
+    arg.iu = size[5];
+
+    arg.erange = op[0];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class STEIN : public ::TestWithParam<stein_tuple>
+{
+protected:
+    STEIN() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = stein_setup_arguments(GetParam());
+
+        if(arg.N == 0 && arg.erange == 'A')
+            testing_stein_bad_arg<T>();
+
+        testing_stein<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(STEIN, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(STEIN, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(STEIN, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(STEIN, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         STEIN,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         STEIN,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(op_range)));
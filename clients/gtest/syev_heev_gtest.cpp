@@ -31,10 +31,13 @@ const vector<vector<int>> size_range = {
     {10, 5},
     // normal (valid) samples
     {1, 1},
+    {2, 2},
+    {3, 5},
     {12, 12},
     {20, 30},
     {35, 35},
-    {50, 60}};
+    {50, 60},
+    {100, 100}};
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range = {{192, 192}, {256, 270}, {300, 300}};
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_syevx_heevx.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<rocsolver_op_char>> syevx_heevx_tuple;
+
+// each size_range vector is a {n, lda, ldz, vl, vu, il, iu}
+
+// each op_range vector is a {evect, erange, uplo}
+
+// case when n == 0, evect == N, erange == A and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<rocsolver_op_char>> op_range = {{'N', 'A', 'L'}, {'N', 'V', 'U'},
+                                                    {'N', 'I', 'L'}, {'V', 'A', 'U'},
+                                                    {'V', 'V', 'L'}, {'V', 'I', 'U'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1, 0, 10, 1, 0},
+    // invalid
+    {-1, 1, 1, 0, 10, 1, 1},
+    {10, 5, 10, 0, 10, 1, 1},
+    {10, 10, 5, 0, 10, 1, 1},
+    {5, 5, 5, 10, 0, 1, 1},
+    {5, 5, 5, 0, 10, 0, 1},
+    {5, 5, 5, 0, 10, 3, 2},
+    {5, 5, 5, 0, 10, 1, 6},
+    // normal (valid) samples
+    {1, 1, 1, 0, 10, 1, 1},
+    {12, 12, 15, -20, 20, 10, 12},
+    {20, 30, 30, 5, 15, 1, 20},
+    {35, 35, 35, -10, 10, 1, 15},
+    {50, 60, 60, -15, -5, 20, 30}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{192, 192, 192, -50, 50, 1, 40},
+                                              {256, 270, 270, -10, 10, 100, 180},
+                                              {300, 300, 310, -60, -20, 1, 300}};
+
+Arguments syevx_heevx_setup_arguments(syevx_heevx_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<rocsolver_op_char> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = size[0];
+    arg.lda = size[1];
+    arg.ldc = size[2];
+    arg.vl = size[3];
+    arg.vu = size[4];
+    arg.il = size[5];
+    arg.iu = size[6];
+
+    arg.evect = op[0];
+    arg.erange = op[1];
+    arg.uplo_option = op[2];
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N; // strideA
+    arg.bsb = arg.N; // strideW
+    arg.bsc = arg.ldc * arg.N; // strideZ
+    arg.bsp = arg.N; // strideF
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYEVX_HEEVX : public ::TestWithParam<syevx_heevx_tuple>
+{
+protected:
+    SYEVX_HEEVX() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = syevx_heevx_setup_arguments(GetParam());
+
+        if(arg.N == 0 && arg.evect == 'N' && arg.erange == 'A' && arg.uplo_option == 'L')
+            testing_syevx_heevx_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_syevx_heevx<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class SYEVX : public SYEVX_HEEVX
+{
+};
+
+class HEEVX : public SYEVX_HEEVX
+{
+};
+
+// non-batch tests
+
+TEST_P(SYEVX, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYEVX, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEEVX, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVX, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(SYEVX, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(SYEVX, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(HEEVX, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVX, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYEVX, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYEVX, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEEVX, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVX, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         SYEVX,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         HEEVX,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYEVX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEEVX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
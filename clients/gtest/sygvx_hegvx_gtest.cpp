@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sygvx_hegvx.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<rocsolver_op_char>> sygvx_tuple;
+
+// each size_range vector is a {n, lda, ldb, ldz, vl, vu, il, iu, singular}
+// if singular = 1, then the used matrix B for the tests is not positive definite
+
+// each op_range vector is a {itype, evect, erange, uplo}
+
+// case when n == 0, itype == 1, evect == N, erange == A and uplo = U will also execute
+// the bad arguments test (null handle, null pointers and invalid values)
+
+const vector<vector<rocsolver_op_char>> op_range
+    = {{'1', 'N', 'A', 'U'}, {'2', 'N', 'V', 'L'}, {'3', 'N', 'I', 'U'},
+       {'1', 'V', 'V', 'L'}, {'2', 'V', 'I', 'U'}, {'3', 'V', 'A', 'L'},
+       {'1', 'V', 'I', 'U'}, {'2', 'V', 'A', 'L'}, {'3', 'V', 'V', 'U'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1, 1, 0, 10, 1, 0, 0},
+    // invalid
+    {-1, 1, 1, 1, 0, 10, 1, 1, 0},
+    {10, 5, 10, 10, 0, 10, 1, 1, 0},
+    {10, 10, 5, 10, 0, 10, 1, 1, 0},
+    {10, 10, 10, 5, 0, 10, 1, 1, 0},
+    {5, 5, 5, 5, 10, 0, 1, 1, 0},
+    {5, 5, 5, 5, 0, 10, 0, 1, 0},
+    {5, 5, 5, 5, 0, 10, 3, 2, 0},
+    {5, 5, 5, 5, 0, 10, 1, 6, 0},
+    // normal (valid) samples
+    {1, 1, 1, 1, 0, 10, 1, 1, 0},
+    {12, 12, 15, 15, -20, 20, 10, 12, 0},
+    {20, 30, 20, 30, 5, 15, 1, 20, 1},
+    {35, 35, 35, 35, -10, 10, 1, 15, 0},
+    {50, 60, 50, 60, -15, -5, 20, 30, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{192, 192, 192, 192, -50, 50, 1, 40, 0},
+                                              {256, 270, 256, 270, -10, 10, 100, 180, 0},
+                                              {300, 300, 310, 310, -60, -20, 1, 300, 0}};
+
+Arguments sygvx_setup_arguments(sygvx_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<rocsolver_op_char> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N = size[0];
+    arg.lda = size[1];
+    arg.ldb = size[2];
+    arg.ldc = size[3];
+    arg.vl = size[4];
+    arg.vu = size[5];
+    arg.il = size[6];
+    arg.iu = size[7];
+    arg.singular = size[8];
+
+    arg.itype = op[0];
+    arg.evect = op[1];
+    arg.erange = op[2];
+    arg.uplo_option = op[3];
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsa = arg.lda * arg.N; // strideA
+    arg.bsb = arg.ldb * arg.N; // strideB
+    arg.bsc = arg.N; // strideW
+    arg.bs5 = arg.ldc * arg.N; // strideZ
+    arg.bsp = arg.N; // strideF
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYGVX_HEGVX : public ::TestWithParam<sygvx_tuple>
+{
+protected:
+    SYGVX_HEGVX() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = sygvx_setup_arguments(GetParam());
+
+        if(arg.N == 0 && arg.itype == '1' && arg.evect == 'N' && arg.erange == 'A'
+           && arg.uplo_option == 'U')
+            testing_sygvx_hegvx_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_sygvx_hegvx<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_sygvx_hegvx<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class SYGVX : public SYGVX_HEGVX
+{
+};
+
+class HEGVX : public SYGVX_HEGVX
+{
+};
+
+// non-batch tests
+
+TEST_P(SYGVX, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYGVX, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEGVX, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEGVX, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(SYGVX, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(SYGVX, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(HEGVX, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVX, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYGVX, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYGVX, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEGVX, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVX, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         SYGVX,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         HEGVX,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYGVX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEGVX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sysv.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> sysv_tuple;
+
+// each A_range vector is a {N, lda, ldb, singular};
+// if singular = 1, then the used matrix for the tests is singular
+
+// each B_range vector is a {nrhs, uplo};
+// if uplo = 0 then upper
+// if uplo = 1 then lower
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 1, 0},
+    // invalid
+    {-1, 1, 1, 0},
+    {10, 2, 10, 0},
+    {10, 10, 2, 0},
+    /// normal (valid) samples
+    {20, 20, 20, 1},
+    {30, 50, 30, 0},
+    {30, 30, 50, 1},
+    {50, 60, 60, 0}};
+const vector<vector<int>> matrix_sizeB_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {10, 0},
+    {20, 1},
+    {30, 0},
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range
+    = {{70, 70, 100, 0},     {192, 192, 192, 1},   {600, 700, 645, 0},
+       {1000, 1000, 1000, 1}, {1000, 2000, 2000, 0}};
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100, 0}, {150, 1}, {200, 1}, {524, 0}, {1000, 1},
+};
+
+Arguments sysv_setup_arguments(sysv_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = matrix_sizeB[0];
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+    arg.singular = matrix_sizeA[3];
+
+    arg.uplo_option = matrix_sizeB[1] == 0 ? 'U' : 'L';
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsp = arg.M;
+    arg.bsa = arg.lda * arg.M;
+    arg.bsb = arg.ldb * arg.N;
+
+    return arg;
+}
+
+class SYSV : public ::TestWithParam<sysv_tuple>
+{
+protected:
+    SYSV() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = sysv_setup_arguments(GetParam());
+
+        if(arg.M == 0 && arg.N == 0)
+            testing_sysv_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_sysv<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_sysv<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(SYSV, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYSV, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(SYSV, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(SYSV, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(SYSV, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(SYSV, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(SYSV, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(SYSV, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYSV, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYSV, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(SYSV, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(SYSV, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         SYSV,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYSV,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -110,6 +110,53 @@ void cblas_potf2(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, rocbla
 template <typename T>
 void cblas_potrf(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, rocblas_int* info);
 
+template <typename S, typename T>
+void cblas_pstrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* piv,
+                 rocblas_int* rank,
+                 S tol,
+                 S* work,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_sytf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_hetf2(rocblas_fill uplo,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_sytrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 T* work,
+                 rocblas_int lwork,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_hetrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 T* work,
+                 rocblas_int lwork,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_getf2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, rocblas_int* ipiv, rocblas_int* info);
 
@@ -137,6 +184,52 @@ void cblas_getrs(rocblas_operation trans,
                  T* B,
                  rocblas_int ldb);
 
+template <typename T>
+void cblas_sytrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 T* B,
+                 rocblas_int ldb);
+
+template <typename T>
+void cblas_hetrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* ipiv,
+                 T* B,
+                 rocblas_int ldb);
+
+template <typename T>
+void cblas_sysv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                T* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                T* B,
+                rocblas_int ldb,
+                T* work,
+                rocblas_int lwork,
+                rocblas_int* info);
+
+template <typename T>
+void cblas_hesv(rocblas_fill uplo,
+                rocblas_int n,
+                rocblas_int nrhs,
+                T* A,
+                rocblas_int lda,
+                rocblas_int* ipiv,
+                T* B,
+                rocblas_int ldb,
+                T* work,
+                rocblas_int lwork,
+                rocblas_int* info);
+
 template <typename T>
 void cblas_gels(rocblas_operation transR,
                 rocblas_int m,
@@ -150,6 +243,37 @@ void cblas_gels(rocblas_operation transR,
                 rocblas_int lwork,
                 rocblas_int* info);
 
+template <typename T>
+void cblas_trtri(rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_potri(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, rocblas_int* info);
+
+template <typename T, typename S>
+void cblas_gecon(rocblas_norm_type norm_type,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 S anorm,
+                 S* rcond);
+
+template <typename T, typename S>
+void cblas_pocon(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, S anorm, S* rcond);
+
+template <typename T, typename S>
+void cblas_trcon(rocblas_norm_type norm_type,
+                 rocblas_fill uplo,
+                 rocblas_diagonal diag,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 S* rcond);
+
 template <typename T>
 void cblas_getri(rocblas_int n,
                  T* A,
@@ -247,12 +371,37 @@ void cblas_bdsqr(rocblas_fill uplo,
                  W* work,
                  rocblas_int* info);
 
+template <typename T>
+void cblas_bdsdc(rocblas_fill uplo,
+                 rocblas_svect svect,
+                 rocblas_int n,
+                 T* D,
+                 T* E,
+                 T* U,
+                 rocblas_int ldu,
+                 T* V,
+                 rocblas_int ldv,
+                 T* work,
+                 rocblas_int* iwork,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_geqr2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work);
 
 template <typename T>
 void cblas_geqrf(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work, rocblas_int sizeW);
 
+template <typename S, typename T>
+void cblas_geqp3(rocblas_int m,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* jpvt,
+                 T* ipiv,
+                 T* work,
+                 rocblas_int sizeW,
+                 S* rwork);
+
 template <typename T>
 void cblas_geql2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work);
 
@@ -283,6 +432,25 @@ void cblas_laswp(rocblas_int n,
                  rocblas_int* ipiv,
                  rocblas_int inc);
 
+template <typename T>
+void cblas_lauum(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda);
+
+template <typename T, typename S>
+void cblas_lange(rocblas_norm_type norm_type,
+                 rocblas_int m,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 S* norm);
+
+template <typename T, typename S>
+void cblas_lansy_lanhe(rocblas_norm_type norm_type,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       T* A,
+                       rocblas_int lda,
+                       S* norm);
+
 template <typename T>
 void cblas_org2r_ung2r(rocblas_int m,
                        rocblas_int n,
@@ -516,12 +684,79 @@ void cblas_gesvd(rocblas_svect leftv,
                  W* E,
                  rocblas_int* info);
 
+template <typename T, typename W>
+void cblas_gesdd(rocblas_svect svect,
+                 rocblas_int m,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 W* S,
+                 T* U,
+                 rocblas_int ldu,
+                 T* V,
+                 rocblas_int ldv,
+                 T* work,
+                 rocblas_int lwork,
+                 W* rwork,
+                 rocblas_int* iwork,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_sterf(rocblas_int n, T* D, T* E);
 
 template <typename S, typename T>
 void cblas_steqr(rocblas_evect compc, rocblas_int n, S* D, S* E, T* C, rocblas_int ldc, S* work);
 
+template <typename S, typename T>
+void cblas_stedc(rocblas_evect evect,
+                 rocblas_int n,
+                 S* D,
+                 S* E,
+                 T* C,
+                 rocblas_int ldc,
+                 T* work,
+                 rocblas_int lwork,
+                 S* rwork,
+                 rocblas_int lrwork,
+                 rocblas_int* iwork,
+                 rocblas_int liwork,
+                 rocblas_int* info);
+
+template <typename T>
+void cblas_stebz(rocblas_erange erange,
+                 rocblas_eorder eorder,
+                 rocblas_int n,
+                 T vl,
+                 T vu,
+                 rocblas_int il,
+                 rocblas_int iu,
+                 T abstol,
+                 T* D,
+                 T* E,
+                 rocblas_int* nev,
+                 rocblas_int* nsplit,
+                 T* W,
+                 rocblas_int* iblock,
+                 rocblas_int* isplit,
+                 T* work,
+                 rocblas_int* iwork,
+                 rocblas_int* info);
+
+template <typename S, typename T>
+void cblas_stein(rocblas_int n,
+                 S* D,
+                 S* E,
+                 rocblas_int* nev,
+                 S* W,
+                 rocblas_int* iblock,
+                 rocblas_int* isplit,
+                 T* Z,
+                 rocblas_int ldz,
+                 S* work,
+                 rocblas_int* iwork,
+                 rocblas_int* ifail,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_sygs2_hegs2(rocblas_eform itype,
                        rocblas_fill uplo,
@@ -551,6 +786,44 @@ void cblas_syev_heev(rocblas_evect evect,
                      rocblas_int size_w,
                      rocblas_int* info);
 
+template <typename T, typename S>
+void cblas_syevd_heevd(rocblas_evect evect,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       T* A,
+                       rocblas_int lda,
+                       S* D,
+                       T* work,
+                       rocblas_int lwork,
+                       S* rwork,
+                       rocblas_int lrwork,
+                       rocblas_int* iwork,
+                       rocblas_int liwork,
+                       rocblas_int* info);
+
+template <typename T, typename S>
+void cblas_syevx_heevx(rocblas_evect evect,
+                       rocblas_erange erange,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       T* A,
+                       rocblas_int lda,
+                       S vl,
+                       S vu,
+                       rocblas_int il,
+                       rocblas_int iu,
+                       S abstol,
+                       rocblas_int* nev,
+                       S* W,
+                       T* Z,
+                       rocblas_int ldz,
+                       T* work,
+                       rocblas_int lwork,
+                       S* rwork,
+                       rocblas_int* iwork,
+                       rocblas_int* ifail,
+                       rocblas_int* info);
+
 template <typename S, typename T>
 void cblas_sygv_hegv(rocblas_eform itype,
                      rocblas_evect jobz,
@@ -583,3 +856,29 @@ void cblas_sygvd_hegvd(rocblas_eform itype,
                        rocblas_int* iwork,
                        rocblas_int liwork,
                        rocblas_int* info);
+
+template <typename S, typename T>
+void cblas_sygvx_hegvx(rocblas_eform itype,
+                       rocblas_evect evect,
+                       rocblas_erange erange,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       T* A,
+                       rocblas_int lda,
+                       T* B,
+                       rocblas_int ldb,
+                       S vl,
+                       S vu,
+                       rocblas_int il,
+                       rocblas_int iu,
+                       S abstol,
+                       rocblas_int* nev,
+                       S* W,
+                       T* Z,
+                       rocblas_int ldz,
+                       T* work,
+                       rocblas_int lwork,
+                       S* rwork,
+                       rocblas_int* iwork,
+                       rocblas_int* ifail,
+                       rocblas_int* info);
@@ -99,6 +99,178 @@ rocblas_status rocsolver_zgetri_outofplace_batched(rocblas_handle handle,
                                                    rocblas_int* info,
                                                    const rocblas_int batch_count);
 
+rocblas_status rocsolver_sgesvd_batched_nodqds(rocblas_handle handle,
+                                               const rocblas_svect left_svect,
+                                               const rocblas_svect right_svect,
+                                               const rocblas_int m,
+                                               const rocblas_int n,
+                                               float* const A[],
+                                               const rocblas_int lda,
+                                               float* S,
+                                               const rocblas_stride strideS,
+                                               float* U,
+                                               const rocblas_int ldu,
+                                               const rocblas_stride strideU,
+                                               float* V,
+                                               const rocblas_int ldv,
+                                               const rocblas_stride strideV,
+                                               float* E,
+                                               const rocblas_stride strideE,
+                                               const rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count);
+
+rocblas_status rocsolver_dgesvd_batched_nodqds(rocblas_handle handle,
+                                               const rocblas_svect left_svect,
+                                               const rocblas_svect right_svect,
+                                               const rocblas_int m,
+                                               const rocblas_int n,
+                                               double* const A[],
+                                               const rocblas_int lda,
+                                               double* S,
+                                               const rocblas_stride strideS,
+                                               double* U,
+                                               const rocblas_int ldu,
+                                               const rocblas_stride strideU,
+                                               double* V,
+                                               const rocblas_int ldv,
+                                               const rocblas_stride strideV,
+                                               double* E,
+                                               const rocblas_stride strideE,
+                                               const rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count);
+
+rocblas_status rocsolver_cgesvd_batched_nodqds(rocblas_handle handle,
+                                               const rocblas_svect left_svect,
+                                               const rocblas_svect right_svect,
+                                               const rocblas_int m,
+                                               const rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int lda,
+                                               float* S,
+                                               const rocblas_stride strideS,
+                                               rocblas_float_complex* U,
+                                               const rocblas_int ldu,
+                                               const rocblas_stride strideU,
+                                               rocblas_float_complex* V,
+                                               const rocblas_int ldv,
+                                               const rocblas_stride strideV,
+                                               float* E,
+                                               const rocblas_stride strideE,
+                                               const rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count);
+
+rocblas_status rocsolver_zgesvd_batched_nodqds(rocblas_handle handle,
+                                               const rocblas_svect left_svect,
+                                               const rocblas_svect right_svect,
+                                               const rocblas_int m,
+                                               const rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int lda,
+                                               double* S,
+                                               const rocblas_stride strideS,
+                                               rocblas_double_complex* U,
+                                               const rocblas_int ldu,
+                                               const rocblas_stride strideU,
+                                               rocblas_double_complex* V,
+                                               const rocblas_int ldv,
+                                               const rocblas_stride strideV,
+                                               double* E,
+                                               const rocblas_stride strideE,
+                                               const rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count);
+
+rocblas_status rocsolver_sgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                                       const rocblas_svect left_svect,
+                                                       const rocblas_svect right_svect,
+                                                       const rocblas_int m,
+                                                       const rocblas_int n,
+                                                       float* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       float* S,
+                                                       const rocblas_stride strideS,
+                                                       float* U,
+                                                       const rocblas_int ldu,
+                                                       const rocblas_stride strideU,
+                                                       float* V,
+                                                       const rocblas_int ldv,
+                                                       const rocblas_stride strideV,
+                                                       float* E,
+                                                       const rocblas_stride strideE,
+                                                       const rocblas_workmode fast_alg,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count);
+
+rocblas_status rocsolver_dgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                                       const rocblas_svect left_svect,
+                                                       const rocblas_svect right_svect,
+                                                       const rocblas_int m,
+                                                       const rocblas_int n,
+                                                       double* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       double* S,
+                                                       const rocblas_stride strideS,
+                                                       double* U,
+                                                       const rocblas_int ldu,
+                                                       const rocblas_stride strideU,
+                                                       double* V,
+                                                       const rocblas_int ldv,
+                                                       const rocblas_stride strideV,
+                                                       double* E,
+                                                       const rocblas_stride strideE,
+                                                       const rocblas_workmode fast_alg,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count);
+
+rocblas_status rocsolver_cgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                                       const rocblas_svect left_svect,
+                                                       const rocblas_svect right_svect,
+                                                       const rocblas_int m,
+                                                       const rocblas_int n,
+                                                       rocblas_float_complex* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       float* S,
+                                                       const rocblas_stride strideS,
+                                                       rocblas_float_complex* U,
+                                                       const rocblas_int ldu,
+                                                       const rocblas_stride strideU,
+                                                       rocblas_float_complex* V,
+                                                       const rocblas_int ldv,
+                                                       const rocblas_stride strideV,
+                                                       float* E,
+                                                       const rocblas_stride strideE,
+                                                       const rocblas_workmode fast_alg,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count);
+
+rocblas_status rocsolver_zgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                                       const rocblas_svect left_svect,
+                                                       const rocblas_svect right_svect,
+                                                       const rocblas_int m,
+                                                       const rocblas_int n,
+                                                       rocblas_double_complex* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       double* S,
+                                                       const rocblas_stride strideS,
+                                                       rocblas_double_complex* U,
+                                                       const rocblas_int ldu,
+                                                       const rocblas_stride strideU,
+                                                       rocblas_double_complex* V,
+                                                       const rocblas_int ldv,
+                                                       const rocblas_stride strideV,
+                                                       double* E,
+                                                       const rocblas_stride strideE,
+                                                       const rocblas_workmode fast_alg,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -167,6 +339,292 @@ inline rocblas_status rocsolver_laswp(rocblas_handle handle,
 }
 /*****************************************************/
 
+/******************** LAUUM ********************/
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_slauum(handle, uplo, n, A, lda);
+}
+
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_dlauum(handle, uplo, n, A, lda);
+}
+
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_clauum(handle, uplo, n, A, lda);
+}
+
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_zlauum(handle, uplo, n, A, lda);
+}
+/*****************************************************/
+
+/******************** LANGE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* norm,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_slange_strided_batched(handle, norm_type, m, n, A, lda, stA, norm, bc)
+        : rocsolver_slange(handle, norm_type, m, n, A, lda, norm);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* norm,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dlange_strided_batched(handle, norm_type, m, n, A, lda, stA, norm, bc)
+        : rocsolver_dlange(handle, norm_type, m, n, A, lda, norm);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* norm,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_clange_strided_batched(handle, norm_type, m, n, A, lda, stA, norm, bc)
+        : rocsolver_clange(handle, norm_type, m, n, A, lda, norm);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* norm,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zlange_strided_batched(handle, norm_type, m, n, A, lda, stA, norm, bc)
+        : rocsolver_zlange(handle, norm_type, m, n, A, lda, norm);
+}
+
+// batched
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* norm,
+                                      rocblas_int bc)
+{
+    return rocsolver_slange_batched(handle, norm_type, m, n, A, lda, norm, bc);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* norm,
+                                      rocblas_int bc)
+{
+    return rocsolver_dlange_batched(handle, norm_type, m, n, A, lda, norm, bc);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* norm,
+                                      rocblas_int bc)
+{
+    return rocsolver_clange_batched(handle, norm_type, m, n, A, lda, norm, bc);
+}
+
+inline rocblas_status rocsolver_lange(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* norm,
+                                      rocblas_int bc)
+{
+    return rocsolver_zlange_batched(handle, norm_type, m, n, A, lda, norm, bc);
+}
+/********************************************************/
+
+/******************** LANSY_LANHE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* norm,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_slansy_strided_batched(handle, norm_type, uplo, n, A, lda, stA, norm, bc)
+        : rocsolver_slansy(handle, norm_type, uplo, n, A, lda, norm);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* norm,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dlansy_strided_batched(handle, norm_type, uplo, n, A, lda, stA, norm, bc)
+        : rocsolver_dlansy(handle, norm_type, uplo, n, A, lda, norm);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* norm,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_clanhe_strided_batched(handle, norm_type, uplo, n, A, lda, stA, norm, bc)
+        : rocsolver_clanhe(handle, norm_type, uplo, n, A, lda, norm);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* norm,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zlanhe_strided_batched(handle, norm_type, uplo, n, A, lda, stA, norm, bc)
+        : rocsolver_zlanhe(handle, norm_type, uplo, n, A, lda, norm);
+}
+
+// batched
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* norm,
+                                            rocblas_int bc)
+{
+    return rocsolver_slansy_batched(handle, norm_type, uplo, n, A, lda, norm, bc);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* norm,
+                                            rocblas_int bc)
+{
+    return rocsolver_dlansy_batched(handle, norm_type, uplo, n, A, lda, norm, bc);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* norm,
+                                            rocblas_int bc)
+{
+    return rocsolver_clanhe_batched(handle, norm_type, uplo, n, A, lda, norm, bc);
+}
+
+inline rocblas_status rocsolver_lansy_lanhe(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_norm_type norm_type,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* norm,
+                                            rocblas_int bc)
+{
+    return rocsolver_zlanhe_batched(handle, norm_type, uplo, n, A, lda, norm, bc);
+}
+/********************************************************/
+
 /******************** LARFG ********************/
 inline rocblas_status rocsolver_larfg(rocblas_handle handle,
                                       rocblas_int n,
@@ -473,6 +931,52 @@ inline rocblas_status rocsolver_bdsqr(rocblas_handle handle,
 }
 /***************************************************************/
 
+/******************** BDSDC ********************/
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_svect svect,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_int* info)
+{
+    return rocsolver_sbdsdc(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_svect svect,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_int* info)
+{
+    return rocsolver_dbdsdc(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+/***************************************************************/
+
+/******************** BDSVALS ********************/
+inline rocblas_status
+    rocsolver_bdsvals(rocblas_handle handle, rocblas_int n, float* D, float* E, rocblas_int* info)
+{
+    return rocsolver_sbdsvals(handle, n, D, E, info);
+}
+
+inline rocblas_status
+    rocsolver_bdsvals(rocblas_handle handle, rocblas_int n, double* D, double* E, rocblas_int* info)
+{
+    return rocsolver_dbdsvals(handle, n, D, E, info);
+}
+/********************************************************/
+
 /******************** LATRD ********************/
 inline rocblas_status rocsolver_latrd(rocblas_handle handle,
                                       rocblas_fill uplo,
@@ -1261,18 +1765,180 @@ inline rocblas_status rocsolver_steqr(rocblas_handle handle,
 }
 /********************************************************/
 
-/******************** POTF2_POTRF ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
-                                            bool POTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* info,
-                                            rocblas_int batch_count)
+/******************** STEDC ********************/
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      float* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_sstedc(handle, evect, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      double* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_dstedc(handle, evect, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      rocblas_float_complex* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_cstedc(handle, evect, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_stedc(rocblas_handle handle,
+                                      rocblas_evect evect,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      rocblas_double_complex* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_zstedc(handle, evect, n, D, E, C, ldc, info);
+}
+/********************************************************/
+
+/******************** STEBZ ********************/
+inline rocblas_status rocsolver_stebz(rocblas_handle handle,
+                                      rocblas_erange erange,
+                                      rocblas_eorder eorder,
+                                      rocblas_int n,
+                                      float vl,
+                                      float vu,
+                                      rocblas_int il,
+                                      rocblas_int iu,
+                                      float abstol,
+                                      float* D,
+                                      float* E,
+                                      rocblas_int* nev,
+                                      rocblas_int* nsplit,
+                                      float* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_int* info)
+{
+    return rocsolver_sstebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, E, nev, nsplit, W,
+                            iblock, isplit, info);
+}
+
+inline rocblas_status rocsolver_stebz(rocblas_handle handle,
+                                      rocblas_erange erange,
+                                      rocblas_eorder eorder,
+                                      rocblas_int n,
+                                      double vl,
+                                      double vu,
+                                      rocblas_int il,
+                                      rocblas_int iu,
+                                      double abstol,
+                                      double* D,
+                                      double* E,
+                                      rocblas_int* nev,
+                                      rocblas_int* nsplit,
+                                      double* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_int* info)
+{
+    return rocsolver_dstebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, E, nev, nsplit, W,
+                            iblock, isplit, info);
+}
+/********************************************************/
+
+/******************** STEIN ********************/
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      rocblas_int* nev,
+                                      float* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      float* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_sstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      rocblas_int* nev,
+                                      double* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      double* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_dstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      rocblas_int* nev,
+                                      float* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_float_complex* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_cstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_stein(rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      rocblas_int* nev,
+                                      double* W,
+                                      rocblas_int* iblock,
+                                      rocblas_int* isplit,
+                                      rocblas_double_complex* Z,
+                                      rocblas_int ldz,
+                                      rocblas_int* ifail,
+                                      rocblas_int* info)
+{
+    return rocsolver_zstein(handle, n, D, E, nev, W, iblock, isplit, Z, ldz, ifail, info);
+}
+/********************************************************/
+
+/******************** POTF2_POTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* info,
+                                            rocblas_int batch_count)
 {
     if(STRIDED)
         return POTRF
@@ -1405,1901 +2071,6346 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GETF2_GETRF_NPVT ********************/
+/******************** POTRI ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 float* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF ? rocsolver_sgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_sgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
-    else
-        return GETRF ? rocsolver_sgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_sgetf2_npvt(handle, m, n, A, lda, info);
+    return STRIDED ? rocsolver_spotri_strided_batched(handle, uplo, n, A, lda, stA, info, bc)
+                   : rocsolver_spotri(handle, uplo, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 double* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF ? rocsolver_dgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_dgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
-    else
-        return GETRF ? rocsolver_dgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_dgetf2_npvt(handle, m, n, A, lda, info);
+    return STRIDED ? rocsolver_dpotri_strided_batched(handle, uplo, n, A, lda, stA, info, bc)
+                   : rocsolver_dpotri(handle, uplo, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF ? rocsolver_cgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_cgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
-    else
-        return GETRF ? rocsolver_cgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_cgetf2_npvt(handle, m, n, A, lda, info);
+    return STRIDED ? rocsolver_cpotri_strided_batched(handle, uplo, n, A, lda, stA, info, bc)
+                   : rocsolver_cpotri(handle, uplo, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF ? rocsolver_zgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_zgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
-    else
-        return GETRF ? rocsolver_zgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_zgetf2_npvt(handle, m, n, A, lda, info);
+    return STRIDED ? rocsolver_zpotri_strided_batched(handle, uplo, n, A, lda, stA, info, bc)
+                   : rocsolver_zpotri(handle, uplo, n, A, lda, info);
 }
 
 // batched
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 float* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_sgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_sgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_spotri_batched(handle, uplo, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 double* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_dgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_dgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_dpotri_batched(handle, uplo, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_cgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_cgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_cpotri_batched(handle, uplo, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_zgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_zgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_zpotri_batched(handle, uplo, n, A, lda, info, bc);
 }
 /********************************************************/
 
-/******************** GETF2_GETRF ********************/
+/******************** GECON ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_sgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_sgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_sgetf2(handle, m, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_sgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_sgecon(handle, norm_type, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_dgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_dgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_dgetf2(handle, m, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_dgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_dgecon(handle, norm_type, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_cgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_cgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_cgetf2(handle, m, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_cgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_cgecon(handle, norm_type, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_zgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_zgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_zgetf2(handle, m, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_zgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_zgecon(handle, norm_type, n, A, lda, anorm, rcond);
 }
 
 // batched
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_sgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_sgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_sgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_dgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_dgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_dgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_cgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_cgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_cgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return GETRF ? rocsolver_zgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_zgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_zgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
 }
 /********************************************************/
 
-/******************** GESVD ********************/
+/******************** POCON ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      float* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      float* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const float* anorm,
+                                      float* rcond,
                                       rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_sgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_sgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+        ? rocsolver_spocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_spocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      double* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      double* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const double* anorm,
+                                      double* rcond,
                                       rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_dgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_dgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+        ? rocsolver_dpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_dpocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      rocblas_float_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_float_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const float* anorm,
+                                      float* rcond,
                                       rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_cgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_cgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+        ? rocsolver_cpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_cpocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      rocblas_double_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_double_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const double* anorm,
+                                      double* rcond,
                                       rocblas_int bc)
 {
     return STRIDED
-        ? rocsolver_zgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_zgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+        ? rocsolver_zpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc)
+        : rocsolver_zpocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      float* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      float* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const float* anorm,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_sgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_spocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      double* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      double* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const double* anorm,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_dgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_dpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      rocblas_float_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_float_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const float* anorm,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_cgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_cpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pocon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
                                       rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      rocblas_double_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_double_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
+                                      const double* anorm,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_zgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_zpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
 /********************************************************/
 
-/******************** GETRS ********************/
+/******************** TRCON ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      float* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED
+        ? rocsolver_strcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA, rcond, bc)
+        : rocsolver_strcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      double* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED
+        ? rocsolver_dtrcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA, rcond, bc)
+        : rocsolver_dtrcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED
+        ? rocsolver_ctrcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA, rcond, bc)
+        : rocsolver_ctrcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED
+        ? rocsolver_ztrcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA, rcond, bc)
+        : rocsolver_ztrcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
 // batched
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      float* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_sgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_strcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      double* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_dgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_dtrcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_cgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_ctrcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
                                       rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return rocsolver_zgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_ztrcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
 }
 /********************************************************/
 
-/******************** GETRI ********************/
+/******************** POTRF_UPDATE_DOWNDATE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_spotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, bc)
+            : rocsolver_spotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      bc);
+    else
+        return DOWNDATE ? rocsolver_spotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_spotrf_update(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_dpotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, bc)
+            : rocsolver_dpotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      bc);
+    else
+        return DOWNDATE ? rocsolver_dpotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_dpotrf_update(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_float_complex* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_cpotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, bc)
+            : rocsolver_cpotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      bc);
+    else
+        return DOWNDATE ? rocsolver_cpotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_cpotrf_update(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_double_complex* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_zpotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, bc)
+            : rocsolver_zpotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      bc);
+    else
+        return DOWNDATE ? rocsolver_zpotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_zpotrf_update(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+// batched
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return DOWNDATE
+        ? rocsolver_spotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, bc)
+        : rocsolver_spotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return DOWNDATE
+        ? rocsolver_dpotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, bc)
+        : rocsolver_dpotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_float_complex* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return DOWNDATE
+        ? rocsolver_cpotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, bc)
+        : rocsolver_cpotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_double_complex* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return DOWNDATE
+        ? rocsolver_zpotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, bc)
+        : rocsolver_zpotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, bc);
+}
+/********************************************************/
+
+/******************** PSTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      float* A1,
                                       float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_spstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank, tol, info,
+                                           bc)
+        : rocsolver_spstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      double* A1,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_dpstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank, tol, info,
+                                           bc)
+        : rocsolver_dpstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_float_complex* A1,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_cpstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank, tol, info,
+                                           bc)
+        : rocsolver_cpstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_double_complex* A1,
                                       rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
+    return STRIDED
+        ? rocsolver_zpstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank, tol, info,
+                                           bc)
+        : rocsolver_zpstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
 }
 
-// batched and outofplace_batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
+// batched
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      float* const A1[],
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
-        : rocsolver_sgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+    return rocsolver_spstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      double* const A1[],
                                       double* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
-        : rocsolver_dgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+    return rocsolver_dpstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_float_complex* const A1[],
                                       rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
-        : rocsolver_cgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+    return rocsolver_cpstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_double_complex* const A1[],
                                       rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
+                                      rocblas_int* piv,
                                       rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
                                       rocblas_int* info,
                                       rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
-        : rocsolver_zgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+    return rocsolver_zpstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
 }
 /********************************************************/
 
-/******************** GEQR2_GEQRF ********************/
+/******************** GETF2_GETRF_NPVT ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_sgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_sgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_sgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_sgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_dgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_dgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_dgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_dgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_cgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_cgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_cgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_cgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_zgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_zgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_zgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_zgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_sgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_sgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_dgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_dgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_cgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_cgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_zgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_zgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** GETF2_GETRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GETRF
+            ? rocsolver_sgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_sgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+        return GETRF ? rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_sgetf2(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GETRF
+            ? rocsolver_dgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_dgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+        return GETRF ? rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_dgetf2(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GETRF
+            ? rocsolver_cgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_cgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+        return GETRF ? rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_cgetf2(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GETRF
+            ? rocsolver_zgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+        return GETRF ? rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_zgetf2(handle, m, n, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GETRF ? rocsolver_sgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_sgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GETRF ? rocsolver_dgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_dgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_cgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GETRF ? rocsolver_cgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_cgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    return GEQRF ? rocsolver_zgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
-}
-
-// ptr_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    return GEQRF ? rocsolver_sgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
-}
-
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    return GEQRF ? rocsolver_dgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
-}
-
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
-}
-
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* const ipiv[],
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return GETRF ? rocsolver_zgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** GEQL2_GEQLF ********************/
+/******************** SYTF2_SYTRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_sgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRF
+            ? rocsolver_ssytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_ssytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQLF ? rocsolver_sgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeql2(handle, m, n, A, lda, ipiv);
+        return SYTRF ? rocsolver_ssytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_ssytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_dgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRF
+            ? rocsolver_dsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_dsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQLF ? rocsolver_dgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeql2(handle, m, n, A, lda, ipiv);
+        return SYTRF ? rocsolver_dsytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_dsytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_cgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRF
+            ? rocsolver_csytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_csytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQLF ? rocsolver_cgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeql2(handle, m, n, A, lda, ipiv);
+        return SYTRF ? rocsolver_csytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_csytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_zgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return SYTRF
+            ? rocsolver_zsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GEQLF ? rocsolver_zgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeql2(handle, m, n, A, lda, ipiv);
+        return SYTRF ? rocsolver_zsytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_zsytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_sgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRF ? rocsolver_ssytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_ssytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_dgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRF ? rocsolver_dsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_dsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_cgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_zgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** GELQ2_GELQF ********************/
+/******************** HETF2_HETRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    if(STRIDED)
-        return GELQF ? rocsolver_sgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GELQF ? rocsolver_sgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgelq2(handle, m, n, A, lda, ipiv);
-}
-
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    if(STRIDED)
-        return GELQF ? rocsolver_dgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GELQF ? rocsolver_dgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgelq2(handle, m, n, A, lda, ipiv);
-}
-
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_hetf2_hetrf(bool STRIDED,
+                                            bool HETRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_cgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return HETRF
+            ? rocsolver_chetrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_chetf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GELQF ? rocsolver_cgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgelq2(handle, m, n, A, lda, ipiv);
+        return HETRF ? rocsolver_chetrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_chetf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_hetf2_hetrf(bool STRIDED,
+                                            bool HETRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return HETRF
+            ? rocsolver_zhetrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zhetf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return GELQF ? rocsolver_zgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgelq2(handle, m, n, A, lda, ipiv);
+        return HETRF ? rocsolver_zhetrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_zhetf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_hetf2_hetrf(bool STRIDED,
+                                            bool HETRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
-                                            float* const A[],
+                                            rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_sgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return HETRF ? rocsolver_chetrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_chetf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_hetf2_hetrf(bool STRIDED,
+                                            bool HETRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
-                                            double* const A[],
+                                            rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* ipiv,
+                                            rocblas_int* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_dgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return HETRF ? rocsolver_zhetrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zhetf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    return GELQF ? rocsolver_cgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
-}
+/******************** GESVD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_sgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_dgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_cgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_zgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+// GESVD with the dqds iterations disabled, to test the fallback to BDSQR
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* S,
+                                             rocblas_stride stS,
+                                             float* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             float* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             float* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_sgesvd_strided_batched_nodqds(handle, leftv, rightv, m, n, A, lda, stA, S, stS,
+                                                   U, ldu, stU, V, ldv, stV, E, stE, fast_alg, info,
+                                                   bc);
+}
+
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* S,
+                                             rocblas_stride stS,
+                                             double* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             double* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             double* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dgesvd_strided_batched_nodqds(handle, leftv, rightv, m, n, A, lda, stA, S, stS,
+                                                   U, ldu, stU, V, ldv, stV, E, stE, fast_alg, info,
+                                                   bc);
+}
+
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* S,
+                                             rocblas_stride stS,
+                                             rocblas_float_complex* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             rocblas_float_complex* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             float* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cgesvd_strided_batched_nodqds(handle, leftv, rightv, m, n, A, lda, stA, S, stS,
+                                                   U, ldu, stU, V, ldv, stV, E, stE, fast_alg, info,
+                                                   bc);
+}
+
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* S,
+                                             rocblas_stride stS,
+                                             rocblas_double_complex* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             rocblas_double_complex* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             double* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zgesvd_strided_batched_nodqds(handle, leftv, rightv, m, n, A, lda, stA, S, stS,
+                                                   U, ldu, stU, V, ldv, stV, E, stE, fast_alg, info,
+                                                   bc);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* S,
+                                             rocblas_stride stS,
+                                             float* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             float* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             float* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_sgesvd_batched_nodqds(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU,
+                                           V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* S,
+                                             rocblas_stride stS,
+                                             double* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             double* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             double* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dgesvd_batched_nodqds(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU,
+                                           V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* S,
+                                             rocblas_stride stS,
+                                             rocblas_float_complex* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             rocblas_float_complex* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             float* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cgesvd_batched_nodqds(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU,
+                                           V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_nodqds(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_svect leftv,
+                                             rocblas_svect rightv,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* S,
+                                             rocblas_stride stS,
+                                             rocblas_double_complex* U,
+                                             rocblas_int ldu,
+                                             rocblas_stride stU,
+                                             rocblas_double_complex* V,
+                                             rocblas_int ldv,
+                                             rocblas_stride stV,
+                                             double* E,
+                                             rocblas_stride stE,
+                                             rocblas_workmode fast_alg,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zgesvd_batched_nodqds(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU,
+                                           V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+/********************************************************/
+
+/******************** GESDD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_sgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_dgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_cgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_zgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+/********************************************************/
+
+/******************** GESVDJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvdj_strided_batched(handle, svect, m, n, A, lda, stA, abstol, residual,
+                                            max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV,
+                                            info, bc)
+        : rocsolver_sgesvdj(handle, svect, m, n, A, lda, abstol, residual, max_sweeps, n_sweeps, S,
+                            U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvdj_strided_batched(handle, svect, m, n, A, lda, stA, abstol, residual,
+                                            max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV,
+                                            info, bc)
+        : rocsolver_dgesvdj(handle, svect, m, n, A, lda, abstol, residual, max_sweeps, n_sweeps, S,
+                            U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvdj_strided_batched(handle, svect, m, n, A, lda, stA, abstol, residual,
+                                            max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV,
+                                            info, bc)
+        : rocsolver_cgesvdj(handle, svect, m, n, A, lda, abstol, residual, max_sweeps, n_sweeps, S,
+                            U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvdj_strided_batched(handle, svect, m, n, A, lda, stA, abstol, residual,
+                                            max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV,
+                                            info, bc)
+        : rocsolver_zgesvdj(handle, svect, m, n, A, lda, abstol, residual, max_sweeps, n_sweeps, S,
+                            U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdj_batched(handle, svect, m, n, A, lda, abstol, residual, max_sweeps,
+                                     n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdj_batched(handle, svect, m, n, A, lda, abstol, residual, max_sweeps,
+                                     n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdj_batched(handle, svect, m, n, A, lda, abstol, residual, max_sweeps,
+                                     n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect svect,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgesvdj_batched(handle, svect, m, n, A, lda, abstol, residual, max_sweeps,
+                                     n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+/********************************************************/
+
+/******************** GESVD_RANDOMIZED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* S,
+                                                 rocblas_stride stS,
+                                                 float* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 float* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvd_randomized_strided_batched(handle, leftv, rightv, m, n, k, p, q, A, lda,
+                                                      stA, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                                      bc)
+        : rocsolver_sgesvd_randomized(handle, leftv, rightv, m, n, k, p, q, A, lda, S, U, ldu, V,
+                                      ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* S,
+                                                 rocblas_stride stS,
+                                                 double* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 double* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvd_randomized_strided_batched(handle, leftv, rightv, m, n, k, p, q, A, lda,
+                                                      stA, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                                      bc)
+        : rocsolver_dgesvd_randomized(handle, leftv, rightv, m, n, k, p, q, A, lda, S, U, ldu, V,
+                                      ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* S,
+                                                 rocblas_stride stS,
+                                                 rocblas_float_complex* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 rocblas_float_complex* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvd_randomized_strided_batched(handle, leftv, rightv, m, n, k, p, q, A, lda,
+                                                      stA, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                                      bc)
+        : rocsolver_cgesvd_randomized(handle, leftv, rightv, m, n, k, p, q, A, lda, S, U, ldu, V,
+                                      ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* S,
+                                                 rocblas_stride stS,
+                                                 rocblas_double_complex* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 rocblas_double_complex* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvd_randomized_strided_batched(handle, leftv, rightv, m, n, k, p, q, A, lda,
+                                                      stA, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                                      bc)
+        : rocsolver_zgesvd_randomized(handle, leftv, rightv, m, n, k, p, q, A, lda, S, U, ldu, V,
+                                      ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* S,
+                                                 rocblas_stride stS,
+                                                 float* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 float* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgesvd_randomized_batched(handle, leftv, rightv, m, n, k, p, q, A, lda, S, stS,
+                                               U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* S,
+                                                 rocblas_stride stS,
+                                                 double* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 double* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgesvd_randomized_batched(handle, leftv, rightv, m, n, k, p, q, A, lda, S, stS,
+                                               U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* S,
+                                                 rocblas_stride stS,
+                                                 rocblas_float_complex* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 rocblas_float_complex* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgesvd_randomized_batched(handle, leftv, rightv, m, n, k, p, q, A, lda, S, stS,
+                                               U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_randomized(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_svect leftv,
+                                                 rocblas_svect rightv,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_int p,
+                                                 rocblas_int q,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* S,
+                                                 rocblas_stride stS,
+                                                 rocblas_double_complex* U,
+                                                 rocblas_int ldu,
+                                                 rocblas_stride stU,
+                                                 rocblas_double_complex* V,
+                                                 rocblas_int ldv,
+                                                 rocblas_stride stV,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zgesvd_randomized_batched(handle, leftv, rightv, m, n, k, p, q, A, lda, S, stS,
+                                               U, ldu, stU, V, ldv, stV, info, bc);
+}
+/********************************************************/
+
+/******************** GEPOLAR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        float* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        float* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        float* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgepolar_strided_batched(handle, svect, m, n, A, lda, stA, H, ldh, stH, S, stS,
+                                             info, bc)
+        : rocsolver_sgepolar(handle, svect, m, n, A, lda, H, ldh, S, info);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        double* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        double* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        double* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgepolar_strided_batched(handle, svect, m, n, A, lda, stA, H, ldh, stH, S, stS,
+                                             info, bc)
+        : rocsolver_dgepolar(handle, svect, m, n, A, lda, H, ldh, S, info);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_float_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_float_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        float* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgepolar_strided_batched(handle, svect, m, n, A, lda, stA, H, ldh, stH, S, stS,
+                                             info, bc)
+        : rocsolver_cgepolar(handle, svect, m, n, A, lda, H, ldh, S, info);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_double_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_double_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        double* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgepolar_strided_batched(handle, svect, m, n, A, lda, stA, H, ldh, stH, S, stS,
+                                             info, bc)
+        : rocsolver_zgepolar(handle, svect, m, n, A, lda, H, ldh, S, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        float* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        float* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        float* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_sgepolar_batched(handle, svect, m, n, A, lda, H, ldh, stH, S, stS, info, bc);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        double* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        double* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        double* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_dgepolar_batched(handle, svect, m, n, A, lda, H, ldh, stH, S, stS, info, bc);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_float_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        float* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_cgepolar_batched(handle, svect, m, n, A, lda, H, ldh, stH, S, stS, info, bc);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_svect svect,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_double_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        double* S,
+                                        rocblas_stride stS,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_zgepolar_batched(handle, svect, m, n, A, lda, H, ldh, stH, S, stS, info, bc);
+}
+/********************************************************/
+
+/******************** GETRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** SYTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                      B, ldb, stB, bc)
+                   : rocsolver_ssytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                      B, ldb, stB, bc)
+                   : rocsolver_dsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_csytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                      B, ldb, stB, bc)
+                   : rocsolver_csytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zsytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                      B, ldb, stB, bc)
+                   : rocsolver_zsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_ssytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dsytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_csytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zsytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** HETRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_hetrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_chetrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                      B, ldb, stB, bc)
+                   : rocsolver_chetrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_hetrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zhetrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                      B, ldb, stB, bc)
+                   : rocsolver_zhetrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_hetrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_chetrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_hetrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zhetrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** SYSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                     B, ldb, stB, info, bc)
+                   : rocsolver_ssysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                     B, ldb, stB, info, bc)
+                   : rocsolver_dsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_csysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                     B, ldb, stB, info, bc)
+                   : rocsolver_csysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zsysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                     B, ldb, stB, info, bc)
+                   : rocsolver_zsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_ssysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dsysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_csysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zsysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** HESV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_hesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_chesv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                     B, ldb, stB, info, bc)
+                   : rocsolver_chesv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_hesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zhesv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP,
+                                                     B, ldb, stB, info, bc)
+                   : rocsolver_zhesv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_hesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_chesv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_hesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zhesv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** TRTRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+// batched
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** GETRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* A1,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* A1,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A1,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A1,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
+}
+
+// batched and outofplace_batched
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* const A1[],
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
+        : rocsolver_sgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* const A1[],
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
+        : rocsolver_dgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A1[],
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
+        : rocsolver_cgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A1[],
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc)
+        : rocsolver_zgetri_outofplace_batched(handle, n, A1, lda, ipiv, stP, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** GEQR2_GEQRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_cgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_zgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+// ptr_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_sgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_dgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+/********************************************************/
+
+/******************** GEQL2_GEQLF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_sgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_sgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeql2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_dgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_dgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeql2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_cgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_cgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeql2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQLF ? rocsolver_zgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQLF ? rocsolver_zgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeql2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_sgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_dgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_cgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQLF ? rocsolver_zgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** GELQ2_GELQF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_sgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_sgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgelq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_dgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_dgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgelq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_cgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_cgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgelq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GELQF ? rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GELQF ? rocsolver_zgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgelq2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_sgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_dgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_cgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GELQF ? rocsolver_zgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** GEQP3 ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_cgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
+    else
+        return rocsolver_zgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** QR_UPDATE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          float* Q,
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          float* R,
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          float* X,
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          float* Y,
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sqr_update_strided_batched(handle, m, n, k, Q, ldq, stQ, R, ldr, stR,
+                                                          X, ldx, stX, Y, ldy, stY, bc)
+                   : rocsolver_sqr_update(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy);
+}
+
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          double* Q,
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          double* R,
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          double* X,
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          double* Y,
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dqr_update_strided_batched(handle, m, n, k, Q, ldq, stQ, R, ldr, stR,
+                                                          X, ldx, stX, Y, ldy, stY, bc)
+                   : rocsolver_dqr_update(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy);
+}
+
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          rocblas_float_complex* Q,
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          rocblas_float_complex* R,
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          rocblas_float_complex* X,
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          rocblas_float_complex* Y,
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cqr_update_strided_batched(handle, m, n, k, Q, ldq, stQ, R, ldr, stR,
+                                                          X, ldx, stX, Y, ldy, stY, bc)
+                   : rocsolver_cqr_update(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy);
+}
+
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          rocblas_double_complex* Q,
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          rocblas_double_complex* R,
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          rocblas_double_complex* X,
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          rocblas_double_complex* Y,
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zqr_update_strided_batched(handle, m, n, k, Q, ldq, stQ, R, ldr, stR,
+                                                          X, ldx, stX, Y, ldy, stY, bc)
+                   : rocsolver_zqr_update(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy);
+}
+
+// batched
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          float* const Q[],
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          float* const R[],
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          float* const X[],
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          float* const Y[],
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return rocsolver_sqr_update_batched(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy, bc);
+}
+
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          double* const Q[],
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          double* const R[],
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          double* const X[],
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          double* const Y[],
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return rocsolver_dqr_update_batched(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy, bc);
+}
+
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          rocblas_float_complex* const Q[],
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          rocblas_float_complex* const R[],
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          rocblas_float_complex* const X[],
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          rocblas_float_complex* const Y[],
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return rocsolver_cqr_update_batched(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy, bc);
+}
+
+inline rocblas_status rocsolver_qr_update(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_int k,
+                                          rocblas_double_complex* const Q[],
+                                          rocblas_int ldq,
+                                          rocblas_stride stQ,
+                                          rocblas_double_complex* const R[],
+                                          rocblas_int ldr,
+                                          rocblas_stride stR,
+                                          rocblas_double_complex* const X[],
+                                          rocblas_int ldx,
+                                          rocblas_stride stX,
+                                          rocblas_double_complex* const Y[],
+                                          rocblas_int ldy,
+                                          rocblas_stride stY,
+                                          rocblas_int bc)
+{
+    return rocsolver_zqr_update_batched(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy, bc);
+}
+/********************************************************/
+
+/******************** QR_INSERT_DELETE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 float* Q,
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 float* R,
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 float* x,
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return STRIDED ? rocsolver_sqr_insert_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_sqr_insert_row(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else if(ROW)
+        return STRIDED ? rocsolver_sqr_delete_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_sqr_delete_row(handle, m, n, idx, Q, ldq, R, ldr);
+    else if(INSERT)
+        return STRIDED ? rocsolver_sqr_insert_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_sqr_insert_col(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else
+        return STRIDED ? rocsolver_sqr_delete_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_sqr_delete_col(handle, m, n, idx, Q, ldq, R, ldr);
+}
+
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 double* Q,
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 double* R,
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 double* x,
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return STRIDED ? rocsolver_dqr_insert_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_dqr_insert_row(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else if(ROW)
+        return STRIDED ? rocsolver_dqr_delete_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_dqr_delete_row(handle, m, n, idx, Q, ldq, R, ldr);
+    else if(INSERT)
+        return STRIDED ? rocsolver_dqr_insert_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_dqr_insert_col(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else
+        return STRIDED ? rocsolver_dqr_delete_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_dqr_delete_col(handle, m, n, idx, Q, ldq, R, ldr);
+}
+
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 rocblas_float_complex* Q,
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 rocblas_float_complex* R,
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 rocblas_float_complex* x,
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return STRIDED ? rocsolver_cqr_insert_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_cqr_insert_row(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else if(ROW)
+        return STRIDED ? rocsolver_cqr_delete_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_cqr_delete_row(handle, m, n, idx, Q, ldq, R, ldr);
+    else if(INSERT)
+        return STRIDED ? rocsolver_cqr_insert_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_cqr_insert_col(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else
+        return STRIDED ? rocsolver_cqr_delete_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_cqr_delete_col(handle, m, n, idx, Q, ldq, R, ldr);
+}
+
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 rocblas_double_complex* Q,
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 rocblas_double_complex* R,
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 rocblas_double_complex* x,
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return STRIDED ? rocsolver_zqr_insert_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_zqr_insert_row(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else if(ROW)
+        return STRIDED ? rocsolver_zqr_delete_row_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_zqr_delete_row(handle, m, n, idx, Q, ldq, R, ldr);
+    else if(INSERT)
+        return STRIDED ? rocsolver_zqr_insert_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, x, incx, stx, bc)
+                       : rocsolver_zqr_insert_col(handle, m, n, idx, Q, ldq, R, ldr, x, incx);
+    else
+        return STRIDED ? rocsolver_zqr_delete_col_strided_batched(handle, m, n, idx, Q, ldq, stQ, R,
+                                                                  ldr, stR, bc)
+                       : rocsolver_zqr_delete_col(handle, m, n, idx, Q, ldq, R, ldr);
+}
+
+// batched
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 float* const Q[],
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 float* const R[],
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 float* const x[],
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return rocsolver_sqr_insert_row_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else if(ROW)
+        return rocsolver_sqr_delete_row_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+    else if(INSERT)
+        return rocsolver_sqr_insert_col_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else
+        return rocsolver_sqr_delete_col_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+}
+
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 double* const Q[],
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 double* const R[],
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 double* const x[],
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return rocsolver_dqr_insert_row_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else if(ROW)
+        return rocsolver_dqr_delete_row_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+    else if(INSERT)
+        return rocsolver_dqr_insert_col_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else
+        return rocsolver_dqr_delete_col_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+}
+
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 rocblas_float_complex* const Q[],
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 rocblas_float_complex* const R[],
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 rocblas_float_complex* const x[],
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return rocsolver_cqr_insert_row_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else if(ROW)
+        return rocsolver_cqr_delete_row_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+    else if(INSERT)
+        return rocsolver_cqr_insert_col_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else
+        return rocsolver_cqr_delete_col_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+}
+
+inline rocblas_status rocsolver_qr_insert_delete(bool STRIDED,
+                                                 bool ROW,
+                                                 bool INSERT,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int idx,
+                                                 rocblas_double_complex* const Q[],
+                                                 rocblas_int ldq,
+                                                 rocblas_stride stQ,
+                                                 rocblas_double_complex* const R[],
+                                                 rocblas_int ldr,
+                                                 rocblas_stride stR,
+                                                 rocblas_double_complex* const x[],
+                                                 rocblas_int incx,
+                                                 rocblas_stride stx,
+                                                 rocblas_int bc)
+{
+    if(ROW && INSERT)
+        return rocsolver_zqr_insert_row_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else if(ROW)
+        return rocsolver_zqr_delete_row_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+    else if(INSERT)
+        return rocsolver_zqr_insert_col_batched(handle, m, n, idx, Q, ldq, R, ldr, x, incx, bc);
+    else
+        return rocsolver_zqr_delete_col_batched(handle, m, n, idx, Q, ldq, R, ldr, bc);
+}
+/********************************************************/
+
+/******************** GELS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GEBD2_GEBRD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+// batched
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+/********************************************************/
+
+/******************** SYTD2/SYTRD_HETD2/HETRD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_ssytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_ssytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_ssytrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_ssytd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_dsytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_dsytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_dsytrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_dsytd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_chetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_chetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_chetrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_chetd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_zhetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_zhetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_zhetrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_zhetd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+// batched
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_ssytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_ssytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_dsytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_dsytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_chetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_chetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_zhetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_zhetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+/********************************************************/
+
+/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_ssygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_ssygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_ssygst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_ssygs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_dsygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_dsygst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_dsygs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_chegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_chegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_chegst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_chegs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_zhegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_zhegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_zhegst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_zhegs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_ssygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_ssygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_dsygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_dsygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_chegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_chegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_zhegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_zhegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** SYEV/HEEV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_ssyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_dsyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_cheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_zheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+/********************************************************/
+
+/******************** SYGV_HEGV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssygv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_ssygv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsygv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_dsygv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_float_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_chegv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_chegv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_double_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_zhegv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_ssygv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_dsygv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_float_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_chegv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect jobz,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_double_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_zhegv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+/********************************************************/
+
+/******************** SYEVD/HEEVD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
-                                            rocblas_double_complex* const A[],
+                                            double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GELQF ? rocsolver_zgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
-}
-/********************************************************/
-
-/******************** GELS ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
-}
-
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    return STRIDED ? rocsolver_dsyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    return STRIDED ? rocsolver_cheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    return STRIDED ? rocsolver_zheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_ssyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_dsyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_cheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_zheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
 }
 /********************************************************/
 
-/******************** GEBD2_GEBRD ********************/
+/******************** SYEVX_HEEVX ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    if(STRIDED)
-        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+                                            rocblas_stride stA,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_ssyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
-                                            rocblas_stride stP,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+    return STRIDED ? rocsolver_dsyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_dsyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
-                                            rocblas_stride stP,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+    return STRIDED ? rocsolver_cheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_cheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
-                                            rocblas_stride stP,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+    return STRIDED ? rocsolver_zheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_zheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
-                                            rocblas_stride stP,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_ssyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
-                                            rocblas_stride stP,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_dsyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
-                                            rocblas_stride stP,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_cheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_int m,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
-                                            rocblas_stride stP,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return rocsolver_zheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 /********************************************************/
 
-/******************** SYTD2/SYTRD_HETD2/HETRD ********************/
+/******************** SYEVJ_HEEVJ ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tau,
-                                            rocblas_stride stP,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_ssytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_ssytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_ssytrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_ssytd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_ssyevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_ssyevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tau,
-                                            rocblas_stride stP,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_dsytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_dsytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_dsytrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_dsytd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_dsyevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_dsyevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tau,
-                                            rocblas_stride stP,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_chetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_chetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_chetrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_chetd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_cheevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_cheevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tau,
-                                            rocblas_stride stP,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYTRD ? rocsolver_zhetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_zhetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
-    else
-        return SYTRD ? rocsolver_zhetrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_zhetd2(handle, uplo, n, A, lda, D, E, tau);
+    return STRIDED ? rocsolver_zheevj_strided_batched(handle, evect, uplo, n, A, lda, stA, abstol,
+                                                      residual, max_sweeps, n_sweeps, W, stW, info,
+                                                      bc)
+                   : rocsolver_zheevj(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                      n_sweeps, W, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tau,
-                                            rocblas_stride stP,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_ssytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_ssytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_ssyevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tau,
-                                            rocblas_stride stP,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_dsytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_dsytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_dsyevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tau,
-                                            rocblas_stride stP,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_chetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_chetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_cheevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tau,
-                                            rocblas_stride stP,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRD ? rocsolver_zhetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_zhetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_zheevj_batched(handle, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                                    n_sweeps, W, stW, info, bc);
 }
 /********************************************************/
 
-/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+/******************** SYGVD_HEGVD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
@@ -3308,21 +8419,24 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             float* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return SYGST
-            ? rocsolver_ssygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_ssygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    if(STRIDED)
+        return rocsolver_ssygvd_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
     else
-        return SYGST ? rocsolver_ssygst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_ssygs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_ssygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
@@ -3331,21 +8445,24 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             double* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_dsygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_dsygvd_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
     else
-        return SYGST ? rocsolver_dsygst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_dsygs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_dsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
@@ -3354,21 +8471,24 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             rocblas_float_complex* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_chegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_chegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_chegvd_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
     else
-        return SYGST ? rocsolver_chegst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_chegs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_chegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
@@ -3377,22 +8497,25 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             rocblas_double_complex* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_zhegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_zhegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_zhegvd_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
     else
-        return SYGST ? rocsolver_zhegst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_zhegs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_zhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* const A[],
@@ -3401,16 +8524,21 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             float* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_ssygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_ssygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_ssygvd_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
@@ -3419,16 +8547,21 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             double* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_dsygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_dsygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_dsygvd_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
@@ -3437,16 +8570,21 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             rocblas_float_complex* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYGST ? rocsolver_chegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_chegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_chegvd_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
+                                            rocblas_evect jobz,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
@@ -3455,365 +8593,294 @@ inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
                                             rocblas_double_complex* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            rocblas_int bc)
-{
-    return SYGST ? rocsolver_zhegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_zhegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
-}
-/********************************************************/
-
-/******************** SYEV/HEEV ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return STRIDED ? rocsolver_ssyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
-}
-
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return STRIDED ? rocsolver_dsyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
-}
-
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return STRIDED ? rocsolver_cheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
-}
-
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return STRIDED ? rocsolver_zheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
-}
-
-// batched
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return rocsolver_ssyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
-}
-
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return rocsolver_dsyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
-}
-
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return rocsolver_cheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
-}
-
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    return rocsolver_zheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
-}
-/********************************************************/
-
-/******************** SYGV_HEGV ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_ssygv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_ssygv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+    return rocsolver_zhegvd_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+/******************** SYGVX_HEGVX ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_dsygv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_dsygv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_ssygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_ssygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          rocblas_float_complex* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_chegv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_chegv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_dsygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_dsygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          rocblas_double_complex* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zhegv_strided_batched(handle, itype, jobz, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_zhegv(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_chegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_chegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zhegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_zhegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_ssygv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_ssygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_dsygv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_dsygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          rocblas_float_complex* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_chegv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_chegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect jobz,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          rocblas_double_complex* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
 {
-    return rocsolver_zhegv_batched(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_zhegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 /********************************************************/
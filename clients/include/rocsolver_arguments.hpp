@@ -19,6 +19,8 @@ public:
     rocblas_int S4 = 128;
     rocblas_int k1 = 1;
     rocblas_int k2 = 2;
+    rocblas_int oversample = 10;
+    rocblas_int power_iters = 2;
 
     rocblas_int lda = 128;
     rocblas_int ldb = 128;
@@ -37,6 +39,13 @@ public:
 
     double alpha = 1.0;
     double beta = 0.0;
+    double tol = -1.0;
+    double vl = 0.0;
+    double vu = 1.0;
+    rocblas_int il = 1;
+    rocblas_int iu = 1;
+    double abstol = 0.0;
+    rocblas_int max_sweeps = 100;
 
     char transA_option = 'N';
     char transB_option = 'N';
@@ -49,6 +58,9 @@ public:
     char left_svect = 'N';
     char right_svect = 'N';
     char evect = 'N';
+    char norm_type = '1';
+    char erange = 'A';
+    char eorder = 'E';
 
     rocblas_int apiCallCount = 1;
     rocblas_int batch_count = 5;
@@ -9,24 +9,38 @@
 #include <map>
 #include <string>
 
+#include "testing_bdsdc.hpp"
 #include "testing_bdsqr.hpp"
+#include "testing_bdsvals.hpp"
 #include "testing_gebd2_gebrd.hpp"
+#include "testing_gecon.hpp"
 #include "testing_gelq2_gelqf.hpp"
 #include "testing_gels.hpp"
 #include "testing_geql2_geqlf.hpp"
+#include "testing_gepolar.hpp"
+#include "testing_geqp3.hpp"
 #include "testing_geqr2_geqrf.hpp"
+#include "testing_gesdd.hpp"
 #include "testing_gesvd.hpp"
+#include "testing_gesvd_randomized.hpp"
+#include "testing_gesvdj.hpp"
 #include "testing_getf2_getrf.hpp"
 #include "testing_getf2_getrf_npvt.hpp"
 #include "testing_getri.hpp"
 #include "testing_getrs.hpp"
+#include "testing_hesv.hpp"
+#include "testing_hetf2_hetrf.hpp"
+#include "testing_hetrs.hpp"
 #include "testing_labrd.hpp"
 #include "testing_lacgv.hpp"
 #include "testing_larf.hpp"
 #include "testing_larfb.hpp"
 #include "testing_larfg.hpp"
 #include "testing_larft.hpp"
+#include "testing_lange.hpp"
+#include "testing_lansy_lanhe.hpp"
 #include "testing_laswp.hpp"
+#include "testing_lauum.hpp"
 #include "testing_latrd.hpp"
 #include "testing_orgbr_ungbr.hpp"
 #include "testing_orglx_unglx.hpp"
@@ -38,13 +52,32 @@
 #include "testing_ormtr_unmtr.hpp"
 #include "testing_ormxl_unmxl.hpp"
 #include "testing_ormxr_unmxr.hpp"
+#include "testing_pocon.hpp"
 #include "testing_potf2_potrf.hpp"
+#include "testing_potri.hpp"
+#include "testing_potrf_update.hpp"
+#include "testing_pstrf.hpp"
+#include "testing_qr_insert_delete.hpp"
+#include "testing_qr_update.hpp"
+#include "testing_stebz.hpp"
+#include "testing_stedc.hpp"
+#include "testing_stein.hpp"
 #include "testing_steqr.hpp"
 #include "testing_sterf.hpp"
 #include "testing_syev_heev.hpp"
+#include "testing_syevd_heevd.hpp"
+#include "testing_syevj_heevj.hpp"
+#include "testing_syevx_heevx.hpp"
 #include "testing_sygsx_hegsx.hpp"
 #include "testing_sygv_hegv.hpp"
+#include "testing_sygvd_hegvd.hpp"
+#include "testing_sygvx_hegvx.hpp"
+#include "testing_sysv.hpp"
+#include "testing_sytf2_sytrf.hpp"
+#include "testing_sytrs.hpp"
 #include "testing_sytxx_hetxx.hpp"
+#include "testing_trcon.hpp"
+#include "testing_trtri.hpp"
 
 struct str_less
 {
@@ -66,6 +99,7 @@ class rocsolver_dispatcher
         // Map for functions that support all precisions
         static const func_map map = {
             {"laswp", testing_laswp<T>},
+            {"lauum", testing_lauum<T>},
             {"larfg", testing_larfg<T>},
             {"larf", testing_larf<T>},
             {"larft", testing_larft<T>},
@@ -74,6 +108,8 @@ class rocsolver_dispatcher
             {"labrd", testing_labrd<T>},
             {"bdsqr", testing_bdsqr<T>},
             {"steqr", testing_steqr<T>},
+            {"stedc", testing_stedc<T>},
+            {"stein", testing_stein<T>},
             // potrf
             {"potf2", testing_potf2_potrf<false, false, 0, T>},
             {"potf2_batched", testing_potf2_potrf<true, true, 0, T>},
@@ -81,6 +117,37 @@ class rocsolver_dispatcher
             {"potrf", testing_potf2_potrf<false, false, 1, T>},
             {"potrf_batched", testing_potf2_potrf<true, true, 1, T>},
             {"potrf_strided_batched", testing_potf2_potrf<false, true, 1, T>},
+            // potri
+            {"potri", testing_potri<false, false, T>},
+            {"potri_batched", testing_potri<true, true, T>},
+            {"potri_strided_batched", testing_potri<false, true, T>},
+            // lange
+            {"lange", testing_lange<false, false, T>},
+            {"lange_batched", testing_lange<true, true, T>},
+            {"lange_strided_batched", testing_lange<false, true, T>},
+            // gecon
+            {"gecon", testing_gecon<false, false, T>},
+            {"gecon_batched", testing_gecon<true, true, T>},
+            {"gecon_strided_batched", testing_gecon<false, true, T>},
+            // pocon
+            {"pocon", testing_pocon<false, false, T>},
+            {"pocon_batched", testing_pocon<true, true, T>},
+            {"pocon_strided_batched", testing_pocon<false, true, T>},
+            // trcon
+            {"trcon", testing_trcon<false, false, T>},
+            {"trcon_batched", testing_trcon<true, true, T>},
+            {"trcon_strided_batched", testing_trcon<false, true, T>},
+            // potrf_update
+            {"potrf_update", testing_potrf_update<false, false, 0, T>},
+            {"potrf_update_batched", testing_potrf_update<true, true, 0, T>},
+            {"potrf_update_strided_batched", testing_potrf_update<false, true, 0, T>},
+            {"potrf_downdate", testing_potrf_update<false, false, 1, T>},
+            {"potrf_downdate_batched", testing_potrf_update<true, true, 1, T>},
+            {"potrf_downdate_strided_batched", testing_potrf_update<false, true, 1, T>},
+            // pstrf
+            {"pstrf", testing_pstrf<false, false, T>},
+            {"pstrf_batched", testing_pstrf<true, true, T>},
+            {"pstrf_strided_batched", testing_pstrf<false, true, T>},
             // getrf_npvt
             {"getf2_npvt", testing_getf2_getrf_npvt<false, false, 0, T>},
             {"getf2_npvt_batched", testing_getf2_getrf_npvt<true, true, 0, T>},
@@ -95,6 +162,13 @@ class rocsolver_dispatcher
             {"getrf", testing_getf2_getrf<false, false, 1, T>},
             {"getrf_batched", testing_getf2_getrf<true, true, 1, T>},
             {"getrf_strided_batched", testing_getf2_getrf<false, true, 1, T>},
+            // sytrf
+            {"sytf2", testing_sytf2_sytrf<false, false, 0, T>},
+            {"sytf2_batched", testing_sytf2_sytrf<true, true, 0, T>},
+            {"sytf2_strided_batched", testing_sytf2_sytrf<false, true, 0, T>},
+            {"sytrf", testing_sytf2_sytrf<false, false, 1, T>},
+            {"sytrf_batched", testing_sytf2_sytrf<true, true, 1, T>},
+            {"sytrf_strided_batched", testing_sytf2_sytrf<false, true, 1, T>},
             // geqrf
             {"geqr2", testing_geqr2_geqrf<false, false, 0, T>},
             {"geqr2_batched", testing_geqr2_geqrf<true, true, 0, T>},
@@ -117,14 +191,69 @@ class rocsolver_dispatcher
             {"gelqf", testing_gelq2_gelqf<false, false, 1, T>},
             {"gelqf_batched", testing_gelq2_gelqf<true, true, 1, T>},
             {"gelqf_strided_batched", testing_gelq2_gelqf<false, true, 1, T>},
+            // geqp3
+            {"geqp3", testing_geqp3<false, false, T>},
+            {"geqp3_batched", testing_geqp3<true, true, T>},
+            {"geqp3_strided_batched", testing_geqp3<false, true, T>},
+            // qr_update
+            {"qr_update", testing_qr_update<false, false, T>},
+            {"qr_update_batched", testing_qr_update<true, true, T>},
+            {"qr_update_strided_batched", testing_qr_update<false, true, T>},
+            // qr_insert_col
+            {"qr_insert_col", testing_qr_insert_delete<false, false, false, true, T>},
+            {"qr_insert_col_batched", testing_qr_insert_delete<true, true, false, true, T>},
+            {"qr_insert_col_strided_batched",
+             testing_qr_insert_delete<false, true, false, true, T>},
+            // qr_delete_col
+            {"qr_delete_col", testing_qr_insert_delete<false, false, false, false, T>},
+            {"qr_delete_col_batched", testing_qr_insert_delete<true, true, false, false, T>},
+            {"qr_delete_col_strided_batched",
+             testing_qr_insert_delete<false, true, false, false, T>},
+            // qr_insert_row
+            {"qr_insert_row", testing_qr_insert_delete<false, false, true, true, T>},
+            {"qr_insert_row_batched", testing_qr_insert_delete<true, true, true, true, T>},
+            {"qr_insert_row_strided_batched", testing_qr_insert_delete<false, true, true, true, T>},
+            // qr_delete_row
+            {"qr_delete_row", testing_qr_insert_delete<false, false, true, false, T>},
+            {"qr_delete_row_batched", testing_qr_insert_delete<true, true, true, false, T>},
+            {"qr_delete_row_strided_batched",
+             testing_qr_insert_delete<false, true, true, false, T>},
             // getrs
             {"getrs", testing_getrs<false, false, T>},
             {"getrs_batched", testing_getrs<true, true, T>},
             {"getrs_strided_batched", testing_getrs<false, true, T>},
+            // sytrs
+            {"sytrs", testing_sytrs<false, false, T>},
+            {"sytrs_batched", testing_sytrs<true, true, T>},
+            {"sytrs_strided_batched", testing_sytrs<false, true, T>},
+            // sysv
+            {"sysv", testing_sysv<false, false, T>},
+            {"sysv_batched", testing_sysv<true, true, T>},
+            {"sysv_strided_batched", testing_sysv<false, true, T>},
             // gesvd
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
             {"gesvd_strided_batched", testing_gesvd<false, true, T>},
+            // gesdd
+            {"gesdd", testing_gesdd<false, false, T>},
+            {"gesdd_batched", testing_gesdd<true, true, T>},
+            {"gesdd_strided_batched", testing_gesdd<false, true, T>},
+            // gesvdj
+            {"gesvdj", testing_gesvdj<false, false, T>},
+            {"gesvdj_batched", testing_gesvdj<true, true, T>},
+            {"gesvdj_strided_batched", testing_gesvdj<false, true, T>},
+            // gesvd_randomized
+            {"gesvd_randomized", testing_gesvd_randomized<false, false, T>},
+            {"gesvd_randomized_batched", testing_gesvd_randomized<true, true, T>},
+            {"gesvd_randomized_strided_batched", testing_gesvd_randomized<false, true, T>},
+            // gepolar
+            {"gepolar", testing_gepolar<false, false, T>},
+            {"gepolar_batched", testing_gepolar<true, true, T>},
+            {"gepolar_strided_batched", testing_gepolar<false, true, T>},
+            // trtri
+            {"trtri", testing_trtri<false, false, T>},
+            {"trtri_batched", testing_trtri<true, true, T>},
+            {"trtri_strided_batched", testing_trtri<false, true, T>},
             // getri
             {"getri", testing_getri<false, false, T>},
             {"getri_batched", testing_getri<true, true, T>},
@@ -160,6 +289,9 @@ class rocsolver_dispatcher
         // Map for functions that support single and double precisions
         static const func_map map_real = {
             {"sterf", testing_sterf<T>},
+            {"stebz", testing_stebz<T>},
+            {"bdsdc", testing_bdsdc<T>},
+            {"bdsvals", testing_bdsvals<T>},
             // orgxx
             {"org2r", testing_orgxr_ungxr<T, 0>},
             {"orgqr", testing_orgxr_ungxr<T, 1>},
@@ -192,14 +324,38 @@ class rocsolver_dispatcher
             {"sygst", testing_sygsx_hegsx<false, false, 1, T>},
             {"sygst_batched", testing_sygsx_hegsx<true, true, 1, T>},
             {"sygst_strided_batched", testing_sygsx_hegsx<false, true, 1, T>},
+            // lansy
+            {"lansy", testing_lansy_lanhe<false, false, T>},
+            {"lansy_batched", testing_lansy_lanhe<true, true, T>},
+            {"lansy_strided_batched", testing_lansy_lanhe<false, true, T>},
             // syev
             {"syev", testing_syev_heev<false, false, T>},
             {"syev_batched", testing_syev_heev<true, true, T>},
             {"syev_strided_batched", testing_syev_heev<false, true, T>},
+            // syevd
+            {"syevd", testing_syevd_heevd<false, false, T>},
+            {"syevd_batched", testing_syevd_heevd<true, true, T>},
+            {"syevd_strided_batched", testing_syevd_heevd<false, true, T>},
+            // syevx
+            {"syevx", testing_syevx_heevx<false, false, T>},
+            {"syevx_batched", testing_syevx_heevx<true, true, T>},
+            {"syevx_strided_batched", testing_syevx_heevx<false, true, T>},
+            // syevj
+            {"syevj", testing_syevj_heevj<false, false, T>},
+            {"syevj_batched", testing_syevj_heevj<true, true, T>},
+            {"syevj_strided_batched", testing_syevj_heevj<false, true, T>},
             // sygv
             {"sygv", testing_sygv_hegv<false, false, T>},
             {"sygv_batched", testing_sygv_hegv<true, true, T>},
             {"sygv_strided_batched", testing_sygv_hegv<false, true, T>},
+            // sygvd
+            {"sygvd", testing_sygvd_hegvd<false, false, T>},
+            {"sygvd_batched", testing_sygvd_hegvd<true, true, T>},
+            {"sygvd_strided_batched", testing_sygvd_hegvd<false, true, T>},
+            // sygvx
+            {"sygvx", testing_sygvx_hegvx<false, false, T>},
+            {"sygvx_batched", testing_sygvx_hegvx<true, true, T>},
+            {"sygvx_strided_batched", testing_sygvx_hegvx<false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -251,14 +407,53 @@ class rocsolver_dispatcher
             {"hegst", testing_sygsx_hegsx<false, false, 1, T>},
             {"hegst_batched", testing_sygsx_hegsx<true, true, 1, T>},
             {"hegst_strided_batched", testing_sygsx_hegsx<false, true, 1, T>},
+            // lanhe
+            {"lanhe", testing_lansy_lanhe<false, false, T>},
+            {"lanhe_batched", testing_lansy_lanhe<true, true, T>},
+            {"lanhe_strided_batched", testing_lansy_lanhe<false, true, T>},
             // heev
             {"heev", testing_syev_heev<false, false, T>},
             {"heev_batched", testing_syev_heev<true, true, T>},
             {"heev_strided_batched", testing_syev_heev<false, true, T>},
+            // heevd
+            {"heevd", testing_syevd_heevd<false, false, T>},
+            {"heevd_batched", testing_syevd_heevd<true, true, T>},
+            {"heevd_strided_batched", testing_syevd_heevd<false, true, T>},
+            // heevx
+            {"heevx", testing_syevx_heevx<false, false, T>},
+            {"heevx_batched", testing_syevx_heevx<true, true, T>},
+            {"heevx_strided_batched", testing_syevx_heevx<false, true, T>},
+            // heevj
+            {"heevj", testing_syevj_heevj<false, false, T>},
+            {"heevj_batched", testing_syevj_heevj<true, true, T>},
+            {"heevj_strided_batched", testing_syevj_heevj<false, true, T>},
             // hegv
             {"hegv", testing_sygv_hegv<false, false, T>},
             {"hegv_batched", testing_sygv_hegv<true, true, T>},
             {"hegv_strided_batched", testing_sygv_hegv<false, true, T>},
+            // hegvd
+            {"hegvd", testing_sygvd_hegvd<false, false, T>},
+            {"hegvd_batched", testing_sygvd_hegvd<true, true, T>},
+            {"hegvd_strided_batched", testing_sygvd_hegvd<false, true, T>},
+            // hegvx
+            {"hegvx", testing_sygvx_hegvx<false, false, T>},
+            {"hegvx_batched", testing_sygvx_hegvx<true, true, T>},
+            {"hegvx_strided_batched", testing_sygvx_hegvx<false, true, T>},
+            // hetrf
+            {"hetf2", testing_hetf2_hetrf<false, false, 0, T>},
+            {"hetf2_batched", testing_hetf2_hetrf<true, true, 0, T>},
+            {"hetf2_strided_batched", testing_hetf2_hetrf<false, true, 0, T>},
+            {"hetrf", testing_hetf2_hetrf<false, false, 1, T>},
+            {"hetrf_batched", testing_hetf2_hetrf<true, true, 1, T>},
+            {"hetrf_strided_batched", testing_hetf2_hetrf<false, true, 1, T>},
+            // hetrs
+            {"hetrs", testing_hetrs<false, false, T>},
+            {"hetrs_batched", testing_hetrs<true, true, T>},
+            {"hetrs_strided_batched", testing_hetrs<false, true, T>},
+            // hesv
+            {"hesv", testing_hesv<false, false, T>},
+            {"hesv_batched", testing_hesv<true, true, T>},
+            {"hesv_strided_batched", testing_hesv<false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -0,0 +1,516 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <typename T>
+void bdsdc_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_svect svect,
+                        const rocblas_int n,
+                        T dD,
+                        T dE,
+                        T dU,
+                        const rocblas_int ldu,
+                        T dV,
+                        const rocblas_int ldv,
+                        rocblas_int* dinfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(nullptr, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, dinfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, rocblas_fill_full, svect, n, dD, dE, dU, ldu, dV,
+                                          ldv, dinfo),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, rocblas_svect_all, n, dD, dE, dU, ldu, dV,
+                                          ldv, dinfo),
+                          rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, (T) nullptr, dE, dU, ldu, dV, ldv, dinfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, (T) nullptr, dU, ldu, dV, ldv, dinfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, dE, (T) nullptr, ldu, dV, ldv, dinfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, dE, dU, ldu, (T) nullptr, ldv, dinfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, (rocblas_int*)nullptr),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, 0, (T) nullptr, (T) nullptr,
+                                          (T) nullptr, ldu, (T) nullptr, ldv, dinfo),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_bdsdc_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_svect svect = rocblas_svect_singular;
+    rocblas_int n = 2;
+    rocblas_int ldu = 2;
+    rocblas_int ldv = 2;
+
+    // memory allocations
+    device_strided_batch_vector<T> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dE(1, 1, 1, 1);
+    device_strided_batch_vector<T> dU(1, 1, 1, 1);
+    device_strided_batch_vector<T> dV(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // check bad arguments
+    bdsdc_checkBadArgs(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(), ldu, dV.data(), ldv,
+                       dinfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void bdsdc_initData(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_svect svect,
+                    const rocblas_int n,
+                    Td& dD,
+                    Td& dE,
+                    Ud& dInfo,
+                    Th& hD,
+                    Th& hE,
+                    Uh& hInfo,
+                    std::vector<T>& D,
+                    std::vector<T>& E,
+                    const rocblas_int singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hD, true);
+        rocblas_init<T>(hE, false);
+
+        // Adding possible gaps to fully test the algorithm.
+        for(rocblas_int i = 0; i < n - 1; ++i)
+        {
+            hE[0][i] -= 5;
+            hD[0][i] -= 4;
+        }
+        hD[0][n - 1] -= 4;
+
+        // When required, use matrices with small singular values that are hard to
+        // resolve: graded matrices with some zeros in the diagonal (singular = 1),
+        // or matrices with a cluster of tiny singular values (singular = 2)
+        const T eps = get_epsilon<T>();
+        if(singular == 1 && n > 1)
+        {
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                T scal = std::pow(eps, T(2 * i) / T(n - 1));
+                hD[0][i] = (i % 7 == 3) ? 0 : hD[0][i] * scal;
+                if(i < n - 1)
+                    hE[0][i] *= scal;
+            }
+        }
+        if(singular == 2)
+        {
+            for(rocblas_int i = n / 2; i < n; ++i)
+            {
+                hD[0][i] *= eps * eps;
+                if(i < n - 1)
+                    hE[0][i] *= eps * eps;
+            }
+        }
+
+        // make copy of original data to test vectors if required
+        if(svect != rocblas_svect_none)
+        {
+            for(rocblas_int i = 0; i < n - 1; ++i)
+            {
+                E[i] = hE[0][i];
+                D[i] = hD[0][i];
+            }
+            D[n - 1] = hD[0][n - 1];
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dE.transfer_from(hE));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void bdsdc_getError(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_svect svect,
+                    const rocblas_int n,
+                    Td& dD,
+                    Td& dE,
+                    Td& dU,
+                    const rocblas_int ldu,
+                    Td& dV,
+                    const rocblas_int ldv,
+                    Ud& dInfo,
+                    Th& hD,
+                    Th& hDRes,
+                    Th& hE,
+                    Th& hU,
+                    Th& hV,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    double* max_errv,
+                    const rocblas_int singular)
+{
+    std::vector<T> hW(4 * n);
+    std::vector<rocblas_int> hIW(8 * n);
+    std::vector<T> D(n);
+    std::vector<T> E(n);
+
+    // input data initialization
+    bdsdc_initData<true, true, T>(handle, uplo, svect, n, dD, dE, dInfo, hD, hE, hInfo, D, E,
+                                  singular);
+
+    // execute computations
+    // CPU lapack (only the singular values are compared explicitly)
+    cblas_bdsdc<T>(uplo, rocblas_svect_none, n, hD[0], hE[0], (T*)nullptr, 1, (T*)nullptr, 1,
+                   hW.data(), hIW.data(), hInfo[0]);
+
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(),
+                                        ldu, dV.data(), ldv, dInfo.data()));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    if(svect != rocblas_svect_none)
+    {
+        CHECK_HIP_ERROR(hU.transfer_from(dU));
+        CHECK_HIP_ERROR(hV.transfer_from(dV));
+    }
+
+    // Check info for non-covergence
+    *max_err = 0;
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err = 1;
+
+    // error is ||hD - hDRes||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    double err;
+    T tmp;
+    *max_errv = 0;
+    err = norm_error('F', 1, n, 1, hD[0], hDRes[0]);
+    *max_err = err > *max_err ? err : *max_err;
+
+    // Check the singular vectors if required
+    if(hInfoRes[0][0] == 0 && svect != rocblas_svect_none)
+    {
+        // check singular vectors implicitly (B*v_k = s_k*u_k and B'*u_k = s_k*v_k).
+        // Both relations are needed to validate the vectors of zero singular values.
+        // (The right singular vectors are stored as rows of V)
+        err = 0;
+        bool upper = (uplo == rocblas_fill_upper);
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                // row i of B*v_k
+                tmp = D[i] * hV[0][k + i * ldv];
+                if(upper && i < n - 1)
+                    tmp += E[i] * hV[0][k + (i + 1) * ldv];
+                if(!upper && i > 0)
+                    tmp += E[i - 1] * hV[0][k + (i - 1) * ldv];
+                tmp -= hDRes[0][k] * hU[0][i + k * ldu];
+                err += tmp * tmp;
+
+                // row i of B'*u_k
+                tmp = D[i] * hU[0][i + k * ldu];
+                if(upper && i > 0)
+                    tmp += E[i - 1] * hU[0][(i - 1) + k * ldu];
+                if(!upper && i < n - 1)
+                    tmp += E[i] * hU[0][(i + 1) + k * ldu];
+                tmp -= hDRes[0][k] * hV[0][k + i * ldv];
+                err += tmp * tmp;
+            }
+        }
+
+        double normD = double(snorm('F', 1, n, D.data(), 1));
+        double normE = double(snorm('F', 1, n - 1, E.data(), 1));
+        err = std::sqrt(err) / std::sqrt(normD * normD + normE * normE);
+        *max_errv = err > *max_errv ? err : *max_errv;
+
+        // check orthonormality of the singular vectors: ||U'*U - I|| and ||V*V' - I||
+        // (the right singular vectors are stored as rows of V)
+        double erru = 0, errv = 0;
+        for(rocblas_int i = 0; i < n; ++i)
+        {
+            for(rocblas_int j = 0; j < n; ++j)
+            {
+                T tmpu = (i == j) ? -1 : 0;
+                T tmpv = (i == j) ? -1 : 0;
+                for(rocblas_int k = 0; k < n; ++k)
+                {
+                    tmpu += hU[0][k + i * ldu] * hU[0][k + j * ldu];
+                    tmpv += hV[0][i + k * ldv] * hV[0][j + k * ldv];
+                }
+                erru += tmpu * tmpu;
+                errv += tmpv * tmpv;
+            }
+        }
+        err = std::max(std::sqrt(erru), std::sqrt(errv));
+        *max_errv = err > *max_errv ? err : *max_errv;
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void bdsdc_getPerfData(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_svect svect,
+                       const rocblas_int n,
+                       Td& dD,
+                       Td& dE,
+                       Td& dU,
+                       const rocblas_int ldu,
+                       Td& dV,
+                       const rocblas_int ldv,
+                       Ud& dInfo,
+                       Th& hD,
+                       Th& hE,
+                       Th& hU,
+                       Th& hV,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf,
+                       const rocblas_int singular)
+{
+    std::vector<T> hW(3 * n * n + 4 * n);
+    std::vector<rocblas_int> hIW(8 * n);
+    std::vector<T> D(n);
+    std::vector<T> E(n);
+
+    if(!perf)
+    {
+        bdsdc_initData<true, false, T>(handle, uplo, svect, n, dD, dE, dInfo, hD, hE, hInfo, D, E,
+                                       singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_bdsdc<T>(uplo, svect, n, hD[0], hE[0], hU[0], ldu, hV[0], ldv, hW.data(), hIW.data(),
+                       hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    bdsdc_initData<true, false, T>(handle, uplo, svect, n, dD, dE, dInfo, hD, hE, hInfo, D, E,
+                                   singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        bdsdc_initData<false, true, T>(handle, uplo, svect, n, dD, dE, dInfo, hD, hE, hInfo, D, E,
+                                       singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(),
+                                            ldu, dV.data(), ldv, dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        bdsdc_initData<false, true, T>(handle, uplo, svect, n, dD, dE, dInfo, hD, hE, hInfo, D, E,
+                                       singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(), ldu, dV.data(),
+                        ldv, dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_bdsdc(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int ldu = argus.ldb;
+    rocblas_int ldv = argus.ldv;
+    char uploC = argus.uplo_option;
+    char svectC = argus.left_svect;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_svect svect = char2rocblas_svect(svectC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if((uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+       || (svect != rocblas_svect_singular && svect != rocblas_svect_none))
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, n, (T*)nullptr, (T*)nullptr,
+                                              (T*)nullptr, ldu, (T*)nullptr, ldv,
+                                              (rocblas_int*)nullptr),
+                              rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    // E, U and V could have size zero in cases that are not quick-return or
+    // invalid cases setting the size to one to avoid possible memory-access
+    // errors in the rest of the unit test
+    size_t size_D = size_t(n);
+    size_t size_E = n > 1 ? size_t(n - 1) : 1;
+    size_t size_U = svect == rocblas_svect_singular ? max(size_t(ldu) * n, 1) : 1;
+    size_t size_V = svect == rocblas_svect_singular ? max(size_t(ldv) * n, 1) : 1;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    size_t size_DRes = (argus.unit_check || argus.norm_check) ? size_D : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || ldu < 1 || ldv < 1)
+        || (svect == rocblas_svect_singular && (ldu < n || ldv < n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, n, (T*)nullptr, (T*)nullptr,
+                                              (T*)nullptr, ldu, (T*)nullptr, ldv,
+                                              (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_bdsdc(handle, uplo, svect, n, (T*)nullptr, (T*)nullptr,
+                                          (T*)nullptr, ldu, (T*)nullptr, ldv,
+                                          (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hDRes(size_DRes, 1, size_DRes, 1);
+    host_strided_batch_vector<T> hE(size_E, 1, size_E, 1);
+    host_strided_batch_vector<T> hU(size_U, 1, size_U, 1);
+    host_strided_batch_vector<T> hV(size_V, 1, size_V, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dE(size_E, 1, size_E, 1);
+    device_strided_batch_vector<T> dU(size_U, 1, size_U, 1);
+    device_strided_batch_vector<T> dV(size_V, 1, size_V, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(),
+                                              dU.data(), ldu, dV.data(), ldv, dInfo.data()),
+                              rocblas_status_success);
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        bdsdc_getError<T>(handle, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, dInfo, hD, hDRes, hE,
+                          hU, hV, hInfo, hInfoRes, &max_error, &max_errorv, argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        bdsdc_getPerfData<T>(handle, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, dInfo, hD, hE, hU,
+                             hV, hInfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.perf,
+                             argus.singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance for the singular values, and
+    // 2 * n * machine_precision for the singular vectors (as in GESVD)
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+        if(svect != rocblas_svect_none)
+            ROCSOLVER_TEST_CHECK(T, max_errorv, 2 * n);
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            if(svect != rocblas_svect_none)
+                max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            rocsolver_bench_output("uplo", "svect", "n", "ldu", "ldv");
+            rocsolver_bench_output(uploC, svectC, n, ldu, ldv);
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -11,7 +11,7 @@
 #include "rocsolver_arguments.hpp"
 #include "rocsolver_test.hpp"
 
-template <bool BATCHED, bool STRIDED, typename U>
+template <bool BATCHED, bool STRIDED, bool COMPLEX, typename U>
 void gels_checkBadArgs(const rocblas_handle handle,
                        const rocblas_operation trans,
                        const rocblas_int m,
@@ -36,6 +36,16 @@ void gels_checkBadArgs(const rocblas_handle handle,
                                          lda, stA, dB, ldb, stB, info, bc),
                           rocblas_status_invalid_value)
         << "Must report error when operation is invalid";
+    if(COMPLEX)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, rocblas_operation_transpose, m, n,
+                                             nrhs, dA, lda, stA, dB, ldb, stB, info, bc),
+                              rocblas_status_invalid_value)
+            << "Must report error when operation is transpose for complex types";
+    else
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, rocblas_operation_conjugate_transpose,
+                                             m, n, nrhs, dA, lda, stA, dB, ldb, stB, info, bc),
+                              rocblas_status_invalid_value)
+            << "Must report error when operation is conjugate transpose for real types";
 
     // sizes (only check batch_count if applicable)
     if(STRIDED)
@@ -61,7 +71,7 @@ void gels_checkBadArgs(const rocblas_handle handle,
     // quick return with invalid pointers
     EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, 0, n, nrhs, (U) nullptr, lda, stA,
                                          dB, ldb, stB, info, bc),
-                          rocblas_status_not_implemented) // TODO: replace with success
+                          rocblas_status_success)
         << "Matrix A may be null when m is 0 (empty matrix)";
     EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, 0, nrhs, (U) nullptr, lda, stA,
                                          dB, ldb, stB, info, bc),
@@ -88,7 +98,7 @@ void gels_checkBadArgs(const rocblas_handle handle,
             rocblas_status_success);
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
+template <bool BATCHED, bool STRIDED, typename T, bool COMPLEX = is_complex<T>>
 void testing_gels_bad_arg()
 {
     // safe arguments
@@ -113,8 +123,8 @@ void testing_gels_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         // check bad arguments
-        gels_checkBadArgs<BATCHED, STRIDED>(handle, trans, m, n, nrhs, dA.data(), lda, stA,
-                                            dB.data(), ldb, stB, dInfo.data(), bc);
+        gels_checkBadArgs<BATCHED, STRIDED, COMPLEX>(handle, trans, m, n, nrhs, dA.data(), lda,
+                                                     stA, dB.data(), ldb, stB, dInfo.data(), bc);
     }
     else
     {
@@ -127,8 +137,8 @@ void testing_gels_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         // check bad arguments
-        gels_checkBadArgs<BATCHED, STRIDED>(handle, trans, m, n, nrhs, dA.data(), lda, stA,
-                                            dB.data(), ldb, stB, dInfo.data(), bc);
+        gels_checkBadArgs<BATCHED, STRIDED, COMPLEX>(handle, trans, m, n, nrhs, dA.data(), lda,
+                                                     stA, dB.data(), ldb, stB, dInfo.data(), bc);
     }
 }
 
@@ -257,8 +267,7 @@ void gels_getError(const rocblas_handle handle,
     *max_err = 0;
     for(rocblas_int b = 0; b < bc; ++b)
     {
-        const rocblas_int rowsB = (trans == rocblas_operation_none) ? m : n;
-        err = norm_error('I', rowsB, nrhs, ldb, hB[b], hBRes[b]);
+        err = norm_error('I', std::max(m, n), nrhs, ldb, hB[b], hBRes[b]);
         *max_err = err > *max_err ? err : *max_err;
     }
 
@@ -337,7 +346,7 @@ void gels_getPerfData(const rocblas_handle handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
+template <bool BATCHED, bool STRIDED, typename T, bool COMPLEX = is_complex<T>>
 void testing_gels(Arguments argus)
 {
     // get arguments
@@ -357,12 +366,20 @@ void testing_gels(Arguments argus)
     rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
 
     // check non-supported values
-    if(m < n || trans == rocblas_operation_transpose || trans == rocblas_operation_conjugate_transpose)
+    bool invalid_value = ((COMPLEX && trans == rocblas_operation_transpose)
+                          || (!COMPLEX && trans == rocblas_operation_conjugate_transpose));
+    if(invalid_value)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, (T* const*)nullptr,
-                                             lda, stA, (T* const*)nullptr, ldb, stB,
-                                             (rocblas_int*)nullptr, bc),
-                              rocblas_status_not_implemented);
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs,
+                                                 (T* const*)nullptr, lda, stA, (T* const*)nullptr,
+                                                 ldb, stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, (T*)nullptr,
+                                                 lda, stA, (T*)nullptr, ldb, stB,
+                                                 (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
 
         if(argus.timing)
             ROCSOLVER_BENCH_INFORM(2);
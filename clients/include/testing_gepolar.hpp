@@ -0,0 +1,643 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename TT, typename W, typename U>
+void gepolar_checkBadArgs(const rocblas_handle handle,
+                          const rocblas_svect svect,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          W dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          T dH,
+                          const rocblas_int ldh,
+                          const rocblas_stride stH,
+                          TT dS,
+                          const rocblas_stride stS,
+                          U dinfo,
+                          const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, nullptr, svect, m, n, dA, lda, stA, dH, ldh,
+                                            stH, dS, stS, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, rocblas_svect(-1), m, n, dA, lda, stA,
+                                            dH, ldh, stH, dS, stS, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, rocblas_svect_all, m, n, dA, lda, stA,
+                                            dH, ldh, stH, dS, stS, dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA, lda, stA, dH,
+                                                ldh, stH, dS, stS, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, (W) nullptr, lda, stA,
+                                            dH, ldh, stH, dS, stS, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA, lda, stA,
+                                            (T) nullptr, ldh, stH, dS, stS, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA, lda, stA, dH, ldh,
+                                            stH, (TT) nullptr, stS, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA, lda, stA, dH, ldh,
+                                            stH, dS, stS, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, 0, (W) nullptr, lda, stA,
+                                            (T) nullptr, ldh, stH, (TT) nullptr, stS, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA, lda, stA, dH,
+                                                ldh, stH, dS, stS, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gepolar_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_svect svect = rocblas_svect_singular;
+    rocblas_int m = 2;
+    rocblas_int n = 2;
+    rocblas_int lda = 2;
+    rocblas_int ldh = 2;
+    rocblas_stride stA = 2;
+    rocblas_stride stH = 2;
+    rocblas_stride stS = 2;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<T> dH(1, 1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dH.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gepolar_checkBadArgs<STRIDED>(handle, svect, m, n, dA.data(), lda, stA, dH.data(), ldh,
+                                      stH, dS.data(), stS, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dH(1, 1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dH.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gepolar_checkBadArgs<STRIDED>(handle, svect, m, n, dA.data(), lda, stA, dH.data(), ldh,
+                                      stH, dS.data(), stS, dinfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gepolar_initData(const rocblas_handle handle,
+                      const rocblas_int m,
+                      const rocblas_int n,
+                      Td& dA,
+                      const rocblas_int lda,
+                      const rocblas_int bc,
+                      Th& hA,
+                      std::vector<T>& A,
+                      const bool ill_cond,
+                      bool test = true)
+{
+    if(CPU)
+    {
+        using S = decltype(std::real(T{}));
+        const S eps = get_epsilon<T>();
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // grade the columns of A so that its condition number is about eps^(-1.5),
+            // beyond the reach of a single QDWH sweep
+            if(ill_cond && n > 1)
+            {
+                for(rocblas_int j = 1; j < n; j++)
+                {
+                    T scl = T(std::pow(eps, S(1.5) * j / (n - 1)));
+                    for(rocblas_int i = 0; i < m; i++)
+                        hA[b][i + j * lda] *= scl;
+                }
+            }
+
+            // make copy of original data to test vectors if required
+            if(test)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
+void gepolar_getError(const rocblas_handle handle,
+                      const rocblas_svect svect,
+                      const rocblas_int m,
+                      const rocblas_int n,
+                      Wd& dA,
+                      const rocblas_int lda,
+                      const rocblas_stride stA,
+                      Ud& dH,
+                      const rocblas_int ldh,
+                      const rocblas_stride stH,
+                      Td& dS,
+                      const rocblas_stride stS,
+                      Id& dinfo,
+                      const rocblas_int bc,
+                      Wh& hA,
+                      Uh& hHres,
+                      Th& hS,
+                      Th& hSres,
+                      Th& hE,
+                      Ih& hinfo,
+                      Ih& hinfoRes,
+                      double* max_err,
+                      double* max_errv,
+                      const bool ill_cond)
+{
+    rocblas_int lwork = 5 * max(m, n);
+    std::vector<T> hWork(lwork);
+    std::vector<T> A(lda * n * bc);
+    std::vector<T> Vt(n * n);
+
+    // input data initialization
+    gepolar_initData<true, true, T>(handle, m, n, dA, lda, bc, hA, A, ill_cond);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA.data(), lda, stA,
+                                          dH.data(), ldh, stH, dS.data(), stS, dinfo.data(), bc));
+
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    CHECK_HIP_ERROR(hHres.transfer_from(dH));
+    if(svect == rocblas_svect_singular)
+        CHECK_HIP_ERROR(hSres.transfer_from(dS));
+
+    // the computed polar factor Up (or left singular vectors U) is in A
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    *max_err = 0;
+    *max_errv = 0;
+    double err, nrmA;
+    std::vector<T> hAcopy(lda * n);
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        T* Ab = A.data() + b * lda * n;
+
+        // CPU lapack (the polar factor H = V * S * V' is formed from the SVD)
+        hAcopy.assign(Ab, Ab + lda * n);
+        cblas_gesvd<T>(rocblas_svect_none, rocblas_svect_all, m, n, hAcopy.data(), lda, hS[b],
+                       (T*)nullptr, 1, Vt.data(), n, hWork.data(), lwork, hE[b], hinfo[b]);
+
+        // Check info for non-convergence
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+
+        if(hinfoRes[b][0] != 0)
+            continue;
+
+        nrmA = double(snorm('F', m, n, Ab, lda));
+
+        // check orthonormality of the columns of Up (or U): ||Up'*Up - I||
+        err = 0;
+        for(rocblas_int i = 0; i < n; ++i)
+        {
+            for(rocblas_int j = 0; j < n; ++j)
+            {
+                T tmp = (i == j) ? -1 : 0;
+                for(rocblas_int k = 0; k < m; ++k)
+                    tmp += sconj(hA[b][k + i * lda]) * hA[b][k + j * lda];
+                err += std::abs(tmp) * std::abs(tmp);
+            }
+        }
+        err = std::sqrt(err);
+        *max_errv = err > *max_errv ? err : *max_errv;
+
+        if(svect == rocblas_svect_singular)
+        {
+            // error is ||hS - hSres||
+            err = norm_error('F', 1, n, 1, hS[b], hSres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+
+            // check singular vectors implicitly (A*v_i = s_i*u_i)
+            err = 0;
+            for(rocblas_int c = 0; c < n; ++c)
+            {
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(rocblas_int j = 0; j < n; ++j)
+                        tmp += Ab[i + j * lda] * hHres[b][j + c * ldh];
+                    tmp -= hSres[b][c] * hA[b][i + c * lda];
+                    err += std::abs(tmp) * std::abs(tmp);
+                }
+            }
+            err = std::sqrt(err) / nrmA;
+            *max_errv = err > *max_errv ? err : *max_errv;
+        }
+        else
+        {
+            // check the Hermitian factor against the reference H = V * S * V'
+            err = 0;
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                for(rocblas_int j = 0; j < n; ++j)
+                {
+                    T tmp = 0;
+                    for(rocblas_int k = 0; k < n; ++k)
+                        tmp += hS[b][k] * sconj(Vt[k + i * n]) * Vt[k + j * n];
+                    tmp -= hHres[b][i + j * ldh];
+                    err += std::abs(tmp) * std::abs(tmp);
+                }
+            }
+            err = std::sqrt(err) / nrmA;
+            *max_err = err > *max_err ? err : *max_err;
+
+            // check the reconstruction A = Up * H
+            err = 0;
+            for(rocblas_int i = 0; i < m; ++i)
+            {
+                for(rocblas_int j = 0; j < n; ++j)
+                {
+                    T tmp = 0;
+                    for(rocblas_int k = 0; k < n; ++k)
+                        tmp += hA[b][i + k * lda] * hHres[b][k + j * ldh];
+                    tmp -= Ab[i + j * lda];
+                    err += std::abs(tmp) * std::abs(tmp);
+                }
+            }
+            err = std::sqrt(err) / nrmA;
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Ih>
+void gepolar_getPerfData(const rocblas_handle handle,
+                         const rocblas_svect svect,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         Wd& dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         Ud& dH,
+                         const rocblas_int ldh,
+                         const rocblas_stride stH,
+                         Td& dS,
+                         const rocblas_stride stS,
+                         Id& dinfo,
+                         const rocblas_int bc,
+                         Wh& hA,
+                         Th& hS,
+                         Th& hE,
+                         Ih& hinfo,
+                         double* gpu_time_used,
+                         double* cpu_time_used,
+                         const rocblas_int hot_calls,
+                         const bool perf,
+                         const bool ill_cond)
+{
+    rocblas_int lwork = 5 * max(m, n);
+    std::vector<T> hWork(lwork);
+    std::vector<T> A;
+    std::vector<T> Vt(n * n);
+
+    if(!perf)
+    {
+        gepolar_initData<true, false, T>(handle, m, n, dA, lda, bc, hA, A, ill_cond, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no polar decomposition in LAPACK; the time of the GESVD
+        // that computes the singular values and right singular vectors is reported)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_gesvd<T>(rocblas_svect_none, rocblas_svect_all, m, n, hA[b], lda, hS[b],
+                           (T*)nullptr, 1, Vt.data(), n, hWork.data(), lwork, hE[b], hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gepolar_initData<true, false, T>(handle, m, n, dA, lda, bc, hA, A, ill_cond, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gepolar_initData<false, true, T>(handle, m, n, dA, lda, bc, hA, A, ill_cond, 0);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA.data(), lda, stA,
+                                              dH.data(), ldh, stH, dS.data(), stS, dinfo.data(),
+                                              bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gepolar_initData<false, true, T>(handle, m, n, dA, lda, bc, hA, A, ill_cond, 0);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gepolar(STRIDED, handle, svect, m, n, dA.data(), lda, stA, dH.data(), ldh, stH,
+                          dS.data(), stS, dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gepolar(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldh = argus.ldb;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stH = argus.bsb;
+    rocblas_stride stS = argus.bsc;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char svectC = argus.left_svect;
+    rocblas_svect svect = char2rocblas_svect(svectC);
+    bool ill_cond = argus.singular;
+
+    // check non-supported values
+    bool invalid_value = (svect != rocblas_svect_singular && svect != rocblas_svect_none);
+    if(invalid_value)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n,
+                                                    (T* const*)nullptr, lda, stA, (T*)nullptr, ldh,
+                                                    stH, (S*)nullptr, stS, (rocblas_int*)nullptr,
+                                                    bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, (T*)nullptr, lda,
+                                                    stA, (T*)nullptr, ldh, stH, (S*)nullptr, stS,
+                                                    (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_H = size_t(ldh) * n;
+    size_t size_S = size_t(n);
+    rocblas_stride stSref = size_S;
+
+    size_t size_Sres = (argus.unit_check || argus.norm_check) ? size_S : 0;
+    size_t size_Hres = (argus.unit_check || argus.norm_check) ? size_H : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < n || lda < m || ldh < n || ldh < 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n,
+                                                    (T* const*)nullptr, lda, stA, (T*)nullptr, ldh,
+                                                    stH, (S*)nullptr, stS, (rocblas_int*)nullptr,
+                                                    bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, (T*)nullptr, lda,
+                                                    stA, (T*)nullptr, ldh, stH, (S*)nullptr, stS,
+                                                    (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gepolar(STRIDED, handle, svect, m, n, (T* const*)nullptr,
+                                                lda, stA, (T*)nullptr, ldh, stH, (S*)nullptr, stS,
+                                                (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gepolar(STRIDED, handle, svect, m, n, (T*)nullptr, lda, stA,
+                                                (T*)nullptr, ldh, stH, (S*)nullptr, stS,
+                                                (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hE(5 * max(m, n), 1, 5 * max(m, n), bc);
+    host_strided_batch_vector<S> hS(size_S, 1, stSref, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hSres(size_Sres, 1, stS, bc);
+    host_strided_batch_vector<T> hHres(size_Hres, 1, stH, bc);
+    // device
+    device_strided_batch_vector<T> dH(size_H, 1, stH, bc);
+    device_strided_batch_vector<S> dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    if(size_H)
+        CHECK_HIP_ERROR(dH.memcheck());
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA.data(), lda,
+                                                    stA, dH.data(), ldh, stH, dS.data(), stS,
+                                                    dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gepolar_getError<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dH, ldh, stH, dS, stS,
+                                         dinfo, bc, hA, hHres, hS, hSres, hE, hinfo, hinfoRes,
+                                         &max_error, &max_errorv, ill_cond);
+
+        // collect performance data
+        if(argus.timing)
+            gepolar_getPerfData<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dH, ldh, stH, dS,
+                                            stS, dinfo, bc, hA, hS, hE, hinfo, &gpu_time_used,
+                                            &cpu_time_used, hot_calls, argus.perf, ill_cond);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gepolar(STRIDED, handle, svect, m, n, dA.data(), lda,
+                                                    stA, dH.data(), ldh, stH, dS.data(), stS,
+                                                    dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gepolar_getError<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dH, ldh, stH, dS, stS,
+                                         dinfo, bc, hA, hHres, hS, hSres, hE, hinfo, hinfoRes,
+                                         &max_error, &max_errorv, ill_cond);
+
+        // collect performance data
+        if(argus.timing)
+            gepolar_getPerfData<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dH, ldh, stH, dS,
+                                            stS, dinfo, bc, hA, hS, hE, hinfo, &gpu_time_used,
+                                            &cpu_time_used, hot_calls, argus.perf, ill_cond);
+    }
+
+    // validate results for rocsolver-test
+    // using 2 * m * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * m);
+        ROCSOLVER_TEST_CHECK(T, max_errorv, 2 * m);
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("svect", "m", "n", "lda", "ldh", "strideH", "strideS",
+                                       "batch_c");
+                rocsolver_bench_output(svectC, m, n, lda, ldh, stH, stS, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("svect", "m", "n", "lda", "strideA", "ldh", "strideH",
+                                       "strideS", "batch_c");
+                rocsolver_bench_output(svectC, m, n, lda, stA, ldh, stH, stS, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("svect", "m", "n", "lda", "ldh");
+                rocsolver_bench_output(svectC, m, n, lda, ldh);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
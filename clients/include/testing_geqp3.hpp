@@ -0,0 +1,498 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename I, typename U>
+void geqp3_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        I dJpvt,
+                        const rocblas_stride stJ,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, nullptr, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, handle, m, n, (T) nullptr, lda, stA, dJpvt, stJ, dIpiv, stP, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, (I) nullptr, stJ, dIpiv, stP, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, (U) nullptr, stP, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, 0, n, (T) nullptr, lda, stA, dJpvt, stJ,
+                                          (U) nullptr, stP, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, 0, (T) nullptr, lda, stA, (I) nullptr,
+                                          stJ, (U) nullptr, stP, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqp3_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stJ = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                                    dIpiv.data(), stP, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                                    dIpiv.data(), stP, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void geqp3_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Id& dJpvt,
+                    const rocblas_stride stJ,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Ih& hJpvt,
+                    Uh& hIpiv)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // make the last columns a combination of the first ones so that
+        // the matrices are rank deficient and pivoting is actually exercised
+        rocblas_int r = max(n / 2, 1);
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int j = r; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    hA[b][i + j * lda] = hA[b][i + (j - r) * lda] + hA[b][i + (j % r) * lda];
+            }
+
+            // columns are free for the CPU reference
+            for(rocblas_int j = 0; j < n; j++)
+                hJpvt[b][j] = 0;
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void geqp3_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Id& dJpvt,
+                    const rocblas_stride stJ,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Ih& hJpvt,
+                    Uh& hIpiv,
+                    double* max_err)
+{
+    rocblas_int k = min(m, n);
+    size_t size_W = max(m, n);
+    std::vector<T> hW(size_W);
+    std::vector<T> hQR(size_t(lda) * n);
+    std::vector<T> hAP(size_t(lda) * n);
+
+    // input data initialization
+    geqp3_initData<true, true, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                  hJpvt, hIpiv);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA, dJpvt.data(),
+                                        stJ, dIpiv.data(), stP, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hJpvt.transfer_from(dJpvt));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+
+    // error is ||A*P - Qres*Rres|| / ||A*P||
+    // (the pivoting sequence is not unique when columns have equal norms, so results
+    // are not compared directly against LAPACK; instead the factorization is
+    // reconstructed on the host)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // jpvt must be a permutation of 1,2,...,n
+        std::vector<bool> seen(n, false);
+        bool valid = true;
+        for(rocblas_int j = 0; j < n && valid; j++)
+        {
+            rocblas_int p = hJpvt[b][j] - 1;
+            valid = (p >= 0 && p < n && !seen[p]);
+            if(valid)
+                seen[p] = true;
+        }
+        if(!valid)
+        {
+            *max_err = 1;
+            continue;
+        }
+
+        // form A*P and R
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                hAP[i + j * lda] = hA[b][i + (hJpvt[b][j] - 1) * lda];
+                hQR[i + j * lda] = (i <= j) ? hARes[b][i + j * lda] : 0;
+            }
+        }
+
+        // compute Q*R
+        cblas_ormqr_unmqr<T>(rocblas_side_left, rocblas_operation_none, m, n, k, hARes[b], lda,
+                             hIpiv[b], hQR.data(), lda, hW.data(), size_W);
+
+        err = norm_error('F', m, n, lda, hAP.data(), hQR.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void geqp3_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Id& dJpvt,
+                       const rocblas_stride stJ,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Ih& hJpvt,
+                       Uh& hIpiv,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int size_W = 3 * n + 1;
+    std::vector<T> hW(size_W);
+    std::vector<S> hRW(2 * n);
+
+    if(!perf)
+    {
+        geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hJpvt, hIpiv);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_geqp3<S, T>(m, n, hA[b], lda, hJpvt[b], hIpiv[b], hW.data(), size_W, hRW.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                   hJpvt, hIpiv);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hJpvt, hIpiv);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                            dJpvt.data(), stJ, dIpiv.data(), stP, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hJpvt, hIpiv);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                        dIpiv.data(), stP, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqp3(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stJ = argus.bs5;
+    rocblas_stride stP = argus.bsp;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_J = size_t(n);
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T* const*)nullptr, lda,
+                                                  stA, (rocblas_int*)nullptr, stJ, (T*)nullptr,
+                                                  stP, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, handle, m, n, (T* const*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // jpvt
+    host_strided_batch_vector<rocblas_int> hJpvt(size_J, 1, stJ, bc);
+    device_strided_batch_vector<rocblas_int> dJpvt(size_J, 1, stJ, bc);
+    if(size_J)
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                  dJpvt.data(), stJ, dIpiv.data(), stP, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hARes, hJpvt, hIpiv, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc,
+                                          hA, hJpvt, hIpiv, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                  dJpvt.data(), stJ, dIpiv.data(), stP, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hARes, hJpvt, hIpiv, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc,
+                                          hA, hJpvt, hIpiv, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideJ", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stJ, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "strideJ", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, stJ, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda");
+                rocsolver_bench_output(m, n, lda);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
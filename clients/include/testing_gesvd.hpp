@@ -221,7 +221,7 @@ void gesvd_initData(const rocblas_handle handle,
     }
 }
 
-template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
+template <bool STRIDED, bool NODQDS, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
 void gesvd_getError(const rocblas_handle handle,
                     const rocblas_svect left_svect,
                     const rocblas_svect right_svect,
@@ -297,9 +297,16 @@ void gesvd_getError(const rocblas_handle handle,
                        hWork.data(), lwork, hE[b], hinfo[b]);
 
     // GPU lapack
-    CHECK_ROCBLAS_ERROR(rocsolver_gesvd(STRIDED, handle, left_svect, right_svect, m, n, dA.data(),
-                                        lda, stA, dS.data(), stS, dU.data(), ldu, stU, dV.data(),
-                                        ldv, stV, dE.data(), stE, fa, dinfo.data(), bc));
+    // (with NODQDS, the singular values are computed by the fallback to BDSQR)
+    if(NODQDS)
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvd_nodqds(
+            STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA, dS.data(), stS,
+            dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE, fa, dinfo.data(), bc));
+    else
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvd(STRIDED, handle, left_svect, right_svect, m, n,
+                                            dA.data(), lda, stA, dS.data(), stS, dU.data(), ldu,
+                                            stU, dV.data(), ldv, stV, dE.data(), stE, fa,
+                                            dinfo.data(), bc));
 
     CHECK_HIP_ERROR(hSres.transfer_from(dS));
     CHECK_HIP_ERROR(hEres.transfer_from(dE));
@@ -455,7 +462,7 @@ void gesvd_getPerfData(const rocblas_handle handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
+template <bool BATCHED, bool STRIDED, typename T, bool NODQDS = false>
 void testing_gesvd(Arguments argus)
 {
     using S = decltype(std::real(T{}));
@@ -719,11 +726,11 @@ void testing_gesvd(Arguments argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            gesvd_getError<STRIDED, T>(handle, leftv, rightv, m, n, dA, lda, stA, dS, stS, dU, ldu,
-                                       stU, dV, ldv, stV, dE, stE, fa, dinfo, bc, leftvT, rightvT,
-                                       mT, nT, dUT, lduT, stUT, dVT, ldvT, stVT, hA, hS, hSres, hU,
-                                       Ures, ldures, hV, Vres, ldvres, hE, hEres, hinfo, hinfoRes,
-                                       &max_error, &max_errorv);
+            gesvd_getError<STRIDED, NODQDS, T>(
+                handle, leftv, rightv, m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv, stV, dE,
+                stE, fa, dinfo, bc, leftvT, rightvT, mT, nT, dUT, lduT, stUT, dVT, ldvT, stVT, hA,
+                hS, hSres, hU, Ures, ldures, hV, Vres, ldvres, hE, hEres, hinfo, hinfoRes,
+                &max_error, &max_errorv);
         }
 
         // collect performance data
@@ -761,11 +768,11 @@ void testing_gesvd(Arguments argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            gesvd_getError<STRIDED, T>(handle, leftv, rightv, m, n, dA, lda, stA, dS, stS, dU, ldu,
-                                       stU, dV, ldv, stV, dE, stE, fa, dinfo, bc, leftvT, rightvT,
-                                       mT, nT, dUT, lduT, stUT, dVT, ldvT, stVT, hA, hS, hSres, hU,
-                                       Ures, ldures, hV, Vres, ldvres, hE, hEres, hinfo, hinfoRes,
-                                       &max_error, &max_errorv);
+            gesvd_getError<STRIDED, NODQDS, T>(
+                handle, leftv, rightv, m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv, stV, dE,
+                stE, fa, dinfo, bc, leftvT, rightvT, mT, nT, dUT, lduT, stUT, dVT, ldvT, stVT, hA,
+                hS, hSres, hU, Ures, ldures, hV, Vres, ldvres, hE, hEres, hinfo, hinfoRes,
+                &max_error, &max_errorv);
         }
 
         // collect performance data
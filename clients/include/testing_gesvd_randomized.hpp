@@ -0,0 +1,833 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename TT, typename W, typename U>
+void gesvd_randomized_checkBadArgs(const rocblas_handle handle,
+                                   const rocblas_svect left_svect,
+                                   const rocblas_svect right_svect,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int k,
+                                   const rocblas_int p,
+                                   const rocblas_int q,
+                                   W dA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride stA,
+                                   TT dS,
+                                   const rocblas_stride stS,
+                                   T dU,
+                                   const rocblas_int ldu,
+                                   const rocblas_stride stU,
+                                   T dV,
+                                   const rocblas_int ldv,
+                                   const rocblas_stride stV,
+                                   U dinfo,
+                                   const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, nullptr, left_svect, right_svect, m,
+                                                     n, k, p, q, dA, lda, stA, dS, stS, dU, ldu,
+                                                     stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, rocblas_svect(-1),
+                                                     right_svect, m, n, k, p, q, dA, lda, stA, dS,
+                                                     stS, dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, rocblas_svect(-1),
+                                                     m, n, k, p, q, dA, lda, stA, dS, stS, dU, ldu,
+                                                     stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, rocblas_svect_all,
+                                                     right_svect, m, n, k, p, q, dA, lda, stA, dS,
+                                                     stS, dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect,
+                                                     rocblas_svect_overwrite, m, n, k, p, q, dA,
+                                                     lda, stA, dS, stS, dU, ldu, stU, dV, ldv, stV,
+                                                     dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect,
+                                                         m, n, k, p, q, dA, lda, stA, dS, stS, dU,
+                                                         ldu, stU, dV, ldv, stV, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m,
+                                                     n, k, p, q, (W) nullptr, lda, stA, dS, stS, dU,
+                                                     ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m,
+                                                     n, k, p, q, dA, lda, stA, (TT) nullptr, stS,
+                                                     dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m,
+                                                     n, k, p, q, dA, lda, stA, dS, stS, (T) nullptr,
+                                                     ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m,
+                                                     n, k, p, q, dA, lda, stA, dS, stS, dU, ldu,
+                                                     stU, (T) nullptr, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m,
+                                                     n, k, p, q, dA, lda, stA, dS, stS, dU, ldu,
+                                                     stU, dV, ldv, stV, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, 0,
+                                                     n, 0, 0, q, (W) nullptr, lda, stA,
+                                                     (TT) nullptr, stS, (T) nullptr, ldu, stU,
+                                                     (T) nullptr, ldv, stV, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m,
+                                                     0, 0, 0, q, (W) nullptr, lda, stA,
+                                                     (TT) nullptr, stS, (T) nullptr, ldu, stU,
+                                                     (T) nullptr, ldv, stV, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect,
+                                                         m, n, k, p, q, dA, lda, stA, dS, stS, dU,
+                                                         ldu, stU, dV, ldv, stV, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvd_randomized_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_svect left_svect = rocblas_svect_singular;
+    rocblas_svect right_svect = rocblas_svect_singular;
+    rocblas_int m = 2;
+    rocblas_int n = 2;
+    rocblas_int k = 1;
+    rocblas_int p = 1;
+    rocblas_int q = 1;
+    rocblas_int lda = 2;
+    rocblas_int ldu = 2;
+    rocblas_int ldv = 2;
+    rocblas_stride stA = 2;
+    rocblas_stride stS = 2;
+    rocblas_stride stU = 2;
+    rocblas_stride stV = 2;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<T> dU(1, 1, 1, 1);
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gesvd_randomized_checkBadArgs<STRIDED>(handle, left_svect, right_svect, m, n, k, p, q,
+                                               dA.data(), lda, stA, dS.data(), stS, dU.data(), ldu,
+                                               stU, dV.data(), ldv, stV, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<T> dU(1, 1, 1, 1);
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gesvd_randomized_checkBadArgs<STRIDED>(handle, left_svect, right_svect, m, n, k, p, q,
+                                               dA.data(), lda, stA, dS.data(), stS, dU.data(), ldu,
+                                               stU, dV.data(), ldv, stV, dinfo.data(), bc);
+    }
+}
+
+/** Expected spectral norm of the error of the randomized SVD (with k singular triplets,
+    oversampling p >= 2 and q power iterations) of a matrix with singular values s_j = 1/j.
+    This is the bound of Halko, Martinsson and Tropp (SIAM Review 53, 2011, Cor. 10.10);
+    it is a small multiple of s_(k+1) that decreases with p and q. **/
+inline double gesvd_randomized_expectedError(const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int k,
+                                             const rocblas_int p,
+                                             const rocblas_int q)
+{
+    double e = 2 * q + 1;
+    double tail = 0;
+    for(rocblas_int j = k + 1; j <= min(m, n); ++j)
+        tail += std::pow(1.0 / j, 2 * e);
+
+    double bound = (1 + std::sqrt(double(k) / (p - 1))) * std::pow(1.0 / (k + 1), e)
+        + std::exp(1.0) * std::sqrt(double(k + p)) / p * std::sqrt(tail);
+    return std::pow(bound, 1 / e);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvd_randomized_initData(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int r,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_int bc,
+                               Th& hA,
+                               std::vector<T>& A,
+                               const bool decay,
+                               bool test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        std::vector<T> L(m * r);
+        std::vector<T> R(r * n);
+        std::vector<T> u(max(m, n));
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            if(decay)
+            {
+                // build a full-rank matrix with slowly decaying singular values s_j = 1/j
+                // as H_U * diag(s) * H_V, where H_U and H_V are products of two
+                // Householder reflectors with random vectors
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                        hA[b][i + j * lda] = (i == j ? T(1.0 / (i + 1)) : T(0));
+                }
+
+                for(rocblas_int h = 0; h < 4; h++)
+                {
+                    bool left = (h % 2 == 0);
+                    rocblas_int nu = left ? m : n;
+                    double unorm = 0;
+                    for(rocblas_int i = 0; i < nu; i++)
+                    {
+                        u[i] = random_generator<T>() - 5;
+                        unorm += std::abs(u[i]) * std::abs(u[i]);
+                    }
+
+                    if(left)
+                    {
+                        // A = A - 2 * u * (u' * A) / (u' * u)
+                        for(rocblas_int j = 0; j < n; j++)
+                        {
+                            T tmp = 0;
+                            for(rocblas_int i = 0; i < m; i++)
+                                tmp += sconj(u[i]) * hA[b][i + j * lda];
+                            tmp *= T(2 / unorm);
+                            for(rocblas_int i = 0; i < m; i++)
+                                hA[b][i + j * lda] -= u[i] * tmp;
+                        }
+                    }
+                    else
+                    {
+                        // A = A - 2 * (A * u) * u' / (u' * u)
+                        for(rocblas_int i = 0; i < m; i++)
+                        {
+                            T tmp = 0;
+                            for(rocblas_int j = 0; j < n; j++)
+                                tmp += hA[b][i + j * lda] * u[j];
+                            tmp *= T(2 / unorm);
+                            for(rocblas_int j = 0; j < n; j++)
+                                hA[b][i + j * lda] -= tmp * sconj(u[j]);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // build a matrix of rank r = k + p as the product L * R of two
+                // full-rank factors, so that the randomized SVD is exact up to round-off
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int c = 0; c < r; c++)
+                        L[i + c * m] = hA[b][i + c * lda] + (i == c ? 400 : -4);
+                }
+                for(rocblas_int c = 0; c < r; c++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                        R[c + j * r] = random_generator<T>() + (c == j ? 400 : -4);
+                }
+
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                    {
+                        T tmp = 0;
+                        for(rocblas_int c = 0; c < r; c++)
+                            tmp += L[i + c * m] * R[c + j * r];
+                        hA[b][i + j * lda] = tmp;
+                    }
+                }
+            }
+
+            // make copy of original data to test vectors if required
+            if(test)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
+void gesvd_randomized_getError(const rocblas_handle handle,
+                               const rocblas_svect left_svect,
+                               const rocblas_svect right_svect,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int k,
+                               const rocblas_int p,
+                               const rocblas_int q,
+                               Wd& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               Td& dS,
+                               const rocblas_stride stS,
+                               Ud& dU,
+                               const rocblas_int ldu,
+                               const rocblas_stride stU,
+                               Ud& dV,
+                               const rocblas_int ldv,
+                               const rocblas_stride stV,
+                               Id& dinfo,
+                               const rocblas_int bc,
+                               Wh& hA,
+                               Th& hS,
+                               Th& hSres,
+                               Uh& Ures,
+                               Uh& Vres,
+                               Th& hE,
+                               Ih& hinfo,
+                               Ih& hinfoRes,
+                               const bool decay,
+                               double* max_err,
+                               double* max_errv)
+{
+    rocblas_int lwork = 5 * max(m, n);
+    std::vector<T> hWork(lwork);
+    std::vector<T> A(lda * n * bc);
+
+    // input data initialization
+    gesvd_randomized_initData<true, true, T>(handle, m, n, k + p, dA, lda, bc, hA, A, decay);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gesvd_randomized(
+        STRIDED, handle, left_svect, right_svect, m, n, k, p, q, dA.data(), lda, stA, dS.data(),
+        stS, dU.data(), ldu, stU, dV.data(), ldv, stV, dinfo.data(), bc));
+
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(left_svect == rocblas_svect_singular)
+        CHECK_HIP_ERROR(Ures.transfer_from(dU));
+    if(right_svect == rocblas_svect_singular)
+        CHECK_HIP_ERROR(Vres.transfer_from(dV));
+
+    // CPU lapack (all the singular values)
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_gesvd<T>(rocblas_svect_none, rocblas_svect_none, m, n, hA[b], lda, hS[b],
+                       (T*)nullptr, 1, (T*)nullptr, 1, hWork.data(), lwork, hE[b], hinfo[b]);
+
+    // Check info for non-convergence
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+
+    double err;
+    *max_errv = 0;
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // error is ||hS - hSres|| for the k largest singular values
+        // (or max |hS_i - hSres_i| if the singular values decay slowly, in which case it is
+        // bounded by the error of the randomized approximation, see the Weyl inequality)
+        if(decay)
+        {
+            err = 0;
+            for(rocblas_int i = 0; i < k; ++i)
+                err = max(err, double(std::abs(hS[b][i] - hSres[b][i])));
+        }
+        else
+            err = norm_error('F', 1, k, 1, hS[b], hSres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(hinfoRes[b][0] != 0)
+            continue;
+
+        T* Ab = A.data() + b * lda * n;
+        err = 0;
+        if(left_svect == rocblas_svect_singular && right_svect == rocblas_svect_singular)
+        {
+            // check singular vectors implicitly (A*v_i = s_i*u_i)
+            for(rocblas_int c = 0; c < k; ++c)
+            {
+                double errc = 0;
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(rocblas_int j = 0; j < n; ++j)
+                        tmp += Ab[i + j * lda] * sconj(Vres[b][c + j * ldv]);
+                    tmp -= hSres[b][c] * Ures[b][i + c * ldu];
+                    errc += std::abs(tmp) * std::abs(tmp);
+                }
+                err = decay ? max(err, std::sqrt(errc)) : err + errc;
+            }
+            if(!decay)
+                err = std::sqrt(err) / double(snorm('F', m, n, Ab, lda));
+        }
+        else if(left_svect == rocblas_svect_singular)
+        {
+            // check left singular vectors implicitly (A*A'*u_i = s_i^2*u_i)
+            std::vector<T> w(n);
+            for(rocblas_int c = 0; c < k; ++c)
+            {
+                for(rocblas_int j = 0; j < n; ++j)
+                {
+                    w[j] = 0;
+                    for(rocblas_int i = 0; i < m; ++i)
+                        w[j] += sconj(Ab[i + j * lda]) * Ures[b][i + c * ldu];
+                }
+                double errc = 0;
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(rocblas_int j = 0; j < n; ++j)
+                        tmp += Ab[i + j * lda] * w[j];
+                    tmp -= hSres[b][c] * hSres[b][c] * Ures[b][i + c * ldu];
+                    errc += std::abs(tmp) * std::abs(tmp);
+                }
+                err = decay ? max(err, std::sqrt(errc)) : err + errc;
+            }
+            if(!decay)
+                err = std::sqrt(err) / std::pow(double(snorm('F', m, n, Ab, lda)), 2);
+        }
+        else if(right_svect == rocblas_svect_singular)
+        {
+            // check right singular vectors implicitly (A'*A*v_i = s_i^2*v_i)
+            std::vector<T> w(m);
+            for(rocblas_int c = 0; c < k; ++c)
+            {
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    w[i] = 0;
+                    for(rocblas_int j = 0; j < n; ++j)
+                        w[i] += Ab[i + j * lda] * sconj(Vres[b][c + j * ldv]);
+                }
+                double errc = 0;
+                for(rocblas_int j = 0; j < n; ++j)
+                {
+                    T tmp = 0;
+                    for(rocblas_int i = 0; i < m; ++i)
+                        tmp += sconj(Ab[i + j * lda]) * w[i];
+                    tmp -= hSres[b][c] * hSres[b][c] * sconj(Vres[b][c + j * ldv]);
+                    errc += std::abs(tmp) * std::abs(tmp);
+                }
+                err = decay ? max(err, std::sqrt(errc)) : err + errc;
+            }
+            if(!decay)
+                err = std::sqrt(err) / std::pow(double(snorm('F', m, n, Ab, lda)), 2);
+        }
+        *max_errv = err > *max_errv ? err : *max_errv;
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Ih>
+void gesvd_randomized_getPerfData(const rocblas_handle handle,
+                                  const rocblas_svect left_svect,
+                                  const rocblas_svect right_svect,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int k,
+                                  const rocblas_int p,
+                                  const rocblas_int q,
+                                  Wd& dA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride stA,
+                                  Td& dS,
+                                  const rocblas_stride stS,
+                                  Ud& dU,
+                                  const rocblas_int ldu,
+                                  const rocblas_stride stU,
+                                  Ud& dV,
+                                  const rocblas_int ldv,
+                                  const rocblas_stride stV,
+                                  Id& dinfo,
+                                  const rocblas_int bc,
+                                  Wh& hA,
+                                  Th& hS,
+                                  Th& hE,
+                                  Ih& hinfo,
+                                  const bool decay,
+                                  double* gpu_time_used,
+                                  double* cpu_time_used,
+                                  const rocblas_int hot_calls,
+                                  const bool perf)
+{
+    rocblas_int lwork = 5 * max(m, n);
+    std::vector<T> hWork(lwork);
+    std::vector<T> A;
+
+    if(!perf)
+    {
+        gesvd_randomized_initData<true, false, T>(handle, m, n, k + p, dA, lda, bc, hA, A, decay,
+                                                  0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no randomized SVD in LAPACK; the time of a full GESVD is reported)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_gesvd<T>(rocblas_svect_none, rocblas_svect_none, m, n, hA[b], lda, hS[b],
+                           (T*)nullptr, 1, (T*)nullptr, 1, hWork.data(), lwork, hE[b], hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesvd_randomized_initData<true, false, T>(handle, m, n, k + p, dA, lda, bc, hA, A, decay, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvd_randomized_initData<false, true, T>(handle, m, n, k + p, dA, lda, bc, hA, A, decay,
+                                                  0);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvd_randomized(
+            STRIDED, handle, left_svect, right_svect, m, n, k, p, q, dA.data(), lda, stA, dS.data(),
+            stS, dU.data(), ldu, stU, dV.data(), ldv, stV, dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvd_randomized_initData<false, true, T>(handle, m, n, k + p, dA, lda, bc, hA, A, decay,
+                                                  0);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gesvd_randomized(STRIDED, handle, left_svect, right_svect, m, n, k, p, q,
+                                   dA.data(), lda, stA, dS.data(), stS, dU.data(), ldu, stU,
+                                   dV.data(), ldv, stV, dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvd_randomized(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int k = argus.K;
+    rocblas_int p = argus.oversample;
+    rocblas_int q = argus.power_iters;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldu = argus.ldb;
+    rocblas_int ldv = argus.ldv;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stS = argus.bsb;
+    rocblas_stride stU = argus.bsc;
+    rocblas_stride stV = argus.bsp;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char leftvC = argus.left_svect;
+    char rightvC = argus.right_svect;
+    bool decay = (argus.singular == 1);
+    rocblas_svect leftv = char2rocblas_svect(leftvC);
+    rocblas_svect rightv = char2rocblas_svect(rightvC);
+
+    // check non-supported values
+    bool invalid_value = ((leftv != rocblas_svect_singular && leftv != rocblas_svect_none)
+                          || (rightv != rocblas_svect_singular && rightv != rocblas_svect_none));
+    if(invalid_value)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(
+                                      STRIDED, handle, leftv, rightv, m, n, k, p, q,
+                                      (T* const*)nullptr, lda, stA, (S*)nullptr, stS, (T*)nullptr,
+                                      ldu, stU, (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(
+                                      STRIDED, handle, leftv, rightv, m, n, k, p, q, (T*)nullptr,
+                                      lda, stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                      (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_S = size_t(k);
+    size_t size_Sref = size_t(min(m, n));
+    size_t size_U = size_t(ldu) * k;
+    size_t size_V = size_t(ldv) * n;
+    rocblas_stride stSref = size_Sref;
+
+    size_t size_Ures = (argus.unit_check || argus.norm_check) ? size_U : 0;
+    size_t size_Vres = (argus.unit_check || argus.norm_check) ? size_V : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < 0 || k < 0 || p < 0 || q < 0 || k + p > min(m, n)
+                         || lda < m || ldu < 1 || ldv < 1 || bc < 0)
+        || (leftv == rocblas_svect_singular && ldu < m)
+        || (rightv == rocblas_svect_singular && ldv < k);
+
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(
+                                      STRIDED, handle, leftv, rightv, m, n, k, p, q,
+                                      (T* const*)nullptr, lda, stA, (S*)nullptr, stS, (T*)nullptr,
+                                      ldu, stU, (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(
+                                      STRIDED, handle, leftv, rightv, m, n, k, p, q, (T*)nullptr,
+                                      lda, stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                      (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gesvd_randomized(
+                STRIDED, handle, leftv, rightv, m, n, k, p, q, (T* const*)nullptr, lda, stA,
+                (S*)nullptr, stS, (T*)nullptr, ldu, stU, (T*)nullptr, ldv, stV,
+                (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gesvd_randomized(
+                STRIDED, handle, leftv, rightv, m, n, k, p, q, (T*)nullptr, lda, stA, (S*)nullptr,
+                stS, (T*)nullptr, ldu, stU, (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hE(5 * max(m, n), 1, 5 * max(m, n), bc);
+    host_strided_batch_vector<S> hS(size_Sref, 1, stSref, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hSres(size_S, 1, stS, bc);
+    host_strided_batch_vector<T> Ures(size_Ures, 1, stU, bc);
+    host_strided_batch_vector<T> Vres(size_Vres, 1, stV, bc);
+    // device
+    device_strided_batch_vector<S> dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<T> dU(size_U, 1, stU, bc);
+    device_strided_batch_vector<T> dV(size_V, 1, stV, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(
+                                      STRIDED, handle, leftv, rightv, m, n, k, p, q, dA.data(), lda,
+                                      stA, dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
+                                      dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesvd_randomized_getError<STRIDED, T>(
+                handle, leftv, rightv, m, n, k, p, q, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                stV, dinfo, bc, hA, hS, hSres, Ures, Vres, hE, hinfo, hinfoRes, decay, &max_error,
+                &max_errorv);
+
+        // collect performance data
+        if(argus.timing)
+            gesvd_randomized_getPerfData<STRIDED, T>(
+                handle, leftv, rightv, m, n, k, p, q, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                stV, dinfo, bc, hA, hS, hE, hinfo, decay, &gpu_time_used, &cpu_time_used,
+                hot_calls, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_randomized(
+                                      STRIDED, handle, leftv, rightv, m, n, k, p, q, dA.data(), lda,
+                                      stA, dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
+                                      dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesvd_randomized_getError<STRIDED, T>(
+                handle, leftv, rightv, m, n, k, p, q, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                stV, dinfo, bc, hA, hS, hSres, Ures, Vres, hE, hinfo, hinfoRes, decay, &max_error,
+                &max_errorv);
+
+        // collect performance data
+        if(argus.timing)
+            gesvd_randomized_getPerfData<STRIDED, T>(
+                handle, leftv, rightv, m, n, k, p, q, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                stV, dinfo, bc, hA, hS, hE, hinfo, decay, &gpu_time_used, &cpu_time_used,
+                hot_calls, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using 2 * min(m, n) * machine_precision as tolerance
+    // (if the singular values decay slowly, the approximation is not exact and the tolerance
+    // is the expected error, which is proportional to s_(k+1) and decreases with p and q)
+    if(argus.unit_check)
+    {
+        double tol = 2 * min(m, n);
+        if(decay)
+            tol = gesvd_randomized_expectedError(m, n, k, p, q) / get_epsilon<T>();
+        ROCSOLVER_TEST_CHECK(T, max_error, tol);
+        if(leftv != rocblas_svect_none || rightv != rocblas_svect_none)
+            ROCSOLVER_TEST_CHECK(T, max_errorv, tol);
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(leftv != rocblas_svect_none || rightv != rocblas_svect_none)
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("left_svect", "right_svect", "m", "n", "k", "oversample",
+                                       "poweriters", "lda", "strideS", "ldu", "strideU", "ldv",
+                                       "strideV", "batch_c");
+                rocsolver_bench_output(leftvC, rightvC, m, n, k, p, q, lda, stS, ldu, stU, ldv, stV,
+                                       bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("left_svect", "right_svect", "m", "n", "k", "oversample",
+                                       "poweriters", "lda", "strideA", "strideS", "ldu", "strideU",
+                                       "ldv", "strideV", "batch_c");
+                rocsolver_bench_output(leftvC, rightvC, m, n, k, p, q, lda, stA, stS, ldu, stU, ldv,
+                                       stV, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("left_svect", "right_svect", "m", "n", "k", "oversample",
+                                       "poweriters", "lda", "ldu", "ldv");
+                rocsolver_bench_output(leftvC, rightvC, m, n, k, p, q, lda, ldu, ldv);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,533 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, bool HETRF, typename T, typename U>
+void hetf2_hetrf_checkBadArgs(const rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              T dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              U dIpiv,
+                              const rocblas_stride stP,
+                              U dInfo,
+                              const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, nullptr, uplo, n, dA, lda, stA,
+                                                dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, rocblas_fill_full, n, dA,
+                                                lda, stA, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA, lda, stA,
+                                                    dIpiv, stP, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, (T) nullptr, lda,
+                                                stA, dIpiv, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA, lda, stA,
+                                                (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA, lda, stA,
+                                                dIpiv, stP, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, 0, (T) nullptr, lda,
+                                                stA, (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA, lda, stA,
+                                                    dIpiv, stP, (U) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA, lda, stA,
+                                                    dIpiv, stP, dInfo, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool HETRF, typename T>
+void testing_hetf2_hetrf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        hetf2_hetrf_checkBadArgs<STRIDED, HETRF>(handle, uplo, n, dA.data(), lda, stA,
+                                                 dIpiv.data(), stP, dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        hetf2_hetrf_checkBadArgs<STRIDED, HETRF>(handle, uplo, n, dA.data(), lda, stA,
+                                                 dIpiv.data(), stP, dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void hetf2_hetrf_initData(const rocblas_handle handle,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          const rocblas_int bc,
+                          Th& hA,
+                          const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // shift the entries so that the matrix is Hermitian, indefinite and not diagonally
+            // dominant (this forces interchanges and 2-by-2 pivots); the small
+            // perturbation avoids ties in the pivot search
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = j; i < n; i++)
+                {
+                    hA[b][i + j * lda] -= 4;
+                    hA[b][i + j * lda] += T(1.0 / (i + j + 1));
+                    if(i == j)
+                        hA[b][i + j * lda] = hA[b][i + j * lda].real();
+                    hA[b][j + i * lda] = sconj(hA[b][i + j * lda]);
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                // The algorithm must detect the first zero pivot in those
+                // matrices in the batch that are singular
+                rocblas_int j = n / 4 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    hA[b][i + j * lda] = 0;
+                    hA[b][j + i * lda] = 0;
+                }
+                j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    hA[b][i + j * lda] = 0;
+                    hA[b][j + i * lda] = 0;
+                }
+                j = n - 1 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    hA[b][i + j * lda] = 0;
+                    hA[b][j + i * lda] = 0;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, bool HETRF, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void hetf2_hetrf_getError(const rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          Ud& dIpiv,
+                          const rocblas_stride stP,
+                          Ud& dInfo,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Th& hARes,
+                          Uh& hIpiv,
+                          Uh& hIpivRes,
+                          Uh& hInfo,
+                          Uh& hInfoRes,
+                          double* max_err,
+                          const bool singular)
+{
+    int lwork = 64 * n;
+    std::vector<T> work(lwork);
+
+    // input data initialization
+    hetf2_hetrf_initData<true, true, T>(handle, n, dA, lda, stA, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA.data(), lda, stA,
+                                              dIpiv.data(), stP, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        HETRF ? cblas_hetrf<T>(uplo, n, hA[b], lda, hIpiv[b], work.data(), lwork, hInfo[b])
+              : cblas_hetf2<T>(uplo, n, hA[b], lda, hIpiv[b], hInfo[b]);
+    }
+
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', n, n, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        err = 0;
+        for(rocblas_int i = 0; i < n; ++i)
+            if(hIpiv[b][i] != hIpivRes[b][i])
+                err++;
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <bool STRIDED, bool HETRF, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void hetf2_hetrf_getPerfData(const rocblas_handle handle,
+                             const rocblas_fill uplo,
+                             const rocblas_int n,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_stride stA,
+                             Ud& dIpiv,
+                             const rocblas_stride stP,
+                             Ud& dInfo,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Uh& hIpiv,
+                             Uh& hInfo,
+                             double* gpu_time_used,
+                             double* cpu_time_used,
+                             const rocblas_int hot_calls,
+                             const bool perf,
+                             const bool singular)
+{
+    int lwork = 64 * n;
+    std::vector<T> work(lwork);
+
+    if(!perf)
+    {
+        hetf2_hetrf_initData<true, false, T>(handle, n, dA, lda, stA, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            HETRF ? cblas_hetrf<T>(uplo, n, hA[b], lda, hIpiv[b], work.data(), lwork, hInfo[b])
+                  : cblas_hetf2<T>(uplo, n, hA[b], lda, hIpiv[b], hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    hetf2_hetrf_initData<true, false, T>(handle, n, dA, lda, stA, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        hetf2_hetrf_initData<false, true, T>(handle, n, dA, lda, stA, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA.data(), lda,
+                                                  stA, dIpiv.data(), stP, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        hetf2_hetrf_initData<false, true, T>(handle, n, dA, lda, stA, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA.data(), lda, stA, dIpiv.data(),
+                              stP, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool HETRF, typename T>
+void testing_hetf2_hetrf(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stP = argus.bsp;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char uploC = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stPRes = (argus.unit_check || argus.norm_check) ? stP : 0;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, (T* const*)nullptr, lda, stA,
+                                      (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr, bc),
+                rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n,
+                                                        (T*)nullptr, lda, stA,
+                                                        (rocblas_int*)nullptr, stP,
+                                                        (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, (T* const*)nullptr, lda, stA,
+                                      (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr, bc),
+                rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n,
+                                                        (T*)nullptr, lda, stA,
+                                                        (rocblas_int*)nullptr, stP,
+                                                        (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n,
+                                                    (T* const*)nullptr, lda, stA,
+                                                    (rocblas_int*)nullptr, stP,
+                                                    (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, (T*)nullptr,
+                                                    lda, stA, (rocblas_int*)nullptr, stP,
+                                                    (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // ipiv and info
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, stPRes, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA.data(),
+                                                        lda, stA, dIpiv.data(), stP, dInfo.data(),
+                                                        bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            hetf2_hetrf_getError<STRIDED, HETRF, T>(handle, uplo, n, dA, lda, stA, dIpiv, stP,
+                                                    dInfo, bc, hA, hARes, hIpiv, hIpivRes, hInfo,
+                                                    hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            hetf2_hetrf_getPerfData<STRIDED, HETRF, T>(
+                handle, uplo, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_hetf2_hetrf(STRIDED, HETRF, handle, uplo, n, dA.data(),
+                                                        lda, stA, dIpiv.data(), stP, dInfo.data(),
+                                                        bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            hetf2_hetrf_getError<STRIDED, HETRF, T>(handle, uplo, n, dA, lda, stA, dIpiv, stP,
+                                                    dInfo, bc, hA, hARes, hIpiv, hIpivRes, hInfo,
+                                                    hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            hetf2_hetrf_getPerfData<STRIDED, HETRF, T>(
+                handle, uplo, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideP", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "strideP", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda");
+                rocsolver_bench_output(uploC, n, lda);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
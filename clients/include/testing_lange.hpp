@@ -0,0 +1,415 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S>
+void lange_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_norm_type norm_type,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        S dNorm,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_lange(STRIDED, nullptr, norm_type, m, n, dA, lda, stA, dNorm, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, rocblas_norm_type(-1), m, n, dA, lda,
+                                          stA, dNorm, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_lange(STRIDED, handle, norm_type, m, n, dA, lda, stA, dNorm, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_lange(STRIDED, handle, norm_type, m, n, (T) nullptr, lda, stA, dNorm, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_lange(STRIDED, handle, norm_type, m, n, dA, lda, stA, (S) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_lange(STRIDED, handle, norm_type, 0, n, (T) nullptr, lda, stA, dNorm, bc),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_lange(STRIDED, handle, norm_type, m, 0, (T) nullptr, lda, stA, dNorm, bc),
+        rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_lange(STRIDED, handle, norm_type, m, n, dA, lda, stA, (S) nullptr, 0),
+            rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_lange(STRIDED, handle, norm_type, m, n, dA, lda, stA, dNorm, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_lange_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_norm_type norm_type = rocblas_norm_one;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dNorm(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dNorm.memcheck());
+
+        // check bad arguments
+        lange_checkBadArgs<STRIDED>(handle, norm_type, m, n, dA.data(), lda, stA, dNorm.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dNorm(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dNorm.memcheck());
+
+        // check bad arguments
+        lange_checkBadArgs<STRIDED>(handle, norm_type, m, n, dA.data(), lda, stA, dNorm.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void lange_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_int bc,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void lange_getError(const rocblas_handle handle,
+                    const rocblas_norm_type norm_type,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Sd& dNorm,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Sh& hNorm,
+                    Sh& hNormRes,
+                    double* max_err)
+{
+    // input data initialization
+    lange_initData<true, true, T>(handle, m, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_lange(STRIDED, handle, norm_type, m, n, dA.data(), lda, stA, dNorm.data(), bc));
+    CHECK_HIP_ERROR(hNormRes.transfer_from(dNorm));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_lange<T>(norm_type, m, n, hA[b], lda, hNorm[b]);
+
+    // error is |norm - normRes| / |norm|
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = std::abs(hNorm[b][0] - hNormRes[b][0]) / std::abs(hNorm[b][0]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void lange_getPerfData(const rocblas_handle handle,
+                       const rocblas_norm_type norm_type,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Sd& dNorm,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Sh& hNorm,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf)
+{
+    if(!perf)
+    {
+        lange_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_lange<T>(norm_type, m, n, hA[b], lda, hNorm[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    lange_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        lange_initData<false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_lange(STRIDED, handle, norm_type, m, n, dA.data(), lda, stA,
+                                            dNorm.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        lange_initData<false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_lange(STRIDED, handle, norm_type, m, n, dA.data(), lda, stA, dNorm.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_lange(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_stride stA = argus.bsa;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char normC = argus.norm_type;
+    rocblas_norm_type norm_type = char2rocblas_norm(normC);
+
+    // check non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf
+       && norm_type != rocblas_norm_max && norm_type != rocblas_norm_frobenius)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, norm_type, m, n,
+                                                  (T* const*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, norm_type, m, n, (T*)nullptr,
+                                                  lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, norm_type, m, n,
+                                                  (T* const*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, norm_type, m, n, (T*)nullptr,
+                                                  lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_lange(STRIDED, handle, norm_type, m, n, (T* const*)nullptr,
+                                              lda, stA, (S*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_lange(STRIDED, handle, norm_type, m, n, (T*)nullptr, lda,
+                                              stA, (S*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<S> hNorm(1, 1, 1, bc);
+    host_strided_batch_vector<S> hNormRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dNorm(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dNorm.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, norm_type, m, n, dA.data(), lda,
+                                                  stA, dNorm.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            lange_getError<STRIDED, T>(handle, norm_type, m, n, dA, lda, stA, dNorm, bc, hA, hNorm,
+                                       hNormRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            lange_getPerfData<STRIDED, T>(handle, norm_type, m, n, dA, lda, stA, dNorm, bc, hA,
+                                          hNorm, &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_lange(STRIDED, handle, norm_type, m, n, dA.data(), lda,
+                                                  stA, dNorm.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            lange_getError<STRIDED, T>(handle, norm_type, m, n, dA, lda, stA, dNorm, bc, hA, hNorm,
+                                       hNormRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            lange_getPerfData<STRIDED, T>(handle, norm_type, m, n, dA, lda, stA, dNorm, bc, hA,
+                                          hNorm, &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("norm_type", "m", "n", "lda", "batch_c");
+                rocsolver_bench_output(normC, m, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("norm_type", "m", "n", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(normC, m, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("norm_type", "m", "n", "lda");
+                rocsolver_bench_output(normC, m, n, lda);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,473 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S>
+void pocon_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        S dAnorm,
+                        S dRcond,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pocon(STRIDED, nullptr, uplo, n, dA, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pocon(STRIDED, handle, rocblas_fill_full, n, dA, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_pocon(STRIDED, handle, uplo, n, dA, lda, stA, dAnorm, dRcond, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pocon(STRIDED, handle, uplo, n, (T) nullptr, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pocon(STRIDED, handle, uplo, n, dA, lda, stA, (S) nullptr, dRcond, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pocon(STRIDED, handle, uplo, n, dA, lda, stA, dAnorm, (S) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pocon(STRIDED, handle, uplo, 0, (T) nullptr, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_pocon(STRIDED, handle, uplo, n, dA, lda, stA, (S) nullptr, (S) nullptr, 0),
+            rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_pocon(STRIDED, handle, uplo, n, dA, lda, stA, dAnorm, dRcond, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pocon_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dAnorm(1, 1, 1, 1);
+        device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAnorm.memcheck());
+        CHECK_HIP_ERROR(dRcond.memcheck());
+
+        // check bad arguments
+        pocon_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA, dAnorm.data(),
+                                    dRcond.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dAnorm(1, 1, 1, 1);
+        device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAnorm.memcheck());
+        CHECK_HIP_ERROR(dRcond.memcheck());
+
+        // check bad arguments
+        pocon_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA, dAnorm.data(),
+                                    dRcond.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void pocon_initData(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Sd& dAnorm,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hATmp,
+                    Sh& hAnorm,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hATmp, true);
+        rocblas_int info;
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // make A hermitian and scale to ensure positive definiteness
+            cblas_gemm(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n,
+                       (T)1.0, hATmp[b], lda, hATmp[b], lda, (T)0.0, hA[b], lda);
+
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] += 400;
+
+            // compute the norm of A and its Cholesky factorization
+            // w/ the reference LAPACK routines
+            cblas_lansy_lanhe<T>(rocblas_norm_one, uplo, n, hA[b], lda, hAnorm[b]);
+            cblas_potrf<T>(uplo, n, hA[b], lda, &info);
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // add some singularities
+                // always the same elements for debugging purposes
+                // the estimated reciprocal condition number of those matrices
+                // in the batch that are singular must be zero
+                rocblas_int i = n / 4 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy the factors and norms to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dAnorm.transfer_from(hAnorm));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void pocon_getError(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Sd& dAnorm,
+                    Sd& dRcond,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hATmp,
+                    Sh& hAnorm,
+                    Sh& hRcond,
+                    Sh& hRcondRes,
+                    double* max_err,
+                    const bool singular)
+{
+    // input data initialization
+    pocon_initData<true, true, T>(handle, uplo, n, dA, lda, dAnorm, bc, hA, hATmp, hAnorm,
+                                  singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_pocon(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                        dAnorm.data(), dRcond.data(), bc));
+    CHECK_HIP_ERROR(hRcondRes.transfer_from(dRcond));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_pocon<T>(uplo, n, hA[b], lda, hAnorm[b][0], hRcond[b]);
+
+    // error is |rcond - rcondRes| / |rcond|
+    // (singular matrices must return exactly zero)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hRcond[b][0] == 0)
+            err = (hRcondRes[b][0] == 0) ? 0 : 1;
+        else
+            err = std::abs(hRcond[b][0] - hRcondRes[b][0]) / std::abs(hRcond[b][0]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void pocon_getPerfData(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Sd& dAnorm,
+                       Sd& dRcond,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hATmp,
+                       Sh& hAnorm,
+                       Sh& hRcond,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf,
+                       const bool singular)
+{
+    if(!perf)
+    {
+        pocon_initData<true, false, T>(handle, uplo, n, dA, lda, dAnorm, bc, hA, hATmp, hAnorm,
+                                       singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_pocon<T>(uplo, n, hA[b], lda, hAnorm[b][0], hRcond[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pocon_initData<true, false, T>(handle, uplo, n, dA, lda, dAnorm, bc, hA, hATmp, hAnorm,
+                                   singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        pocon_initData<false, true, T>(handle, uplo, n, dA, lda, dAnorm, bc, hA, hATmp, hAnorm,
+                                       singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_pocon(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                            dAnorm.data(), dRcond.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        pocon_initData<false, true, T>(handle, uplo, n, dA, lda, dAnorm, bc, hA, hATmp, hAnorm,
+                                       singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_pocon(STRIDED, handle, uplo, n, dA.data(), lda, stA, dAnorm.data(), dRcond.data(),
+                        bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pocon(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_stride stA = argus.bsa;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char uploC = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pocon(STRIDED, handle, uplo, n,
+                                                  (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                  (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pocon(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                                  (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pocon(STRIDED, handle, uplo, n,
+                                                  (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                  (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pocon(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                                  (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_pocon(STRIDED, handle, uplo, n, (T* const*)nullptr, lda,
+                                              stA, (S*)nullptr, (S*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_pocon(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                              (S*)nullptr, (S*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<S> hAnorm(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcond(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcondRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dAnorm(1, 1, 1, bc);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dAnorm.memcheck());
+    CHECK_HIP_ERROR(dRcond.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hATmp(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pocon(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                                  dAnorm.data(), dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pocon_getError<STRIDED, T>(handle, uplo, n, dA, lda, stA, dAnorm, dRcond, bc, hA, hATmp,
+                                       hAnorm, hRcond, hRcondRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pocon_getPerfData<STRIDED, T>(handle, uplo, n, dA, lda, stA, dAnorm, dRcond, bc, hA,
+                                          hATmp, hAnorm, hRcond, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hATmp(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pocon(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                                  dAnorm.data(), dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pocon_getError<STRIDED, T>(handle, uplo, n, dA, lda, stA, dAnorm, dRcond, bc, hA, hATmp,
+                                       hAnorm, hRcond, hRcondRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pocon_getPerfData<STRIDED, T>(handle, uplo, n, dA, lda, stA, dAnorm, dRcond, bc, hA,
+                                          hATmp, hAnorm, hRcond, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda");
+                rocsolver_bench_output(uploC, n, lda);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,578 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, bool DOWNDATE, typename T, typename U>
+void potrf_update_checkBadArgs(const rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               const rocblas_int k,
+                               T dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               T dX,
+                               const rocblas_int ldx,
+                               const rocblas_stride stX,
+                               U dinfo,
+                               const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, nullptr, uplo, n, k, dA, lda,
+                                                 stA, dX, ldx, stX, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, rocblas_fill_full, n, k,
+                                                 dA, lda, stA, dX, ldx, stX, dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA, lda,
+                                                     stA, dX, ldx, stX, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, (T) nullptr,
+                                                 lda, stA, dX, ldx, stX, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA, lda,
+                                                 stA, (T) nullptr, ldx, stX, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    if(DOWNDATE)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA, lda,
+                                                     stA, dX, ldx, stX, (U) nullptr, bc),
+                              rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, 0, k, (T) nullptr,
+                                                 lda, stA, (T) nullptr, ldx, stX, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, 0, dA, lda,
+                                                 stA, (T) nullptr, ldx, stX, dinfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA, lda,
+                                                     stA, dX, ldx, stX, (U) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA, lda,
+                                                     stA, dX, ldx, stX, dinfo, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool DOWNDATE, typename T>
+void testing_potrf_update_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int k = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldx = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stX = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        potrf_update_checkBadArgs<STRIDED, DOWNDATE>(handle, uplo, n, k, dA.data(), lda, stA,
+                                                     dX.data(), ldx, stX, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        potrf_update_checkBadArgs<STRIDED, DOWNDATE>(handle, uplo, n, k, dA.data(), lda, stA,
+                                                     dX.data(), ldx, stX, dinfo.data(), bc);
+    }
+}
+
+template <bool DOWNDATE, bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_update_initData(const rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           const rocblas_int k,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Td& dX,
+                           const rocblas_int ldx,
+                           const rocblas_stride stX,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           Th& hATmp,
+                           Th& hX,
+                           Uh& hInfo,
+                           const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_int info;
+
+        rocblas_init<T>(hATmp, true);
+        rocblas_init<T>(hX, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // make A hermitian and scale to ensure positive definiteness
+            cblas_gemm(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n,
+                       (T)1.0, hATmp[b], lda, hATmp[b], lda, (T)0.0, hA[b], lda);
+
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] += 400;
+
+            // when downdating, add X*X' so that A - X*X' is positive definite
+            if(DOWNDATE)
+                cblas_gemm(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, k,
+                           (T)1.0, hX[b], ldx, hX[b], ldx, (T)1.0, hA[b], lda);
+
+            hInfo[b][0] = 0;
+            if(DOWNDATE && singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some downdated matrices not positive definite by choosing the first
+                // column of X such that the diagonal element i of A - x*x' is negative
+                // always the same elements for debugging purposes
+                // the algorithm must detect the lower order of the principal minors <= 0
+                // in those matrices in the batch that are non positive definite
+                rocblas_int i = n / 2 + b;
+                i -= (i / n) * n;
+                for(rocblas_int j = 0; j < i; j++)
+                    hX[b][j] = 0;
+                hX[b][i] = 2 * std::sqrt(std::real(hA[b][i + i * lda]));
+                hInfo[b][0] = i + 1;
+            }
+
+            // the target matrix is A +/- X*X', or A itself if the downdate fails at the
+            // first column of X (in which case A must be left unchanged)
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < n; i++)
+                    hATmp[b][i + j * lda] = hA[b][i + j * lda];
+            }
+            if(hInfo[b][0] == 0)
+                cblas_gemm(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, k,
+                           (T)(DOWNDATE ? -1.0 : 1.0), hX[b], ldx, hX[b], ldx, (T)1.0, hATmp[b],
+                           lda);
+
+            // the input is the cholesky factor of A
+            cblas_potrf<T>(uplo, n, hA[b], lda, &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dX.transfer_from(hX));
+    }
+}
+
+template <bool STRIDED, bool DOWNDATE, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_update_getError(const rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           const rocblas_int k,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Td& dX,
+                           const rocblas_int ldx,
+                           const rocblas_stride stX,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           Th& hATmp,
+                           Th& hARes,
+                           Th& hX,
+                           Uh& hInfo,
+                           Uh& hInfoRes,
+                           double* max_err,
+                           const bool singular)
+{
+    std::vector<T> hF(size_t(lda) * n);
+    std::vector<T> hFF(size_t(lda) * n);
+
+    // input data initialization
+    potrf_update_initData<DOWNDATE, true, true, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx, stX,
+                                                   dInfo, bc, hA, hATmp, hX, hInfo, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA.data(),
+                                               lda, stA, dX.data(), ldx, stX, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    if(DOWNDATE)
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // error is ||A +/- X*X' - Fres'*Fres|| / ||A +/- X*X'|| (or with Fres*Fres' when lower)
+    // (there is no LAPACK routine to update a cholesky factorization, so the product
+    // is reconstructed on the host)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // extract the triangular factor
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                bool inTr = (uplo == rocblas_fill_upper) ? (i <= j) : (i >= j);
+                hF[i + j * lda] = inTr ? hARes[b][i + j * lda] : 0;
+            }
+        }
+
+        if(uplo == rocblas_fill_upper)
+            cblas_gemm<T>(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, n,
+                          (T)1.0, hF.data(), lda, hF.data(), lda, (T)0.0, hFF.data(), lda);
+        else
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n,
+                          (T)1.0, hF.data(), lda, hF.data(), lda, (T)0.0, hFF.data(), lda);
+
+        err = norm_error('F', n, n, lda, hATmp[b], hFF.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for non positive definite cases
+    if(DOWNDATE)
+    {
+        err = 0;
+        for(rocblas_int b = 0; b < bc; ++b)
+            if(hInfo[b][0] != hInfoRes[b][0])
+                err++;
+        *max_err += err;
+    }
+}
+
+template <bool STRIDED, bool DOWNDATE, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_update_getPerfData(const rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int k,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              Td& dX,
+                              const rocblas_int ldx,
+                              const rocblas_stride stX,
+                              Ud& dInfo,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Th& hATmp,
+                              Th& hX,
+                              Uh& hInfo,
+                              double* gpu_time_used,
+                              double* cpu_time_used,
+                              const rocblas_int hot_calls,
+                              const bool perf,
+                              const bool singular)
+{
+    rocblas_int info;
+
+    if(!perf)
+    {
+        potrf_update_initData<DOWNDATE, true, false, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx,
+                                                        stX, dInfo, bc, hA, hATmp, hX, hInfo,
+                                                        singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no LAPACK routine to update a cholesky factorization, so the reference
+        // time is that of refactorizing the modified matrix)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_potrf<T>(uplo, n, hATmp[b], lda, &info);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrf_update_initData<DOWNDATE, true, false, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx, stX,
+                                                    dInfo, bc, hA, hATmp, hX, hInfo, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrf_update_initData<DOWNDATE, false, true, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx,
+                                                        stX, dInfo, bc, hA, hATmp, hX, hInfo,
+                                                        singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                   dA.data(), lda, stA, dX.data(), ldx, stX,
+                                                   dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        potrf_update_initData<DOWNDATE, false, true, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx,
+                                                        stX, dInfo, bc, hA, hATmp, hX, hInfo,
+                                                        singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k, dA.data(), lda, stA,
+                               dX.data(), ldx, stX, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool DOWNDATE, typename T>
+void testing_potrf_update(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int k = argus.K;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldx = argus.ldb;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stX = argus.bsb;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char uploC = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                         (T* const*)nullptr, lda, stA,
+                                                         (T* const*)nullptr, ldx, stX,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                         (T*)nullptr, lda, stA, (T*)nullptr, ldx,
+                                                         stX, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_X = size_t(ldx) * k;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || k < 0 || lda < n || ldx < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                         (T* const*)nullptr, lda, stA,
+                                                         (T* const*)nullptr, ldx, stX,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                         (T*)nullptr, lda, stA, (T*)nullptr, ldx,
+                                                         stX, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                     (T* const*)nullptr, lda, stA,
+                                                     (T* const*)nullptr, ldx, stX,
+                                                     (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                     (T*)nullptr, lda, stA, (T*)nullptr, ldx, stX,
+                                                     (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hATmp(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(n == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                         dA.data(), lda, stA, dX.data(), ldx, stX,
+                                                         dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potrf_update_getError<STRIDED, DOWNDATE, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx,
+                                                        stX, dInfo, bc, hA, hATmp, hARes, hX, hInfo,
+                                                        hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            potrf_update_getPerfData<STRIDED, DOWNDATE, T>(
+                handle, uplo, n, k, dA, lda, stA, dX, ldx, stX, dInfo, bc, hA, hATmp, hX, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hATmp(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(n == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_update(STRIDED, DOWNDATE, handle, uplo, n, k,
+                                                         dA.data(), lda, stA, dX.data(), ldx, stX,
+                                                         dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potrf_update_getError<STRIDED, DOWNDATE, T>(handle, uplo, n, k, dA, lda, stA, dX, ldx,
+                                                        stX, dInfo, bc, hA, hATmp, hARes, hX, hInfo,
+                                                        hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            potrf_update_getPerfData<STRIDED, DOWNDATE, T>(
+                handle, uplo, n, k, dA, lda, stA, dX, ldx, stX, dInfo, bc, hA, hATmp, hX, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * k * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n * k);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "k", "lda", "ldx", "batch_c");
+                rocsolver_bench_output(uploC, n, k, lda, ldx, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "k", "lda", "strideA", "ldx", "strideX",
+                                       "batch_c");
+                rocsolver_bench_output(uploC, n, k, lda, stA, ldx, stX, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "k", "lda", "ldx");
+                rocsolver_bench_output(uploC, n, k, lda, ldx);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,550 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U>
+void pstrf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dPiv,
+                        const rocblas_stride stP,
+                        U dRank,
+                        const S tol,
+                        U dInfo,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pstrf(STRIDED, nullptr, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, rocblas_fill_full, n, dA, lda, stA, dPiv,
+                                          stP, dRank, tol, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                              dRank, tol, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T) nullptr, lda, stA, dPiv,
+                                          stP, dRank, tol, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, (U) nullptr, stP,
+                                          dRank, tol, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                          (U) nullptr, tol, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP, dRank,
+                                          tol, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, 0, (T) nullptr, lda, stA,
+                                          (U) nullptr, stP, dRank, tol, dInfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                              (U) nullptr, tol, (U) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                              dRank, tol, dInfo, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pstrf_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    S tol = -1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> dPiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dPiv.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        pstrf_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA, dPiv.data(), stP,
+                                    dRank.data(), tol, dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        pstrf_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA, dPiv.data(), stP,
+                                    dRank.data(), tol, dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void pstrf_initData(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hATmp,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_int r;
+
+        rocblas_init<T>(hATmp, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            r = n;
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some matrices rank deficient by using fewer columns in the
+                // product below; always the same ranks for debugging purposes
+                r = n / 2 + b;
+                r -= (r / n) * n;
+            }
+
+            // scale the first r columns to ensure they are well conditioned
+            for(rocblas_int i = 0; i < r; i++)
+                hATmp[b][i + i * lda] += 400;
+
+            // A = B*B' is hermitian positive semidefinite of rank r, where B
+            // is the n-by-r matrix formed by the first r columns of ATmp
+            cblas_gemm(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, r,
+                       (T)1.0, hATmp[b], lda, hATmp[b], lda, (T)0.0, hA[b], lda);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void pstrf_getError(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dPiv,
+                    const rocblas_stride stP,
+                    Ud& dRank,
+                    const S tol,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hATmp,
+                    Th& hARes,
+                    Uh& hPivRes,
+                    Uh& hRankRes,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    std::vector<T> hF(size_t(lda) * n);
+    std::vector<T> hFF(size_t(lda) * n);
+    std::vector<rocblas_int> hPiv(n);
+    std::vector<S> work(2 * n);
+    rocblas_int rank, info;
+
+    // input data initialization
+    pstrf_initData<true, true, T>(handle, uplo, n, dA, lda, stA, bc, hA, hATmp, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA, dPiv.data(),
+                                        stP, dRank.data(), tol, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hPivRes.transfer_from(dPiv));
+    CHECK_HIP_ERROR(hRankRes.transfer_from(dRank));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // error is ||P'*A*P - Fres'*Fres|| / ||P'*A*P|| (or with Fres*Fres' when lower),
+    // where Fres is formed by the first rank rows of U (or columns of L)
+    // (the pivoting sequence could differ from that of LAPACK when there are ties, so
+    // the factorization is compared with the permuted input matrix instead)
+    // using frobenius norm
+    double err;
+    rocblas_int nerr = 0;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // CPU lapack
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+                hF[i + j * lda] = hA[b][i + j * lda];
+        }
+        cblas_pstrf<S, T>(uplo, n, hF.data(), lda, hPiv.data(), &rank, tol, work.data(), &info);
+
+        // the computed rank must agree with LAPACK
+        if(rank != hRankRes[b][0] || info != hInfoRes[b][0])
+            nerr++;
+
+        // extract the triangular factor
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                bool inTr = (uplo == rocblas_fill_upper) ? (i <= j && i < hRankRes[b][0])
+                                                         : (i >= j && j < hRankRes[b][0]);
+                hF[i + j * lda] = inTr ? hARes[b][i + j * lda] : 0;
+            }
+        }
+
+        if(uplo == rocblas_fill_upper)
+            cblas_gemm<T>(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, n,
+                          (T)1.0, hF.data(), lda, hF.data(), lda, (T)0.0, hFF.data(), lda);
+        else
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n,
+                          (T)1.0, hF.data(), lda, hF.data(), lda, (T)0.0, hFF.data(), lda);
+
+        // permute the input matrix
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+                hF[i + j * lda] = hA[b][(hPivRes[b][i] - 1) + (hPivRes[b][j] - 1) * lda];
+        }
+
+        err = norm_error('F', n, n, lda, hF.data(), hFF.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check rank and info
+    *max_err += nerr;
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void pstrf_getPerfData(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dPiv,
+                       const rocblas_stride stP,
+                       Ud& dRank,
+                       const S tol,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hATmp,
+                       Uh& hPiv,
+                       Uh& hRank,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf,
+                       const bool singular)
+{
+    std::vector<S> work(2 * n);
+
+    if(!perf)
+    {
+        pstrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, bc, hA, hATmp, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_pstrf<S, T>(uplo, n, hA[b], lda, hPiv[b], hRank[b], tol, work.data(), hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pstrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, bc, hA, hATmp, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        pstrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, bc, hA, hATmp, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                            dPiv.data(), stP, dRank.data(), tol, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        pstrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, bc, hA, hATmp, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA, dPiv.data(), stP,
+                        dRank.data(), tol, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pstrf(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stP = argus.bsp;
+    S tol = S(argus.tol);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char uploC = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T* const*)nullptr, lda,
+                                                  stA, (rocblas_int*)nullptr, stP,
+                                                  (rocblas_int*)nullptr, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                                  tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T* const*)nullptr, lda,
+                                                  stA, (rocblas_int*)nullptr, stP,
+                                                  (rocblas_int*)nullptr, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                                  tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_pstrf(STRIDED, handle, uplo, n, (T* const*)nullptr, lda,
+                                              stA, (rocblas_int*)nullptr, stP,
+                                              (rocblas_int*)nullptr, tol, (rocblas_int*)nullptr,
+                                              bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_pstrf(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                              tol, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // piv, rank and info
+    host_strided_batch_vector<rocblas_int> hPiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hRank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dPiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dPiv.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hATmp(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                                  dPiv.data(), stP, dRank.data(), tol,
+                                                  dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pstrf_getError<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol, dInfo,
+                                       bc, hA, hATmp, hARes, hPiv, hRank, hInfo, &max_error,
+                                       argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pstrf_getPerfData<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol,
+                                          dInfo, bc, hA, hATmp, hPiv, hRank, hInfo, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hATmp(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                                  dPiv.data(), stP, dRank.data(), tol,
+                                                  dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pstrf_getError<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol, dInfo,
+                                       bc, hA, hATmp, hARes, hPiv, hRank, hInfo, &max_error,
+                                       argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pstrf_getPerfData<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol,
+                                          dInfo, bc, hA, hATmp, hPiv, hRank, hInfo, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideP", "tol", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stP, tol, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "strideP", "tol", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, stP, tol, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "tol");
+                rocsolver_bench_output(uploC, n, lda, tol);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
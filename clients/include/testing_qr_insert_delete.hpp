@@ -0,0 +1,635 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, bool ROW, bool INSERT, typename T>
+void qr_insert_delete_checkBadArgs(const rocblas_handle handle,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int idx,
+                                   T dQ,
+                                   const rocblas_int ldq,
+                                   const rocblas_stride stQ,
+                                   T dR,
+                                   const rocblas_int ldr,
+                                   const rocblas_stride stR,
+                                   T dx,
+                                   const rocblas_int incx,
+                                   const rocblas_stride stx,
+                                   const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, nullptr, m, n, idx, dQ,
+                                                     ldq, stQ, dR, ldr, stR, dx, incx, stx, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                         dQ, ldq, stQ, dR, ldr, stR, dx, incx, stx,
+                                                         -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                     (T) nullptr, ldq, stQ, dR, ldr, stR, dx, incx,
+                                                     stx, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx, dQ,
+                                                     ldq, stQ, (T) nullptr, ldr, stR, dx, incx,
+                                                     stx, bc),
+                          rocblas_status_invalid_pointer);
+    if(INSERT)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                         dQ, ldq, stQ, dR, ldr, stR, (T) nullptr,
+                                                         incx, stx, bc),
+                              rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    // (only the updates after inserting/deleting a column have quick return
+    // for empty matrices)
+    if(!ROW)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, 0, n, idx,
+                                                         (T) nullptr, ldq, stQ, (T) nullptr, ldr,
+                                                         stR, (T) nullptr, incx, stx, bc),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                         dQ, ldq, stQ, dR, ldr, stR, dx, incx, stx,
+                                                         0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool ROW, bool INSERT, typename T>
+void testing_qr_insert_delete_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int idx = 1;
+    rocblas_int ldq = (ROW && INSERT) ? 2 : 1;
+    rocblas_int ldr = (ROW && INSERT) ? 2 : 1;
+    rocblas_int incx = 1;
+    rocblas_stride stQ = 1;
+    rocblas_stride stR = 1;
+    rocblas_stride stx = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dQ(1, 1, 1);
+        device_batch_vector<T> dR(1, 1, 1);
+        device_batch_vector<T> dx(1, 1, 1);
+        CHECK_HIP_ERROR(dQ.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dx.memcheck());
+
+        // check bad arguments
+        qr_insert_delete_checkBadArgs<STRIDED, ROW, INSERT>(handle, m, n, idx, dQ.data(), ldq, stQ,
+                                                            dR.data(), ldr, stR, dx.data(), incx,
+                                                            stx, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dQ(1, 1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        device_strided_batch_vector<T> dx(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dQ.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dx.memcheck());
+
+        // check bad arguments
+        qr_insert_delete_checkBadArgs<STRIDED, ROW, INSERT>(handle, m, n, idx, dQ.data(), ldq, stQ,
+                                                            dR.data(), ldr, stR, dx.data(), incx,
+                                                            stx, bc);
+    }
+}
+
+/** Inserts x (as a row if ROW, as a column otherwise) before position idx of the m-by-n
+    matrix A, or deletes the row/column at position idx. A must be large enough to hold
+    the result. **/
+template <bool ROW, bool INSERT, typename T>
+void qr_insert_delete_modify(const rocblas_int m,
+                             const rocblas_int n,
+                             const rocblas_int idx,
+                             T* A,
+                             const rocblas_int lda,
+                             T* x,
+                             const rocblas_int incx)
+{
+    if(ROW)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            if(INSERT)
+            {
+                for(rocblas_int i = m; i >= idx; i--)
+                    A[i + j * lda] = A[(i - 1) + j * lda];
+                A[(idx - 1) + j * lda] = x[j * incx];
+            }
+            else
+            {
+                for(rocblas_int i = idx - 1; i < m - 1; i++)
+                    A[i + j * lda] = A[(i + 1) + j * lda];
+            }
+        }
+    }
+    else
+    {
+        if(INSERT)
+        {
+            for(rocblas_int j = n; j >= idx; j--)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    A[i + j * lda] = A[i + (j - 1) * lda];
+            }
+            for(rocblas_int i = 0; i < m; i++)
+                A[i + (idx - 1) * lda] = x[i * incx];
+        }
+        else
+        {
+            for(rocblas_int j = idx - 1; j < n - 1; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    A[i + j * lda] = A[i + (j + 1) * lda];
+            }
+        }
+    }
+}
+
+template <bool CPU, bool GPU, bool INSERT, typename T, typename Td, typename Th>
+void qr_insert_delete_initData(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               Td& dQ,
+                               const rocblas_int ldq,
+                               const rocblas_stride stQ,
+                               Td& dR,
+                               const rocblas_int ldr,
+                               const rocblas_stride stR,
+                               Td& dx,
+                               const rocblas_int incx,
+                               const rocblas_stride stx,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Th& hQ,
+                               Th& hR,
+                               Th& hx)
+{
+    if(CPU)
+    {
+        rocblas_int kk = min(m, n);
+        size_t size_W = max(m, n);
+        std::vector<T> hW(size_W);
+        std::vector<T> hIpiv(kk);
+
+        rocblas_init<T>(hA, true);
+        if(INSERT)
+            rocblas_init<T>(hx, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // compute the QR factorization of A
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    hR[b][i + j * ldr] = hA[b][i + j * ldr];
+            }
+            cblas_geqrf<T>(m, n, hR[b], ldr, hIpiv.data(), hW.data(), size_W);
+
+            // form the full m-by-m matrix Q
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    hQ[b][i + j * ldq] = hR[b][i + j * ldr];
+            }
+            cblas_orgqr_ungqr<T>(m, m, kk, hQ[b], ldq, hIpiv.data(), hW.data(), size_W);
+
+            // R is the upper trapezoidal part
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = j + 1; i < m; i++)
+                    hR[b][i + j * ldr] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dQ.transfer_from(hQ));
+        CHECK_HIP_ERROR(dR.transfer_from(hR));
+        if(INSERT)
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+    }
+}
+
+template <bool STRIDED, bool ROW, bool INSERT, typename T, typename Td, typename Th>
+void qr_insert_delete_getError(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int idx,
+                               Td& dQ,
+                               const rocblas_int ldq,
+                               const rocblas_stride stQ,
+                               Td& dR,
+                               const rocblas_int ldr,
+                               const rocblas_stride stR,
+                               Td& dx,
+                               const rocblas_int incx,
+                               const rocblas_stride stx,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Th& hQ,
+                               Th& hR,
+                               Th& hx,
+                               Th& hQRes,
+                               Th& hRRes,
+                               double* max_err)
+{
+    // size of the updated factorization
+    rocblas_int m1 = ROW ? (INSERT ? m + 1 : m - 1) : m;
+    rocblas_int n1 = ROW ? n : (INSERT ? n + 1 : n - 1);
+
+    std::vector<T> hQR(size_t(ldr) * n1);
+    std::vector<T> hRTr(size_t(ldr) * n1);
+    std::vector<T> hQtQ(size_t(m1) * m1);
+    std::vector<T> hI(size_t(m1) * m1, 0);
+    for(rocblas_int i = 0; i < m1; i++)
+        hI[i + i * m1] = 1;
+
+    // input data initialization
+    qr_insert_delete_initData<true, true, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR, dx,
+                                                     incx, stx, bc, hA, hQ, hR, hx);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                   dQ.data(), ldq, stQ, dR.data(), ldr, stR,
+                                                   dx.data(), incx, stx, bc));
+    CHECK_HIP_ERROR(hQRes.transfer_from(dQ));
+    CHECK_HIP_ERROR(hRRes.transfer_from(dR));
+
+    // error is max(||A1 - Qres*Rres|| / ||A1||, ||I - Qres'*Qres|| / ||I||), where A1 is
+    // the matrix A after the insertion/deletion
+    // (the factorization is not unique, so results are not compared directly against
+    // a new factorization computed by LAPACK; instead the product is reconstructed on
+    // the host)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // form the modified matrix A1
+        qr_insert_delete_modify<ROW, INSERT>(m, n, idx, hA[b], ldr, INSERT ? hx[b] : (T*)nullptr,
+                                             incx);
+
+        // compute Qres*Rres
+        if(m1 > 0 && n1 > 0)
+        {
+            for(rocblas_int j = 0; j < n1; j++)
+            {
+                for(rocblas_int i = 0; i < m1; i++)
+                    hRTr[i + j * ldr] = (i <= j) ? hRRes[b][i + j * ldr] : 0;
+            }
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_none, m1, n1, m1, (T)1.0,
+                          hQRes[b], ldq, hRTr.data(), ldr, (T)0.0, hQR.data(), ldr);
+
+            err = norm_error('F', m1, n1, ldr, hA[b], hQR.data());
+            *max_err = err > *max_err ? err : *max_err;
+        }
+
+        // check that Qres is orthogonal/unitary
+        if(m1 > 0)
+        {
+            cblas_gemm<T>(rocblas_operation_conjugate_transpose, rocblas_operation_none, m1, m1,
+                          m1, (T)1.0, hQRes[b], ldq, hQRes[b], ldq, (T)0.0, hQtQ.data(), m1);
+
+            err = norm_error('F', m1, m1, m1, hI.data(), hQtQ.data());
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, bool ROW, bool INSERT, typename T, typename Td, typename Th>
+void qr_insert_delete_getPerfData(const rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int idx,
+                                  Td& dQ,
+                                  const rocblas_int ldq,
+                                  const rocblas_stride stQ,
+                                  Td& dR,
+                                  const rocblas_int ldr,
+                                  const rocblas_stride stR,
+                                  Td& dx,
+                                  const rocblas_int incx,
+                                  const rocblas_stride stx,
+                                  const rocblas_int bc,
+                                  Th& hA,
+                                  Th& hQ,
+                                  Th& hR,
+                                  Th& hx,
+                                  double* gpu_time_used,
+                                  double* cpu_time_used,
+                                  const rocblas_int hot_calls,
+                                  const bool perf)
+{
+    rocblas_int m1 = ROW ? (INSERT ? m + 1 : m - 1) : m;
+    rocblas_int n1 = ROW ? n : (INSERT ? n + 1 : n - 1);
+    size_t size_W = max(m1, n1);
+    std::vector<T> hW(size_W);
+    std::vector<T> hIpiv(min(m1, n1));
+
+    if(!perf)
+    {
+        qr_insert_delete_initData<true, false, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR,
+                                                          dx, incx, stx, bc, hA, hQ, hR, hx);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no LAPACK routine to update a QR factorization, so the reference
+        // time is that of refactorizing the modified matrix)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            qr_insert_delete_modify<ROW, INSERT>(m, n, idx, hA[b], ldr,
+                                                 INSERT ? hx[b] : (T*)nullptr, incx);
+            cblas_geqrf<T>(m1, n1, hA[b], ldr, hIpiv.data(), hW.data(), size_W);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    qr_insert_delete_initData<true, false, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR, dx,
+                                                      incx, stx, bc, hA, hQ, hR, hx);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        qr_insert_delete_initData<false, true, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR,
+                                                          dx, incx, stx, bc, hA, hQ, hR, hx);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                       dQ.data(), ldq, stQ, dR.data(), ldr, stR,
+                                                       dx.data(), incx, stx, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        qr_insert_delete_initData<false, true, INSERT, T>(handle, m, n, dQ, ldq, stQ, dR, ldr, stR,
+                                                          dx, incx, stx, bc, hA, hQ, hR, hx);
+
+        start = get_time_us_sync(stream);
+        rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx, dQ.data(), ldq, stQ,
+                                   dR.data(), ldr, stR, dx.data(), incx, stx, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool ROW, bool INSERT, typename T>
+void testing_qr_insert_delete(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int idx = argus.k1;
+    rocblas_int ldq = argus.lda;
+    rocblas_int ldr = argus.ldb;
+    rocblas_int incx = argus.incx;
+    rocblas_stride stQ = argus.bsa;
+    rocblas_stride stR = argus.bsb;
+    rocblas_stride stx = argus.bsc;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stQRes = (argus.unit_check || argus.norm_check) ? stQ : 0;
+    rocblas_stride stRRes = (argus.unit_check || argus.norm_check) ? stR : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // (Q and R must have room for the inserted row/column)
+    rocblas_int mq = (ROW && INSERT) ? m + 1 : m;
+    rocblas_int nr = (!ROW && INSERT) ? n + 1 : n;
+    rocblas_int max_idx = ROW ? (INSERT ? m + 1 : m) : (INSERT ? n + 1 : n);
+    size_t size_Q = size_t(ldq) * mq;
+    size_t size_R = size_t(ldr) * nr;
+    size_t size_x = INSERT ? size_t(ROW ? n : m) * incx : 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_QRes = (argus.unit_check || argus.norm_check) ? size_Q : 0;
+    size_t size_RRes = (argus.unit_check || argus.norm_check) ? size_R : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || idx < 1 || idx > max_idx || ldq < mq || ldr < mq
+                         || (INSERT && incx < 1) || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                           (T* const*)nullptr, ldq, stQ, (T* const*)nullptr, ldr,
+                                           stR, (T* const*)nullptr, incx, stx, bc),
+                rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx, (T*)nullptr,
+                                           ldq, stQ, (T*)nullptr, ldr, stR, (T*)nullptr, incx, stx,
+                                           bc),
+                rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                         (T* const*)nullptr, ldq, stQ,
+                                                         (T* const*)nullptr, ldr, stR,
+                                                         (T* const*)nullptr, incx, stx, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx,
+                                                         (T*)nullptr, ldq, stQ, (T*)nullptr, ldr,
+                                                         stR, (T*)nullptr, incx, stx, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // quick return happens only for empty matrices when inserting/deleting columns
+    bool quick_return = (bc == 0 || (!ROW && m == 0));
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_R, 1, bc);
+        host_batch_vector<T> hQ(size_Q, 1, bc);
+        host_batch_vector<T> hR(size_R, 1, bc);
+        host_batch_vector<T> hx(size_x, 1, bc);
+        host_batch_vector<T> hQRes(size_QRes, 1, bc);
+        host_batch_vector<T> hRRes(size_RRes, 1, bc);
+        device_batch_vector<T> dQ(size_Q, 1, bc);
+        device_batch_vector<T> dR(size_R, 1, bc);
+        device_batch_vector<T> dx(size_x, 1, bc);
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+        if(size_R)
+            CHECK_HIP_ERROR(dR.memcheck());
+        if(size_x)
+            CHECK_HIP_ERROR(dx.memcheck());
+
+        // check quick return
+        if(quick_return)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx, dQ.data(), ldq,
+                                           stQ, dR.data(), ldr, stR, dx.data(), incx, stx, bc),
+                ldq, stQ, dR.data(), ldr, stR, dx.data(), incx, stx, bc), rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            qr_insert_delete_getError<STRIDED, ROW, INSERT, T>(
+                handle, m, n, idx, dQ, ldq, stQ, dR, ldr, stR, dx, incx, stx, bc, hA, hQ, hR, hx,
+                hQRes, hRRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            qr_insert_delete_getPerfData<STRIDED, ROW, INSERT, T>(
+                handle, m, n, idx, dQ, ldq, stQ, dR, ldr, stR, dx, incx, stx, bc, hA, hQ, hR, hx,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_R, 1, stR, bc);
+        host_strided_batch_vector<T> hQ(size_Q, 1, stQ, bc);
+        host_strided_batch_vector<T> hR(size_R, 1, stR, bc);
+        host_strided_batch_vector<T> hx(size_x, 1, stx, bc);
+        host_strided_batch_vector<T> hQRes(size_QRes, 1, stQRes, bc);
+        host_strided_batch_vector<T> hRRes(size_RRes, 1, stRRes, bc);
+        device_strided_batch_vector<T> dQ(size_Q, 1, stQ, bc);
+        device_strided_batch_vector<T> dR(size_R, 1, stR, bc);
+        device_strided_batch_vector<T> dx(size_x, 1, stx, bc);
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+        if(size_R)
+            CHECK_HIP_ERROR(dR.memcheck());
+        if(size_x)
+            CHECK_HIP_ERROR(dx.memcheck());
+
+        // check quick return
+        if(quick_return)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_qr_insert_delete(STRIDED, ROW, INSERT, handle, m, n, idx, dQ.data(), ldq,
+                                           stQ, dR.data(), ldr, stR, dx.data(), incx, stx, bc),
+                ldq, stQ, dR.data(), ldr, stR, dx.data(), incx, stx, bc), rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            qr_insert_delete_getError<STRIDED, ROW, INSERT, T>(
+                handle, m, n, idx, dQ, ldq, stQ, dR, ldr, stR, dx, incx, stx, bc, hA, hQ, hR, hx,
+                hQRes, hRRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            qr_insert_delete_getPerfData<STRIDED, ROW, INSERT, T>(
+                handle, m, n, idx, dQ, ldq, stQ, dR, ldr, stR, dx, incx, stx, bc, hA, hQ, hR, hx,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", ROW ? "i" : "j", "ldq", "ldr", "incx", "batch_c");
+                rocsolver_bench_output(m, n, idx, ldq, ldr, incx, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", ROW ? "i" : "j", "ldq", "strideQ", "ldr",
+                                       "strideR", "incx", "stridex", "batch_c");
+                rocsolver_bench_output(m, n, idx, ldq, stQ, ldr, stR, incx, stx, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", ROW ? "i" : "j", "ldq", "ldr", "incx");
+                rocsolver_bench_output(m, n, idx, ldq, ldr, incx);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,595 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T>
+void qr_update_checkBadArgs(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            const rocblas_int k,
+                            T dQ,
+                            const rocblas_int ldq,
+                            const rocblas_stride stQ,
+                            T dR,
+                            const rocblas_int ldr,
+                            const rocblas_stride stR,
+                            T dX,
+                            const rocblas_int ldx,
+                            const rocblas_stride stX,
+                            T dY,
+                            const rocblas_int ldy,
+                            const rocblas_stride stY,
+                            const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, nullptr, m, n, k, dQ, ldq, stQ, dR, ldr, stR,
+                                              dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ, ldq, stQ, dR, ldr,
+                                                  stR, dX, ldx, stX, dY, ldy, stY, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, (T) nullptr, ldq, stQ, dR,
+                                              ldr, stR, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ, ldq, stQ, (T) nullptr,
+                                              ldr, stR, dX, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR,
+                                              (T) nullptr, ldx, stX, dY, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR,
+                                              dX, ldx, stX, (T) nullptr, ldy, stY, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, 0, n, k, (T) nullptr, ldq, stQ,
+                                              (T) nullptr, ldr, stR, (T) nullptr, ldx, stX, dY, ldy,
+                                              stY, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, 0, k, dQ, ldq, stQ, (T) nullptr,
+                                              ldr, stR, dX, ldx, stX, (T) nullptr, ldy, stY, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, 0, dQ, ldq, stQ, dR, ldr, stR,
+                                              (T) nullptr, ldx, stX, (T) nullptr, ldy, stY, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ, ldq, stQ, dR, ldr,
+                                                  stR, dX, ldx, stX, dY, ldy, stY, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_qr_update_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int k = 1;
+    rocblas_int ldq = 1;
+    rocblas_int ldr = 1;
+    rocblas_int ldx = 1;
+    rocblas_int ldy = 1;
+    rocblas_stride stQ = 1;
+    rocblas_stride stR = 1;
+    rocblas_stride stX = 1;
+    rocblas_stride stY = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dQ(1, 1, 1);
+        device_batch_vector<T> dR(1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        device_batch_vector<T> dY(1, 1, 1);
+        CHECK_HIP_ERROR(dQ.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dY.memcheck());
+
+        // check bad arguments
+        qr_update_checkBadArgs<STRIDED>(handle, m, n, k, dQ.data(), ldq, stQ, dR.data(), ldr, stR,
+                                        dX.data(), ldx, stX, dY.data(), ldy, stY, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dQ(1, 1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        device_strided_batch_vector<T> dY(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dQ.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dY.memcheck());
+
+        // check bad arguments
+        qr_update_checkBadArgs<STRIDED>(handle, m, n, k, dQ.data(), ldq, stQ, dR.data(), ldr, stR,
+                                        dX.data(), ldx, stX, dY.data(), ldy, stY, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void qr_update_initData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int k,
+                        Td& dQ,
+                        const rocblas_int ldq,
+                        const rocblas_stride stQ,
+                        Td& dR,
+                        const rocblas_int ldr,
+                        const rocblas_stride stR,
+                        Td& dX,
+                        const rocblas_int ldx,
+                        const rocblas_stride stX,
+                        Td& dY,
+                        const rocblas_int ldy,
+                        const rocblas_stride stY,
+                        const rocblas_int bc,
+                        Th& hA,
+                        Th& hQ,
+                        Th& hR,
+                        Th& hX,
+                        Th& hY)
+{
+    if(CPU)
+    {
+        rocblas_int kk = min(m, n);
+        size_t size_W = max(m, n);
+        std::vector<T> hW(size_W);
+        std::vector<T> hIpiv(kk);
+
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hX, false);
+        rocblas_init<T>(hY, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // compute the QR factorization of A
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    hR[b][i + j * ldr] = hA[b][i + j * ldr];
+            }
+            cblas_geqrf<T>(m, n, hR[b], ldr, hIpiv.data(), hW.data(), size_W);
+
+            // form the full m-by-m matrix Q
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                    hQ[b][i + j * ldq] = hR[b][i + j * ldr];
+            }
+            cblas_orgqr_ungqr<T>(m, m, kk, hQ[b], ldq, hIpiv.data(), hW.data(), size_W);
+
+            // R is the upper trapezoidal part
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = j + 1; i < m; i++)
+                    hR[b][i + j * ldr] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dQ.transfer_from(hQ));
+        CHECK_HIP_ERROR(dR.transfer_from(hR));
+        CHECK_HIP_ERROR(dX.transfer_from(hX));
+        CHECK_HIP_ERROR(dY.transfer_from(hY));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Th>
+void qr_update_getError(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int k,
+                        Td& dQ,
+                        const rocblas_int ldq,
+                        const rocblas_stride stQ,
+                        Td& dR,
+                        const rocblas_int ldr,
+                        const rocblas_stride stR,
+                        Td& dX,
+                        const rocblas_int ldx,
+                        const rocblas_stride stX,
+                        Td& dY,
+                        const rocblas_int ldy,
+                        const rocblas_stride stY,
+                        const rocblas_int bc,
+                        Th& hA,
+                        Th& hQ,
+                        Th& hR,
+                        Th& hX,
+                        Th& hY,
+                        Th& hQRes,
+                        Th& hRRes,
+                        double* max_err)
+{
+    std::vector<T> hQR(size_t(ldr) * n);
+    std::vector<T> hRTr(size_t(ldr) * n);
+    std::vector<T> hQtQ(size_t(m) * m);
+    std::vector<T> hI(size_t(m) * m, 0);
+    for(rocblas_int i = 0; i < m; i++)
+        hI[i + i * m] = 1;
+
+    // input data initialization
+    qr_update_initData<true, true, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx, stX, dY,
+                                      ldy, stY, bc, hA, hQ, hR, hX, hY);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ.data(), ldq, stQ,
+                                            dR.data(), ldr, stR, dX.data(), ldx, stX, dY.data(),
+                                            ldy, stY, bc));
+    CHECK_HIP_ERROR(hQRes.transfer_from(dQ));
+    CHECK_HIP_ERROR(hRRes.transfer_from(dR));
+
+    // error is max(||A + X*Y' - Qres*Rres|| / ||A + X*Y'||, ||I - Qres'*Qres|| / ||I||)
+    // (the factorization is not unique, so results are not compared directly against
+    // a new factorization computed by LAPACK; instead the product is reconstructed on
+    // the host)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // form the modified matrix A + X*Y'
+        cblas_gemm<T>(rocblas_operation_none, rocblas_operation_conjugate_transpose, m, n, k,
+                      (T)1.0, hX[b], ldx, hY[b], ldy, (T)1.0, hA[b], ldr);
+
+        // compute Qres*Rres
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+                hRTr[i + j * ldr] = (i <= j) ? hRRes[b][i + j * ldr] : 0;
+        }
+        cblas_gemm<T>(rocblas_operation_none, rocblas_operation_none, m, n, m, (T)1.0, hQRes[b],
+                      ldq, hRTr.data(), ldr, (T)0.0, hQR.data(), ldr);
+
+        err = norm_error('F', m, n, ldr, hA[b], hQR.data());
+        *max_err = err > *max_err ? err : *max_err;
+
+        // check that Qres is orthogonal/unitary
+        cblas_gemm<T>(rocblas_operation_conjugate_transpose, rocblas_operation_none, m, m, m,
+                      (T)1.0, hQRes[b], ldq, hQRes[b], ldq, (T)0.0, hQtQ.data(), m);
+
+        err = norm_error('F', m, m, m, hI.data(), hQtQ.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Th>
+void qr_update_getPerfData(const rocblas_handle handle,
+                           const rocblas_int m,
+                           const rocblas_int n,
+                           const rocblas_int k,
+                           Td& dQ,
+                           const rocblas_int ldq,
+                           const rocblas_stride stQ,
+                           Td& dR,
+                           const rocblas_int ldr,
+                           const rocblas_stride stR,
+                           Td& dX,
+                           const rocblas_int ldx,
+                           const rocblas_stride stX,
+                           Td& dY,
+                           const rocblas_int ldy,
+                           const rocblas_stride stY,
+                           const rocblas_int bc,
+                           Th& hA,
+                           Th& hQ,
+                           Th& hR,
+                           Th& hX,
+                           Th& hY,
+                           double* gpu_time_used,
+                           double* cpu_time_used,
+                           const rocblas_int hot_calls,
+                           const bool perf)
+{
+    size_t size_W = max(m, n);
+    std::vector<T> hW(size_W);
+    std::vector<T> hIpiv(min(m, n));
+
+    if(!perf)
+    {
+        qr_update_initData<true, false, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                           stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no LAPACK routine to update a QR factorization, so the reference
+        // time is that of refactorizing the modified matrix)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_conjugate_transpose, m, n, k,
+                          (T)1.0, hX[b], ldx, hY[b], ldy, (T)1.0, hA[b], ldr);
+            cblas_geqrf<T>(m, n, hA[b], ldr, hIpiv.data(), hW.data(), size_W);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    qr_update_initData<true, false, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx, stX,
+                                       dY, ldy, stY, bc, hA, hQ, hR, hX, hY);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        qr_update_initData<false, true, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                           stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ.data(), ldq, stQ,
+                                                dR.data(), ldr, stR, dX.data(), ldx, stX,
+                                                dY.data(), ldy, stY, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        qr_update_initData<false, true, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                           stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY);
+
+        start = get_time_us_sync(stream);
+        rocsolver_qr_update(STRIDED, handle, m, n, k, dQ.data(), ldq, stQ, dR.data(), ldr, stR,
+                            dX.data(), ldx, stX, dY.data(), ldy, stY, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_qr_update(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.M;
+    rocblas_int n = argus.N;
+    rocblas_int k = argus.K;
+    rocblas_int ldq = argus.lda;
+    rocblas_int ldr = argus.ldb;
+    rocblas_int ldx = argus.ldc;
+    rocblas_int ldy = argus.ldv;
+    rocblas_stride stQ = argus.bsa;
+    rocblas_stride stR = argus.bsb;
+    rocblas_stride stX = argus.bsc;
+    rocblas_stride stY = argus.bsp;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stQRes = (argus.unit_check || argus.norm_check) ? stQ : 0;
+    rocblas_stride stRRes = (argus.unit_check || argus.norm_check) ? stR : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_Q = size_t(ldq) * m;
+    size_t size_R = size_t(ldr) * n;
+    size_t size_X = size_t(ldx) * k;
+    size_t size_Y = size_t(ldy) * k;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_QRes = (argus.unit_check || argus.norm_check) ? size_Q : 0;
+    size_t size_RRes = (argus.unit_check || argus.norm_check) ? size_R : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (m < 0 || n < 0 || k < 0 || ldq < m || ldr < m || ldx < m || ldy < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, (T* const*)nullptr,
+                                                      ldq, stQ, (T* const*)nullptr, ldr, stR,
+                                                      (T* const*)nullptr, ldx, stX,
+                                                      (T* const*)nullptr, ldy, stY, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, (T*)nullptr, ldq,
+                                                      stQ, (T*)nullptr, ldr, stR, (T*)nullptr, ldx,
+                                                      stX, (T*)nullptr, ldy, stY, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_qr_update(STRIDED, handle, m, n, k, (T* const*)nullptr, ldq,
+                                                  stQ, (T* const*)nullptr, ldr, stR,
+                                                  (T* const*)nullptr, ldx, stX, (T* const*)nullptr,
+                                                  ldy, stY, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_qr_update(STRIDED, handle, m, n, k, (T*)nullptr, ldq, stQ,
+                                                  (T*)nullptr, ldr, stR, (T*)nullptr, ldx, stX,
+                                                  (T*)nullptr, ldy, stY, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_R, 1, bc);
+        host_batch_vector<T> hQ(size_Q, 1, bc);
+        host_batch_vector<T> hR(size_R, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hY(size_Y, 1, bc);
+        host_batch_vector<T> hQRes(size_QRes, 1, bc);
+        host_batch_vector<T> hRRes(size_RRes, 1, bc);
+        device_batch_vector<T> dQ(size_Q, 1, bc);
+        device_batch_vector<T> dR(size_R, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        device_batch_vector<T> dY(size_Y, 1, bc);
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+        if(size_R)
+            CHECK_HIP_ERROR(dR.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        if(size_Y)
+            CHECK_HIP_ERROR(dY.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ.data(), ldq,
+                                                      stQ, dR.data(), ldr, stR, dX.data(), ldx,
+                                                      stX, dY.data(), ldy, stY, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            qr_update_getError<STRIDED, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                           stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY, hQRes, hRRes,
+                                           &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            qr_update_getPerfData<STRIDED, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                              stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY,
+                                              &gpu_time_used, &cpu_time_used, hot_calls,
+                                              argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_R, 1, stR, bc);
+        host_strided_batch_vector<T> hQ(size_Q, 1, stQ, bc);
+        host_strided_batch_vector<T> hR(size_R, 1, stR, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hY(size_Y, 1, stY, bc);
+        host_strided_batch_vector<T> hQRes(size_QRes, 1, stQRes, bc);
+        host_strided_batch_vector<T> hRRes(size_RRes, 1, stRRes, bc);
+        device_strided_batch_vector<T> dQ(size_Q, 1, stQ, bc);
+        device_strided_batch_vector<T> dR(size_R, 1, stR, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        device_strided_batch_vector<T> dY(size_Y, 1, stY, bc);
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+        if(size_R)
+            CHECK_HIP_ERROR(dR.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        if(size_Y)
+            CHECK_HIP_ERROR(dY.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_qr_update(STRIDED, handle, m, n, k, dQ.data(), ldq,
+                                                      stQ, dR.data(), ldr, stR, dX.data(), ldx,
+                                                      stX, dY.data(), ldy, stY, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            qr_update_getError<STRIDED, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                           stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY, hQRes, hRRes,
+                                           &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            qr_update_getPerfData<STRIDED, T>(handle, m, n, k, dQ, ldq, stQ, dR, ldr, stR, dX, ldx,
+                                              stX, dY, ldy, stY, bc, hA, hQ, hR, hX, hY,
+                                              &gpu_time_used, &cpu_time_used, hot_calls,
+                                              argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using k * max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, k * max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "k", "ldq", "ldr", "ldx", "ldy", "batch_c");
+                rocsolver_bench_output(m, n, k, ldq, ldr, ldx, ldy, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "k", "ldq", "strideQ", "ldr", "strideR", "ldx",
+                                       "strideX", "ldy", "strideY", "batch_c");
+                rocsolver_bench_output(m, n, k, ldq, stQ, ldr, stR, ldx, stX, ldy, stY, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "k", "ldq", "ldr", "ldx", "ldy");
+                rocsolver_bench_output(m, n, k, ldq, ldr, ldx, ldy);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,496 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <typename T, typename U>
+void stebz_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_erange erange,
+                        const rocblas_eorder eorder,
+                        const rocblas_int n,
+                        const T vl,
+                        const T vu,
+                        const rocblas_int il,
+                        const rocblas_int iu,
+                        const T abstol,
+                        T* dD,
+                        T* dE,
+                        U dNev,
+                        U dNsplit,
+                        T* dW,
+                        U dIblock,
+                        U dIsplit,
+                        U dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(nullptr, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, dNev, dNsplit, dW, dIblock, dIsplit, dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, rocblas_erange(-1), eorder, n, vl, vu, il, iu,
+                                          abstol, dD, dE, dNev, dNsplit, dW, dIblock, dIsplit,
+                                          dInfo),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, rocblas_eorder(-1), n, vl, vu, il, iu,
+                                          abstol, dD, dE, dNev, dNsplit, dW, dIblock, dIsplit,
+                                          dInfo),
+                          rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
+                                          (T*)nullptr, dE, dNev, dNsplit, dW, dIblock, dIsplit,
+                                          dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          (T*)nullptr, dNev, dNsplit, dW, dIblock, dIsplit, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, (U) nullptr, dNsplit, dW, dIblock, dIsplit, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, dNev, (U) nullptr, dW, dIblock, dIsplit, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, dNev, dNsplit, (T*)nullptr, dIblock, dIsplit, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, dNev, dNsplit, dW, (U) nullptr, dIsplit, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, dNev, dNsplit, dW, dIblock, (U) nullptr, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD,
+                                          dE, dNev, dNsplit, dW, dIblock, dIsplit, (U) nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, 0, vl, vu, il, 0, abstol,
+                                          (T*)nullptr, (T*)nullptr, dNev, dNsplit, (T*)nullptr,
+                                          (U) nullptr, (U) nullptr, dInfo),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_stebz_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_erange erange = rocblas_erange_value;
+    rocblas_eorder eorder = rocblas_eorder_entire;
+    rocblas_int n = 2;
+    T vl = 0.0;
+    T vu = 1.0;
+    rocblas_int il = 1;
+    rocblas_int iu = 1;
+    T abstol = 0;
+
+    // memory allocations
+    device_strided_batch_vector<T> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dE(1, 1, 1, 1);
+    device_strided_batch_vector<T> dW(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dNev(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dNsplit(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIblock(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIsplit(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dNev.memcheck());
+    CHECK_HIP_ERROR(dNsplit.memcheck());
+    CHECK_HIP_ERROR(dIblock.memcheck());
+    CHECK_HIP_ERROR(dIsplit.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    stebz_checkBadArgs(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD.data(), dE.data(),
+                       dNev.data(), dNsplit.data(), dW.data(), dIblock.data(), dIsplit.data(),
+                       dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void stebz_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    Td& dD,
+                    Td& dE,
+                    Th& hD,
+                    Th& hE)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hD, true);
+        rocblas_init<T>(hE, true);
+
+        // shift the matrix so that the eigenvalues are spread around zero and are
+        // (generally) not integers, which could fall on the bounds of the search interval
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            hD[0][i] -= 5.25;
+            hE[0][i] -= 5;
+        }
+
+        // add fixed splits in the matrix to test split handling
+        rocblas_int k = n / 2;
+        if(k > 0)
+        {
+            hE[0][k] = 0;
+            hE[0][k - 1] = 0;
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dE.transfer_from(hE));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void stebz_getError(const rocblas_handle handle,
+                    const rocblas_erange erange,
+                    const rocblas_eorder eorder,
+                    const rocblas_int n,
+                    const T vl,
+                    const T vu,
+                    const rocblas_int il,
+                    const rocblas_int iu,
+                    const T abstol,
+                    Td& dD,
+                    Td& dE,
+                    Ud& dNev,
+                    Ud& dNsplit,
+                    Td& dW,
+                    Ud& dIblock,
+                    Ud& dIsplit,
+                    Ud& dInfo,
+                    Th& hD,
+                    Th& hE,
+                    Uh& hNev,
+                    Uh& hNevRes,
+                    Uh& hNsplit,
+                    Uh& hNsplitRes,
+                    Th& hW,
+                    Th& hWRes,
+                    Uh& hIblock,
+                    Uh& hIblockRes,
+                    Uh& hIsplit,
+                    Uh& hIsplitRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err)
+{
+    std::vector<T> work(4 * n);
+    std::vector<rocblas_int> iwork(3 * n);
+
+    // input data initialization
+    stebz_initData<true, true, T>(handle, n, dD, dE, hD, hE);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
+                                        dD.data(), dE.data(), dNev.data(), dNsplit.data(),
+                                        dW.data(), dIblock.data(), dIsplit.data(), dInfo.data()));
+    CHECK_HIP_ERROR(hNevRes.transfer_from(dNev));
+    CHECK_HIP_ERROR(hNsplitRes.transfer_from(dNsplit));
+    CHECK_HIP_ERROR(hWRes.transfer_from(dW));
+    CHECK_HIP_ERROR(hIblockRes.transfer_from(dIblock));
+    CHECK_HIP_ERROR(hIsplitRes.transfer_from(dIsplit));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cblas_stebz<T>(erange, eorder, n, vl, vu, il, iu, abstol, hD[0], hE[0], hNev[0], hNsplit[0],
+                   hW[0], hIblock[0], hIsplit[0], work.data(), iwork.data(), hInfo[0]);
+
+    // check info, number of eigenvalues and splitting of the matrix
+    *max_err = 0;
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+    if(hNev[0][0] != hNevRes[0][0])
+        *max_err += 1;
+    if(hNsplit[0][0] != hNsplitRes[0][0])
+        *max_err += 1;
+    if(*max_err > 0)
+        return;
+
+    for(rocblas_int i = 0; i < hNsplit[0][0]; i++)
+    {
+        if(hIsplit[0][i] != hIsplitRes[0][i])
+            *max_err += 1;
+    }
+
+    // the eigenvalues are grouped by blocks only when eorder is blocks
+    if(eorder == rocblas_eorder_blocks)
+    {
+        for(rocblas_int i = 0; i < hNev[0][0]; i++)
+        {
+            if(hIblock[0][i] != hIblockRes[0][i])
+                *max_err += 1;
+        }
+    }
+
+    // error is ||hW - hWRes|| / ||hW||
+    // using frobenius norm
+    double err = 0;
+    if(hNev[0][0] > 0)
+        err = norm_error('F', 1, hNev[0][0], 1, hW[0], hWRes[0]);
+    *max_err = err > *max_err ? err : *max_err;
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void stebz_getPerfData(const rocblas_handle handle,
+                       const rocblas_erange erange,
+                       const rocblas_eorder eorder,
+                       const rocblas_int n,
+                       const T vl,
+                       const T vu,
+                       const rocblas_int il,
+                       const rocblas_int iu,
+                       const T abstol,
+                       Td& dD,
+                       Td& dE,
+                       Ud& dNev,
+                       Ud& dNsplit,
+                       Td& dW,
+                       Ud& dIblock,
+                       Ud& dIsplit,
+                       Ud& dInfo,
+                       Th& hD,
+                       Th& hE,
+                       Uh& hNev,
+                       Uh& hNsplit,
+                       Th& hW,
+                       Uh& hIblock,
+                       Uh& hIsplit,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf)
+{
+    std::vector<T> work(4 * n);
+    std::vector<rocblas_int> iwork(3 * n);
+
+    if(!perf)
+    {
+        stebz_initData<true, false, T>(handle, n, dD, dE, hD, hE);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_stebz<T>(erange, eorder, n, vl, vu, il, iu, abstol, hD[0], hE[0], hNev[0],
+                       hNsplit[0], hW[0], hIblock[0], hIsplit[0], work.data(), iwork.data(),
+                       hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    stebz_initData<true, false, T>(handle, n, dD, dE, hD, hE);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        stebz_initData<false, true, T>(handle, n, dD, dE, hD, hE);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
+                                            dD.data(), dE.data(), dNev.data(), dNsplit.data(),
+                                            dW.data(), dIblock.data(), dIsplit.data(),
+                                            dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        stebz_initData<false, true, T>(handle, n, dD, dE, hD, hE);
+
+        start = get_time_us_sync(stream);
+        rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD.data(), dE.data(),
+                        dNev.data(), dNsplit.data(), dW.data(), dIblock.data(), dIsplit.data(),
+                        dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_stebz(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    T vl = T(argus.vl);
+    T vu = T(argus.vu);
+    rocblas_int il = argus.il;
+    rocblas_int iu = argus.iu;
+    T abstol = T(argus.abstol);
+    rocblas_int hot_calls = argus.iters;
+    char erangeC = argus.erange;
+    char eorderC = argus.eorder;
+    rocblas_erange erange = char2rocblas_erange(erangeC);
+    rocblas_eorder eorder = char2rocblas_eorder(eorderC);
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_D = n;
+    size_t size_E = n;
+    size_t size_W = n;
+    size_t size_iblock = n;
+    size_t size_isplit = n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_WRes = (argus.unit_check || argus.norm_check) ? size_W : 0;
+    size_t size_iblockRes = (argus.unit_check || argus.norm_check) ? size_iblock : 0;
+    size_t size_isplitRes = (argus.unit_check || argus.norm_check) ? size_isplit : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || (erange == rocblas_erange_value && vl >= vu)
+                         || (erange == rocblas_erange_index && (il < 1 || iu < 0))
+                         || (erange == rocblas_erange_index && (iu > n || (n > 0 && il > iu))));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
+                                              (T*)nullptr, (T*)nullptr, (rocblas_int*)nullptr,
+                                              (rocblas_int*)nullptr, (T*)nullptr,
+                                              (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                              (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
+                                          (T*)nullptr, (T*)nullptr, (rocblas_int*)nullptr,
+                                          (rocblas_int*)nullptr, (T*)nullptr,
+                                          (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                          (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hE(size_E, 1, size_E, 1);
+    host_strided_batch_vector<T> hW(size_W, 1, size_W, 1);
+    host_strided_batch_vector<T> hWRes(size_WRes, 1, size_WRes, 1);
+    host_strided_batch_vector<rocblas_int> hIblock(size_iblock, 1, size_iblock, 1);
+    host_strided_batch_vector<rocblas_int> hIblockRes(size_iblockRes, 1, size_iblockRes, 1);
+    host_strided_batch_vector<rocblas_int> hIsplit(size_isplit, 1, size_isplit, 1);
+    host_strided_batch_vector<rocblas_int> hIsplitRes(size_isplitRes, 1, size_isplitRes, 1);
+    host_strided_batch_vector<rocblas_int> hNev(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hNevRes(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hNsplit(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hNsplitRes(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dE(size_E, 1, size_E, 1);
+    device_strided_batch_vector<T> dW(size_W, 1, size_W, 1);
+    device_strided_batch_vector<rocblas_int> dIblock(size_iblock, 1, size_iblock, 1);
+    device_strided_batch_vector<rocblas_int> dIsplit(size_isplit, 1, size_isplit, 1);
+    device_strided_batch_vector<rocblas_int> dNev(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dNsplit(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+    if(size_W)
+        CHECK_HIP_ERROR(dW.memcheck());
+    if(size_iblock)
+        CHECK_HIP_ERROR(dIblock.memcheck());
+    if(size_isplit)
+        CHECK_HIP_ERROR(dIsplit.memcheck());
+    CHECK_HIP_ERROR(dNev.memcheck());
+    CHECK_HIP_ERROR(dNsplit.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
+                                              dD.data(), dE.data(), dNev.data(), dNsplit.data(),
+                                              dW.data(), dIblock.data(), dIsplit.data(),
+                                              dInfo.data()),
+                              rocblas_status_success);
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        stebz_getError<T>(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD, dE, dNev, dNsplit,
+                          dW, dIblock, dIsplit, dInfo, hD, hE, hNev, hNevRes, hNsplit, hNsplitRes,
+                          hW, hWRes, hIblock, hIblockRes, hIsplit, hIsplitRes, hInfo, hInfoRes,
+                          &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        stebz_getPerfData<T>(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD, dE, dNev,
+                             dNsplit, dW, dIblock, dIsplit, dInfo, hD, hE, hNev, hNsplit, hW,
+                             hIblock, hIsplit, hInfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                             argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            rocsolver_bench_output("erange", "eorder", "n", "vl", "vu", "il", "iu", "abstol");
+            rocsolver_bench_output(erangeC, eorderC, n, vl, vu, il, iu, abstol);
+
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,420 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <typename S, typename T, typename U>
+void stedc_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_evect evect,
+                        const rocblas_int n,
+                        S dD,
+                        S dE,
+                        T dC,
+                        const rocblas_int ldc,
+                        U dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_stedc(nullptr, evect, n, dD, dE, dC, ldc, dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_stedc(handle, rocblas_evect(-1), n, dD, dE, dC, ldc, dInfo),
+                          rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_stedc(handle, evect, n, (S) nullptr, dE, dC, ldc, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stedc(handle, evect, n, dD, (S) nullptr, dC, ldc, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stedc(handle, evect, n, dD, dE, (T) nullptr, ldc, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_stedc(handle, evect, n, dD, dE, dC, ldc, (U) nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_stedc(handle, evect, 0, (S) nullptr, (S) nullptr, (T) nullptr, ldc, dInfo),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_stedc_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_evect evect = rocblas_evect_original;
+    rocblas_int n = 1;
+    rocblas_int ldc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dD(1, 1, 1, 1);
+    device_strided_batch_vector<S> dE(1, 1, 1, 1);
+    device_strided_batch_vector<T> dC(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    stedc_checkBadArgs(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename S, typename T, typename Sd, typename Td, typename Ud, typename Sh, typename Th, typename Uh>
+void stedc_initData(const rocblas_handle handle,
+                    const rocblas_evect evect,
+                    const rocblas_int n,
+                    Sd& dD,
+                    Sd& dE,
+                    Td& dC,
+                    const rocblas_int ldc,
+                    Ud& dInfo,
+                    Sh& hD,
+                    Sh& hE,
+                    Th& hC,
+                    Uh& hInfo)
+{
+    if(CPU)
+    {
+        rocblas_init<S>(hD, true);
+        rocblas_init<S>(hE, true);
+
+        // scale matrix and add random splits
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            hD[0][i] += 400;
+            hE[0][i] -= 5;
+        }
+
+        // add fixed splits in the matrix to test split handling
+        rocblas_int k = n / 2;
+        hE[0][k] = 0;
+        hE[0][k - 1] = 0;
+
+        // initialize C to the identity matrix
+        if(evect == rocblas_evect_original)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hC[0][i + j * ldc] = 1;
+                    else
+                        hC[0][i + j * ldc] = 0;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dE.transfer_from(hE));
+
+        if(evect == rocblas_evect_original)
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+    }
+}
+
+template <typename T, typename Sd, typename Td, typename Ud, typename Sh, typename Th, typename Uh>
+void stedc_getError(const rocblas_handle handle,
+                    const rocblas_evect evect,
+                    const rocblas_int n,
+                    Sd& dD,
+                    Sd& dE,
+                    Td& dC,
+                    const rocblas_int ldc,
+                    Ud& dInfo,
+                    Sh& hD,
+                    Sh& hDRes,
+                    Sh& hE,
+                    Sh& hERes,
+                    Th& hC,
+                    Th& hCRes,
+                    Uh& hInfo,
+                    double* max_err)
+{
+    using S = decltype(std::real(T{}));
+
+    // input data initialization
+    stedc_initData<true, true, S, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_stedc(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data()));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+    CHECK_HIP_ERROR(hERes.transfer_from(dE));
+    if(evect != rocblas_evect_none)
+        CHECK_HIP_ERROR(hCRes.transfer_from(dC));
+
+    if(evect == rocblas_evect_none)
+    {
+        // only eigenvalues needed; can compare with LAPACK
+
+        // CPU lapack
+        cblas_sterf<S>(n, hD[0], hE[0]);
+
+        // error is ||hD - hDRes|| / ||hD||
+        // using frobenius norm
+        *max_err = norm_error('F', 1, n, 1, hD[0], hDRes[0]);
+    }
+    else
+    {
+        // both eigenvalues and eigenvectors needed; need to implicitly test
+        // eigenvectors due to non-uniqueness of eigenvectors under scaling
+
+        // prepare matrix A (upper triangular)
+        rocblas_int lda = n;
+        size_t size_A = lda * n;
+        host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = i; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] = hD[0][i];
+                else if(i + 1 == j)
+                    hA[0][i + j * lda] = hE[0][i];
+                else
+                    hA[0][i + j * lda] = 0;
+            }
+        }
+
+        // multiply A with each of the n eigenvectors and divide by corresponding
+        // eigenvalues
+        T alpha;
+        T beta = 0;
+        for(int j = 0; j < n; j++)
+        {
+            alpha = T(1) / hDRes[0][j];
+            cblas_symv_hemv(rocblas_fill_upper, n, alpha, hA[0], lda, hCRes[0] + j * ldc, 1, beta,
+                            hC[0] + j * ldc, 1);
+        }
+
+        // error is ||hC - hCRes|| / ||hC||
+        // using frobenius norm
+        *max_err = norm_error('F', n, n, ldc, hC[0], hCRes[0]);
+    }
+}
+
+template <typename T, typename Sd, typename Td, typename Ud, typename Sh, typename Th, typename Uh>
+void stedc_getPerfData(const rocblas_handle handle,
+                       const rocblas_evect evect,
+                       const rocblas_int n,
+                       Sd& dD,
+                       Sd& dE,
+                       Td& dC,
+                       const rocblas_int ldc,
+                       Ud& dInfo,
+                       Sh& hD,
+                       Sh& hE,
+                       Th& hC,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+
+    // LAPACK workspace sizes (computing the eigenvectors of the original matrix
+    // is the most demanding case)
+    rocblas_int lgn = 0;
+    while((1 << lgn) < n)
+        lgn++;
+    rocblas_int size_rW = 1 + 3 * n + 2 * n * lgn + 4 * n * n;
+    rocblas_int lwork = (is_complex<T> ? n * n : size_rW);
+    rocblas_int lrwork = (is_complex<T> ? size_rW : 0);
+    rocblas_int liwork = 6 + 6 * n + 5 * n * lgn;
+    std::vector<T> hW(lwork);
+    std::vector<S> hRW(lrwork);
+    std::vector<rocblas_int> hIW(liwork);
+
+    if(!perf)
+    {
+        stedc_initData<true, false, S, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC,
+                                          hInfo);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_stedc<S, T>(evect, n, hD[0], hE[0], hC[0], ldc, hW.data(), lwork, hRW.data(), lrwork,
+                          hIW.data(), liwork, hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    stedc_initData<true, false, S, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        stedc_initData<false, true, S, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC,
+                                          hInfo);
+
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_stedc(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        stedc_initData<false, true, S, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC,
+                                          hInfo);
+
+        start = get_time_us_sync(stream);
+        rocsolver_stedc(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_stedc(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int ldc = argus.ldc;
+    rocblas_int hot_calls = argus.iters;
+    char evectC = argus.evect;
+    rocblas_evect evect = char2rocblas_evect(evectC);
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_D = n;
+    size_t size_E = n;
+    size_t size_C = ldc * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_DRes = (argus.unit_check || argus.norm_check) ? size_D : 0;
+    size_t size_ERes = (argus.unit_check || argus.norm_check) ? size_E : 0;
+    size_t size_CRes = (argus.unit_check || argus.norm_check) ? size_C : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || (evect != rocblas_evect_none && ldc < n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_stedc(handle, evect, n, (S*)nullptr, (S*)nullptr,
+                                              (T*)nullptr, ldc, (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_stedc(handle, evect, n, (S*)nullptr, (S*)nullptr, (T*)nullptr,
+                                          ldc, (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<S> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<S> hDRes(size_DRes, 1, size_DRes, 1);
+    host_strided_batch_vector<S> hE(size_E, 1, size_E, 1);
+    host_strided_batch_vector<S> hERes(size_ERes, 1, size_ERes, 1);
+    host_strided_batch_vector<T> hC(size_C, 1, size_C, 1);
+    host_strided_batch_vector<T> hCRes(size_CRes, 1, size_CRes, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+    device_strided_batch_vector<S> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<S> dE(size_E, 1, size_E, 1);
+    device_strided_batch_vector<T> dC(size_C, 1, size_C, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+    if(size_C)
+        CHECK_HIP_ERROR(dC.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_stedc(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data()),
+            rocblas_status_success);
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(0);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        stedc_getError<T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hDRes, hE, hERes, hC, hCRes,
+                          hInfo, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        stedc_getPerfData<T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo,
+                             &gpu_time_used, &cpu_time_used, hot_calls, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            rocsolver_bench_output("evect", "n", "ldc");
+            rocsolver_bench_output(evectC, n, ldc);
+
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
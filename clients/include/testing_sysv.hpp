@@ -0,0 +1,563 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void sysv_checkBadArgs(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       T dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       U dIpiv,
+                       const rocblas_stride stP,
+                       T dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       U dInfo,
+                       const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, nullptr, uplo, n, nrhs, dA, lda, stA, dIpiv, stP,
+                                         dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, rocblas_fill_full, n, nrhs, dA, lda, stA,
+                                         dIpiv, stP, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA, lda, stA, dIpiv,
+                                             stP, dB, ldb, stB, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, (T) nullptr, lda, stA,
+                                         dIpiv, stP, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA, lda, stA, (U) nullptr,
+                                         stP, dB, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA, lda, stA, dIpiv, stP,
+                                         (T) nullptr, ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA, lda, stA, dIpiv, stP,
+                                         dB, ldb, stB, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, 0, nrhs, (T) nullptr, lda, stA,
+                                         (U) nullptr, stP, (T) nullptr, ldb, stB, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, 0, dA, lda, stA, dIpiv, stP,
+                                         (T) nullptr, ldb, stB, dInfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA, lda, stA, dIpiv,
+                                             stP, dB, ldb, stB, (U) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA, lda, stA, dIpiv,
+                                             stP, dB, ldb, stB, dInfo, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_sysv_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        sysv_checkBadArgs<STRIDED>(handle, uplo, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
+                                   dB.data(), ldb, stB, dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        sysv_checkBadArgs<STRIDED>(handle, uplo, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
+                                   dB.data(), ldb, stB, dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void sysv_initData(const rocblas_handle handle,
+                   const rocblas_int n,
+                   const rocblas_int nrhs,
+                   Td& dA,
+                   const rocblas_int lda,
+                   const rocblas_stride stA,
+                   Td& dB,
+                   const rocblas_int ldb,
+                   const rocblas_stride stB,
+                   const rocblas_int bc,
+                   Th& hA,
+                   Th& hB,
+                   const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // shift the entries so that the matrix is indefinite and not diagonally
+            // dominant (this forces interchanges and 2-by-2 pivots)
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = j; i < n; i++)
+                {
+                    hA[b][i + j * lda] -= 4;
+                    hA[b][i + j * lda] += T(1.0 / (i + j + 1));
+                    hA[b][j + i * lda] = hA[b][i + j * lda];
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                // The algorithm must detect the singularity and skip the solve
+                // in those matrices in the batch that are singular
+                rocblas_int j = n / 4 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    hA[b][i + j * lda] = 0;
+                    hA[b][j + i * lda] = 0;
+                }
+                j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    hA[b][i + j * lda] = 0;
+                    hA[b][j + i * lda] = 0;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void sysv_getError(const rocblas_handle handle,
+                   const rocblas_fill uplo,
+                   const rocblas_int n,
+                   const rocblas_int nrhs,
+                   Td& dA,
+                   const rocblas_int lda,
+                   const rocblas_stride stA,
+                   Ud& dIpiv,
+                   const rocblas_stride stP,
+                   Td& dB,
+                   const rocblas_int ldb,
+                   const rocblas_stride stB,
+                   Ud& dInfo,
+                   const rocblas_int bc,
+                   Th& hA,
+                   Uh& hIpiv,
+                   Th& hB,
+                   Th& hBRes,
+                   Uh& hInfo,
+                   Uh& hInfoRes,
+                   double* max_err,
+                   const bool singular)
+{
+    int lwork = 64 * n;
+    std::vector<T> work(lwork);
+
+    // input data initialization
+    sysv_initData<true, true, T>(handle, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA.data(), lda, stA,
+                                       dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cblas_sysv<T>(uplo, n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb, work.data(), lwork,
+                      hInfo[b]);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', n, nrhs, ldb, hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void sysv_getPerfData(const rocblas_handle handle,
+                      const rocblas_fill uplo,
+                      const rocblas_int n,
+                      const rocblas_int nrhs,
+                      Td& dA,
+                      const rocblas_int lda,
+                      const rocblas_stride stA,
+                      Ud& dIpiv,
+                      const rocblas_stride stP,
+                      Td& dB,
+                      const rocblas_int ldb,
+                      const rocblas_stride stB,
+                      Ud& dInfo,
+                      const rocblas_int bc,
+                      Th& hA,
+                      Uh& hIpiv,
+                      Th& hB,
+                      Uh& hInfo,
+                      double* gpu_time_used,
+                      double* cpu_time_used,
+                      const rocblas_int hot_calls,
+                      const bool perf,
+                      const bool singular)
+{
+    int lwork = 64 * n;
+    std::vector<T> work(lwork);
+
+    if(!perf)
+    {
+        sysv_initData<true, false, T>(handle, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB,
+                                      singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cblas_sysv<T>(uplo, n, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb, work.data(), lwork,
+                          hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    sysv_initData<true, false, T>(handle, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB,
+                                  singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        sysv_initData<false, true, T>(handle, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB,
+                                      singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA.data(), lda, stA,
+                                           dIpiv.data(), stP, dB.data(), ldb, stB, dInfo.data(),
+                                           bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        sysv_initData<false, true, T>(handle, n, nrhs, dA, lda, stA, dB, ldb, stB, bc, hA, hB,
+                                      singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
+                       dB.data(), ldb, stB, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_sysv(Arguments argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.M;
+    rocblas_int nrhs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_stride stA = argus.bsa;
+    rocblas_stride stP = argus.bsp;
+    rocblas_stride stB = argus.bsb;
+    rocblas_int bc = argus.batch_count;
+    char uploC = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs,
+                                                 (T* const*)nullptr, lda, stA,
+                                                 (rocblas_int*)nullptr, stP, (T* const*)nullptr,
+                                                 ldb, stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, (T*)nullptr, lda,
+                                                 stA, (rocblas_int*)nullptr, stP, (T*)nullptr, ldb,
+                                                 stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs,
+                                                 (T* const*)nullptr, lda, stA,
+                                                 (rocblas_int*)nullptr, stP, (T* const*)nullptr,
+                                                 ldb, stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, (T*)nullptr, lda,
+                                                 stA, (rocblas_int*)nullptr, stP, (T*)nullptr, ldb,
+                                                 stB, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, (T* const*)nullptr,
+                                             lda, stA, (rocblas_int*)nullptr, stP,
+                                             (T* const*)nullptr, ldb, stB, (rocblas_int*)nullptr,
+                                             bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, (T*)nullptr, lda, stA,
+                                             (rocblas_int*)nullptr, stP, (T*)nullptr, ldb, stB,
+                                             (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // ipiv and info
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hBRes(size_BRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA.data(), lda,
+                                                 stA, dIpiv.data(), stP, dB.data(), ldb, stB,
+                                                 dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            sysv_getError<STRIDED, T>(handle, uplo, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
+                                      stB, dInfo, bc, hA, hIpiv, hB, hBRes, hInfo, hInfoRes,
+                                      &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            sysv_getPerfData<STRIDED, T>(handle, uplo, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
+                                         stB, dInfo, bc, hA, hIpiv, hB, hInfo, &gpu_time_used,
+                                         &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_sysv(STRIDED, handle, uplo, n, nrhs, dA.data(), lda,
+                                                 stA, dIpiv.data(), stP, dB.data(), ldb, stB,
+                                                 dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            sysv_getError<STRIDED, T>(handle, uplo, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
+                                      stB, dInfo, bc, hA, hIpiv, hB, hBRes, hInfo, hInfoRes,
+                                      &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            sysv_getPerfData<STRIDED, T>(handle, uplo, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
+                                         stB, dInfo, bc, hA, hIpiv, hB, hInfo, &gpu_time_used,
+                                         &cpu_time_used, hot_calls, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "nrhs", "lda", "ldb", "strideP", "batch_c");
+                rocsolver_bench_output(uploC, n, nrhs, lda, ldb, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "nrhs", "lda", "ldb", "strideA", "strideP",
+                                       "strideB", "batch_c");
+                rocsolver_bench_output(uploC, n, nrhs, lda, ldb, stA, stP, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "nrhs", "lda", "ldb");
+                rocsolver_bench_output(uploC, n, nrhs, lda, ldb);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -0,0 +1,463 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S>
+void trcon_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_norm_type norm_type,
+                        const rocblas_fill uplo,
+                        const rocblas_diagonal diag,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        S dRcond,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_trcon(STRIDED, nullptr, norm_type, uplo, diag, n, dA, lda, stA, dRcond, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, rocblas_norm_max, uplo, diag, n, dA, lda,
+                                          stA, dRcond, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, rocblas_fill_full, diag, n,
+                                          dA, lda, stA, dRcond, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, rocblas_diagonal(-1), n,
+                                          dA, lda, stA, dRcond, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA, lda, stA, dRcond, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, (T) nullptr,
+                                          lda, stA, dRcond, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA, lda, stA,
+                                          (S) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, 0, (T) nullptr,
+                                          lda, stA, dRcond, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA, lda,
+                                              stA, (S) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA, lda, stA, dRcond, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_trcon_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_norm_type norm_type = rocblas_norm_one;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_diagonal diag = rocblas_diagonal_non_unit;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dRcond.memcheck());
+
+        // check bad arguments
+        trcon_checkBadArgs<STRIDED>(handle, norm_type, uplo, diag, n, dA.data(), lda, stA,
+                                    dRcond.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dRcond.memcheck());
+
+        // check bad arguments
+        trcon_checkBadArgs<STRIDED>(handle, norm_type, uplo, diag, n, dA.data(), lda, stA,
+                                    dRcond.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void trcon_initData(const rocblas_handle handle,
+                    const rocblas_diagonal diag,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_int bc,
+                    Th& hA,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            if(singular && diag == rocblas_diagonal_non_unit
+               && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // add some singularities
+                // always the same elements for debugging purposes
+                // the estimated reciprocal condition number of those matrices
+                // in the batch that are singular must be zero
+                rocblas_int i = n / 4 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void trcon_getError(const rocblas_handle handle,
+                    const rocblas_norm_type norm_type,
+                    const rocblas_fill uplo,
+                    const rocblas_diagonal diag,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Sd& dRcond,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Sh& hRcond,
+                    Sh& hRcondRes,
+                    double* max_err,
+                    const bool singular)
+{
+    // input data initialization
+    trcon_initData<true, true, T>(handle, diag, n, dA, lda, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA.data(), lda,
+                                        stA, dRcond.data(), bc));
+    CHECK_HIP_ERROR(hRcondRes.transfer_from(dRcond));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_trcon<T>(norm_type, uplo, diag, n, hA[b], lda, hRcond[b]);
+
+    // error is |rcond - rcondRes| / |rcond|
+    // (singular matrices must return exactly zero)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hRcond[b][0] == 0)
+            err = (hRcondRes[b][0] == 0) ? 0 : 1;
+        else
+            err = std::abs(hRcond[b][0] - hRcondRes[b][0]) / std::abs(hRcond[b][0]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void trcon_getPerfData(const rocblas_handle handle,
+                       const rocblas_norm_type norm_type,
+                       const rocblas_fill uplo,
+                       const rocblas_diagonal diag,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Sd& dRcond,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Sh& hRcond,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const bool perf,
+                       const bool singular)
+{
+    if(!perf)
+    {
+        trcon_initData<true, false, T>(handle, diag, n, dA, lda, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_trcon<T>(norm_type, uplo, diag, n, hA[b], lda, hRcond[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    trcon_initData<true, false, T>(handle, diag, n, dA, lda, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        trcon_initData<false, true, T>(handle, diag, n, dA, lda, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA.data(),
+                                            lda, stA, dRcond.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        trcon_initData<false, true, T>(handle, diag, n, dA, lda, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n, dA.data(), lda, stA,
+                        dRcond.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_trcon(Arguments argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_stride stA = argus.bsa;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+    char normC = argus.norm_type;
+    char uploC = argus.uplo_option;
+    char diagC = argus.diag_option;
+    rocblas_norm_type norm_type = char2rocblas_norm(normC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_diagonal diag = char2rocblas_diagonal(diagC);
+
+    // check non-supported values
+    if((norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf)
+       || (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower))
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                                  (T* const*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                                  (T*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                                  (T* const*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                                  (T*)nullptr, lda, stA, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(!USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                              (T* const*)nullptr, lda, stA, (S*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                              (T*)nullptr, lda, stA, (S*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<S> hRcond(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcondRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dRcond.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                                  dA.data(), lda, stA, dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            trcon_getError<STRIDED, T>(handle, norm_type, uplo, diag, n, dA, lda, stA, dRcond, bc,
+                                       hA, hRcond, hRcondRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            trcon_getPerfData<STRIDED, T>(handle, norm_type, uplo, diag, n, dA, lda, stA, dRcond,
+                                          bc, hA, hRcond, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_trcon(STRIDED, handle, norm_type, uplo, diag, n,
+                                                  dA.data(), lda, stA, dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                ROCSOLVER_BENCH_INFORM(0);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            trcon_getError<STRIDED, T>(handle, norm_type, uplo, diag, n, dA, lda, stA, dRcond, bc,
+                                       hA, hRcond, hRcondRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            trcon_getPerfData<STRIDED, T>(handle, norm_type, uplo, diag, n, dA, lda, stA, dRcond,
+                                          bc, hA, hRcond, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Arguments:\n";
+            rocsolver_cout << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("norm_type", "uplo", "diag", "n", "lda", "batch_c");
+                rocsolver_bench_output(normC, uploC, diagC, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("norm_type", "uplo", "diag", "n", "lda", "strideA",
+                                       "batch_c");
+                rocsolver_bench_output(normC, uploC, diagC, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("norm_type", "uplo", "diag", "n", "lda");
+                rocsolver_bench_output(normC, uploC, diagC, n, lda);
+            }
+            rocsolver_cout << "\n============================================\n";
+            rocsolver_cout << "Results:\n";
+            rocsolver_cout << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_cout << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -138,6 +138,39 @@ constexpr auto rocblas2char_eform(rocblas_eform value)
     return '\0';
 }
 
+constexpr auto rocblas2char_norm(rocblas_norm_type value)
+{
+    switch(value)
+    {
+    case rocblas_norm_one: return '1';
+    case rocblas_norm_inf: return 'I';
+    case rocblas_norm_max: return 'M';
+    case rocblas_norm_frobenius: return 'F';
+    }
+    return '\0';
+}
+
+constexpr auto rocblas2char_erange(rocblas_erange value)
+{
+    switch(value)
+    {
+    case rocblas_erange_all: return 'A';
+    case rocblas_erange_value: return 'V';
+    case rocblas_erange_index: return 'I';
+    }
+    return '\0';
+}
+
+constexpr auto rocblas2char_eorder(rocblas_eorder value)
+{
+    switch(value)
+    {
+    case rocblas_eorder_blocks: return 'B';
+    case rocblas_eorder_entire: return 'E';
+    }
+    return '\0';
+}
+
 // return precision string for rocblas_datatype
 constexpr auto rocblas2string_datatype(rocblas_datatype type)
 {
@@ -292,6 +325,39 @@ constexpr rocblas_eform char2rocblas_eform(char value)
     }
 }
 
+constexpr rocblas_norm_type char2rocblas_norm(char value)
+{
+    switch(value)
+    {
+    case '1': return rocblas_norm_one;
+    case 'I': return rocblas_norm_inf;
+    case 'M': return rocblas_norm_max;
+    case 'F': return rocblas_norm_frobenius;
+    default: return static_cast<rocblas_norm_type>(-1);
+    }
+}
+
+constexpr rocblas_erange char2rocblas_erange(char value)
+{
+    switch(value)
+    {
+    case 'A': return rocblas_erange_all;
+    case 'V': return rocblas_erange_value;
+    case 'I': return rocblas_erange_index;
+    default: return static_cast<rocblas_erange>(-1);
+    }
+}
+
+constexpr rocblas_eorder char2rocblas_eorder(char value)
+{
+    switch(value)
+    {
+    case 'B': return rocblas_eorder_blocks;
+    case 'E': return rocblas_eorder_entire;
+    default: return static_cast<rocblas_eorder>(-1);
+    }
+}
+
 // clang-format off
 inline rocblas_initialization string2rocblas_initialization(const std::string& value)
 {
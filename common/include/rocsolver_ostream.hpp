@@ -396,6 +396,24 @@ public:
         return os << rocblas2char_eform(value);
     }
 
+    // rocsolver_norm output
+    friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_norm_type value)
+    {
+        return os << rocblas2char_norm(value);
+    }
+
+    // rocsolver_erange output
+    friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_erange value)
+    {
+        return os << rocblas2char_erange(value);
+    }
+
+    // rocsolver_eorder output
+    friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_eorder value)
+    {
+        return os << rocblas2char_eorder(value);
+    }
+
     // rocsolver_status output
     friend rocsolver_ostream& operator<<(rocsolver_ostream& os, rocblas_status status)
     {
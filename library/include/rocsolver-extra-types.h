@@ -71,4 +71,35 @@ typedef enum rocblas_eform_
     rocblas_eform_bax = 223, /**< The problem is B*A*x = lambda*x. */
 } rocblas_eform;
 
+/*! \brief Used to specify the norm of a matrix to be computed or estimated
+ ********************************************************************************/
+typedef enum rocblas_norm_type_
+{
+    rocblas_norm_one = 231, /**< The 1-norm (maximum absolute column sum). */
+    rocblas_norm_inf = 232, /**< The infinity norm (maximum absolute row sum). */
+    rocblas_norm_max = 233, /**< The largest absolute value of any element. */
+    rocblas_norm_frobenius = 234, /**< The Frobenius norm. */
+} rocblas_norm_type;
+
+/*! \brief Used to specify the type of range in which eigenvalues will be found
+ *in partial eigenvalue decompositions
+ ********************************************************************************/
+typedef enum rocblas_erange_
+{
+    rocblas_erange_all = 241, /**< All eigenvalues will be found. */
+    rocblas_erange_value = 242, /**< All eigenvalues in the half-open interval
+                                  (vl, vu] will be found. */
+    rocblas_erange_index = 243, /**< The il-th through iu-th eigenvalues will be found.*/
+} rocblas_erange;
+
+/*! \brief Used to specify whether the eigenvalues are grouped and ordered by blocks
+ ********************************************************************************/
+typedef enum rocblas_eorder_
+{
+    rocblas_eorder_blocks = 251, /**< The computed eigenvalues will be grouped by split-off
+                                   blocks and arranged in increasing order within each block. */
+    rocblas_eorder_entire = 252, /**< All computed eigenvalues of the entire matrix will be
+                                   ordered from smallest to largest. */
+} rocblas_eorder;
+
 #endif /* ROCSOLVER_EXTRAS_H_ */
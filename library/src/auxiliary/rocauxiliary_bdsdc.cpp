@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_bdsdc.hpp"
+
+template <typename S>
+rocblas_status rocsolver_bdsdc_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_svect svect,
+                                    const rocblas_int n,
+                                    S* D,
+                                    S* E,
+                                    S* U,
+                                    const rocblas_int ldu,
+                                    S* V,
+                                    const rocblas_int ldv,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("bdsdc", "--uplo", uplo, "--leftsv", svect, "-n", n, "--ldb", ldu, "--ldv",
+                        ldv);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_bdsdc_argCheck(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftU = 0;
+    rocblas_int shiftV = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideD = 0;
+    rocblas_stride strideE = 0;
+    rocblas_stride strideU = 0;
+    rocblas_stride strideV = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for the divide and conquer workspace (or the bdsqr workspace)
+    size_t size_work_stack;
+    // size for temporary matrices of singular vectors
+    size_t size_tempvect;
+    rocsolver_bdsdc_getMemorySize<S>(svect, n, batch_count, &size_work_stack, &size_tempvect);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work_stack, size_tempvect);
+
+    // memory workspace allocation
+    void *work_stack, *tempvect;
+    rocblas_device_malloc mem(handle, size_work_stack, size_tempvect);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work_stack = mem[0];
+    tempvect = mem[1];
+
+    // execution
+    return rocsolver_bdsdc_template<S, S>(handle, uplo, svect, n, D, strideD, E, strideE, U,
+                                          shiftU, ldu, strideU, V, shiftV, ldv, strideV, info,
+                                          batch_count, work_stack, (S*)tempvect);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sbdsdc(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_svect svect,
+                                const rocblas_int n,
+                                float* D,
+                                float* E,
+                                float* U,
+                                const rocblas_int ldu,
+                                float* V,
+                                const rocblas_int ldv,
+                                rocblas_int* info)
+{
+    return rocsolver_bdsdc_impl<float>(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+
+rocblas_status rocsolver_dbdsdc(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_svect svect,
+                                const rocblas_int n,
+                                double* D,
+                                double* E,
+                                double* U,
+                                const rocblas_int ldu,
+                                double* V,
+                                const rocblas_int ldv,
+                                rocblas_int* info)
+{
+    return rocsolver_bdsdc_impl<double>(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+
+} // extern C
@@ -0,0 +1,1160 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_bdsqr.hpp"
+#include "rocauxiliary_stedc.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+  BDSDC implements the divide and conquer method for the SVD of an upper bidiagonal
+  matrix B (as LAPACK's LASD0/LASD1). B is split into sub-blocks of size at most
+  BDSDC_MIN_DC_SIZE by removing the last row of every sub-block but the last one,
+  so that those sub-blocks have one more column than rows. The sub-blocks are solved
+  with the QR iteration of bdsqr (one group per sub-block) and then merged back
+  pairwise, following a balanced binary tree. Every merge restores the removed row,
+  which reduces the problem to a matrix of the form [z; 0 diag(d)] whose singular values
+  are the roots of the secular equation 1 + sum_j z_j^2 / (d_j^2 - sigma^2) = 0
+  (one thread per singular value); the singular vectors of all the merges of a level
+  are updated at once with strided-batched gemm calls.
+  A lower bidiagonal matrix is solved as the transpose of an upper bidiagonal one.
+
+  Workspace layout (n-by-n matrices with leading dimension n): U and V hold the
+  left and right singular vectors of the sub-blocks, sorted by increasing singular
+  value. The null vector of a sub-block with an extra column is kept in the last
+  column of its diagonal block of V. WU and WV hold the singular vectors of the
+  modified problems of the current level in consecutive maxm-by-maxm blocks (maxm
+  is the size of the largest merge), padded with zeros.
+***************************************************************************/
+
+/** BDSDC_SECULAR computes the i-th root sigma of the secular equation
+    1 + sum_j z_j^2 / (d_j^2 - sigma^2) = 0, where d is a vector of size k sorted in
+    increasing order. The root is returned as sigma^2 = d[org]^2 + tau, with d[org]
+    the closest pole, so that all the differences d_j^2 - sigma^2 can be computed
+    accurately as (d_j - d[org]) * (d_j + d[org]) - tau. The iterations are those of
+    stedc_secular applied to the squared poles. **/
+template <typename S>
+__device__ void bdsdc_secular(const rocblas_int k,
+                              const rocblas_int i,
+                              const S* d,
+                              const S* z,
+                              const S eps,
+                              rocblas_int& org,
+                              S& tau)
+{
+    if(k == 1)
+    {
+        org = 0;
+        tau = z[0] * z[0];
+        return;
+    }
+
+    // determine the poles of the model, the origin and the initial bracket
+    rocblas_int ilo, ihi;
+    S tlo, thi;
+    if(i < k - 1)
+    {
+        ilo = i;
+        ihi = i + 1;
+        S mid = (d[i + 1] - d[i]) * (d[i + 1] + d[i]) / 2;
+        S w = 1;
+        for(rocblas_int j = 0; j < k; j++)
+            w += z[j] * z[j] / ((d[j] - d[i]) * (d[j] + d[i]) - mid);
+
+        if(w >= 0)
+        {
+            org = i;
+            tlo = 0;
+            thi = mid;
+        }
+        else
+        {
+            org = i + 1;
+            tlo = -mid;
+            thi = 0;
+        }
+    }
+    else
+    {
+        ilo = k - 2;
+        ihi = k - 1;
+        org = k - 1;
+        S zz = 0;
+        for(rocblas_int j = 0; j < k; j++)
+            zz += z[j] * z[j];
+        tlo = 0;
+        thi = zz;
+    }
+    tau = (tlo + thi) / 2;
+
+    for(rocblas_int iter = 0; iter < STEDC_MAX_SECULAR_ITERS; iter++)
+    {
+        // evaluate the secular function and its derivative
+        S psi = 0, phi = 0, dpsi = 0, dphi = 0;
+        for(rocblas_int j = 0; j < k; j++)
+        {
+            S t = z[j] / ((d[j] - d[org]) * (d[j] + d[org]) - tau);
+            if(j <= ilo)
+            {
+                psi += z[j] * t;
+                dpsi += t * t;
+            }
+            else
+            {
+                phi += z[j] * t;
+                dphi += t * t;
+            }
+        }
+        S w = 1 + psi + phi;
+
+        // check convergence
+        if(abs(w) <= eps * (8 * (abs(psi) + abs(phi)) + 2))
+            break;
+
+        // update bracket (the secular function is increasing)
+        if(w < 0)
+            tlo = tau;
+        else
+            thi = tau;
+
+        // solve the model a + b / (dlo - eta) + c / (dhi - eta) = 0
+        S dlo = (d[ilo] - d[org]) * (d[ilo] + d[org]) - tau;
+        S dhi = (d[ihi] - d[org]) * (d[ihi] + d[org]) - tau;
+        S a = 1 + psi - dpsi * dlo + phi - dphi * dhi;
+        S qb = a * (dlo + dhi) + dpsi * dlo * dlo + dphi * dhi * dhi;
+        S qc = dlo * dhi * w;
+        S disc = sqrt(max(qb * qb - 4 * a * qc, S(0)));
+        S den = (qb >= 0 ? qb + disc : qb - disc);
+
+        // take the root of the model closest to the current iterate if it is in the bracket;
+        // otherwise bisect
+        S tnew = (tlo + thi) / 2;
+        if(den != 0 && tau + 2 * qc / den > tlo && tau + 2 * qc / den < thi)
+            tnew = tau + 2 * qc / den;
+        else if(a != 0 && tau + den / (2 * a) > tlo && tau + den / (2 * a) < thi)
+            tnew = tau + den / (2 * a);
+
+        if(tnew == tau)
+            break;
+        tau = tnew;
+    }
+}
+
+/** BDSDC_LEAVES_KERNEL solves each of the nleaves sub-blocks with the QR iteration of
+    bdsqr. The extra column of a sub-block that has one is first rotated out from the
+    right (as in LAPACK's LASDQ), which leaves a square upper bidiagonal matrix and moves
+    the null vector to the last column of the diagonal block of V. The singular values
+    are stored in increasing order, and the singular vectors in the corresponding
+    diagonal blocks of U and V (which must be initialized to the identity). Thread 0
+    chases the bulges and records the rotations of up to BDSQR_MAX_DEFERRED_SWEEPS QR
+    steps at a time in work; all the threads then apply them to the rows of U and V.
+    Call this kernel with one group per sub-block and batch instance. **/
+template <typename S>
+__global__ void __launch_bounds__(BDSQR_MAX_THDS) bdsdc_leaves_kernel(const rocblas_int n,
+                                                                     const rocblas_int nleaves,
+                                                                     S* DD,
+                                                                     const rocblas_stride strideD,
+                                                                     S* EE,
+                                                                     const rocblas_stride strideE,
+                                                                     S* UU,
+                                                                     S* VV,
+                                                                     const rocblas_stride strideQ,
+                                                                     rocblas_int* info,
+                                                                     S* WW,
+                                                                     const rocblas_stride strideW,
+                                                                     const S eps,
+                                                                     const S sfm,
+                                                                     const S tol)
+{
+    rocblas_int lid = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthds = hipBlockDim_x;
+
+    // the sub-block has nc columns, and one row less if it is not the last one
+    rocblas_int start = stedc_split(lid, n, nleaves);
+    rocblas_int nc = stedc_split(lid + 1, n, nleaves) - start;
+    rocblas_int nr = (lid < nleaves - 1 ? nc - 1 : nc);
+
+    rocblas_stride shiftQ = (bid * strideQ) + start + start * n;
+    S* D = DD + (bid * strideD) + start;
+    S* E = EE + (bid * strideE) + start;
+    S* U = UU + shiftQ;
+    S* V = VV + shiftQ;
+
+    // buffer for the rotations of the sub-block (BDSQR_MAX_DEFERRED_SWEEPS slots of
+    // size 4*nc)
+    rocblas_stride strideR = 4 * nc;
+    S* work = WW + (bid * strideW) + 4 * start * BDSQR_MAX_DEFERRED_SWEEPS;
+
+    __shared__ rocblas_int steps[3 * BDSQR_MAX_DEFERRED_SWEEPS];
+    __shared__ rocblas_int nsteps;
+    __shared__ bool done;
+    __shared__ rocblas_int piv;
+
+    // rotate the extra column out of the sub-block
+    if(nr < nc)
+    {
+        if(tid == 0)
+        {
+            S f, g = E[nr - 1];
+            for(rocblas_int j = nr - 1; j >= 0; j--)
+            {
+                f = D[j];
+                lartg(f, g, work[j], work[j + nr], D[j]);
+                if(j > 0)
+                {
+                    g = work[j + nr] * E[j - 1];
+                    E[j - 1] = work[j] * E[j - 1];
+                }
+            }
+        }
+        __syncthreads();
+
+        for(rocblas_int i = tid; i < nc; i += nthds)
+        {
+            for(rocblas_int j = nr - 1; j >= 0; j--)
+            {
+                S a = V[i + j * n];
+                S b = V[i + nr * n];
+                V[i + j * n] = work[j] * a - work[j + nr] * b;
+                V[i + nr * n] = work[j + nr] * a + work[j] * b;
+            }
+        }
+        __syncthreads();
+    }
+
+    // QR iteration on the square nr-by-nr upper bidiagonal matrix
+    rocblas_int k = nr - 1;
+    rocblas_int iter = 0;
+    rocblas_int maxiter = 6 * nr * nr;
+    S minshift = max(eps, tol / S(100)) / (nr * tol);
+    S thresh;
+
+    if(tid == 0)
+    {
+        int t2b = (D[0] >= D[nr - 1]) ? 1 : 0;
+        S smin = estimate<S>(nr, D, E, t2b, tol, 0);
+        thresh = max(tol * smin / sqrt(S(nr)), S(maxiter) * sfm);
+    }
+
+    bool finished = false;
+    while(!finished)
+    {
+        if(tid == 0)
+        {
+            nsteps = 0;
+            done = bdsqr_defer_steps<S>(nr, 1, 1, 0, D, E, work, strideR, steps, nsteps, k,
+                                        iter, maxiter, eps, tol, minshift, thresh);
+        }
+        __syncthreads();
+        finished = done;
+
+        // the rotations of V^T from the left are applied to the rows of V from the right
+        for(rocblas_int q = 0; q < nsteps; ++q)
+        {
+            rocblas_int i = steps[3 * q];
+            rocblas_int nn = steps[3 * q + 1];
+            rocblas_direct direc = rocblas_direct(steps[3 * q + 2]);
+            S* rots = work + q * strideR;
+            S* rotsU = rots + 2 * (nn - 1);
+
+            for(rocblas_int j = tid; j < nc; j += nthds)
+                lasr(rocblas_side_right, direc, 1, nn, rots, rots + nn - 1, V + j + i * n, n);
+            for(rocblas_int j = tid; j < nr; j += nthds)
+                lasr(rocblas_side_right, direc, 1, nn, rotsU, rotsU + nn - 1, U + j + i * n, n);
+        }
+        __syncthreads();
+    }
+
+    // if not converged, info is increased by the number of off-diagonal elements
+    // that did not converge to zero
+    if(tid == 0 && k != 0)
+    {
+        rocblas_int nconv = 0;
+        for(rocblas_int i = 0; i < nr - 1; ++i)
+            if(E[i] != 0)
+                nconv++;
+        atomicAdd(info + bid, nconv);
+    }
+
+    // make the singular values positive, and sort them in increasing order
+    // (as required by the merges)
+    for(rocblas_int i = tid; i < nc; i += nthds)
+    {
+        for(rocblas_int j = 0; j < nr; ++j)
+        {
+            if(D[j] < 0)
+                V[i + j * n] = -V[i + j * n];
+        }
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        for(rocblas_int j = 0; j < nr; ++j)
+            D[j] = abs(D[j]);
+    }
+
+    for(rocblas_int jj = 0; jj < nr - 1; ++jj)
+    {
+        // detect minimum
+        if(tid == 0)
+        {
+            rocblas_int idx = jj;
+            S smin = D[jj];
+            for(rocblas_int j = jj + 1; j < nr; ++j)
+            {
+                if(D[j] < smin)
+                {
+                    idx = j;
+                    smin = D[j];
+                }
+            }
+            if(idx != jj)
+            {
+                D[idx] = D[jj];
+                D[jj] = smin;
+            }
+            piv = idx;
+        }
+        __syncthreads();
+
+        // swap
+        rocblas_int idx = piv;
+        if(idx != jj)
+        {
+            S temp;
+            for(rocblas_int i = tid; i < nc; i += nthds)
+            {
+                temp = V[i + idx * n];
+                V[i + idx * n] = V[i + jj * n];
+                V[i + jj * n] = temp;
+            }
+            for(rocblas_int i = tid; i < nr; i += nthds)
+            {
+                temp = U[i + idx * n];
+                U[i + idx * n] = U[i + jj * n];
+                U[i + jj * n] = temp;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/** BDSDC_COPY_BLOCKS copies the diagonal blocks of the n-by-n matrix A that belong to
+    the merges of the current level to (pack = true) or from (pack = false) consecutive
+    ldp-by-ldp matrices of P, padded with zeros. The blocks include the last column (and
+    row) of the merged sub-blocks only if full is true. Call this kernel with a grid of
+    size blocks x (blocks * number of merges) x batch_count, with blocks = ldp/32. **/
+template <typename S>
+__global__ void bdsdc_copy_blocks(const rocblas_int n,
+                                  const rocblas_int nleaves,
+                                  const rocblas_int level,
+                                  const bool full,
+                                  S* AA,
+                                  const rocblas_stride strideQ,
+                                  S* PP,
+                                  const rocblas_int ldp,
+                                  const bool pack)
+{
+    rocblas_int blocks = hipGridDim_x;
+    rocblas_int mid = hipBlockIdx_y / blocks;
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = (hipBlockIdx_y % blocks) * hipBlockDim_y + hipThreadIdx_y;
+
+    rocblas_int nmerges = nleaves >> level;
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int mc = stedc_split((mid + 1) << level, n, nleaves) - off;
+    rocblas_int mb = (full || off + mc == n ? mc : mc - 1);
+
+    if(i < ldp && j < ldp)
+    {
+        S* A = AA + (bid * strideQ) + off + off * n;
+        S* P = PP + (bid * nmerges + mid) * ldp * ldp;
+
+        if(pack)
+            P[i + j * ldp] = (i < mb && j < mb ? A[i + j * n] : 0);
+        else if(i < mb && j < mb)
+            A[i + j * n] = P[i + j * ldp];
+    }
+}
+
+/** BDSDC_MERGE_PREPARE_KERNEL sets up the secular equation that merges the two halves of
+    every sub-block of the current level. It restores the removed row to form the vector
+    z, combines the null vectors of both halves, sorts the singular values of both halves,
+    deflates, and applies the deflation rotations to the singular vectors in U and V. It
+    also initializes the ldw-by-ldw blocks of WU and WV that will receive the singular
+    vectors of the modified problems. Call this kernel with BLOCKSIZE threads and one
+    group per merge and batch instance. **/
+template <typename S>
+__global__ void bdsdc_merge_prepare_kernel(const rocblas_int n,
+                                           const rocblas_int nleaves,
+                                           const rocblas_int level,
+                                           S* DD,
+                                           const rocblas_stride strideD,
+                                           S* EE,
+                                           const rocblas_stride strideE,
+                                           S* UU,
+                                           S* VV,
+                                           const rocblas_stride strideQ,
+                                           S* WUU,
+                                           S* WVV,
+                                           const rocblas_int ldw,
+                                           S* WW,
+                                           const rocblas_stride strideW,
+                                           rocblas_int* IW,
+                                           const rocblas_stride strideIW,
+                                           const S eps)
+{
+    rocblas_int mid = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // indices of the sub-block and its split point; the sub-block has mc columns and m
+    // rows, and its first half has m1 singular values (the row removed between both
+    // halves is k - 1)
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int k = stedc_split((mid << level) + (1 << (level - 1)), n, nleaves);
+    rocblas_int mc = stedc_split((mid + 1) << level, n, nleaves) - off;
+    rocblas_int m = (off + mc < n ? mc - 1 : mc);
+    rocblas_int m1 = k - 1 - off;
+    rocblas_int m2 = m - 1 - m1;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    S* U = UU + (bid * strideQ);
+    S* V = VV + (bid * strideQ);
+    S* WU = WUU + ((bid * (nleaves >> level) + mid) * ldw * ldw);
+    S* WV = WVV + ((bid * (nleaves >> level) + mid) * ldw * ldw);
+
+    // workspace arrays
+    S* work = WW + (bid * strideW);
+    S* ds = work + off;
+    S* zs = work + n + off;
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* ev = work + 5 * n + off;
+    S* rc = work + 6 * n + off;
+    S* rs = work + 7 * n + off;
+    S* scl = work + 8 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* perm = iwork + off;
+    rocblas_int* col = iwork + n + off;
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* rp = iwork + 3 * n + off;
+    rocblas_int* rq = iwork + 4 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    rocblas_int r = k - 1;
+    S alpha = D[r];
+    S beta = E[r];
+
+    // scale the sub-block by its largest entry (as LAPACK's LASD1), so that the squares
+    // in the secular equation do not underflow when the sub-block is much smaller than B
+    rocblas_int idx = 0;
+    S orgnrm = max(abs(alpha), abs(beta));
+    for(rocblas_int j = tid; j < m - 1; j += BLOCKSIZE)
+        orgnrm = max(orgnrm, abs(D[j < m1 ? off + j : k + j - m1]));
+    orgnrm = block_reduce_max(orgnrm, idx, sval, sidx);
+    if(orgnrm == 0)
+        orgnrm = 1;
+    alpha = alpha / orgnrm;
+    beta = beta / orgnrm;
+    if(tid == 0)
+        scl[0] = orgnrm;
+
+    // the entry of z of the null vector of the first half (column r of V); if the second
+    // half also has a null vector (last column of the sub-block), both are combined into
+    // column r, and the last column becomes the null vector of the merged sub-block
+    rocblas_int nul = off + mc - 1;
+    S z1 = alpha * V[r + r * n];
+    S z2 = (m < mc ? beta * V[k + nul * n] : 0);
+    S z0 = (m < mc ? sqrt(z1 * z1 + z2 * z2) : z1);
+    __syncthreads();
+
+    if(m < mc && z0 != 0)
+    {
+        S c = z1 / z0;
+        S s = z2 / z0;
+        for(rocblas_int i = off + tid; i < off + mc; i += BLOCKSIZE)
+        {
+            S a = V[i + r * n];
+            S b = V[i + nul * n];
+            V[i + r * n] = c * a + s * b;
+            V[i + nul * n] = c * b - s * a;
+        }
+    }
+
+    // form z and sort the singular values of both halves into a single list,
+    // after the pole at zero of column r
+    S dmax = 0, zmax = abs(z0);
+    for(rocblas_int j = tid; j < m - 1; j += BLOCKSIZE)
+    {
+        rocblas_int lo, hi, pos, c;
+        S dj, zj;
+
+        if(j < m1)
+        {
+            c = off + j;
+            dj = D[c];
+            zj = alpha * V[r + c * n];
+
+            // count the entries of the second half strictly smaller than dj
+            lo = 0;
+            hi = m2;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(D[k + pos] < dj)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = j + lo;
+        }
+        else
+        {
+            c = k + j - m1;
+            dj = D[c];
+            zj = beta * V[k + c * n];
+
+            // count the entries of the first half smaller than or equal to dj
+            lo = 0;
+            hi = m1;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(D[off + pos] <= dj)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = j - m1 + lo;
+        }
+
+        dj = dj / orgnrm;
+        ds[pos + 1] = dj;
+        zs[pos + 1] = zj;
+        perm[pos + 1] = c;
+        dmax = max(dmax, abs(dj));
+        zmax = max(zmax, abs(zj));
+    }
+    dmax = block_reduce_max(dmax, idx, sval, sidx);
+    zmax = block_reduce_max(zmax, idx, sval, sidx);
+    S tol = 8 * eps * max(dmax, zmax);
+
+    // deflation (executed by a single thread)
+    if(tid == 0)
+    {
+        rocblas_int kk = 1, nd = 0, nrot = 0, pj = -1;
+        S c, s, t;
+
+        // the pole at zero is never deflated
+        dl[0] = 0;
+        zl[0] = (abs(z0) <= tol ? tol : z0);
+        col[0] = r;
+
+        for(rocblas_int j = 1; j < m; j++)
+        {
+            if(abs(zs[j]) <= tol)
+            {
+                // z_j is negligible; keep the list of deflated singular values sorted
+                t = ds[j];
+                rocblas_int q = nd++;
+                while(q > 0 && ev[q - 1] > t)
+                {
+                    ev[q] = ev[q - 1];
+                    org[q] = org[q - 1];
+                    q--;
+                }
+                ev[q] = t;
+                org[q] = perm[j];
+                continue;
+            }
+
+            if(pj >= 0)
+            {
+                s = zs[pj];
+                c = zs[j];
+                t = sqrt(c * c + s * s);
+                c = c / t;
+                s = -s / t;
+
+                if(abs((ds[j] - ds[pj]) * c * s) <= tol)
+                {
+                    // close singular values; rotate to deflate the first one
+                    zs[j] = t;
+                    zs[pj] = 0;
+                    rp[nrot] = perm[pj];
+                    rq[nrot] = perm[j];
+                    rc[nrot] = c;
+                    rs[nrot] = s;
+                    nrot++;
+
+                    t = ds[pj] * c * c + ds[j] * s * s;
+                    ds[j] = ds[pj] * s * s + ds[j] * c * c;
+                    ds[pj] = t;
+
+                    rocblas_int q = nd++;
+                    while(q > 0 && ev[q - 1] > t)
+                    {
+                        ev[q] = ev[q - 1];
+                        org[q] = org[q - 1];
+                        q--;
+                    }
+                    ev[q] = t;
+                    org[q] = perm[pj];
+                }
+                else
+                {
+                    dl[kk] = ds[pj];
+                    zl[kk] = zs[pj];
+                    col[kk] = perm[pj];
+                    kk++;
+                }
+            }
+            pj = j;
+        }
+        if(pj >= 0)
+        {
+            dl[kk] = ds[pj];
+            zl[kk] = zs[pj];
+            col[kk] = perm[pj];
+            kk++;
+        }
+
+        // keep the smallest non-zero pole away from zero
+        if(kk > 1 && dl[1] <= tol / 2)
+            dl[1] = tol / 2;
+
+        // move the deflated singular values to the end of the list
+        for(rocblas_int q = nd - 1; q >= 0; q--)
+        {
+            ev[kk + q] = ev[q];
+            col[kk + q] = org[q];
+        }
+
+        cnt[0] = kk;
+        cnt[1] = nrot;
+    }
+    __syncthreads();
+
+    // apply deflation rotations to the columns of U and V
+    rocblas_int nrot = cnt[1];
+    for(rocblas_int i = off + tid; i < off + mc; i += BLOCKSIZE)
+    {
+        for(rocblas_int p = 0; p < nrot; p++)
+        {
+            S a = V[i + rp[p] * n];
+            S b = V[i + rq[p] * n];
+            V[i + rp[p] * n] = rc[p] * a + rs[p] * b;
+            V[i + rq[p] * n] = rc[p] * b - rs[p] * a;
+
+            if(i < off + m)
+            {
+                a = U[i + rp[p] * n];
+                b = U[i + rq[p] * n];
+                U[i + rp[p] * n] = rc[p] * a + rs[p] * b;
+                U[i + rq[p] * n] = rc[p] * b - rs[p] * a;
+            }
+        }
+    }
+
+    // initialize the blocks of WU and WV, padded with zeros (the null vector of the
+    // merged sub-block, if any, stays in its last column)
+    for(rocblas_int j = 0; j < ldw; j++)
+    {
+        for(rocblas_int i = tid; i < ldw; i += BLOCKSIZE)
+        {
+            WV[i + j * ldw] = (m < mc && i == mc - 1 && j == mc - 1 ? 1 : 0);
+            WU[i + j * ldw] = 0;
+        }
+    }
+}
+
+/** BDSDC_MERGE_SECULAR_KERNEL solves the secular equation of every merge of the
+    current level. Each thread computes one root. Call this kernel with BLOCKSIZE
+    threads and a grid of size maxm/BLOCKSIZE x number of merges x batch_count. **/
+template <typename S>
+__global__ void bdsdc_merge_secular_kernel(const rocblas_int n,
+                                           const rocblas_int nleaves,
+                                           const rocblas_int level,
+                                           S* WW,
+                                           const rocblas_stride strideW,
+                                           rocblas_int* IW,
+                                           const rocblas_stride strideIW,
+                                           const S eps)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int mid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+
+    S* work = WW + (bid * strideW);
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* tau = work + 4 * n + off;
+    S* ev = work + 5 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    rocblas_int kk = cnt[0];
+
+    if(i < kk)
+    {
+        rocblas_int o;
+        S t;
+        bdsdc_secular(kk, i, dl, zl, eps, o, t);
+        org[i] = o;
+        tau[i] = t;
+        ev[i] = sqrt(dl[o] * dl[o] + t);
+    }
+}
+
+/** BDSDC_MERGE_ZHAT_KERNEL recomputes the vector z from the computed roots so that
+    the singular vectors of the modified problems are numerically orthogonal (Gu and
+    Eisenstat). Call this kernel as bdsdc_merge_secular_kernel. **/
+template <typename S>
+__global__ void bdsdc_merge_zhat_kernel(const rocblas_int n,
+                                        const rocblas_int nleaves,
+                                        const rocblas_int level,
+                                        S* WW,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* IW,
+                                        const rocblas_stride strideIW)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int mid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+
+    S* work = WW + (bid * strideW);
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* tau = work + 4 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    rocblas_int kk = cnt[0];
+
+    if(j < kk)
+    {
+        // zhat_j^2 = prod_i (sigma_i^2 - d_j^2) / prod_{i != j} (d_i^2 - d_j^2)
+        S dj = dl[j];
+        S p = tau[kk - 1] + (dl[org[kk - 1]] - dj) * (dl[org[kk - 1]] + dj);
+        for(rocblas_int i = 0; i < j; i++)
+            p *= (tau[i] + (dl[org[i]] - dj) * (dl[org[i]] + dj)) / ((dl[i] - dj) * (dl[i] + dj));
+        for(rocblas_int i = j; i < kk - 1; i++)
+            p *= (tau[i] + (dl[org[i]] - dj) * (dl[org[i]] + dj))
+                / ((dl[i + 1] - dj) * (dl[i + 1] + dj));
+
+        p = sqrt(abs(p));
+        zl[j] = (zl[j] < 0 ? -p : p);
+    }
+}
+
+/** BDSDC_MERGE_VECTORS_KERNEL writes the new singular values of every merge of the
+    current level in increasing order, and the left and right singular vectors of the
+    modified problems in the corresponding (permuted) columns of the ldw-by-ldw blocks
+    of WU and WV. Call this kernel with BLOCKSIZE threads and a grid of size
+    maxm/BLOCKSIZE x number of merges x batch_count. **/
+template <typename S>
+__global__ void bdsdc_merge_vectors_kernel(const rocblas_int n,
+                                           const rocblas_int nleaves,
+                                           const rocblas_int level,
+                                           S* DD,
+                                           const rocblas_stride strideD,
+                                           S* WUU,
+                                           S* WVV,
+                                           const rocblas_int ldw,
+                                           S* WW,
+                                           const rocblas_stride strideW,
+                                           rocblas_int* IW,
+                                           const rocblas_stride strideIW)
+{
+    rocblas_int s = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int mid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int mc = stedc_split((mid + 1) << level, n, nleaves) - off;
+    rocblas_int m = (off + mc < n ? mc - 1 : mc);
+
+    S* D = DD + (bid * strideD) + off;
+    S* WU = WUU + ((bid * (nleaves >> level) + mid) * ldw * ldw);
+    S* WV = WVV + ((bid * (nleaves >> level) + mid) * ldw * ldw);
+    S* work = WW + (bid * strideW);
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* tau = work + 4 * n + off;
+    S* ev = work + 5 * n + off;
+    S* scl = work + 8 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* col = iwork + n + off;
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    rocblas_int kk = cnt[0];
+
+    if(s < m)
+    {
+        // the roots [0, kk) and the deflated singular values [kk, m) are sorted;
+        // find the final position of ev[s] by merging both lists
+        S e = ev[s];
+        rocblas_int lo, hi, pos;
+        if(s < kk)
+        {
+            lo = kk;
+            hi = m;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(ev[pos] < e)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = s + lo - kk;
+        }
+        else
+        {
+            lo = 0;
+            hi = kk;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(ev[pos] <= e)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = s - kk + lo;
+        }
+        D[pos] = e * scl[0];
+
+        if(s >= kk)
+        {
+            // deflated singular value; the singular vectors are columns of U and V
+            WU[col[s] - off + pos * ldw] = 1;
+            WV[col[s] - off + pos * ldw] = 1;
+        }
+        else
+        {
+            // singular vectors of the modified problem: v_j = zhat_j / (d_j^2 - sigma^2),
+            // u_0 = -1 and u_j = d_j * v_j (normalized with scaling to avoid overflow)
+            S t, dor = dl[org[s]];
+            S vmax = 0, umax = 1, vv = 0, uu = 0;
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                t = zl[j] / ((dl[j] - dor) * (dl[j] + dor) - tau[s]);
+                WV[col[j] - off + pos * ldw] = t;
+                vmax = max(vmax, abs(t));
+                if(j > 0)
+                    umax = max(umax, abs(dl[j] * t));
+            }
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                t = WV[col[j] - off + pos * ldw];
+                vv += (t / vmax) * (t / vmax);
+                t = (j == 0 ? S(-1) : dl[j] * t);
+                uu += (t / umax) * (t / umax);
+            }
+            vv = vmax * sqrt(vv);
+            uu = umax * sqrt(uu);
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                t = WV[col[j] - off + pos * ldw];
+                WV[col[j] - off + pos * ldw] = t / vv;
+                WU[col[j] - off + pos * ldw] = (j == 0 ? S(-1) : dl[j] * t) / uu;
+            }
+        }
+    }
+}
+
+/** BDSDC_UNSCALE_KERNEL restores the scaling of the singular values and sorts them in
+    decreasing order. Call this kernel with one thread per pair of singular values. **/
+template <typename S>
+__global__ void bdsdc_unscale_kernel(const rocblas_int n,
+                                     S* DD,
+                                     const rocblas_stride strideD,
+                                     S* scal)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < (n + 1) / 2)
+    {
+        S* D = DD + (bid * strideD);
+        S sc = (scal[bid] != 0 ? scal[bid] : S(1));
+        S a = D[i];
+        S b = D[n - 1 - i];
+        D[i] = b * sc;
+        D[n - 1 - i] = a * sc;
+    }
+}
+
+/** BDSDC_COPY_VECT writes the left singular vectors of B in the columns of U and
+    the right singular vectors in the rows of V, in decreasing order of the singular
+    values **/
+template <typename T, typename S, typename W>
+__global__ void bdsdc_copy_vect(const rocblas_int n,
+                                const rocblas_fill uplo,
+                                S* UU,
+                                S* VV,
+                                const rocblas_stride strideQ,
+                                W UA,
+                                const rocblas_int shiftU,
+                                const rocblas_int ldu,
+                                const rocblas_stride strideU,
+                                W VA,
+                                const rocblas_int shiftV,
+                                const rocblas_int ldv,
+                                const rocblas_stride strideV)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < n)
+    {
+        // the singular vectors of a lower bidiagonal matrix are swapped
+        bool upper = (uplo == rocblas_fill_upper);
+        S* Ul = (upper ? UU : VV) + (bid * strideQ);
+        S* Vr = (upper ? VV : UU) + (bid * strideQ);
+        T* U = load_ptr_batch<T>(UA, bid, shiftU, strideU);
+        T* V = load_ptr_batch<T>(VA, bid, shiftV, strideV);
+
+        U[i + j * ldu] = T(Ul[i + (n - 1 - j) * n]);
+        V[j + i * ldv] = T(Vr[i + (n - 1 - j) * n]);
+    }
+}
+
+template <typename S>
+void rocsolver_bdsdc_getMemorySize(const rocblas_svect svect,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work_stack,
+                                   size_t* size_tempvect)
+{
+    // if quick return, or if only the singular values are required (bdsqr
+    // without vectors), no workspace is needed
+    if(n == 0 || batch_count == 0 || svect == rocblas_svect_none)
+    {
+        *size_work_stack = 0;
+        *size_tempvect = 0;
+        return;
+    }
+
+    // size of the vectors used by the merges (or of the rotations of the leaves), and of
+    // the scaling factors
+    size_t s1 = std::max(9, 4 * BDSQR_MAX_DEFERRED_SWEEPS) * n;
+    *size_work_stack = (sizeof(S) * (s1 + 1) + sizeof(rocblas_int) * 6 * n) * batch_count;
+
+    // size for the matrices of singular vectors (U and V), of the singular vectors of
+    // the modified problems (WU and WV), and for the packed blocks of U or V before and
+    // after their update (all the blocks of a level, padded, fit in n*n)
+    *size_tempvect = sizeof(S) * 6 * n * n * batch_count;
+}
+
+template <typename S, typename T>
+rocblas_status rocsolver_bdsdc_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_svect svect,
+                                        const rocblas_int n,
+                                        S D,
+                                        S E,
+                                        T U,
+                                        const rocblas_int ldu,
+                                        T V,
+                                        const rocblas_int ldv,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(svect != rocblas_svect_singular && svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || ldu < 1 || ldv < 1)
+        return rocblas_status_invalid_size;
+    if(svect == rocblas_svect_singular && (ldu < n || ldv < n))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n > 1 && !E) || (svect == rocblas_svect_singular && n && (!U || !V)) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename S, typename T, typename W>
+rocblas_status rocsolver_bdsdc_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_svect svect,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_stride strideE,
+                                        W U,
+                                        const rocblas_int shiftU,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        W V,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        void* work_stack,
+                                        S* tempvect)
+{
+    ROCSOLVER_ENTER("bdsdc", "uplo:", uplo, "svect:", svect, "n:", n, "shiftU:", shiftU,
+                    "ldu:", ldu, "shiftV:", shiftV, "ldv:", ldv, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // quick return
+    if(n == 0)
+    {
+        hipLaunchKernelGGL(reset_info, dim3(blocksReset), threads, 0, stream, info, batch_count,
+                           0);
+        return rocblas_status_success;
+    }
+
+    // singular values only are computed with bdsqr
+    if(svect == rocblas_svect_none)
+        return rocsolver_bdsqr_template<T>(handle, uplo, n, 0, 0, 0, D, strideD, E, strideE,
+                                           (T*)nullptr, 0, 1, 0, (T*)nullptr, 0, 1, 0, (T*)nullptr,
+                                           0, 1, 0, info, batch_count, (S*)nullptr);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, dim3(blocksReset), threads, 0, stream, info, batch_count, 0);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    S one = 1;
+    S zero = 0;
+    S eps = get_epsilon<S>();
+    S sfm = get_safemin<S>();
+    S tol = std::max(S(10.0), std::min(S(100.0), S(pow(eps / 2, -0.125)))) * eps / 2;
+
+    // number of leaves of the divide and conquer tree (a power of 2)
+    rocblas_int nleaves = 1;
+    while((n - 1) / nleaves + 1 > BDSDC_MIN_DC_SIZE)
+        nleaves *= 2;
+
+    // workspace arrays
+    rocblas_stride strideW = std::max(9, 4 * BDSQR_MAX_DEFERRED_SWEEPS) * n;
+    rocblas_stride strideIW = 6 * n;
+    rocblas_stride strideQ = n * n;
+    S* work = (S*)work_stack;
+    S* scal = work + strideW * batch_count;
+    rocblas_int* iwork = (rocblas_int*)(scal + batch_count);
+    S* Ub = tempvect;
+    S* Vb = tempvect + strideQ * batch_count;
+    S* WU = tempvect + 2 * strideQ * batch_count;
+    S* WV = tempvect + 3 * strideQ * batch_count;
+    S* PA = tempvect + 4 * strideQ * batch_count;
+    S* PC = tempvect + 5 * strideQ * batch_count;
+
+    rocblas_int blocks = (n - 1) / 32 + 1;
+    dim3 grid2D(blocks, blocks, batch_count);
+    dim3 threads2D(32, 32);
+
+    // scale the matrix (a single sub-block means no tears)
+    hipLaunchKernelGGL(stedc_scale_kernel<S>, dim3(1, batch_count), threads, 0, stream, n, 1, D,
+                       strideD, E, strideE, scal);
+
+    // solve the sub-blocks
+    hipLaunchKernelGGL(init_ident<S>, grid2D, threads2D, 0, stream, n, n, Ub, 0, n, strideQ);
+    hipLaunchKernelGGL(init_ident<S>, grid2D, threads2D, 0, stream, n, n, Vb, 0, n, strideQ);
+    hipLaunchKernelGGL(bdsdc_leaves_kernel<S>, dim3(nleaves, batch_count),
+                       dim3((n - 1) / nleaves + 1), 0, stream, n, nleaves, D, strideD, E, strideE,
+                       Ub, Vb, strideQ, info, work, strideW, eps / 2, sfm, tol);
+
+    // merge the sub-blocks, level by level
+    for(rocblas_int level = 1; (1 << level) <= nleaves; level++)
+    {
+        rocblas_int nmerges = nleaves >> level;
+        rocblas_int maxm = (n - 1) / nmerges + 1;
+        rocblas_int blocksP = (maxm - 1) / 32 + 1;
+        dim3 gridK((maxm - 1) / BLOCKSIZE + 1, nmerges, batch_count);
+        dim3 gridP(blocksP, blocksP * nmerges, batch_count);
+
+        hipLaunchKernelGGL(bdsdc_merge_prepare_kernel<S>, dim3(nmerges, batch_count), threads, 0,
+                           stream, n, nleaves, level, D, strideD, E, strideE, Ub, Vb, strideQ, WU,
+                           WV, maxm, work, strideW, iwork, strideIW, eps);
+        hipLaunchKernelGGL(bdsdc_merge_secular_kernel<S>, gridK, threads, 0, stream, n, nleaves,
+                           level, work, strideW, iwork, strideIW, eps);
+        hipLaunchKernelGGL(bdsdc_merge_zhat_kernel<S>, gridK, threads, 0, stream, n, nleaves,
+                           level, work, strideW, iwork, strideIW);
+        hipLaunchKernelGGL(bdsdc_merge_vectors_kernel<S>, gridK, threads, 0, stream, n, nleaves,
+                           level, D, strideD, WU, WV, maxm, work, strideW, iwork, strideIW);
+
+        // update the singular vectors: Unew = U * WU and Vnew = V * WV on the diagonal
+        // blocks of all the merges at once; the blocks are packed in maxm-by-maxm
+        // matrices padded with zeros (the rows removed by the upper levels keep the identity)
+        hipLaunchKernelGGL(bdsdc_copy_blocks<S>, gridP, threads2D, 0, stream, n, nleaves, level,
+                           false, Ub, strideQ, PA, maxm, true);
+        rocblasCall_gemm<false, true, S>(handle, rocblas_operation_none, rocblas_operation_none,
+                                         maxm, maxm, maxm, &one, PA, 0, maxm, maxm * maxm, WU, 0,
+                                         maxm, maxm * maxm, &zero, PC, 0, maxm, maxm * maxm,
+                                         nmerges * batch_count, (S**)nullptr);
+        hipLaunchKernelGGL(bdsdc_copy_blocks<S>, gridP, threads2D, 0, stream, n, nleaves, level,
+                           false, Ub, strideQ, PC, maxm, false);
+
+        hipLaunchKernelGGL(bdsdc_copy_blocks<S>, gridP, threads2D, 0, stream, n, nleaves, level,
+                           true, Vb, strideQ, PA, maxm, true);
+        rocblasCall_gemm<false, true, S>(handle, rocblas_operation_none, rocblas_operation_none,
+                                         maxm, maxm, maxm, &one, PA, 0, maxm, maxm * maxm, WV, 0,
+                                         maxm, maxm * maxm, &zero, PC, 0, maxm, maxm * maxm,
+                                         nmerges * batch_count, (S**)nullptr);
+        hipLaunchKernelGGL(bdsdc_copy_blocks<S>, gridP, threads2D, 0, stream, n, nleaves, level,
+                           true, Vb, strideQ, PC, maxm, false);
+    }
+
+    // restore scaling, and copy the singular values and vectors in decreasing order
+    hipLaunchKernelGGL(bdsdc_unscale_kernel<S>, dim3((n - 1) / BLOCKSIZE + 1, batch_count),
+                       threads, 0, stream, n, D, strideD, scal);
+    hipLaunchKernelGGL((bdsdc_copy_vect<T>), grid2D, threads2D, 0, stream, n, uplo, Ub, Vb,
+                       strideQ, U, shiftU, ldu, strideU, V, shiftV, ldv, strideV);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
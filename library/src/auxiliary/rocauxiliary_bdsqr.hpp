@@ -14,14 +14,12 @@
 #include "rocsolver.h"
 
 /****************************************************************************
-(TODO:THIS IS BASIC IMPLEMENTATION. THE ONLY PARALLELISM INTRODUCED HERE IS
-  FOR THE BATCHED VERSIONS (A DIFFERENT THREAD WORKS ON EACH INSTANCE OF THE
-  BATCH). MORE PARALLELISM CAN BE INTRODUCED IN THE FUTURE IN AT LEAST TWO
-  WAYS:
+(TODO:THE QR STEPS ARE STILL COMPUTED BY A SINGLE THREAD PER INSTANCE OF THE
+  BATCH; ONLY THE UPDATE OF THE SINGULAR VECTORS IS PARALLELIZED. MORE
+  PARALLELISM CAN BE INTRODUCED IN THE FUTURE IN AT LEAST TWO WAYS:
   1. the split diagonal blocks can be worked in parallel as they are
   independent
   2. for each block, multiple threads can accelerate some of the reductions
-  and vector operations
 ***************************************************************************/
 
 /** ESTIMATE device function computes an estimate of the smallest
@@ -52,33 +50,17 @@ __device__ T estimate(const rocblas_int n, T* D, T* E, int t2b, T tol, int conve
     return smin;
 }
 
-/** NEGVECT device function multiply a vector x of dimension n by -1**/
-template <typename T>
-__device__ void negvect(const rocblas_int n, T* x, const rocblas_int incx)
-{
-    for(rocblas_int i = 0; i < n; ++i)
-    {
-        if(x[incx * i] != 0)
-            x[incx * i] = -x[incx * i];
-    }
-}
-
 /** T2BQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from top to bottom **/
-template <typename S, typename W>
+    from top to bottom. The rotations required to update the singular
+    vectors are saved in rots **/
+template <typename S>
 __device__ void t2bQRstep(const rocblas_int n,
                           const rocblas_int nv,
                           const rocblas_int nu,
                           const rocblas_int nc,
                           S* D,
                           S* E,
-                          W* V,
-                          const rocblas_int ldv,
-                          W* U,
-                          const rocblas_int ldu,
-                          W* C,
-                          const rocblas_int ldc,
                           const S sh,
                           S* rots)
 {
@@ -127,34 +109,19 @@ __device__ void t2bQRstep(const rocblas_int n,
         }
     }
     E[n - 2] = f;
-
-    // update singular vectors
-    if(nv)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nv, rots, rots + n - 1, V, ldv);
-    if(nu)
-        lasr(rocblas_side_right, rocblas_forward_direction, nu, n, rots + nr, rots + nr + n - 1, U,
-             ldu);
-    if(nc)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nc, rots + nr, rots + nr + n - 1, C,
-             ldc);
 }
 
 /** B2TQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from bottom to top **/
-template <typename S, typename W>
+    from bottom to top. The rotations required to update the singular
+    vectors are saved in rots **/
+template <typename S>
 __device__ void b2tQRstep(const rocblas_int n,
                           const rocblas_int nv,
                           const rocblas_int nu,
                           const rocblas_int nc,
                           S* D,
                           S* E,
-                          W* V,
-                          const rocblas_int ldv,
-                          W* U,
-                          const rocblas_int ldu,
-                          W* C,
-                          const rocblas_int ldc,
                           const S sh,
                           S* rots)
 {
@@ -203,82 +170,44 @@ __device__ void b2tQRstep(const rocblas_int n,
         }
     }
     E[0] = f;
-
-    // update singular vectors
-    if(nv)
-        lasr(rocblas_side_left, rocblas_backward_direction, n, nv, rots, rots + n - 1, V, ldv);
-    if(nu)
-        lasr(rocblas_side_right, rocblas_backward_direction, nu, n, rots + nr, rots + nr + n - 1, U,
-             ldu);
-    if(nc)
-        lasr(rocblas_side_left, rocblas_backward_direction, n, nc, rots + nr, rots + nr + n - 1, C,
-             ldc);
 }
 
-/** BDSQRKERNEL implements the main loop of the bdsqr algorithm
-    to compute the SVD of an upper bidiagonal matrix given by D and E **/
-template <typename T, typename S, typename W>
-__global__ void bdsqrKernel(const rocblas_int n,
-                            const rocblas_int nv,
-                            const rocblas_int nu,
-                            const rocblas_int nc,
-                            S* DD,
-                            const rocblas_stride strideD,
-                            S* EE,
-                            const rocblas_stride strideE,
-                            W VV,
-                            const rocblas_int shiftV,
-                            const rocblas_int ldv,
-                            const rocblas_stride strideV,
-                            W UU,
-                            const rocblas_int shiftU,
-                            const rocblas_int ldu,
-                            const rocblas_stride strideU,
-                            W CC,
-                            const rocblas_int shiftC,
-                            const rocblas_int ldc,
-                            const rocblas_stride strideC,
-                            rocblas_int* info,
-                            const rocblas_int maxiter,
-                            const S eps,
-                            const S sfm,
-                            const S tol,
-                            const S minshift,
-                            S* workA,
-                            const rocblas_stride strideW)
+/** BDSQR_DEFER_STEPS runs the main loop of the bdsqr algorithm on the upper
+    bidiagonal matrix given by D and E, starting from the last unconverged element k
+    after iter QR steps. Instead of being applied to the singular vectors, the
+    rotations of each QR step are saved in the next free slot of the buffer work (of
+    size strideW per slot), and the first index, size and direction of the diagonal
+    block are recorded in steps. It returns true when the iteration has finished, or
+    false when all the BDSQR_MAX_DEFERRED_SWEEPS slots are in use. It is executed by a
+    single thread. **/
+template <typename S>
+__device__ bool bdsqr_defer_steps(const rocblas_int n,
+                                  const rocblas_int nv,
+                                  const rocblas_int nu,
+                                  const rocblas_int nc,
+                                  S* D,
+                                  S* E,
+                                  S* work,
+                                  const rocblas_stride strideW,
+                                  rocblas_int* steps,
+                                  rocblas_int& nsteps,
+                                  rocblas_int& k,
+                                  rocblas_int& iter,
+                                  const rocblas_int maxiter,
+                                  const S eps,
+                                  const S tol,
+                                  const S minshift,
+                                  const S thresh)
 {
-    rocblas_int bid = hipBlockIdx_x;
-
-    // select batch instance to work with
-    // (avoiding arithmetics with possible nullptrs)
-    S* rots;
-    T *V, *U, *C;
-    S* D = DD + bid * strideD;
-    S* E = EE + bid * strideE;
-    if(VV)
-        V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
-    if(UU)
-        U = load_ptr_batch<T>(UU, bid, shiftU, strideU);
-    if(CC)
-        C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
-    if(workA)
-        rots = workA + bid * strideW;
-
-    // calculate threshold for zeroing elements (convergence threshold)
-    int t2b = (D[0] >= D[n - 1]) ? 1 : 0; // direction
-    S smin = estimate<S>(n, D, E, t2b, tol,
-                         0); // estimate of the smallest singular value
-    S thresh = std::max(tol * smin / S(std::sqrt(n)),
-                        S(maxiter) * sfm); // threshold
-
-    rocblas_int k = n - 1; // k is the last element of last unconverged diagonal block
-    rocblas_int iter = 0; // iter is the number of iterations (QR steps) applied
     rocblas_int i;
-    S sh, smax;
+    int t2b;
+    S sh, smin, smax;
 
-    // main loop
-    while(k > 0 && iter < maxiter)
+    while(nsteps < BDSQR_MAX_DEFERRED_SWEEPS)
     {
+        if(k <= 0 || iter >= maxiter)
+            return true;
+
         // split the diagonal blocks
         for(rocblas_int j = 0; j < k + 1; ++j)
         {
@@ -325,71 +254,230 @@ __global__ void bdsqrKernel(const rocblas_int n,
                         smin = 0; // shift set to zero if negligible
                 }
 
-                // apply QR step
+                // apply QR step and record its rotations
+                // (no rotations are recorded, and work is not referenced, if there
+                // are no vectors to update)
+                S* rots = (nv || nu || nc) ? work + nsteps * strideW : nullptr;
                 iter += k - i;
                 if(t2b)
-                    t2bQRstep(k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv, U + i * ldu, ldu,
-                              C + i, ldc, smin, rots);
+                    t2bQRstep(k - i + 1, nv, nu, nc, D + i, E + i, smin, rots);
                 else
-                    b2tQRstep(k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv, U + i * ldu, ldu,
-                              C + i, ldc, smin, rots);
+                    b2tQRstep(k - i + 1, nv, nu, nc, D + i, E + i, smin, rots);
+
+                steps[3 * nsteps] = i;
+                steps[3 * nsteps + 1] = k - i + 1;
+                steps[3 * nsteps + 2]
+                    = t2b ? rocblas_forward_direction : rocblas_backward_direction;
+                nsteps++;
             }
         }
     }
 
-    info[bid] = 0;
+    return false;
+}
+
+/** BDSQRKERNEL implements the main loop of the bdsqr algorithm
+    to compute the SVD of an upper bidiagonal matrix given by D and E.
+    Each matrix of the batch is processed by a different thread-block.
+    Thread 0 chases the bulges and records the rotations of up to
+    BDSQR_MAX_DEFERRED_SWEEPS QR steps at a time; the rotations are then
+    applied by all the threads of the block, each working on its own
+    columns of V and C and rows of U.
+    If only_failed is true, only the matrices with info != 0 on entry are processed. **/
+template <typename T, typename S, typename W>
+__global__ void __launch_bounds__(BDSQR_MAX_THDS) bdsqrKernel(const rocblas_int n,
+                                                             const rocblas_int nv,
+                                                             const rocblas_int nu,
+                                                             const rocblas_int nc,
+                                                             S* DD,
+                                                             const rocblas_stride strideD,
+                                                             S* EE,
+                                                             const rocblas_stride strideE,
+                                                             W VV,
+                                                             const rocblas_int shiftV,
+                                                             const rocblas_int ldv,
+                                                             const rocblas_stride strideV,
+                                                             W UU,
+                                                             const rocblas_int shiftU,
+                                                             const rocblas_int ldu,
+                                                             const rocblas_stride strideU,
+                                                             W CC,
+                                                             const rocblas_int shiftC,
+                                                             const rocblas_int ldc,
+                                                             const rocblas_stride strideC,
+                                                             rocblas_int* info,
+                                                             const rocblas_int maxiter,
+                                                             const S eps,
+                                                             const S sfm,
+                                                             const S tol,
+                                                             const S minshift,
+                                                             S* workA,
+                                                             const rocblas_stride strideW,
+                                                             const bool only_failed)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int nthds = hipBlockDim_x;
+
+    if(only_failed && info[bid] == 0)
+        return;
+
+    // select batch instance to work with
+    // (avoiding arithmetics with possible nullptrs)
+    S* work = nullptr;
+    T *V, *U, *C;
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    if(VV)
+        V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
+    if(UU)
+        U = load_ptr_batch<T>(UU, bid, shiftU, strideU);
+    if(CC)
+        C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    if(workA)
+        work = workA + bid * strideW * BDSQR_MAX_DEFERRED_SWEEPS;
+
+    __shared__ rocblas_int steps[3 * BDSQR_MAX_DEFERRED_SWEEPS];
+    __shared__ rocblas_int nsteps;
+    __shared__ bool done;
+
+    rocblas_int k = n - 1; // k is the last element of last unconverged diagonal block
+    rocblas_int iter = 0; // iter is the number of iterations (QR steps) applied
+    S thresh;
+
+    // calculate threshold for zeroing elements (convergence threshold)
+    if(tid == 0)
+    {
+        int t2b = (D[0] >= D[n - 1]) ? 1 : 0; // direction
+        S smin = estimate<S>(n, D, E, t2b, tol,
+                             0); // estimate of the smallest singular value
+        thresh = std::max(tol * smin / S(std::sqrt(n)),
+                          S(maxiter) * sfm); // threshold
+    }
+
+    // main loop
+    bool finished = false;
+    while(!finished)
+    {
+        // thread 0 advances the iteration until the buffer of rotations is full
+        if(tid == 0)
+        {
+            nsteps = 0;
+            done = bdsqr_defer_steps<S>(n, nv, nu, nc, D, E, work, strideW, steps, nsteps, k,
+                                        iter, maxiter, eps, tol, minshift, thresh);
+        }
+        __syncthreads();
+        finished = done;
+
+        // update singular vectors with the recorded rotations
+        for(rocblas_int q = 0; q < nsteps && (nv || nu || nc); ++q)
+        {
+            rocblas_int i = steps[3 * q];
+            rocblas_int nn = steps[3 * q + 1];
+            rocblas_direct direc = rocblas_direct(steps[3 * q + 2]);
+            S* rots = work + q * strideW;
+            S* rotsU = nv ? rots + 2 * (nn - 1) : rots;
+
+            for(rocblas_int j = tid; j < nv; j += nthds)
+                lasr(rocblas_side_left, direc, nn, 1, rots, rots + nn - 1, V + i + j * ldv, ldv);
+            for(rocblas_int j = tid; j < nu; j += nthds)
+                lasr(rocblas_side_right, direc, 1, nn, rotsU, rotsU + nn - 1, U + j + i * ldu, ldu);
+            for(rocblas_int j = tid; j < nc; j += nthds)
+                lasr(rocblas_side_left, direc, nn, 1, rotsU, rotsU + nn - 1, C + i + j * ldc, ldc);
+        }
+        __syncthreads();
+    }
+
+    __shared__ bool converged;
+    if(tid == 0)
+    {
+        info[bid] = 0;
+        converged = (k == 0);
+
+        // if not converged, set value of info
+        if(!converged)
+        {
+            for(rocblas_int i = 0; i < n - 1; ++i)
+                if(E[i] != 0)
+                    info[bid] += 1;
+        }
+    }
+    __syncthreads();
 
     // re-arrange singular values/vectors if algorithm converged
-    if(k == 0)
+    if(converged)
     {
         // all positive
-        for(rocblas_int ii = 0; ii < n; ++ii)
+        for(rocblas_int j = tid; j < nv; j += nthds)
         {
-            if(D[ii] < 0)
+            for(rocblas_int ii = 0; ii < n; ++ii)
             {
-                D[ii] = -D[ii];
-                if(nv)
-                    negvect(nv, V + ii, ldv);
+                if(D[ii] < 0 && V[ii + j * ldv] != 0)
+                    V[ii + j * ldv] = -V[ii + j * ldv];
             }
         }
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            for(rocblas_int ii = 0; ii < n; ++ii)
+                if(D[ii] < 0)
+                    D[ii] = -D[ii];
+        }
 
         // in decreasing order
-        rocblas_int idx;
+        __shared__ rocblas_int piv;
         for(rocblas_int ii = 0; ii < n - 1; ++ii)
         {
-            idx = ii;
-            smax = D[ii];
             // detect maximum
-            for(rocblas_int jj = ii + 1; jj < n; ++jj)
+            if(tid == 0)
             {
-                if(D[jj] > smax)
+                rocblas_int idx = ii;
+                S smax = D[ii];
+                for(rocblas_int jj = ii + 1; jj < n; ++jj)
+                {
+                    if(D[jj] > smax)
+                    {
+                        idx = jj;
+                        smax = D[jj];
+                    }
+                }
+                if(idx != ii)
                 {
-                    idx = jj;
-                    smax = D[jj];
+                    D[idx] = D[ii];
+                    D[ii] = smax;
                 }
+                piv = idx;
             }
+            __syncthreads();
+
             // swap
+            rocblas_int idx = piv;
             if(idx != ii)
             {
-                D[idx] = D[ii];
-                D[ii] = smax;
-                if(nv)
-                    swapvect(nv, V + idx, ldv, V + ii, ldv);
-                if(nu)
-                    swapvect(nu, U + idx * ldu, 1, U + ii * ldu, 1);
-                if(nc)
-                    swapvect(nc, C + idx, ldc, C + ii, ldc);
+                T temp;
+                for(rocblas_int j = tid; j < nv; j += nthds)
+                {
+                    temp = V[idx + j * ldv];
+                    V[idx + j * ldv] = V[ii + j * ldv];
+                    V[ii + j * ldv] = temp;
+                }
+                for(rocblas_int j = tid; j < nu; j += nthds)
+                {
+                    temp = U[j + idx * ldu];
+                    U[j + idx * ldu] = U[j + ii * ldu];
+                    U[j + ii * ldu] = temp;
+                }
+                for(rocblas_int j = tid; j < nc; j += nthds)
+                {
+                    temp = C[idx + j * ldc];
+                    C[idx + j * ldc] = C[ii + j * ldc];
+                    C[ii + j * ldc] = temp;
+                }
             }
+            __syncthreads();
         }
     }
-
-    // if not, set value of info
-    else
-    {
-        for(rocblas_int i = 0; i < n - 1; ++i)
-            if(E[i] != 0)
-                info[bid] += 1;
-    }
 }
 
 /** LOWER2UPPER kernel transforms a lower bidiagonal matrix given by D and E
@@ -475,7 +563,7 @@ void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
         *size_work += 2;
     if(nu || nc)
         *size_work += 2;
-    *size_work *= sizeof(T) * n * batch_count;
+    *size_work *= sizeof(T) * n * BDSQR_MAX_DEFERRED_SWEEPS * batch_count;
 }
 
 template <typename S, typename W>
@@ -544,7 +632,8 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
                                         const rocblas_stride strideC,
                                         rocblas_int* info,
                                         const rocblas_int batch_count,
-                                        S* work)
+                                        S* work,
+                                        const bool only_failed = false)
 {
     ROCSOLVER_ENTER("bdsqr", "uplo:", uplo, "n:", n, "nv:", nv, "nu:", nu, "nc:", nc,
                     "shiftV:", shiftV, "ldv:", ldv, "shiftU:", shiftU, "ldu:", ldu,
@@ -586,9 +675,13 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
     }
 
     // main computation of SVD
-    hipLaunchKernelGGL((bdsqrKernel<T>), dim3(batch_count), dim3(1), 0, stream, n, nv, nu, nc, D,
-                       strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
-                       shiftC, ldc, strideC, info, maxiter, eps, sfm, tol, minshift, work, strideW);
+    // (the singular vectors are updated by as many threads as rows of U or columns of V and C)
+    rocblas_int nthds = std::max(std::max(nv, nu), nc);
+    nthds = std::min(std::max(nthds, 1), BDSQR_MAX_THDS);
+    hipLaunchKernelGGL((bdsqrKernel<T>), dim3(batch_count), dim3(nthds), 0, stream, n, nv, nu, nc,
+                       D, strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
+                       shiftC, ldc, strideC, info, maxiter, eps, sfm, tol, minshift, work, strideW,
+                       only_failed);
 
     return rocblas_status_success;
 }
@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_bdsvals.hpp"
+
+template <typename T>
+rocblas_status rocsolver_bdsvals_impl(rocblas_handle handle,
+                                      const rocblas_int n,
+                                      T* D,
+                                      T* E,
+                                      rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("bdsvals", "-n", n);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_bdsvals_argCheck(handle, n, D, E, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideD = 0;
+    rocblas_stride strideE = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for the qd arrays and scale factors
+    size_t size_work;
+    rocsolver_bdsvals_getMemorySize<T>(n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_bdsvals_template<T>(handle, n, D, strideD, E, strideE, info, batch_count,
+                                         (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sbdsvals(rocblas_handle handle,
+                                  const rocblas_int n,
+                                  float* D,
+                                  float* E,
+                                  rocblas_int* info)
+{
+    return rocsolver_bdsvals_impl<float>(handle, n, D, E, info);
+}
+
+rocblas_status rocsolver_dbdsvals(rocblas_handle handle,
+                                  const rocblas_int n,
+                                  double* D,
+                                  double* E,
+                                  rocblas_int* info)
+{
+    return rocsolver_bdsvals_impl<double>(handle, n, D, E, info);
+}
+
+} // extern C
@@ -0,0 +1,1121 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+(TODO:THE DQDS ITERATIONS ARE STILL COMPUTED BY A SINGLE THREAD PER INSTANCE OF
+  THE BATCH; ONLY THE SCALING OF THE INPUT AND THE FINAL SORTING OF THE SINGULAR
+  VALUES USE MULTIPLE THREADS PER INSTANCE.)
+***************************************************************************/
+
+/** The device functions below work on the qd array z of the dqds algorithm, that
+    stores the 4*n values (q1, qq1, e1, ee1, q2, qq2, e2, ee2, ...). To keep the
+    index arithmetic of the reference implementation, z is indexed from 1 (z[0] is
+    not used). pp = 0 selects the ping (q, e) part of the array, and pp = 1 the pong
+    (qq, ee) part **/
+
+/** BDSVALS_FLIP reverses the order of the qd array between indices i0 and n0 **/
+template <typename T>
+__device__ void bdsvals_flip(const rocblas_int i0, const rocblas_int n0, T* z)
+{
+    rocblas_int ipn4 = 4 * (i0 + n0);
+    T temp;
+
+    for(rocblas_int i4 = 4 * i0; i4 <= 2 * (i0 + n0 - 1); i4 += 4)
+    {
+        temp = z[i4 - 3];
+        z[i4 - 3] = z[ipn4 - i4 - 3];
+        z[ipn4 - i4 - 3] = temp;
+        temp = z[i4 - 2];
+        z[i4 - 2] = z[ipn4 - i4 - 2];
+        z[ipn4 - i4 - 2] = temp;
+        temp = z[i4 - 1];
+        z[i4 - 1] = z[ipn4 - i4 - 5];
+        z[ipn4 - i4 - 5] = temp;
+        temp = z[i4];
+        z[i4] = z[ipn4 - i4 - 4];
+        z[ipn4 - i4 - 4] = temp;
+    }
+}
+
+/** LASQ4 computes an approximation tau to the smallest eigenvalue of the current
+    qd array, to be used as shift in the next dqds transform. ttype records the type
+    of shift that was used, and g is kept between calls **/
+template <typename T>
+__device__ void lasq4(const rocblas_int i0,
+                      const rocblas_int n0,
+                      T* z,
+                      const rocblas_int pp,
+                      const rocblas_int n0in,
+                      const T dmin,
+                      const T dmin1,
+                      const T dmin2,
+                      const T dn,
+                      const T dn1,
+                      const T dn2,
+                      T& tau,
+                      rocblas_int& ttype,
+                      T& g)
+{
+    const T cnst1 = 0.563;
+    const T cnst2 = 1.01;
+    const T cnst3 = 1.05;
+    const T qurtr = 0.25;
+    const T third = 0.333;
+    const T half = 0.5;
+    const T hundrd = 100;
+
+    // a negative dmin forces the shift to take that absolute value
+    if(dmin <= 0)
+    {
+        tau = -dmin;
+        ttype = -1;
+        return;
+    }
+
+    rocblas_int nn = 4 * n0 + pp;
+    rocblas_int np, i4;
+    T s = 0, a2, b1, b2, gam, gap1, gap2;
+
+    if(n0in == n0)
+    {
+        // no eigenvalues deflated
+        if(dmin == dn || dmin == dn1)
+        {
+            b1 = sqrt(z[nn - 3]) * sqrt(z[nn - 5]);
+            b2 = sqrt(z[nn - 7]) * sqrt(z[nn - 9]);
+            a2 = z[nn - 7] + z[nn - 5];
+
+            if(dmin == dn && dmin1 == dn1)
+            {
+                // cases 2 and 3
+                gap2 = dmin2 - a2 - dmin2 * qurtr;
+                if(gap2 > 0 && gap2 > b2)
+                    gap1 = a2 - dn - (b2 / gap2) * b2;
+                else
+                    gap1 = a2 - dn - (b1 + b2);
+
+                if(gap1 > 0 && gap1 > b1)
+                {
+                    s = max(dn - (b1 / gap1) * b1, half * dmin);
+                    ttype = -2;
+                }
+                else
+                {
+                    s = 0;
+                    if(dn > b1)
+                        s = dn - b1;
+                    if(a2 > (b1 + b2))
+                        s = min(s, a2 - (b1 + b2));
+                    s = max(s, third * dmin);
+                    ttype = -3;
+                }
+            }
+            else
+            {
+                // case 4
+                ttype = -4;
+                s = qurtr * dmin;
+                if(dmin == dn)
+                {
+                    gam = dn;
+                    a2 = 0;
+                    if(z[nn - 5] > z[nn - 7])
+                        return;
+                    b2 = z[nn - 5] / z[nn - 7];
+                    np = nn - 9;
+                }
+                else
+                {
+                    np = nn - 2 * pp;
+                    gam = dn1;
+                    if(z[np - 4] > z[np - 2])
+                        return;
+                    a2 = z[np - 4] / z[np - 2];
+                    if(z[nn - 9] > z[nn - 11])
+                        return;
+                    b2 = z[nn - 9] / z[nn - 11];
+                    np = nn - 13;
+                }
+
+                // approximate contribution to norm squared from i < nn-1
+                a2 = a2 + b2;
+                for(i4 = np; i4 >= 4 * i0 - 1 + pp; i4 -= 4)
+                {
+                    if(b2 == 0)
+                        break;
+                    b1 = b2;
+                    if(z[i4] > z[i4 - 2])
+                        return;
+                    b2 = b2 * (z[i4] / z[i4 - 2]);
+                    a2 = a2 + b2;
+                    if(hundrd * max(b2, b1) < a2 || cnst1 < a2)
+                        break;
+                }
+                a2 = cnst3 * a2;
+
+                // rayleigh quotient residual bound
+                if(a2 < cnst1)
+                    s = gam * (1 - sqrt(a2)) / (1 + a2);
+            }
+        }
+        else if(dmin == dn2)
+        {
+            // case 5
+            ttype = -5;
+            s = qurtr * dmin;
+
+            // compute contribution to norm squared from i > nn-2
+            np = nn - 2 * pp;
+            b1 = z[np - 2];
+            b2 = z[np - 6];
+            gam = dn2;
+            if(z[np - 8] > b2 || z[np - 4] > b1)
+                return;
+            a2 = (z[np - 8] / b2) * (1 + z[np - 4] / b1);
+
+            // approximate contribution to norm squared from i < nn-2
+            if(n0 - i0 > 2)
+            {
+                b2 = z[nn - 13] / z[nn - 15];
+                a2 = a2 + b2;
+                for(i4 = nn - 17; i4 >= 4 * i0 - 1 + pp; i4 -= 4)
+                {
+                    if(b2 == 0)
+                        break;
+                    b1 = b2;
+                    if(z[i4] > z[i4 - 2])
+                        return;
+                    b2 = b2 * (z[i4] / z[i4 - 2]);
+                    a2 = a2 + b2;
+                    if(hundrd * max(b2, b1) < a2 || cnst1 < a2)
+                        break;
+                }
+                a2 = cnst3 * a2;
+            }
+
+            if(a2 < cnst1)
+                s = gam * (1 - sqrt(a2)) / (1 + a2);
+        }
+        else
+        {
+            // case 6, no information to guide us
+            if(ttype == -6)
+                g = g + third * (1 - g);
+            else if(ttype == -18)
+                g = qurtr * third;
+            else
+                g = qurtr;
+            s = g * dmin;
+            ttype = -6;
+        }
+    }
+
+    else if(n0in == n0 + 1)
+    {
+        // one eigenvalue just deflated. use dmin1, dn1 for dmin and dn
+        if(dmin1 == dn1 && dmin2 == dn2)
+        {
+            // cases 7 and 8
+            ttype = -7;
+            s = third * dmin1;
+            if(z[nn - 5] > z[nn - 7])
+                return;
+            b1 = z[nn - 5] / z[nn - 7];
+            b2 = b1;
+            if(b2 != 0)
+            {
+                for(i4 = 4 * n0 - 9 + pp; i4 >= 4 * i0 - 1 + pp; i4 -= 4)
+                {
+                    a2 = b1;
+                    if(z[i4] > z[i4 - 2])
+                        return;
+                    b1 = b1 * (z[i4] / z[i4 - 2]);
+                    b2 = b2 + b1;
+                    if(hundrd * max(b1, a2) < b2)
+                        break;
+                }
+            }
+            b2 = sqrt(cnst3 * b2);
+            a2 = dmin1 / (1 + b2 * b2);
+            gap2 = half * dmin2 - a2;
+            if(gap2 > 0 && gap2 > b2 * a2)
+                s = max(s, a2 * (1 - cnst2 * a2 * (b2 / gap2) * b2));
+            else
+            {
+                s = max(s, a2 * (1 - cnst2 * b2));
+                ttype = -8;
+            }
+        }
+        else
+        {
+            // case 9
+            s = qurtr * dmin1;
+            if(dmin1 == dn1)
+                s = half * dmin1;
+            ttype = -9;
+        }
+    }
+
+    else if(n0in == n0 + 2)
+    {
+        // two eigenvalues deflated. use dmin2, dn2 for dmin and dn
+        if(dmin2 == dn2 && 2 * z[nn - 5] < z[nn - 7])
+        {
+            // cases 10 and 11
+            ttype = -10;
+            s = third * dmin2;
+            if(z[nn - 5] > z[nn - 7])
+                return;
+            b1 = z[nn - 5] / z[nn - 7];
+            b2 = b1;
+            if(b2 != 0)
+            {
+                for(i4 = 4 * n0 - 9 + pp; i4 >= 4 * i0 - 1 + pp; i4 -= 4)
+                {
+                    if(z[i4] > z[i4 - 2])
+                        return;
+                    b1 = b1 * (z[i4] / z[i4 - 2]);
+                    b2 = b2 + b1;
+                    if(hundrd * b1 < b2)
+                        break;
+                }
+            }
+            b2 = sqrt(cnst3 * b2);
+            a2 = dmin2 / (1 + b2 * b2);
+            gap2 = z[nn - 7] + z[nn - 9] - sqrt(z[nn - 11]) * sqrt(z[nn - 9]) - a2;
+            if(gap2 > 0 && gap2 > b2 * a2)
+                s = max(s, a2 * (1 - cnst2 * a2 * (b2 / gap2) * b2));
+            else
+                s = max(s, a2 * (1 - cnst2 * b2));
+        }
+        else
+        {
+            s = qurtr * dmin2;
+            ttype = -11;
+        }
+    }
+
+    else if(n0in > n0 + 2)
+    {
+        // case 12, more than two eigenvalues deflated. no information
+        s = 0;
+        ttype = -12;
+    }
+
+    tau = s;
+}
+
+/** LASQ5 computes one dqds transform of the qd array with shift tau, in ping-pong
+    form. It returns the minimum d in dmin, and the last three d's in dn, dnm1 and
+    dnm2 (with the minimum d's up to them in dmin, dmin1 and dmin2) **/
+template <typename T>
+__device__ void lasq5(const rocblas_int i0,
+                      const rocblas_int n0,
+                      T* z,
+                      const rocblas_int pp,
+                      T& tau,
+                      const T sigma,
+                      T& dmin,
+                      T& dmin1,
+                      T& dmin2,
+                      T& dn,
+                      T& dnm1,
+                      T& dnm2,
+                      const T eps)
+{
+    if(n0 - i0 - 1 <= 0)
+        return;
+
+    // tiny shifts are not applied; instead, the d's that are small enough are set to
+    // zero
+    T dthresh = eps * (sigma + tau);
+    if(tau < dthresh / 2)
+        tau = 0;
+
+    rocblas_int j4 = 4 * i0 + pp - 3;
+    rocblas_int j4p2;
+    T emin = z[j4 + 4];
+    T d = z[j4] - tau;
+    T temp;
+    dmin = d;
+    dmin1 = -z[j4];
+
+    for(j4 = 4 * i0; j4 <= 4 * (n0 - 3); j4 += 4)
+    {
+        z[j4 - 2 - pp] = d + z[j4 - 1 + pp];
+        temp = z[j4 + 1 + pp] / z[j4 - 2 - pp];
+        d = d * temp - tau;
+        if(tau == 0 && d < dthresh)
+            d = 0;
+        dmin = min(dmin, d);
+        z[j4 - pp] = z[j4 - 1 + pp] * temp;
+        emin = min(z[j4 - pp], emin);
+    }
+
+    // unroll last two steps
+    dnm2 = d;
+    dmin2 = dmin;
+    j4 = 4 * (n0 - 2) - pp;
+    j4p2 = j4 + 2 * pp - 1;
+    z[j4 - 2] = dnm2 + z[j4p2];
+    z[j4] = z[j4p2 + 2] * (z[j4p2] / z[j4 - 2]);
+    dnm1 = z[j4p2 + 2] * (dnm2 / z[j4 - 2]) - tau;
+    dmin = min(dmin, dnm1);
+
+    dmin1 = dmin;
+    j4 = j4 + 4;
+    j4p2 = j4 + 2 * pp - 1;
+    z[j4 - 2] = dnm1 + z[j4p2];
+    z[j4] = z[j4p2 + 2] * (z[j4p2] / z[j4 - 2]);
+    dn = z[j4p2 + 2] * (dnm1 / z[j4 - 2]) - tau;
+    dmin = min(dmin, dn);
+
+    z[j4 + 2] = dn;
+    z[4 * n0 - pp] = emin;
+}
+
+/** LASQ6_STEP computes the step of the dqd transform (without shift) that updates
+    z[j4 - 2] and z[j4], guarding against underflow. dnext is the new d, and dmin and emin
+    are updated accordingly **/
+template <typename T>
+__device__ void lasq6_step(const rocblas_int j4,
+                           const rocblas_int j4p2,
+                           T* z,
+                           const T d,
+                           T& dnext,
+                           T& dmin,
+                           T& emin,
+                           const T safmin)
+{
+    T temp;
+
+    z[j4 - 2] = d + z[j4p2];
+    if(z[j4 - 2] == 0)
+    {
+        z[j4] = 0;
+        dnext = z[j4p2 + 2];
+        dmin = dnext;
+        emin = 0;
+    }
+    else if(safmin * z[j4p2 + 2] < z[j4 - 2] && safmin * z[j4 - 2] < z[j4p2 + 2])
+    {
+        temp = z[j4p2 + 2] / z[j4 - 2];
+        z[j4] = z[j4p2] * temp;
+        dnext = d * temp;
+    }
+    else
+    {
+        z[j4] = z[j4p2 + 2] * (z[j4p2] / z[j4 - 2]);
+        dnext = z[j4p2 + 2] * (d / z[j4 - 2]);
+    }
+    dmin = min(dmin, dnext);
+}
+
+/** LASQ6 computes one dqd transform (dqds with zero shift) of the qd array in
+    ping-pong form, avoiding underflow. It is used when the shifted transform is
+    at risk **/
+template <typename T>
+__device__ void lasq6(const rocblas_int i0,
+                      const rocblas_int n0,
+                      T* z,
+                      const rocblas_int pp,
+                      T& dmin,
+                      T& dmin1,
+                      T& dmin2,
+                      T& dn,
+                      T& dnm1,
+                      T& dnm2,
+                      const T safmin)
+{
+    if(n0 - i0 - 1 <= 0)
+        return;
+
+    rocblas_int j4 = 4 * i0 + pp - 3;
+    T emin = z[j4 + 4];
+    T d = z[j4];
+    dmin = d;
+
+    for(j4 = 4 * i0; j4 <= 4 * (n0 - 3); j4 += 4)
+    {
+        lasq6_step(j4 - pp, j4 - 1 + pp, z, d, d, dmin, emin, safmin);
+        emin = min(emin, z[j4 - pp]);
+    }
+
+    // unroll last two steps
+    dnm2 = d;
+    dmin2 = dmin;
+    j4 = 4 * (n0 - 2) - pp;
+    lasq6_step(j4, j4 + 2 * pp - 1, z, dnm2, dnm1, dmin, emin, safmin);
+
+    dmin1 = dmin;
+    j4 = j4 + 4;
+    lasq6_step(j4, j4 + 2 * pp - 1, z, dnm1, dn, dmin, emin, safmin);
+
+    z[j4 + 2] = dn;
+    z[4 * n0 - pp] = emin;
+}
+
+/** LASQ3 checks for deflation of the submatrix between indices i0 and n0 of the qd
+    array, computes a shift and takes one dqds step. n0 is updated with the eigenvalues
+    that were deflated (which are stored in their final position), and sigma, desig
+    (the accumulated shift and its rounding error) and the rest of the state that is
+    kept between steps are updated as well **/
+template <typename T>
+__device__ void lasq3(const rocblas_int i0,
+                      rocblas_int& n0,
+                      T* z,
+                      rocblas_int& pp,
+                      T& dmin,
+                      T& sigma,
+                      T& desig,
+                      T& qmax,
+                      rocblas_int& ttype,
+                      T& dmin1,
+                      T& dmin2,
+                      T& dn,
+                      T& dn1,
+                      T& dn2,
+                      T& g,
+                      T& tau,
+                      const T eps,
+                      const T safmin)
+{
+    const T cbias = 1.5;
+    const T tol = 100 * eps;
+    const T tol2 = tol * tol;
+    const rocblas_int n0in = n0;
+
+    rocblas_int nn;
+    T s, t;
+
+    // check for deflation
+    while(n0 >= i0)
+    {
+        if(n0 == i0)
+        {
+            // one eigenvalue
+            z[4 * n0 - 3] = z[4 * n0 + pp - 3] + sigma;
+            n0--;
+            continue;
+        }
+
+        nn = 4 * n0 + pp;
+        if(n0 > i0 + 1)
+        {
+            // check whether e(n0-1) is negligible, one eigenvalue
+            if(z[nn - 5] <= tol2 * (sigma + z[nn - 3]) || z[nn - 2 * pp - 4] <= tol2 * z[nn - 7])
+            {
+                z[4 * n0 - 3] = z[4 * n0 + pp - 3] + sigma;
+                n0--;
+                continue;
+            }
+
+            // check whether e(n0-2) is negligible, two eigenvalues
+            if(z[nn - 9] > tol2 * sigma && z[nn - 2 * pp - 8] > tol2 * z[nn - 11])
+                break;
+        }
+
+        // two eigenvalues
+        if(z[nn - 3] > z[nn - 7])
+        {
+            s = z[nn - 3];
+            z[nn - 3] = z[nn - 7];
+            z[nn - 7] = s;
+        }
+        t = (z[nn - 7] - z[nn - 3] + z[nn - 5]) / 2;
+        if(z[nn - 5] > z[nn - 3] * tol2 && t != 0)
+        {
+            s = z[nn - 3] * (z[nn - 5] / t);
+            if(s <= t)
+                s = z[nn - 3] * (z[nn - 5] / (t * (1 + sqrt(1 + s / t))));
+            else
+                s = z[nn - 3] * (z[nn - 5] / (t + sqrt(t) * sqrt(t + s)));
+            t = z[nn - 7] + (s + z[nn - 5]);
+            z[nn - 3] = z[nn - 3] * (z[nn - 7] / t);
+            z[nn - 7] = t;
+        }
+        z[4 * n0 - 7] = z[nn - 7] + sigma;
+        z[4 * n0 - 3] = z[nn - 3] + sigma;
+        n0 -= 2;
+    }
+
+    if(n0 < i0)
+        return;
+
+    if(pp == 2)
+        pp = 0;
+
+    // reverse the qd array, if warranted
+    if(dmin <= 0 || n0 < n0in)
+    {
+        if(cbias * z[4 * i0 + pp - 3] < z[4 * n0 + pp - 3])
+        {
+            bdsvals_flip(i0, n0, z);
+            if(n0 - i0 <= 4)
+            {
+                z[4 * n0 + pp - 1] = z[4 * i0 + pp - 1];
+                z[4 * n0 - pp] = z[4 * i0 - pp];
+            }
+            dmin2 = min(dmin2, z[4 * n0 + pp - 1]);
+            z[4 * n0 + pp - 1]
+                = min(z[4 * n0 + pp - 1], min(z[4 * i0 + pp - 1], z[4 * i0 + pp + 3]));
+            z[4 * n0 - pp] = min(z[4 * n0 - pp], min(z[4 * i0 - pp], z[4 * i0 - pp + 4]));
+            qmax = max(qmax, max(z[4 * i0 + pp - 3], z[4 * i0 + pp + 1]));
+            dmin = -T(0);
+        }
+    }
+
+    // choose a shift
+    lasq4(i0, n0, z, pp, n0in, dmin, dmin1, dmin2, dn, dn1, dn2, tau, ttype, g);
+
+    // call dqds until dmin > 0
+    bool unshifted = false;
+    while(true)
+    {
+        lasq5(i0, n0, z, pp, tau, sigma, dmin, dmin1, dmin2, dn, dn1, dn2, eps);
+
+        if(dmin >= 0 && dmin1 >= 0)
+        {
+            // success
+            break;
+        }
+        else if(dmin < 0 && dmin1 > 0 && z[4 * (n0 - 1) - pp] < tol * (sigma + dn1)
+                && abs(dn) < tol * sigma)
+        {
+            // convergence hidden by negative dn
+            z[4 * (n0 - 1) - pp + 2] = 0;
+            dmin = 0;
+            break;
+        }
+        else if(dmin < 0)
+        {
+            // tau too big. select new tau and try again
+            if(ttype < -22)
+            {
+                // failed twice. play it safe
+                tau = 0;
+            }
+            else if(dmin1 > 0)
+            {
+                // late failure. gives excellent shift
+                tau = (tau + dmin) * (1 - 2 * eps);
+                ttype -= 11;
+            }
+            else
+            {
+                // early failure. divide by 4
+                tau = tau / 4;
+                ttype -= 12;
+            }
+        }
+        else if(isnan(dmin))
+        {
+            if(tau == 0)
+            {
+                unshifted = true;
+                break;
+            }
+            tau = 0;
+        }
+        else
+        {
+            // possible underflow. play it safe
+            unshifted = true;
+            break;
+        }
+    }
+
+    // risk of underflow
+    if(unshifted)
+    {
+        lasq6(i0, n0, z, pp, dmin, dmin1, dmin2, dn, dn1, dn2, safmin);
+        tau = 0;
+    }
+
+    // accumulate the shift, keeping track of the rounding error in desig
+    if(tau < sigma)
+    {
+        desig = desig + tau;
+        t = sigma + desig;
+        desig = desig - (t - sigma);
+    }
+    else
+    {
+        t = sigma + tau;
+        desig = sigma + (desig - (t - tau));
+    }
+    sigma = t;
+}
+
+/** BDSVALS_INIT_KERNEL scales the bidiagonal matrix given by D and E by its largest
+    element (in absolute value), and copies the squares of the scaled elements into the
+    qd array (q1, e1, q2, e2, ...) in the workspace. The scale factor is stored in scal.
+    Call this kernel with batch_count groups in y, and BLOCKSIZE threads in x **/
+template <typename T>
+__global__ void bdsvals_init_kernel(const rocblas_int n,
+                                    T* DD,
+                                    const rocblas_stride strideD,
+                                    T* EE,
+                                    const rocblas_stride strideE,
+                                    T* work,
+                                    const rocblas_stride strideW,
+                                    T* scal,
+                                    const T scale)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+    T* z = work + (bid * strideW);
+
+    __shared__ T sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // find the largest element
+    T sigmx = 0;
+    rocblas_int idx = 0;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        sigmx = max(sigmx, abs(D[i]));
+        if(i < n - 1)
+            sigmx = max(sigmx, abs(E[i]));
+    }
+    sigmx = block_reduce_max(sigmx, idx, sval, sidx);
+    if(sigmx == 0)
+        sigmx = 1;
+
+    // copy the squares of the scaled elements
+    // (the values are scaled up as much as possible to avoid underflow)
+    T q;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        q = (D[i] / sigmx) * scale;
+        z[2 * i + 1] = q * q;
+        if(i < n - 1)
+        {
+            q = (E[i] / sigmx) * scale;
+            z[2 * i + 2] = q * q;
+        }
+    }
+
+    if(tid == 0)
+    {
+        z[2 * n] = 0;
+        scal[bid] = sigmx;
+    }
+}
+
+/** BDSVALS_KERNEL computes the eigenvalues of the symmetric positive definite
+    tridiagonal matrix associated to the qd array in the workspace, with the dqds
+    algorithm (LAPACK's xLASQ2). On exit, the first n entries of the qd array contain
+    the eigenvalues (not sorted). If the algorithm fails to converge within maxiter
+    iterations per eigenvalue, info is set to the number of eigenvalues that were not
+    computed.
+    Call this kernel with batch_count groups in x, and one thread **/
+template <typename T>
+__global__ void bdsvals_kernel(const rocblas_int n,
+                               T* work,
+                               const rocblas_stride strideW,
+                               rocblas_int* info,
+                               const rocblas_int maxiter,
+                               const T eps,
+                               const T safmin)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    T* z = work + (bid * strideW);
+
+    const T cbias = 1.5;
+    const T tol = 100 * eps;
+    const T tol2 = tol * tol;
+
+    rocblas_int i0, n0, pp, i4, kmin, splt, nbig, ttype;
+    T d, e, s, t, temp, emin, emax, qmin, qmax, dee, deemin, oldemn, sigma, desig;
+    T dmin, dmin1, dmin2, dn, dn1, dn2, g, tau;
+
+    if(n == 1)
+        return;
+
+    if(n == 2)
+    {
+        if(z[3] > z[1])
+        {
+            d = z[3];
+            z[3] = z[1];
+            z[1] = d;
+        }
+        if(z[2] > z[3] * tol2)
+        {
+            t = (z[1] - z[3] + z[2]) / 2;
+            s = z[3] * (z[2] / t);
+            if(s <= t)
+                s = z[3] * (z[2] / (t * (1 + sqrt(1 + s / t))));
+            else
+                s = z[3] * (z[2] / (t + sqrt(t) * sqrt(t + s)));
+            t = z[1] + (s + z[2]);
+            z[3] = z[3] * (z[1] / t);
+            z[1] = t;
+        }
+        z[2] = z[3];
+        return;
+    }
+
+    // check for diagonality
+    e = 0;
+    for(rocblas_int k = 2; k < 2 * n; k += 2)
+        e += z[k];
+    if(e == 0)
+    {
+        for(rocblas_int k = 2; k <= n; k++)
+            z[k] = z[2 * k - 1];
+        return;
+    }
+
+    // rearrange data for locality: z = (q1, qq1, e1, ee1, q2, qq2, e2, ee2, ...)
+    for(rocblas_int k = 2 * n; k >= 2; k -= 2)
+    {
+        z[2 * k] = 0;
+        z[2 * k - 1] = z[k];
+        z[2 * k - 2] = 0;
+        z[2 * k - 3] = z[k - 1];
+    }
+
+    i0 = 1;
+    n0 = n;
+
+    // reverse the qd array, if warranted
+    if(cbias * z[4 * i0 - 3] < z[4 * n0 - 3])
+        bdsvals_flip(i0, n0, z);
+
+    // initial split checking via dqd and Li's test
+    pp = 0;
+    for(rocblas_int k = 0; k < 2; k++)
+    {
+        d = z[4 * n0 + pp - 3];
+        for(i4 = 4 * (n0 - 1) + pp; i4 >= 4 * i0 + pp; i4 -= 4)
+        {
+            if(z[i4 - 1] <= tol2 * d)
+            {
+                z[i4 - 1] = -T(0);
+                d = z[i4 - 3];
+            }
+            else
+                d = z[i4 - 3] * (d / (d + z[i4 - 1]));
+        }
+
+        // dqd maps z to zz plus Li's test
+        d = z[4 * i0 + pp - 3];
+        for(i4 = 4 * i0 + pp; i4 <= 4 * (n0 - 1) + pp; i4 += 4)
+        {
+            z[i4 - 2 * pp - 2] = d + z[i4 - 1];
+            if(z[i4 - 1] <= tol2 * d)
+            {
+                z[i4 - 1] = -T(0);
+                z[i4 - 2 * pp - 2] = d;
+                z[i4 - 2 * pp] = 0;
+                d = z[i4 + 1];
+            }
+            else if(safmin * z[i4 + 1] < z[i4 - 2 * pp - 2]
+                    && safmin * z[i4 - 2 * pp - 2] < z[i4 + 1])
+            {
+                temp = z[i4 + 1] / z[i4 - 2 * pp - 2];
+                z[i4 - 2 * pp] = z[i4 - 1] * temp;
+                d = d * temp;
+            }
+            else
+            {
+                z[i4 - 2 * pp] = z[i4 + 1] * (z[i4 - 1] / z[i4 - 2 * pp - 2]);
+                d = z[i4 + 1] * (d / z[i4 - 2 * pp - 2]);
+            }
+        }
+        z[4 * n0 - pp - 2] = d;
+
+        // prepare for the next iteration on k
+        pp = 1 - pp;
+    }
+
+    // initialise the state kept between dqds steps
+    ttype = 0;
+    dmin1 = 0;
+    dmin2 = 0;
+    dn = 0;
+    dn1 = 0;
+    dn2 = 0;
+    g = 0;
+    tau = 0;
+
+    for(rocblas_int iwhila = 0; iwhila <= n && n0 >= 1; iwhila++)
+    {
+        // e(n0) holds the value of sigma when the submatrix in i0:n0 splits from the
+        // rest of the array, but is negated
+        desig = 0;
+        sigma = (n0 == n) ? 0 : -z[4 * n0 - 1];
+        if(sigma < 0)
+            break;
+
+        // find last unreduced submatrix's top index i0, find qmax and emin.
+        // find Gershgorin-type bound if q's much greater than e's
+        emax = 0;
+        emin = (n0 > i0) ? abs(z[4 * n0 - 5]) : 0;
+        qmin = z[4 * n0 - 3];
+        qmax = qmin;
+        for(i4 = 4 * n0; i4 >= 8; i4 -= 4)
+        {
+            if(z[i4 - 5] <= 0)
+                break;
+            if(qmin >= 4 * emax)
+            {
+                qmin = min(qmin, z[i4 - 3]);
+                emax = max(emax, z[i4 - 5]);
+            }
+            qmax = max(qmax, z[i4 - 7] + z[i4 - 5]);
+            emin = min(emin, z[i4 - 5]);
+        }
+        i0 = i4 / 4;
+        pp = 0;
+
+        if(n0 - i0 > 1)
+        {
+            dee = z[4 * i0 - 3];
+            deemin = dee;
+            kmin = i0;
+            for(i4 = 4 * i0 + 1; i4 <= 4 * n0 - 3; i4 += 4)
+            {
+                dee = z[i4] * (dee / (dee + z[i4 - 2]));
+                if(dee <= deemin)
+                {
+                    deemin = dee;
+                    kmin = (i4 + 3) / 4;
+                }
+            }
+            if((kmin - i0) * 2 < n0 - kmin && deemin <= z[4 * n0 - 3] / 2)
+            {
+                // pp = 2 indicates that the array was flipped, so that the tests for
+                // deflation on entry to lasq3 are skipped
+                bdsvals_flip(i0, n0, z);
+                pp = 2;
+            }
+        }
+
+        // put -(initial shift) into dmin
+        dmin = -max(T(0), qmin - 2 * sqrt(qmin) * sqrt(emax));
+
+        // now i0:n0 is unreduced
+        nbig = maxiter * (n0 - i0 + 1);
+        for(rocblas_int iwhilb = 0; iwhilb < nbig && i0 <= n0; iwhilb++)
+        {
+            // while submatrix unfinished take a good dqds step
+            lasq3(i0, n0, z, pp, dmin, sigma, desig, qmax, ttype, dmin1, dmin2, dn, dn1, dn2, g,
+                  tau, eps, safmin);
+            pp = 1 - pp;
+
+            // when emin is very small check for splits
+            if(pp == 0 && n0 - i0 >= 3)
+            {
+                if(z[4 * n0] <= tol2 * qmax || z[4 * n0 - 1] <= tol2 * sigma)
+                {
+                    splt = i0 - 1;
+                    qmax = z[4 * i0 - 3];
+                    emin = z[4 * i0 - 1];
+                    oldemn = z[4 * i0];
+                    for(i4 = 4 * i0; i4 <= 4 * (n0 - 3); i4 += 4)
+                    {
+                        if(z[i4] <= tol2 * z[i4 - 3] || z[i4 - 1] <= tol2 * sigma)
+                        {
+                            z[i4 - 1] = -sigma;
+                            splt = i4 / 4;
+                            qmax = 0;
+                            emin = z[i4 + 3];
+                            oldemn = z[i4 + 4];
+                        }
+                        else
+                        {
+                            qmax = max(qmax, z[i4 + 1]);
+                            emin = min(emin, z[i4 - 1]);
+                            oldemn = min(oldemn, z[i4]);
+                        }
+                    }
+                    z[4 * n0 - 1] = emin;
+                    z[4 * n0] = oldemn;
+                    i0 = splt + 1;
+                }
+            }
+        }
+
+        // maximum number of iterations exceeded
+        if(i0 <= n0)
+            break;
+    }
+
+    // check for convergence
+    if(n0 >= 1)
+    {
+        info[bid] = n0;
+        return;
+    }
+
+    // move the eigenvalues to the front
+    for(rocblas_int k = 2; k <= n; k++)
+        z[k] = z[4 * k - 3];
+}
+
+/** BDSVALS_SORT_KERNEL returns in D the singular values of the bidiagonal matrix
+    (the square roots of the eigenvalues in the qd array, with the scaling undone)
+    sorted in decreasing order. Each thread places one value by counting the values
+    that are larger (ties are resolved by index), so that no further synchronization
+    is needed. D is not modified if the dqds algorithm did not converge.
+    Call this kernel with batch_count groups in y, and enough groups of BLOCKSIZE
+    threads in x to cover the n values **/
+template <typename T>
+__global__ void bdsvals_sort_kernel(const rocblas_int n,
+                                    T* DD,
+                                    const rocblas_stride strideD,
+                                    T* work,
+                                    const rocblas_stride strideW,
+                                    T* scal,
+                                    const T scale,
+                                    rocblas_int* info)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(info[bid] != 0)
+        return;
+
+    T* D = DD + (bid * strideD);
+    T* z = work + (bid * strideW) + 1;
+
+    __shared__ T sval[BLOCKSIZE];
+
+    T val = (i < n) ? z[i] : 0;
+    rocblas_int rank = 0;
+    for(rocblas_int j0 = 0; j0 < n; j0 += BLOCKSIZE)
+    {
+        if(j0 + tid < n)
+            sval[tid] = z[j0 + tid];
+        __syncthreads();
+
+        rocblas_int nj = min(BLOCKSIZE, n - j0);
+        for(rocblas_int j = 0; j < nj; j++)
+        {
+            if(sval[j] > val || (sval[j] == val && j0 + j < i))
+                rank++;
+        }
+        __syncthreads();
+    }
+
+    if(i < n)
+        D[rank] = (sqrt(val) / scale) * scal[bid];
+}
+
+template <typename T>
+void rocsolver_bdsvals_getMemorySize(const rocblas_int n,
+                                     const rocblas_int batch_count,
+                                     size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of workspace (for the qd arrays and the scale factors)
+    *size_work = sizeof(T) * (4 * n + 2) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_bdsvals_argCheck(rocblas_handle handle,
+                                          const rocblas_int n,
+                                          T* D,
+                                          T* E,
+                                          rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n > 1 && !E) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** ROCSOLVER_BDSVALS_TEMPLATE computes the singular values of a bidiagonal matrix
+    (upper or lower) with the dqds algorithm, as LAPACK's xLASQ1. E is not modified.
+    MAXITER is the max number of dqds iterations per singular value (it is only lowered
+    internally to exercise the non-convergence paths) **/
+template <typename T, rocblas_int MAXITER = BDSVALS_MAX_ITERS>
+rocblas_status rocsolver_bdsvals_template(rocblas_handle handle,
+                                          const rocblas_int n,
+                                          T* D,
+                                          const rocblas_stride strideD,
+                                          T* E,
+                                          const rocblas_stride strideE,
+                                          rocblas_int* info,
+                                          const rocblas_int batch_count,
+                                          T* work)
+{
+    ROCSOLVER_ENTER("bdsvals", "n:", n, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    T eps = get_epsilon<T>();
+    T safmin = get_safemin<T>();
+    T scale = sqrt(eps / safmin);
+
+    // each qd array is indexed from 1 (see above)
+    rocblas_stride strideW = 4 * n + 1;
+    T* scal = work + strideW * batch_count;
+
+    hipLaunchKernelGGL(bdsvals_init_kernel<T>, dim3(1, batch_count), threads, 0, stream, n, D,
+                       strideD, E, strideE, work, strideW, scal, scale);
+
+    hipLaunchKernelGGL(bdsvals_kernel<T>, dim3(batch_count), dim3(1), 0, stream, n, work, strideW,
+                       info, MAXITER, eps, safmin);
+
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(bdsvals_sort_kernel<T>, dim3(blocks, batch_count), threads, 0, stream, n,
+                       D, strideD, work, strideW, scal, scale, info);
+
+    return rocblas_status_success;
+}
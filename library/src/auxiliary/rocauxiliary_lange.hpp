@@ -0,0 +1,189 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** LANGE_ABS returns the absolute value of the element (i,j) of a matrix, or zero
+    if the element is not referenced. If uplo is not full, only the upper or lower
+    trapezoidal part of the matrix is referenced, and its diagonal is assumed to be all
+    ones if diag is unit (as in LAPACK's LANTR). **/
+template <typename T, typename S = decltype(std::real(T{}))>
+__device__ S lange_abs(const rocblas_fill uplo,
+                       const rocblas_diagonal diag,
+                       const rocblas_int i,
+                       const rocblas_int j,
+                       T* A,
+                       const rocblas_int lda)
+{
+    if((uplo == rocblas_fill_upper && i > j) || (uplo == rocblas_fill_lower && i < j))
+        return 0;
+    if(i == j && uplo != rocblas_fill_full && diag == rocblas_diagonal_unit)
+        return 1;
+    return std::abs(A[i + j * lda]);
+}
+
+/** LANGE_KERNEL computes the norm of a m-by-n matrix (or of its upper or lower
+    trapezoidal part, see lange_abs).
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) lange_kernel(const rocblas_norm_type norm_type,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_diagonal diag,
+                                                          const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          U AA,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          S* normA)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    S val = 0, temp, scale;
+    rocblas_int idx = 0;
+
+    if(norm_type == rocblas_norm_one)
+    {
+        // every thread computes the sum of its own columns
+        for(rocblas_int j = tid; j < n; j += BLOCKSIZE)
+        {
+            temp = 0;
+            for(rocblas_int i = 0; i < m; i++)
+                temp += lange_abs(uplo, diag, i, j, A, lda);
+            val = temp > val ? temp : val;
+        }
+        val = block_reduce_max(val, idx, sval, sidx);
+    }
+
+    else if(norm_type == rocblas_norm_inf)
+    {
+        // every thread computes the sum of its own rows
+        for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+        {
+            temp = 0;
+            for(rocblas_int j = 0; j < n; j++)
+                temp += lange_abs(uplo, diag, i, j, A, lda);
+            val = temp > val ? temp : val;
+        }
+        val = block_reduce_max(val, idx, sval, sidx);
+    }
+
+    else
+    {
+        // find the largest absolute value
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+            {
+                temp = lange_abs(uplo, diag, i, j, A, lda);
+                val = temp > val ? temp : val;
+            }
+        }
+        val = block_reduce_max(val, idx, sval, sidx);
+
+        // the frobenius norm is computed with the elements scaled by
+        // the largest absolute value to avoid overflow
+        if(norm_type == rocblas_norm_frobenius && val > 0)
+        {
+            scale = val;
+            val = 0;
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+                {
+                    temp = lange_abs(uplo, diag, i, j, A, lda) / scale;
+                    val += temp * temp;
+                }
+            }
+            val = scale * sqrt(block_reduce_sum(val, sval));
+        }
+    }
+
+    if(tid == 0)
+        normA[b] = val;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_lange_argCheck(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        S* norm,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf
+       && norm_type != rocblas_norm_max && norm_type != rocblas_norm_frobenius)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (batch_count && !norm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lange_template(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* norm,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lange", "norm_type:", norm_type, "m:", m, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, norm,
+                           batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    hipLaunchKernelGGL(lange_kernel<T>, dim3(batch_count, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream,
+                       norm_type, rocblas_fill_full, rocblas_diagonal_non_unit, m, n, A, shiftA,
+                       lda, strideA, norm);
+
+    return rocblas_status_success;
+}
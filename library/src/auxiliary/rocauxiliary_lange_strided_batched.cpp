@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_lange.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lange_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_norm_type norm_type,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    S* norm,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("lange_strided_batched", "--norm", norm_type, "-m", m, "-n", n, "--lda",
+                        lda, "--bsa", strideA, "--batch", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_lange_argCheck(handle, norm_type, m, n, lda, A, norm,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_lange_template<T>(handle, norm_type, m, n, A, shiftA, lda, strideA, norm,
+                                       batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_slange_strided_batched(rocblas_handle handle,
+                                                const rocblas_norm_type norm_type,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* norm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_lange_strided_batched_impl<float>(handle, norm_type, m, n, A, lda, strideA,
+                                                       norm, batch_count);
+}
+
+rocblas_status rocsolver_dlange_strided_batched(rocblas_handle handle,
+                                                const rocblas_norm_type norm_type,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* norm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_lange_strided_batched_impl<double>(handle, norm_type, m, n, A, lda, strideA,
+                                                        norm, batch_count);
+}
+
+rocblas_status rocsolver_clange_strided_batched(rocblas_handle handle,
+                                                const rocblas_norm_type norm_type,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* norm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_lange_strided_batched_impl<rocblas_float_complex>(
+        handle, norm_type, m, n, A, lda, strideA, norm, batch_count);
+}
+
+rocblas_status rocsolver_zlange_strided_batched(rocblas_handle handle,
+                                                const rocblas_norm_type norm_type,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* norm,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_lange_strided_batched_impl<rocblas_double_complex>(
+        handle, norm_type, m, n, A, lda, strideA, norm, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,97 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_lansy_lanhe.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lansy_lanhe_impl(rocblas_handle handle,
+                                          const rocblas_norm_type norm_type,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int n,
+                                          U A,
+                                          const rocblas_int lda,
+                                          S* norm)
+{
+    const char* name = (!is_complex<T> ? "lansy" : "lanhe");
+    ROCSOLVER_ENTER_TOP(name, "--norm", norm_type, "--uplo", uplo, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_lansy_lanhe_argCheck(handle, norm_type, uplo, n, lda, A, norm);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_lansy_lanhe_template<T>(handle, norm_type, uplo, n, A, shiftA, lda, strideA,
+                                             norm, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_slansy(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                float* norm)
+{
+    return rocsolver_lansy_lanhe_impl<float>(handle, norm_type, uplo, n, A, lda, norm);
+}
+
+rocblas_status rocsolver_dlansy(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                double* norm)
+{
+    return rocsolver_lansy_lanhe_impl<double>(handle, norm_type, uplo, n, A, lda, norm);
+}
+
+rocblas_status rocsolver_clanhe(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                float* norm)
+{
+    return rocsolver_lansy_lanhe_impl<rocblas_float_complex>(handle, norm_type, uplo, n, A, lda,
+                                                             norm);
+}
+
+rocblas_status rocsolver_zlanhe(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                double* norm)
+{
+    return rocsolver_lansy_lanhe_impl<rocblas_double_complex>(handle, norm_type, uplo, n, A, lda,
+                                                              norm);
+}
+
+} // extern C
@@ -0,0 +1,173 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** LANSY_ABS returns the absolute value of the element (i,j) of a symmetric/hermitian
+    matrix of which only the upper or lower triangular part is stored. (The imaginary
+    part of the diagonal of a hermitian matrix is assumed to be zero). **/
+template <typename T, typename S = decltype(std::real(T{}))>
+__device__ S lansy_abs(const rocblas_fill uplo,
+                       const rocblas_int i,
+                       const rocblas_int j,
+                       T* A,
+                       const rocblas_int lda)
+{
+    if(i == j)
+        return std::abs(std::real(A[i + i * lda]));
+    if((uplo == rocblas_fill_upper) == (i < j))
+        return std::abs(A[i + j * lda]);
+    return std::abs(A[j + i * lda]);
+}
+
+/** LANSY_KERNEL computes the norm of a n-by-n symmetric/hermitian matrix.
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) lansy_kernel(const rocblas_norm_type norm_type,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          U AA,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          S* normA)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    S val = 0, temp, scale;
+    rocblas_int idx = 0;
+
+    if(norm_type == rocblas_norm_one || norm_type == rocblas_norm_inf)
+    {
+        // every thread computes the sum of its own columns
+        // (the 1-norm and the infinity norm are the same)
+        for(rocblas_int j = tid; j < n; j += BLOCKSIZE)
+        {
+            temp = 0;
+            for(rocblas_int i = 0; i < n; i++)
+                temp += lansy_abs(uplo, i, j, A, lda);
+            val = temp > val ? temp : val;
+        }
+        val = block_reduce_max(val, idx, sval, sidx);
+    }
+
+    else
+    {
+        // find the largest absolute value
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+            {
+                temp = lansy_abs(uplo, i, j, A, lda);
+                val = temp > val ? temp : val;
+            }
+        }
+        val = block_reduce_max(val, idx, sval, sidx);
+
+        // the frobenius norm is computed with the elements scaled by
+        // the largest absolute value to avoid overflow
+        if(norm_type == rocblas_norm_frobenius && val > 0)
+        {
+            scale = val;
+            val = 0;
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+                {
+                    temp = lansy_abs(uplo, i, j, A, lda) / scale;
+                    val += temp * temp;
+                }
+            }
+            val = scale * sqrt(block_reduce_sum(val, sval));
+        }
+    }
+
+    if(tid == 0)
+        normA[b] = val;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_lansy_lanhe_argCheck(rocblas_handle handle,
+                                              const rocblas_norm_type norm_type,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              const rocblas_int lda,
+                                              T A,
+                                              S* norm,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf
+       && norm_type != rocblas_norm_max && norm_type != rocblas_norm_frobenius)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !norm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lansy_lanhe_template(rocblas_handle handle,
+                                              const rocblas_norm_type norm_type,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              S* norm,
+                                              const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lansy_lanhe", "norm_type:", norm_type, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, norm,
+                           batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    hipLaunchKernelGGL(lansy_kernel<T>, dim3(batch_count, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream,
+                       norm_type, uplo, n, A, shiftA, lda, strideA, norm);
+
+    return rocblas_status_success;
+}
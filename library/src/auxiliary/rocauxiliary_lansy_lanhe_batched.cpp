@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_lansy_lanhe.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lansy_lanhe_batched_impl(rocblas_handle handle,
+                                                  const rocblas_norm_type norm_type,
+                                                  const rocblas_fill uplo,
+                                                  const rocblas_int n,
+                                                  U A,
+                                                  const rocblas_int lda,
+                                                  S* norm,
+                                                  const rocblas_int batch_count)
+{
+    const char* name = (!is_complex<T> ? "lansy_batched" : "lanhe_batched");
+    ROCSOLVER_ENTER_TOP(name, "--norm", norm_type, "--uplo", uplo, "-n", n, "--lda", lda, "--batch",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_lansy_lanhe_argCheck(handle, norm_type, uplo, n, lda, A, norm,
+                                                       batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_lansy_lanhe_template<T>(handle, norm_type, uplo, n, A, shiftA, lda, strideA,
+                                             norm, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_slansy_batched(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        float* norm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_lansy_lanhe_batched_impl<float>(handle, norm_type, uplo, n, A, lda, norm,
+                                                     batch_count);
+}
+
+rocblas_status rocsolver_dlansy_batched(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        double* norm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_lansy_lanhe_batched_impl<double>(handle, norm_type, uplo, n, A, lda, norm,
+                                                      batch_count);
+}
+
+rocblas_status rocsolver_clanhe_batched(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        float* norm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_lansy_lanhe_batched_impl<rocblas_float_complex>(handle, norm_type, uplo, n, A,
+                                                                     lda, norm, batch_count);
+}
+
+rocblas_status rocsolver_zlanhe_batched(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        double* norm,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_lansy_lanhe_batched_impl<rocblas_double_complex>(handle, norm_type, uplo, n, A,
+                                                                      lda, norm, batch_count);
+}
+
+} // extern C
@@ -12,6 +12,167 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+/** LARF_SEQUENCE_SMALL_KERNEL applies the sequence of k Householder reflectors
+    stored in A (as returned by GEQRF, GEQLF or GELQF, according to direct and storev)
+    to the m-by-n matrix C, from the side and with the operation that ORMQR, ORMQL and
+    ORMLQ (or their complex counterparts) would use. C is kept in shared memory
+    for the whole sequence, so that all the reflectors are applied with a single launch.
+    Call this kernel with batch_count groups in x, BLOCKSIZE threads, and
+    sizeof(T) * (m * n + 2 * max(m, n)) bytes of dynamic shared memory. **/
+template <typename T, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE)
+    larf_sequence_small_kernel(const rocblas_direct direct,
+                               const rocblas_storev storev,
+                               const rocblas_side side,
+                               const rocblas_operation trans,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int k,
+                               U AA,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               T* ipivA,
+                               const rocblas_stride strideP,
+                               U CC,
+                               const rocblas_int shiftC,
+                               const rocblas_int ldc,
+                               const rocblas_stride strideC)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* C = load_ptr_batch<T>(CC, b, shiftC, strideC);
+    T* ipiv = ipivA + b * strideP;
+
+    const bool left = (side == rocblas_side_left);
+    const bool transpose = (trans != rocblas_operation_none);
+    const bool colwise = (storev == rocblas_column_wise);
+    const bool backward = (direct == rocblas_backward_direction);
+    const rocblas_int nq = left ? m : n;
+    const rocblas_int mn = m * n;
+
+    // shared memory (copy of C, current householder vector, and product of C with it)
+    extern __shared__ double lmem[];
+    T* sC = (T*)lmem;
+    T* v = sC + mn;
+    T* w = v + max(m, n);
+
+    // Q = H(1)*H(2)*...*H(k) for QR, Q = H(k)*...*H(2)*H(1) for QL,
+    // and Q = H(k)'*...*H(2)'*H(1)' for LQ. With row-wise storage, the
+    // householder vectors are the conjugates of the rows of A
+    bool forward = (left == transpose);
+    if(backward || !colwise)
+        forward = !forward;
+    const bool conjtau = (transpose == colwise);
+
+    // load C
+    for(rocblas_int e = tid; e < mn; e += BLOCKSIZE)
+        sC[e] = C[(e % m) + (e / m) * ldc];
+
+    rocblas_int i, p, lo, hi;
+    T tau, temp;
+    for(rocblas_int j = 0; j < k; ++j)
+    {
+        i = forward ? j : k - 1 - j; // current householder vector
+        p = backward ? nq - k + i : i; // position of the implicit one
+        lo = backward ? 0 : p;
+        hi = backward ? p + 1 : nq;
+        tau = conjtau ? sconj(ipiv[i]) : ipiv[i];
+
+        // load the householder vector
+        for(rocblas_int r = tid; r < nq; r += BLOCKSIZE)
+        {
+            if(r == p)
+                v[r] = 1;
+            else if(r >= lo && r < hi)
+                v[r] = colwise ? A[r + i * lda] : sconj(A[i + r * lda]);
+            else
+                v[r] = 0;
+        }
+        __syncthreads();
+
+        // compute w = C'*v (left) or w = C*v (right)
+        if(left)
+        {
+            for(rocblas_int c = tid; c < n; c += BLOCKSIZE)
+            {
+                temp = 0;
+                for(rocblas_int r = lo; r < hi; ++r)
+                    temp += sconj(v[r]) * sC[r + c * m];
+                w[c] = temp;
+            }
+        }
+        else
+        {
+            for(rocblas_int r = tid; r < m; r += BLOCKSIZE)
+            {
+                temp = 0;
+                for(rocblas_int c = lo; c < hi; ++c)
+                    temp += sC[r + c * m] * v[c];
+                w[r] = temp;
+            }
+        }
+        __syncthreads();
+
+        // rank-1 update C = C - tau*v*w' (left) or C = C - tau*w*v' (right)
+        for(rocblas_int e = tid; e < mn; e += BLOCKSIZE)
+        {
+            if(left)
+                sC[e] -= tau * v[e % m] * w[e / m];
+            else
+                sC[e] -= tau * w[e % m] * sconj(v[e / m]);
+        }
+        __syncthreads();
+    }
+
+    // write back C
+    for(rocblas_int e = tid; e < mn; e += BLOCKSIZE)
+        C[(e % m) + (e / m) * ldc] = sC[e];
+}
+
+/** LARF_SEQUENCE_SMALL_FITS returns true if an m-by-n matrix C is small enough
+    to be updated with LARF_SEQUENCE_SMALL_KERNEL (i.e. if it fits in shared memory) **/
+template <typename T>
+bool larf_sequence_small_fits(const rocblas_int m, const rocblas_int n)
+{
+    size_t lmemsize = sizeof(T) * (m * n + 2 * max(m, n));
+    return m <= ORMxx_ORMxx_SMALLSIZE && n <= ORMxx_ORMxx_SMALLSIZE
+        && lmemsize <= ORMxx_ORMxx_SMALL_MAXLDS;
+}
+
+/** LARF_SEQUENCE_SMALL launches LARF_SEQUENCE_SMALL_KERNEL **/
+template <typename T, typename U>
+void rocsolver_larf_sequence_small(rocblas_handle handle,
+                                   const rocblas_direct direct,
+                                   const rocblas_storev storev,
+                                   const rocblas_side side,
+                                   const rocblas_operation trans,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int k,
+                                   U A,
+                                   const rocblas_int shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   T* ipiv,
+                                   const rocblas_stride strideP,
+                                   U C,
+                                   const rocblas_int shiftC,
+                                   const rocblas_int ldc,
+                                   const rocblas_stride strideC,
+                                   const rocblas_int batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t lmemsize = sizeof(T) * (m * n + 2 * max(m, n));
+    hipLaunchKernelGGL(larf_sequence_small_kernel<T>, dim3(batch_count, 1, 1),
+                       dim3(BLOCKSIZE, 1, 1), lmemsize, stream, direct, storev, side, trans, m, n,
+                       k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc, strideC);
+}
+
 template <typename T, bool BATCHED>
 void rocsolver_larf_getMemorySize(const rocblas_side side,
                                   const rocblas_int m,
@@ -12,55 +12,35 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+/** COPYMATV1 copies the k-by-k triangular block V1 of the matrix of Householder
+    vectors into tmptr as a full matrix, with ones in the diagonal and zeros in
+    the opposite triangle, so that V1 can be used directly as a gemm operand. **/
 template <typename T, typename U>
-__global__ void copymatA1(const rocblas_int ldw,
-                          const rocblas_int order,
-                          U A,
-                          const rocblas_int shiftA,
-                          const rocblas_int lda,
-                          const rocblas_stride strideA,
+__global__ void copymatV1(const rocblas_int k,
+                          const rocblas_fill uploV,
+                          U V,
+                          const rocblas_int shiftV,
+                          const rocblas_int ldv,
+                          const rocblas_stride strideV,
                           T* tmptr)
 {
-    const auto blocksizex = hipBlockDim_x;
-    const auto blocksizey = hipBlockDim_y;
     const auto b = hipBlockIdx_z;
-    const auto j = hipBlockIdx_x * blocksizex + hipThreadIdx_x;
-    const auto i = hipBlockIdx_y * blocksizey + hipThreadIdx_y;
-    rocblas_stride strideW = rocblas_stride(ldw) * order;
-
-    if(i < ldw && j < order)
-    {
-        T *Ap, *Wp;
-        Wp = tmptr + b * strideW;
-        Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
-
-        Wp[i + j * ldw] = Ap[i + j * lda];
-    }
-}
-
-template <typename T, typename U>
-__global__ void addmatA1(const rocblas_int ldw,
-                         const rocblas_int order,
-                         U A,
-                         const rocblas_int shiftA,
-                         const rocblas_int lda,
-                         const rocblas_stride strideA,
-                         T* tmptr)
-{
-    const auto blocksizex = hipBlockDim_x;
-    const auto blocksizey = hipBlockDim_y;
-    const auto b = hipBlockIdx_z;
-    const auto j = hipBlockIdx_x * blocksizex + hipThreadIdx_x;
-    const auto i = hipBlockIdx_y * blocksizey + hipThreadIdx_y;
-    rocblas_stride strideW = rocblas_stride(ldw) * order;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_stride strideW = rocblas_stride(k) * k;
 
-    if(i < ldw && j < order)
+    if(i < k && j < k)
     {
-        T *Ap, *Wp;
+        T *Vp, *Wp;
         Wp = tmptr + b * strideW;
-        Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        Vp = load_ptr_batch<T>(V, b, shiftV, strideV);
 
-        Ap[i + j * lda] -= Wp[i + j * ldw];
+        if(i == j)
+            Wp[i + j * k] = 1;
+        else if((uploV == rocblas_fill_lower && i > j) || (uploV == rocblas_fill_upper && i < j))
+            Wp[i + j * k] = Vp[i + j * ldv];
+        else
+            Wp[i + j * k] = 0;
     }
 }
 
@@ -81,17 +61,18 @@ void rocsolver_larfb_getMemorySize(const rocblas_side side,
         return;
     }
 
-    // size of temporary array for computations with
-    // triangular part of V
+    // size of temporary array for the product of V and A,
+    // plus a copy of the triangular part of V
     if(side == rocblas_side_left)
         *size_tmptr = n;
     else
         *size_tmptr = m;
-    *size_tmptr *= sizeof(T) * k * batch_count;
+    *size_tmptr = sizeof(T) * k * (*size_tmptr + k) * batch_count;
 
     // size of array of pointers to workspace
+    // (gemm calls with two workspace operands need two arrays)
     if(BATCHED)
-        *size_workArr = sizeof(T*) * batch_count;
+        *size_workArr = sizeof(T*) * 2 * batch_count;
     else
         *size_workArr = 0;
 }
@@ -190,6 +171,7 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
 
     // constants to use when calling rocablas functions
     T minone = -1;
+    T zero = 0;
     T one = 1;
 
     // determine the side, size of workspace
@@ -286,17 +268,24 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     rocblas_stride strideW = rocblas_stride(ldw) * order;
     uploT = (forward ? rocblas_fill_upper : rocblas_fill_lower);
 
-    // copy A1 to tmptr
-    rocblas_int blocksx = (order - 1) / 32 + 1;
-    rocblas_int blocksy = (ldw - 1) / 32 + 1;
-    hipLaunchKernelGGL(copymatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream, ldw,
-                       order, A, offsetA1, lda, strideA, tmptr);
+    // copy the triangular part of V1 to the workspace, so that
+    // A1 does not have to be copied and V1 can be used in gemm calls
+    T* V1 = tmptr + strideW * batch_count;
+    rocblas_stride strideV1 = rocblas_stride(k) * k;
+    rocblas_int blocks = (k - 1) / 32 + 1;
+    hipLaunchKernelGGL(copymatV1<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream, k,
+                       uploV, V, offsetV1, ldv, strideV, V1);
 
     // compute: V1' * A1
     //   or    A1 * V1
-    rocblasCall_trmm<BATCHED, STRIDED, T>(handle, side, uploV, transp, rocblas_diagonal_unit, ldw,
-                                          order, &one, 0, V, offsetV1, ldv, strideV, tmptr, 0, ldw,
-                                          strideW, batch_count, workArr);
+    if(leftside)
+        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, transp, rocblas_operation_none, ldw, order, k,
+                                              &one, V1, 0, k, strideV1, A, offsetA1, lda, strideA,
+                                              &zero, tmptr, 0, ldw, strideW, batch_count, workArr);
+    else
+        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, rocblas_operation_none, transp, ldw, order, k,
+                                              &one, A, offsetA1, lda, strideA, V1, 0, k, strideV1,
+                                              &zero, tmptr, 0, ldw, strideW, batch_count, workArr);
 
     // compute: V1' * A1 + V2' * A2
     //    or    A1 * V1 + A2 * V2
@@ -341,16 +330,18 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                                                   strideA, batch_count, workArr);
     }
 
-    // compute: V1 * trans(T) * (V1' * A1 + V2' * A2)
-    //    or    (A1 * V1 + A2 * V2) * trans(T) * V1'
-    rocblasCall_trmm<BATCHED, STRIDED, T>(handle, side, uploV, transp, rocblas_diagonal_unit, ldw,
-                                          order, &one, 0, V, offsetV1, ldv, strideV, tmptr, 0, ldw,
-                                          strideW, batch_count, workArr);
-
     // compute: A1 - V1 * trans(T) * (V1' * A1 + V2' * A2)
     //    or    A1 - (A1 * V1 + A2 * V2) * trans(T) * V1'
-    hipLaunchKernelGGL(addmatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream, ldw,
-                       order, A, offsetA1, lda, strideA, tmptr);
+    if(leftside)
+        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, transp, rocblas_operation_none, ldw, order, k,
+                                              &minone, V1, 0, k, strideV1, tmptr, 0, ldw, strideW,
+                                              &one, A, offsetA1, lda, strideA, batch_count,
+                                              workArr);
+    else
+        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, rocblas_operation_none, transp, ldw, order, k,
+                                              &minone, tmptr, 0, ldw, strideW, V1, 0, k, strideV1,
+                                              &one, A, offsetA1, lda, strideA, batch_count,
+                                              workArr);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
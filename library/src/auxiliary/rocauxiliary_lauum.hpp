@@ -0,0 +1,219 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** LAUU2_KERNEL_SMALL computes the product U * U' (or L' * L) of an n-by-n
+    triangular matrix (n <= DIM) using register arrays. The lower triangular
+    case works with the conjugate transpose of L.
+    Call this kernel with DIM threads per group. **/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(WAVESIZE) lauu2_kernel_small(const rocblas_fill uplo,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA)
+{
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // shared memory (for communication between threads in group)
+    __shared__ T common[DIM];
+
+    // read corresponding row (upper) or column (lower) from global memory
+    T rA[DIM];
+    tri_load_regs<DIM>(upper, i, n, A, lda, rA);
+    if(!upper)
+    {
+#pragma unroll
+        for(rocblas_int j = 0; j < DIM; j++)
+            rA[j] = sconj(rA[j]);
+    }
+
+    lauu2_regs<DIM>(i, rA, common);
+
+    // write results to global memory from local array
+    if(!upper)
+    {
+#pragma unroll
+        for(rocblas_int j = 0; j < DIM; j++)
+            rA[j] = sconj(rA[j]);
+    }
+    tri_store_regs<DIM>(upper, false, i, n, A, lda, rA);
+}
+
+template <typename T, typename U>
+void lauu2_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     const rocblas_int batch_count)
+{
+#define RUN_LAUU2_SMALL(DIM)                                                                     \
+    hipLaunchKernelGGL((lauu2_kernel_small<DIM, T>), grid, block, 0, stream, uplo, n, A, shiftA, \
+                       lda, strideA)
+
+    rocblas_int dim = tri_small_dim(n);
+    dim3 grid(batch_count, 1, 1);
+    dim3 block(dim, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size of the register arrays known at
+    // compile time
+    switch(dim)
+    {
+    case 8: RUN_LAUU2_SMALL(8); break;
+    case 16: RUN_LAUU2_SMALL(16); break;
+    case 32: RUN_LAUU2_SMALL(32); break;
+    case 64: RUN_LAUU2_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_lauum_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(n && !A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename S, typename T, typename U>
+rocblas_status rocsolver_lauum_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lauum", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // if the matrix is small, compute the product with a single kernel
+    if(n <= LAUUM_SWITCHSIZE)
+    {
+        lauu2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, batch_count);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T t_one = 1;
+    S s_one = 1;
+
+    rocblas_int jb, nb = LAUUM_BLOCKSIZE;
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // Compute the product U * U'
+        for(rocblas_int j = 0; j < n; j += nb)
+        {
+            jb = min(n - j, nb);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, j, jb, &t_one, 0, A, shiftA + idx2D(j, j, lda), lda,
+                strideA, A, shiftA + idx2D(0, j, lda), lda, strideA, batch_count);
+
+            lauu2_run_small<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                               batch_count);
+
+            if(j + jb < n)
+            {
+                rocblasCall_gemm<BATCHED, STRIDED>(
+                    handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, j, jb,
+                    n - j - jb, &t_one, A, shiftA + idx2D(0, j + jb, lda), lda, strideA, A,
+                    shiftA + idx2D(j, j + jb, lda), lda, strideA, &t_one, A,
+                    shiftA + idx2D(0, j, lda), lda, strideA, batch_count, (T**)nullptr);
+
+                rocblasCall_syrk_herk<S, T>(handle, uplo, rocblas_operation_none, jb, n - j - jb,
+                                            &s_one, A, shiftA + idx2D(j, j + jb, lda), lda, strideA,
+                                            &s_one, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                            batch_count);
+            }
+        }
+    }
+    else
+    {
+        // Compute the product L' * L
+        for(rocblas_int j = 0; j < n; j += nb)
+        {
+            jb = min(n - j, nb);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, jb, j, &t_one, 0, A, shiftA + idx2D(j, j, lda), lda,
+                strideA, A, shiftA + idx2D(j, 0, lda), lda, strideA, batch_count);
+
+            lauu2_run_small<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                               batch_count);
+
+            if(j + jb < n)
+            {
+                rocblasCall_gemm<BATCHED, STRIDED>(
+                    handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, jb, j,
+                    n - j - jb, &t_one, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, A,
+                    shiftA + idx2D(j + jb, 0, lda), lda, strideA, &t_one, A,
+                    shiftA + idx2D(j, 0, lda), lda, strideA, batch_count, (T**)nullptr);
+
+                rocblasCall_syrk_herk<S, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, jb, n - j - jb, &s_one, A,
+                    shiftA + idx2D(j + jb, j, lda), lda, strideA, &s_one, A,
+                    shiftA + idx2D(j, j, lda), lda, strideA, batch_count);
+            }
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
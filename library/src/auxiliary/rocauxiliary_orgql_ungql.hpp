@@ -37,7 +37,7 @@ void rocsolver_orgql_ungql_getMemorySize(const rocblas_int m,
         return;
     }
 
-    size_t temp, unused;
+    size_t temp, w, unused;
     rocsolver_org2l_ung2l_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
                                                     size_Abyx_tmptr, size_workArr);
 
@@ -57,9 +57,10 @@ void rocsolver_orgql_ungql_getMemorySize(const rocblas_int m,
         // size of Abyx_tmptr is maximum of what is needed by org2r/ung2r and larfb.
         rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &unused, size_work, &unused);
         rocsolver_larfb_getMemorySize<T, BATCHED>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &temp, &unused);
+                                                  &temp, &w);
 
         *size_Abyx_tmptr = *size_Abyx_tmptr >= temp ? *size_Abyx_tmptr : temp;
+        *size_workArr = max(*size_workArr, w);
 
         // size of temporary array for triangular factor
         *size_trfact = sizeof(T) * jb * jb * batch_count;
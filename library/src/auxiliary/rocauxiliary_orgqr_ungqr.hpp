@@ -15,6 +15,71 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+/** ORGQR_UNGQR_GENBLOCK overwrites the m-by-k matrix V of householder vectors
+    (as returned by GEQRF) with the first k columns of the block reflector
+    H = I - V * T * V'. The identity is never formed explicitly: with V1 the
+    unit lower triangular top of V, and W = T * V1', the result is computed
+    as [I - V1 * W; -V2 * W]. trfact must contain the triangular factor T
+    (as returned by LARFT), and tmptr must hold 2*k*k elements per batch instance. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void rocsolver_orgqr_ungqr_genblock(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int k,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    T* trfact,
+                                    const rocblas_int ldt,
+                                    const rocblas_stride strideT,
+                                    const rocblas_int batch_count,
+                                    T* tmptr,
+                                    T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T zero = 0;
+    T minone = -1;
+
+    rocblas_stride strideW = rocblas_stride(k) * k;
+    T* W = tmptr;
+    T* V1 = tmptr + strideW * batch_count;
+    rocblas_int blocks = (k - 1) / 32 + 1;
+
+    // copy V1 to the workspace (with explicit ones in the diagonal)
+    hipLaunchKernelGGL(copymatV1<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream, k,
+                       rocblas_fill_lower, A, shiftA, lda, strideA, V1);
+
+    // compute W = T * V1' (upper triangular)
+    rocblasCall_gemm<false, true, T>(handle, rocblas_operation_none,
+                                     rocblas_operation_conjugate_transpose, k, k, k, &one, trfact,
+                                     0, ldt, strideT, V1, 0, k, strideW, &zero, W, 0, k, strideW,
+                                     batch_count, workArr);
+
+    // compute the bottom part -V2 * W (in place)
+    if(m > k)
+        rocblasCall_trmm<BATCHED, STRIDED, T>(handle, rocblas_side_right, rocblas_fill_upper,
+                                              rocblas_operation_none, rocblas_diagonal_non_unit,
+                                              m - k, k, &minone, 0, W, 0, k, strideW, A,
+                                              shiftA + idx2D(k, 0, lda), lda, strideA, batch_count,
+                                              workArr);
+
+    // compute the top part I - V1 * W
+    hipLaunchKernelGGL(init_ident<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
+                       k, k, A, shiftA, lda, strideA);
+    rocblasCall_gemm<BATCHED, STRIDED, T>(handle, rocblas_operation_none, rocblas_operation_none, k,
+                                          k, k, &minone, V1, 0, k, strideW, W, 0, k, strideW, &one,
+                                          A, shiftA, lda, strideA, batch_count, workArr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+}
+
 template <typename T, bool BATCHED>
 void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
                                          const rocblas_int n,
@@ -37,7 +102,7 @@ void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
         return;
     }
 
-    size_t temp, unused;
+    size_t temp, w, unused;
     rocsolver_org2r_ung2r_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
                                                     size_Abyx_tmptr, size_workArr);
 
@@ -57,9 +122,11 @@ void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
         // size of Abyx_tmptr is maximum of what is needed by org2r/ung2r and larfb.
         rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &unused, size_work, &unused);
         rocsolver_larfb_getMemorySize<T, BATCHED>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &temp, &unused);
+                                                  &temp, &w);
 
         *size_Abyx_tmptr = *size_Abyx_tmptr >= temp ? *size_Abyx_tmptr : temp;
+        *size_Abyx_tmptr = max(*size_Abyx_tmptr, sizeof(T) * 2 * jb * jb * batch_count);
+        *size_workArr = max(*size_workArr, w);
 
         // size of temporary array for triangular factor
         *size_trfact = sizeof(T) * jb * jb * batch_count;
@@ -128,15 +195,16 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     // compute the blocked part
     while(j >= 0)
     {
+        // compute the triangular factor of the current block reflector
+        rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, m - j,
+                                    jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j),
+                                    strideP, trfact, ldw, strideW, batch_count, scalars, work,
+                                    workArr);
+
         // first update the already computed part
-        // applying the current block reflector using larft + larfb
+        // (only the columns to the right of the current block are affected)
         if(j + jb < n)
         {
-            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
-                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        (ipiv + j), strideP, trfact, ldw, strideW, batch_count,
-                                        scalars, work, workArr);
-
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
                 handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
                 rocblas_column_wise, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda,
@@ -153,9 +221,9 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
             hipLaunchKernelGGL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
                                stream, j, jb, A, shiftA + idx2D(0, j, lda), lda, strideA);
         }
-        rocsolver_org2r_ung2r_template<T>(handle, m - j, jb, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                          strideA, (ipiv + j), strideP, batch_count, scalars,
-                                          Abyx_tmptr, workArr);
+        rocsolver_orgqr_ungqr_genblock<BATCHED, STRIDED, T>(
+            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, trfact, ldw, strideW,
+            batch_count, Abyx_tmptr, workArr);
 
         j -= jb;
     }
@@ -119,6 +119,15 @@ rocblas_status rocsolver_orm2l_unm2l_template(rocblas_handle handle,
     if(!n || !m || !k || !batch_count)
         return rocblas_status_success;
 
+    // if C is small, apply all the reflectors with a single kernel launch
+    if(larf_sequence_small_fits<T>(m, n))
+    {
+        rocsolver_larf_sequence_small<T>(handle, rocblas_backward_direction, rocblas_column_wise,
+                                         side, trans, m, n, k, A, shiftA, lda, strideA, ipiv,
+                                         strideP, C, shiftC, ldc, strideC, batch_count);
+        return rocblas_status_success;
+    }
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -38,7 +38,7 @@ void rocsolver_ormql_unmql_getMemorySize(const rocblas_side side,
         return;
     }
 
-    size_t unused;
+    size_t w, unused;
     rocsolver_orm2l_unm2l_getMemorySize<T, BATCHED>(side, m, n, k, batch_count, size_scalars,
                                                     size_AbyxORwork, size_diagORtmptr, size_workArr);
 
@@ -52,7 +52,8 @@ void rocsolver_ormql_unmql_getMemorySize(const rocblas_side side,
 
         // requirements for calling larfb
         rocsolver_larfb_getMemorySize<T, BATCHED>(side, m, n, min(jb, k), batch_count,
-                                                  size_diagORtmptr, &unused);
+                                                  size_diagORtmptr, &w);
+        *size_workArr = max(*size_workArr, w);
 
         // size of temporary array for triangular factor
         *size_trfact = sizeof(T) * jb * jb * batch_count;
@@ -97,7 +98,8 @@ rocblas_status rocsolver_ormql_unmql_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= ORMxx_ORMxx_BLOCKSIZE)
+    // (which applies all the reflectors at once when C fits in shared memory)
+    if(k <= ORMxx_ORMxx_BLOCKSIZE || larf_sequence_small_fits<T>(m, n))
         return rocsolver_orm2l_unm2l_template<T>(
             handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
             strideC, batch_count, scalars, AbyxORwork, diagORtmptr, workArr);
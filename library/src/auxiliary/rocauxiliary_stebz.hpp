@@ -0,0 +1,423 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_sterf.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+  STEBZ computes selected eigenvalues of a symmetric tridiagonal matrix by
+  bisection with Sturm counts. The off-diagonal elements that are negligible
+  are set to zero in a squared copy of E, so that the Sturm counts of the entire
+  matrix are the sums of the counts of its independent sub-blocks. Each thread
+  then finds one of the selected eigenvalues (the k-th thread the k-th smallest
+  one) and the sub-block it belongs to, independently of all other threads.
+***************************************************************************/
+
+/** STEBZ_SETUP_KERNEL determines the split points of the tridiagonal matrix, the
+    squared off-diagonal elements (stored in the workspace), the bounds of the
+    spectrum, the minimum pivot in the Sturm sequences and the absolute tolerance.
+    It also determines the range [klo, khi) of indices of the eigenvalues to compute.
+    Call this kernel with batch_count groups in y, and BLOCKSIZE threads in x **/
+template <typename T>
+__global__ void stebz_setup_kernel(const rocblas_erange erange,
+                                   const rocblas_int n,
+                                   const T vl,
+                                   const T vu,
+                                   const rocblas_int il,
+                                   const rocblas_int iu,
+                                   const T abstol,
+                                   T* DD,
+                                   const rocblas_stride strideD,
+                                   T* EE,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* nevA,
+                                   rocblas_int* nsplitA,
+                                   rocblas_int* isplitA,
+                                   const rocblas_stride strideIsplit,
+                                   T* work,
+                                   rocblas_int* iwork,
+                                   const T eps,
+                                   const T sfmin)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+    rocblas_int* isplit = isplitA + (bid * strideIsplit);
+    T* ee = work + (bid * (2 * n + 4));
+    T* params = ee + 2 * n;
+    rocblas_int* range = iwork + (bid * (2 * n + 2)) + 2 * n;
+
+    __shared__ T sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // squared off-diagonal, zeroed at the split points, and Gershgorin bounds
+    T emax = 0;
+    T gl = D[0];
+    T gu = D[0];
+    rocblas_int idx = 0;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        T r = 0;
+        if(i > 0)
+            r += abs(E[i - 1]);
+        if(i < n - 1)
+        {
+            T e = E[i] * E[i];
+            r += abs(E[i]);
+            if(abs(D[i] * D[i + 1]) * eps * eps + sfmin > e)
+                ee[i] = 0;
+            else
+            {
+                ee[i] = e;
+                emax = max(emax, e);
+            }
+        }
+        gl = min(gl, D[i] - r);
+        gu = max(gu, D[i] + r);
+    }
+    emax = block_reduce_max(emax, idx, sval, sidx);
+    gl = -block_reduce_max(-gl, idx, sval, sidx);
+    gu = block_reduce_max(gu, idx, sval, sidx);
+
+    // widen the interval to be safe from rounding
+    T pivmin = sfmin * max(T(1), emax);
+    T tnorm = max(abs(gl), abs(gu));
+    gl = gl - T(2.1) * tnorm * eps * n - T(4.2) * pivmin;
+    gu = gu + T(2.1) * tnorm * eps * n + T(4.2) * pivmin;
+
+    if(tid == 0)
+    {
+        params[0] = gl;
+        params[1] = gu;
+        params[2] = pivmin;
+        params[3] = (abstol <= 0 ? eps * tnorm : abstol);
+
+        // split points (1-based indices of the last row of every block)
+        rocblas_int nsplit = 0;
+        for(rocblas_int i = 0; i < n - 1; i++)
+        {
+            if(ee[i] == 0)
+                isplit[nsplit++] = i + 1;
+        }
+        isplit[nsplit++] = n;
+        nsplitA[bid] = nsplit;
+
+        // range of indices of the eigenvalues to compute
+        rocblas_int klo, khi;
+        if(erange == rocblas_erange_index)
+        {
+            klo = il - 1;
+            khi = iu;
+        }
+        else if(erange == rocblas_erange_value)
+        {
+            klo = sterf_sturm_count(n, D, ee, vl, pivmin);
+            khi = sterf_sturm_count(n, D, ee, vu, pivmin);
+        }
+        else
+        {
+            klo = 0;
+            khi = n;
+        }
+
+        range[0] = klo;
+        range[1] = khi;
+        nevA[bid] = khi - klo;
+    }
+}
+
+/** STEBZ_BISECT_KERNEL computes the selected eigenvalues by bisection, together with
+    the (1-based) index of the sub-block each of them belongs to. The results are
+    stored in the workspace in increasing order.
+    Call this kernel with batch_count groups in y, and enough groups of BLOCKSIZE
+    threads in x to cover the n eigenvalues **/
+template <typename T>
+__global__ void stebz_bisect_kernel(const rocblas_erange erange,
+                                    const rocblas_int n,
+                                    const T vl,
+                                    const T vu,
+                                    T* DD,
+                                    const rocblas_stride strideD,
+                                    rocblas_int* nsplitA,
+                                    rocblas_int* isplitA,
+                                    const rocblas_stride strideIsplit,
+                                    T* work,
+                                    rocblas_int* iwork,
+                                    const T eps)
+{
+    rocblas_int kk = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    T* ee = work + (bid * (2 * n + 4));
+    T* tmpW = ee + n;
+    T* params = ee + 2 * n;
+    rocblas_int* tmpI = iwork + (bid * (2 * n + 2));
+    rocblas_int* range = tmpI + 2 * n;
+
+    rocblas_int k = range[0] + kk;
+    if(k < range[1])
+    {
+        T* D = DD + (bid * strideD);
+        rocblas_int* isplit = isplitA + (bid * strideIsplit);
+        rocblas_int nsplit = nsplitA[bid];
+
+        T pivmin = params[2];
+        T atol = params[3];
+        T lo = params[0];
+        T hi = params[1];
+        if(erange == rocblas_erange_value)
+        {
+            lo = max(lo, vl);
+            hi = min(hi, vu);
+        }
+
+        // bisection
+        T mid;
+        while(hi - lo > max(max(atol, pivmin), 2 * eps * max(abs(lo), abs(hi))))
+        {
+            mid = (lo + hi) / 2;
+            if(mid <= lo || mid >= hi)
+                break;
+
+            if(sterf_sturm_count(n, D, ee, mid, pivmin) > k)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        // find the sub-block containing the eigenvalue: the eigenvalues in (lo, hi] are
+        // assigned to the sub-blocks in order
+        rocblas_int c = k - sterf_sturm_count(n, D, ee, lo, pivmin);
+        rocblas_int ib = nsplit;
+        rocblas_int start = 0;
+        for(rocblas_int b = 0; b < nsplit; b++)
+        {
+            rocblas_int m = isplit[b] - start;
+            rocblas_int nb = sterf_sturm_count(m, D + start, ee + start, hi, pivmin)
+                - sterf_sturm_count(m, D + start, ee + start, lo, pivmin);
+            if(c < nb)
+            {
+                ib = b + 1;
+                break;
+            }
+            c -= nb;
+            start = isplit[b];
+        }
+
+        tmpW[kk] = (lo + hi) / 2;
+        tmpI[kk] = ib;
+    }
+}
+
+/** STEBZ_ORDER_KERNEL copies the computed eigenvalues and block indices into W and
+    iblock, either in increasing order or grouped by sub-blocks.
+    Call this kernel with batch_count groups in y, and BLOCKSIZE threads in x **/
+template <typename T>
+__global__ void stebz_order_kernel(const rocblas_eorder eorder,
+                                   const rocblas_int n,
+                                   rocblas_int* nevA,
+                                   rocblas_int* nsplitA,
+                                   T* WW,
+                                   const rocblas_stride strideW,
+                                   rocblas_int* iblockA,
+                                   const rocblas_stride strideIblock,
+                                   T* work,
+                                   rocblas_int* iwork)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    T* W = WW + (bid * strideW);
+    rocblas_int* iblock = iblockA + (bid * strideIblock);
+    T* tmpW = work + (bid * (2 * n + 4)) + n;
+    rocblas_int* tmpI = iwork + (bid * (2 * n + 2));
+    rocblas_int* offs = tmpI + n;
+    rocblas_int nev = nevA[bid];
+
+    if(eorder == rocblas_eorder_entire || nsplitA[bid] == 1)
+    {
+        for(rocblas_int i = tid; i < nev; i += BLOCKSIZE)
+        {
+            W[i] = tmpW[i];
+            iblock[i] = tmpI[i];
+        }
+    }
+    else if(tid == 0)
+    {
+        // stable counting sort by block index
+        rocblas_int nsplit = nsplitA[bid];
+        for(rocblas_int b = 0; b < nsplit; b++)
+            offs[b] = 0;
+        for(rocblas_int i = 0; i < nev; i++)
+            offs[tmpI[i] - 1]++;
+
+        rocblas_int p = 0;
+        for(rocblas_int b = 0; b < nsplit; b++)
+        {
+            rocblas_int c = offs[b];
+            offs[b] = p;
+            p += c;
+        }
+
+        for(rocblas_int i = 0; i < nev; i++)
+        {
+            p = offs[tmpI[i] - 1]++;
+            W[p] = tmpW[i];
+            iblock[p] = tmpI[i];
+        }
+    }
+}
+
+template <typename T>
+void rocsolver_stebz_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_iwork)
+{
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work = 0;
+        *size_iwork = 0;
+        return;
+    }
+
+    // size of workspace (squared off-diagonal, computed eigenvalues and parameters)
+    *size_work = sizeof(T) * (2 * n + 4) * batch_count;
+
+    // size of integer workspace (computed block indices, offsets and index range)
+    *size_iwork = sizeof(rocblas_int) * (2 * n + 2) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_stebz_argCheck(rocblas_handle handle,
+                                        const rocblas_erange erange,
+                                        const rocblas_eorder eorder,
+                                        const rocblas_int n,
+                                        const T vl,
+                                        const T vu,
+                                        const rocblas_int il,
+                                        const rocblas_int iu,
+                                        T* D,
+                                        T* E,
+                                        rocblas_int* nev,
+                                        rocblas_int* nsplit,
+                                        T* W,
+                                        rocblas_int* iblock,
+                                        rocblas_int* isplit,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(erange != rocblas_erange_all && erange != rocblas_erange_value
+       && erange != rocblas_erange_index)
+        return rocblas_status_invalid_value;
+    if(eorder != rocblas_eorder_blocks && eorder != rocblas_eorder_entire)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_value && vl >= vu)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (il < 1 || iu < 0))
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (iu > n || (n > 0 && il > iu)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || !nev || !nsplit || (n && !W) || (n && !iblock) || (n && !isplit)
+       || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_stebz_template(rocblas_handle handle,
+                                        const rocblas_erange erange,
+                                        const rocblas_eorder eorder,
+                                        const rocblas_int n,
+                                        const T vl,
+                                        const T vu,
+                                        const rocblas_int il,
+                                        const rocblas_int iu,
+                                        const T abstol,
+                                        T* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        T* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* nev,
+                                        rocblas_int* nsplit,
+                                        T* W,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* iblock,
+                                        const rocblas_stride strideIblock,
+                                        rocblas_int* isplit,
+                                        const rocblas_stride strideIsplit,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* work,
+                                        rocblas_int* iwork)
+{
+    ROCSOLVER_ENTER("stebz", "erange:", erange, "eorder:", eorder, "n:", n, "vl:", vl, "vu:", vu,
+                    "il:", il, "iu:", iu, "abstol:", abstol, "shiftD:", shiftD,
+                    "shiftE:", shiftE, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0 (bisection always converges)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+    {
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nev, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nsplit, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    T eps = get_epsilon<T>();
+    T sfmin = get_safemin<T>();
+
+    hipLaunchKernelGGL(stebz_setup_kernel<T>, dim3(1, batch_count), threads, 0, stream, erange, n,
+                       vl, vu, il, iu, abstol, D + shiftD, strideD, E + shiftE, strideE, nev,
+                       nsplit, isplit, strideIsplit, work, iwork, eps, sfmin);
+
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(stebz_bisect_kernel<T>, dim3(blocks, batch_count), threads, 0, stream,
+                       erange, n, vl, vu, D + shiftD, strideD, nsplit, isplit, strideIsplit, work,
+                       iwork, eps);
+
+    hipLaunchKernelGGL(stebz_order_kernel<T>, dim3(1, batch_count), threads, 0, stream, eorder, n,
+                       nev, nsplit, W, strideW, iblock, strideIblock, work, iwork);
+
+    return rocblas_status_success;
+}
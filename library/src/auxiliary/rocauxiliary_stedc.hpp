@@ -0,0 +1,926 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocauxiliary_steqr.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+  STEDC implements Cuppen's divide and conquer method. The tridiagonal matrix
+  is split (torn) into independent sub-blocks of size at most STEDC_MIN_DC_SIZE
+  that are solved with steqr (one thread per sub-block). The sub-blocks are then
+  merged back pairwise, following a balanced binary tree. Every merge solves the
+  secular equation of a rank-one modification (one thread per eigenvalue) and
+  updates the eigenvectors with a gemm call.
+***************************************************************************/
+
+/** STEDC_SPLIT returns the index of the first row of the j-th of the nleaves
+    sub-blocks in which a matrix of order n is divided **/
+__host__ __device__ inline rocblas_int
+    stedc_split(const rocblas_int j, const rocblas_int n, const rocblas_int nleaves)
+{
+    return rocblas_int((rocblas_stride(j) * n) / nleaves);
+}
+
+/** STEDC_REAL_VIEW returns a pointer to the real array that stores the entries of A
+    (a complex array of size m-by-n is seen as a real array of size 2m-by-n) **/
+template <typename S, typename T>
+S* stedc_real_view(T* A)
+{
+    return reinterpret_cast<S*>(A);
+}
+
+template <typename S, typename T>
+S* const* stedc_real_view(T* const* A)
+{
+    return reinterpret_cast<S* const*>(A);
+}
+
+/** STEDC_SECULAR computes the i-th root lambda of the secular equation
+    1/rho + sum_j z_j^2 / (d_j - lambda) = 0, where d is a vector of size k
+    sorted in increasing order. The root is returned as lambda = d[org] + tau,
+    with d[org] the closest pole, so that all the differences d_j - lambda can be
+    computed accurately. The iterations use a rational model of the secular function
+    with poles at the two ends of the interval, safeguarded by bisection. **/
+template <typename S>
+__device__ void stedc_secular(const rocblas_int k,
+                              const rocblas_int i,
+                              const S* d,
+                              const S* z,
+                              const S rho,
+                              const S eps,
+                              rocblas_int& org,
+                              S& tau)
+{
+    const S rhoinv = 1 / rho;
+
+    if(k == 1)
+    {
+        org = 0;
+        tau = rho * z[0] * z[0];
+        return;
+    }
+
+    // determine the poles of the model, the origin and the initial bracket
+    rocblas_int ilo, ihi;
+    S tlo, thi;
+    if(i < k - 1)
+    {
+        ilo = i;
+        ihi = i + 1;
+        S mid = (d[i + 1] - d[i]) / 2;
+        S w = rhoinv;
+        for(rocblas_int j = 0; j < k; j++)
+            w += z[j] * z[j] / ((d[j] - d[i]) - mid);
+
+        if(w >= 0)
+        {
+            org = i;
+            tlo = 0;
+            thi = mid;
+        }
+        else
+        {
+            org = i + 1;
+            tlo = -mid;
+            thi = 0;
+        }
+    }
+    else
+    {
+        ilo = k - 2;
+        ihi = k - 1;
+        org = k - 1;
+        S zz = 0;
+        for(rocblas_int j = 0; j < k; j++)
+            zz += z[j] * z[j];
+        tlo = 0;
+        thi = rho * zz;
+    }
+    tau = (tlo + thi) / 2;
+
+    for(rocblas_int iter = 0; iter < STEDC_MAX_SECULAR_ITERS; iter++)
+    {
+        // evaluate the secular function and its derivative
+        S psi = 0, phi = 0, dpsi = 0, dphi = 0;
+        for(rocblas_int j = 0; j < k; j++)
+        {
+            S t = z[j] / ((d[j] - d[org]) - tau);
+            if(j <= ilo)
+            {
+                psi += z[j] * t;
+                dpsi += t * t;
+            }
+            else
+            {
+                phi += z[j] * t;
+                dphi += t * t;
+            }
+        }
+        S w = rhoinv + psi + phi;
+
+        // check convergence
+        if(abs(w) <= eps * (8 * (abs(psi) + abs(phi)) + 2 * rhoinv))
+            break;
+
+        // update bracket (the secular function is increasing)
+        if(w < 0)
+            tlo = tau;
+        else
+            thi = tau;
+
+        // solve the model a + b / (dlo - eta) + c / (dhi - eta) = 0
+        S dlo = (d[ilo] - d[org]) - tau;
+        S dhi = (d[ihi] - d[org]) - tau;
+        S a = rhoinv + psi - dpsi * dlo + phi - dphi * dhi;
+        S qb = a * (dlo + dhi) + dpsi * dlo * dlo + dphi * dhi * dhi;
+        S qc = dlo * dhi * w;
+        S disc = sqrt(max(qb * qb - 4 * a * qc, S(0)));
+        S den = (qb >= 0 ? qb + disc : qb - disc);
+
+        // take the root of the model closest to the current iterate if it is in the bracket;
+        // otherwise bisect
+        S tnew = (tlo + thi) / 2;
+        if(den != 0 && tau + 2 * qc / den > tlo && tau + 2 * qc / den < thi)
+            tnew = tau + 2 * qc / den;
+        else if(a != 0 && tau + den / (2 * a) > tlo && tau + den / (2 * a) < thi)
+            tnew = tau + den / (2 * a);
+
+        if(tnew == tau)
+            break;
+        tau = tnew;
+    }
+}
+
+/** STEDC_SCALE_KERNEL scales the tridiagonal matrix given by D and E so that its
+    largest entry is one, and applies the rank-one tears that split the matrix
+    into nleaves independent sub-blocks. Call this kernel with BLOCKSIZE threads
+    and one group per batch instance. **/
+template <typename S>
+__global__ void stedc_scale_kernel(const rocblas_int n,
+                                   const rocblas_int nleaves,
+                                   S* DD,
+                                   const rocblas_stride strideD,
+                                   S* EE,
+                                   const rocblas_stride strideE,
+                                   S* scal)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // find max absolute value
+    S nrm = 0;
+    rocblas_int idx = 0;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        nrm = max(nrm, abs(D[i]));
+        if(i < n - 1)
+            nrm = max(nrm, abs(E[i]));
+    }
+    nrm = block_reduce_max(nrm, idx, sval, sidx);
+
+    // scale
+    if(nrm != 0)
+    {
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+        {
+            D[i] = D[i] / nrm;
+            if(i < n - 1)
+                E[i] = E[i] / nrm;
+        }
+    }
+    if(tid == 0)
+        scal[bid] = nrm;
+    __syncthreads();
+
+    // tear matrix
+    for(rocblas_int j = tid + 1; j < nleaves; j += BLOCKSIZE)
+    {
+        rocblas_int k = stedc_split(j, n, nleaves);
+        S beta = abs(E[k - 1]);
+        D[k - 1] -= beta;
+        D[k] -= beta;
+    }
+}
+
+/** STEDC_UNSCALE_KERNEL restores the scaling of the eigenvalues **/
+template <typename S>
+__global__ void stedc_unscale_kernel(const rocblas_int n,
+                                     S* DD,
+                                     const rocblas_stride strideD,
+                                     S* scal)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && scal[bid] != 0)
+        DD[i + bid * strideD] *= scal[bid];
+}
+
+/** STEDC_LEAVES_KERNEL solves each of the nleaves independent sub-blocks with
+    steqr. The eigenvectors are stored in the corresponding diagonal blocks of Q
+    (which must be initialized to the identity). Call this kernel with one thread
+    and one group per sub-block and batch instance. **/
+template <typename S>
+__global__ void stedc_leaves_kernel(const rocblas_int n,
+                                    const rocblas_int nleaves,
+                                    S* DD,
+                                    const rocblas_stride strideD,
+                                    S* EE,
+                                    const rocblas_stride strideE,
+                                    S* QQ,
+                                    const rocblas_stride strideQ,
+                                    rocblas_int* info,
+                                    S* WW,
+                                    const rocblas_stride strideW,
+                                    const S eps,
+                                    const S ssfmin,
+                                    const S ssfmax)
+{
+    rocblas_int lid = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    rocblas_int start = stedc_split(lid, n, nleaves);
+    rocblas_int nb = stedc_split(lid + 1, n, nleaves) - start;
+
+    S* D = DD + (bid * strideD) + start;
+    S* E = EE + (bid * strideE) + start;
+    S* Q = QQ + (bid * strideQ) + start + start * n;
+    S* work = WW + (bid * strideW) + 2 * start;
+
+    rocblas_int nconv = run_steqr<S, S>(nb, D, E, Q, n, work, 30 * nb, eps, ssfmin, ssfmax);
+    if(nconv > 0)
+        atomicAdd(info + bid, nconv);
+}
+
+/** STEDC_MERGE_PREPARE_KERNEL sets up the rank-one modification that merges the
+    two halves of every sub-block of the current level. It forms the vector z, sorts
+    the eigenvalues of both halves, deflates, and applies the deflation rotations to
+    the eigenvectors in Q. It also zeroes the diagonal blocks of W that will receive
+    the eigenvectors of the modified problems. Call this kernel with BLOCKSIZE
+    threads and one group per merge and batch instance. **/
+template <typename S>
+__global__ void stedc_merge_prepare_kernel(const rocblas_int n,
+                                           const rocblas_int nleaves,
+                                           const rocblas_int level,
+                                           S* DD,
+                                           const rocblas_stride strideD,
+                                           S* EE,
+                                           const rocblas_stride strideE,
+                                           S* QQ,
+                                           S* WWmat,
+                                           const rocblas_stride strideQ,
+                                           S* WW,
+                                           const rocblas_stride strideW,
+                                           rocblas_int* IW,
+                                           const rocblas_stride strideIW,
+                                           const S eps)
+{
+    rocblas_int mid = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // indices of the sub-block and its split point
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int k = stedc_split((mid << level) + (1 << (level - 1)), n, nleaves);
+    rocblas_int m = stedc_split((mid + 1) << level, n, nleaves) - off;
+    rocblas_int m1 = k - off;
+
+    S* D = DD + (bid * strideD) + off;
+    S* E = EE + (bid * strideE);
+    S* Q = QQ + (bid * strideQ);
+    S* W = WWmat + (bid * strideQ);
+
+    // workspace arrays
+    S* work = WW + (bid * strideW);
+    S* ds = work + off;
+    S* zs = work + n + off;
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* ev = work + 5 * n + off;
+    S* rc = work + 6 * n + off;
+    S* rs = work + 7 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* perm = iwork + off;
+    rocblas_int* col = iwork + n + off;
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* rp = iwork + 3 * n + off;
+    rocblas_int* rq = iwork + 4 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    S beta = E[k - 1];
+    S rho = 2 * abs(beta);
+    S sgn = (beta < 0 ? S(-1) : S(1));
+
+    // form z and sort the eigenvalues of both halves into a single list
+    S dmax = 0, zmax = 0;
+    rocblas_int idx = 0;
+    for(rocblas_int j = tid; j < m; j += BLOCKSIZE)
+    {
+        S dj = D[j];
+        S zj = (j < m1 ? Q[(k - 1) + (off + j) * n] : sgn * Q[k + (off + j) * n]) / sqrt(S(2));
+        rocblas_int lo, hi, pos;
+
+        if(j < m1)
+        {
+            // count the entries of the second half strictly smaller than dj
+            lo = m1;
+            hi = m;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(D[pos] < dj)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = j + lo - m1;
+        }
+        else
+        {
+            // count the entries of the first half smaller than or equal to dj
+            lo = 0;
+            hi = m1;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(D[pos] <= dj)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = j - m1 + lo;
+        }
+
+        ds[pos] = dj;
+        zs[pos] = zj;
+        perm[pos] = off + j;
+        dmax = max(dmax, abs(dj));
+        zmax = max(zmax, abs(zj));
+    }
+    dmax = block_reduce_max(dmax, idx, sval, sidx);
+    zmax = block_reduce_max(zmax, idx, sval, sidx);
+    S tol = 8 * eps * max(dmax, zmax);
+
+    // deflation (executed by a single thread)
+    if(tid == 0)
+    {
+        rocblas_int kk = 0, nd = 0, nrot = 0, pj = -1;
+        S c, s, t;
+
+        for(rocblas_int j = 0; j < m; j++)
+        {
+            if(rho * abs(zs[j]) <= tol)
+            {
+                // z_j is negligible; keep the list of deflated eigenvalues sorted
+                t = ds[j];
+                rocblas_int q = nd++;
+                while(q > 0 && ev[q - 1] > t)
+                {
+                    ev[q] = ev[q - 1];
+                    org[q] = org[q - 1];
+                    q--;
+                }
+                ev[q] = t;
+                org[q] = perm[j];
+                continue;
+            }
+
+            if(pj >= 0)
+            {
+                s = zs[pj];
+                c = zs[j];
+                t = sqrt(c * c + s * s);
+                c = c / t;
+                s = -s / t;
+
+                if(abs((ds[j] - ds[pj]) * c * s) <= tol)
+                {
+                    // close eigenvalues; rotate to deflate the first one
+                    zs[j] = t;
+                    zs[pj] = 0;
+                    rp[nrot] = perm[pj];
+                    rq[nrot] = perm[j];
+                    rc[nrot] = c;
+                    rs[nrot] = s;
+                    nrot++;
+
+                    t = ds[pj] * c * c + ds[j] * s * s;
+                    ds[j] = ds[pj] * s * s + ds[j] * c * c;
+                    ds[pj] = t;
+
+                    rocblas_int q = nd++;
+                    while(q > 0 && ev[q - 1] > t)
+                    {
+                        ev[q] = ev[q - 1];
+                        org[q] = org[q - 1];
+                        q--;
+                    }
+                    ev[q] = t;
+                    org[q] = perm[pj];
+                }
+                else
+                {
+                    dl[kk] = ds[pj];
+                    zl[kk] = zs[pj];
+                    col[kk] = perm[pj];
+                    kk++;
+                }
+            }
+            pj = j;
+        }
+        if(pj >= 0)
+        {
+            dl[kk] = ds[pj];
+            zl[kk] = zs[pj];
+            col[kk] = perm[pj];
+            kk++;
+        }
+
+        // move the deflated eigenvalues to the end of the list
+        for(rocblas_int q = nd - 1; q >= 0; q--)
+        {
+            ev[kk + q] = ev[q];
+            col[kk + q] = org[q];
+        }
+
+        cnt[0] = kk;
+        cnt[1] = nrot;
+    }
+    __syncthreads();
+
+    // apply deflation rotations to the rows of Q
+    rocblas_int nrot = cnt[1];
+    for(rocblas_int i = off + tid; i < off + m; i += BLOCKSIZE)
+    {
+        for(rocblas_int q = 0; q < nrot; q++)
+        {
+            S a = Q[i + rp[q] * n];
+            S b = Q[i + rq[q] * n];
+            Q[i + rp[q] * n] = rc[q] * a + rs[q] * b;
+            Q[i + rq[q] * n] = rc[q] * b - rs[q] * a;
+        }
+    }
+
+    // zero the diagonal block of W
+    for(rocblas_int j = off; j < off + m; j++)
+        for(rocblas_int i = off + tid; i < off + m; i += BLOCKSIZE)
+            W[i + j * n] = 0;
+}
+
+/** STEDC_MERGE_SECULAR_KERNEL solves the secular equation of every merge of the
+    current level. Each thread computes one root. Call this kernel with BLOCKSIZE
+    threads and a grid of size maxm/BLOCKSIZE x number of merges x batch_count. **/
+template <typename S>
+__global__ void stedc_merge_secular_kernel(const rocblas_int n,
+                                           const rocblas_int nleaves,
+                                           const rocblas_int level,
+                                           S* EE,
+                                           const rocblas_stride strideE,
+                                           S* WW,
+                                           const rocblas_stride strideW,
+                                           rocblas_int* IW,
+                                           const rocblas_stride strideIW,
+                                           const S eps)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int mid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int k = stedc_split((mid << level) + (1 << (level - 1)), n, nleaves);
+
+    S* work = WW + (bid * strideW);
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* tau = work + 4 * n + off;
+    S* ev = work + 5 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    rocblas_int kk = cnt[0];
+    S rho = 2 * abs(EE[(bid * strideE) + k - 1]);
+
+    if(i < kk)
+    {
+        rocblas_int o;
+        S t;
+        stedc_secular(kk, i, dl, zl, rho, eps, o, t);
+        org[i] = o;
+        tau[i] = t;
+        ev[i] = dl[o] + t;
+    }
+}
+
+/** STEDC_MERGE_ZHAT_KERNEL recomputes the vector z from the computed roots so that
+    the eigenvectors of the modified problems are numerically orthogonal (Gu and
+    Eisenstat). Call this kernel as stedc_merge_secular_kernel. **/
+template <typename S>
+__global__ void stedc_merge_zhat_kernel(const rocblas_int n,
+                                        const rocblas_int nleaves,
+                                        const rocblas_int level,
+                                        S* EE,
+                                        const rocblas_stride strideE,
+                                        S* WW,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* IW,
+                                        const rocblas_stride strideIW)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int mid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int k = stedc_split((mid << level) + (1 << (level - 1)), n, nleaves);
+
+    S* work = WW + (bid * strideW);
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* tau = work + 4 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    rocblas_int kk = cnt[0];
+    S rho = 2 * abs(EE[(bid * strideE) + k - 1]);
+
+    if(j < kk)
+    {
+        // zhat_j^2 = prod_i (lambda_i - d_j) / (rho * prod_{i != j} (d_i - d_j))
+        S dj = dl[j];
+        S p = (tau[kk - 1] + (dl[org[kk - 1]] - dj)) / rho;
+        for(rocblas_int i = 0; i < j; i++)
+            p *= (tau[i] + (dl[org[i]] - dj)) / (dl[i] - dj);
+        for(rocblas_int i = j; i < kk - 1; i++)
+            p *= (tau[i] + (dl[org[i]] - dj)) / (dl[i + 1] - dj);
+
+        p = sqrt(abs(p));
+        zl[j] = (zl[j] < 0 ? -p : p);
+    }
+}
+
+/** STEDC_MERGE_VECTORS_KERNEL writes the new eigenvalues of every merge of the
+    current level in increasing order, and the eigenvectors of the modified problems
+    in the corresponding (permuted) columns of W. Call this kernel with BLOCKSIZE
+    threads and a grid of size maxm/BLOCKSIZE x number of merges x batch_count. **/
+template <typename S>
+__global__ void stedc_merge_vectors_kernel(const rocblas_int n,
+                                           const rocblas_int nleaves,
+                                           const rocblas_int level,
+                                           S* DD,
+                                           const rocblas_stride strideD,
+                                           S* WWmat,
+                                           const rocblas_stride strideQ,
+                                           S* WW,
+                                           const rocblas_stride strideW,
+                                           rocblas_int* IW,
+                                           const rocblas_stride strideIW)
+{
+    rocblas_int s = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int mid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    rocblas_int off = stedc_split(mid << level, n, nleaves);
+    rocblas_int m = stedc_split((mid + 1) << level, n, nleaves) - off;
+
+    S* D = DD + (bid * strideD) + off;
+    S* W = WWmat + (bid * strideQ);
+    S* work = WW + (bid * strideW);
+    S* dl = work + 2 * n + off;
+    S* zl = work + 3 * n + off;
+    S* tau = work + 4 * n + off;
+    S* ev = work + 5 * n + off;
+    rocblas_int* iwork = IW + (bid * strideIW);
+    rocblas_int* col = iwork + n + off;
+    rocblas_int* org = iwork + 2 * n + off;
+    rocblas_int* cnt = iwork + 5 * n + off;
+
+    rocblas_int kk = cnt[0];
+
+    if(s < m)
+    {
+        // the roots [0, kk) and the deflated eigenvalues [kk, m) are sorted;
+        // find the final position of ev[s] by merging both lists
+        S e = ev[s];
+        rocblas_int lo, hi, pos;
+        if(s < kk)
+        {
+            lo = kk;
+            hi = m;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(ev[pos] < e)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = s + lo - kk;
+        }
+        else
+        {
+            lo = 0;
+            hi = kk;
+            while(lo < hi)
+            {
+                pos = (lo + hi) / 2;
+                if(ev[pos] <= e)
+                    lo = pos + 1;
+                else
+                    hi = pos;
+            }
+            pos = s - kk + lo;
+        }
+        D[pos] = e;
+        pos += off;
+
+        if(s >= kk)
+        {
+            // deflated eigenvalue; the eigenvector is a column of Q
+            W[col[s] + pos * n] = 1;
+        }
+        else
+        {
+            // eigenvector of the rank-one modification
+            S t, nrm = 0;
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                t = zl[j] / ((dl[j] - dl[org[s]]) - tau[s]);
+                nrm += t * t;
+            }
+            nrm = sqrt(nrm);
+            for(rocblas_int j = 0; j < kk; j++)
+            {
+                t = zl[j] / ((dl[j] - dl[org[s]]) - tau[s]);
+                W[col[j] + pos * n] = t / nrm;
+            }
+        }
+    }
+}
+
+/** STEDC_COPY_VECT copies the real n-by-n matrix Q into C **/
+template <typename T, typename S, typename U>
+__global__ void stedc_copy_vect(const rocblas_int n,
+                                S* QQ,
+                                const rocblas_stride strideQ,
+                                U CC,
+                                const rocblas_int shiftC,
+                                const rocblas_int ldc,
+                                const rocblas_stride strideC)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < n)
+    {
+        S* Q = QQ + (b * strideQ);
+        T* C = load_ptr_batch<T>(CC, b, shiftC, strideC);
+        C[i + j * ldc] = T(Q[i + j * n]);
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work_stack,
+                                   size_t* size_tempvect,
+                                   size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work_stack = 0;
+        *size_tempvect = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // requirements for steqr/sterf (small sizes or no eigenvectors)
+    rocsolver_steqr_getMemorySize<S, T>(evect, n, batch_count, size_work_stack);
+    *size_tempvect = 0;
+    *size_workArr = 0;
+
+    if(evect != rocblas_evect_none && n > STEDC_MIN_DC_SIZE)
+    {
+        // size of the vectors used by the merges and of the scaling factors
+        size_t s1 = (sizeof(S) * (8 * n + 1) + sizeof(rocblas_int) * 6 * n) * batch_count;
+        *size_work_stack = max(*size_work_stack, s1);
+
+        // size for the (ping-pong) matrices of eigenvectors
+        *size_tempvect = sizeof(S) * 3 * n * n * batch_count;
+
+        // size of array of pointers (only for batched case)
+        if(BATCHED && evect == rocblas_evect_original)
+            *size_workArr = sizeof(S*) * 2 * batch_count;
+    }
+}
+
+template <typename S, typename T>
+rocblas_status rocsolver_stedc_argCheck(rocblas_handle handle,
+                                        const rocblas_evect evect,
+                                        const rocblas_int n,
+                                        S D,
+                                        S E,
+                                        T C,
+                                        const rocblas_int ldc,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(evect != rocblas_evect_none && evect != rocblas_evect_tridiagonal
+       && evect != rocblas_evect_original)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0)
+        return rocblas_status_invalid_size;
+    if(evect != rocblas_evect_none && ldc < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || (evect != rocblas_evect_none && n && !C) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename S, typename T, typename U>
+rocblas_status rocsolver_stedc_template(rocblas_handle handle,
+                                        const rocblas_evect evect,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        U C,
+                                        const rocblas_int shiftC,
+                                        const rocblas_int ldc,
+                                        const rocblas_stride strideC,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        void* work_stack,
+                                        S* tempvect,
+                                        S** workArr)
+{
+    ROCSOLVER_ENTER("stedc", "evect:", evect, "n:", n, "shiftD:", shiftD, "shiftE:", shiftE,
+                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    // small sizes and eigenvalues only are computed with steqr/sterf
+    if(evect == rocblas_evect_none || n <= STEDC_MIN_DC_SIZE)
+        return rocsolver_steqr_template<S, T>(handle, evect, n, D, shiftD, strideD, E, shiftE,
+                                              strideE, C, shiftC, ldc, strideC, info, batch_count,
+                                              work_stack);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    S one = 1;
+    S zero = 0;
+
+    S eps = get_epsilon<S>();
+    S ssfmin = get_safemin<S>();
+    S ssfmax = S(1.0) / ssfmin;
+    ssfmin = sqrt(ssfmin) / (eps * eps);
+    ssfmax = sqrt(ssfmax) / S(3.0);
+
+    // number of leaves of the divide and conquer tree (a power of 2)
+    rocblas_int nleaves = 1;
+    while((n - 1) / nleaves + 1 > STEDC_MIN_DC_SIZE)
+        nleaves *= 2;
+
+    // workspace arrays
+    rocblas_stride strideW = 8 * n;
+    rocblas_stride strideIW = 6 * n;
+    rocblas_stride strideQ = n * n;
+    S* work = (S*)work_stack;
+    S* scal = work + strideW * batch_count;
+    rocblas_int* iwork = (rocblas_int*)(scal + batch_count);
+    S* Q = tempvect;
+    S* W = tempvect + strideQ * batch_count;
+    S* Qnew = tempvect + 2 * strideQ * batch_count;
+
+    rocblas_int blocks = (n - 1) / 32 + 1;
+    dim3 grid2D(blocks, blocks, batch_count);
+    dim3 threads2D(32, 32);
+
+    // scale the matrix and split it into independent sub-blocks
+    hipLaunchKernelGGL(stedc_scale_kernel<S>, dim3(1, batch_count), threads, 0, stream, n, nleaves,
+                       D + shiftD, strideD, E + shiftE, strideE, scal);
+
+    // solve the sub-blocks
+    hipLaunchKernelGGL(init_ident<S>, grid2D, threads2D, 0, stream, n, n, Q, 0, n, strideQ);
+    hipLaunchKernelGGL(stedc_leaves_kernel<S>, dim3(nleaves, batch_count), dim3(1), 0, stream, n,
+                       nleaves, D + shiftD, strideD, E + shiftE, strideE, Q, strideQ, info, work,
+                       strideW, eps, ssfmin, ssfmax);
+
+    // merge the sub-blocks, level by level
+    for(rocblas_int level = 1; (1 << level) <= nleaves; level++)
+    {
+        rocblas_int nmerges = nleaves >> level;
+        rocblas_int maxm = (n - 1) / nmerges + 1;
+        dim3 gridK((maxm - 1) / BLOCKSIZE + 1, nmerges, batch_count);
+
+        hipLaunchKernelGGL(stedc_merge_prepare_kernel<S>, dim3(nmerges, batch_count), threads, 0,
+                           stream, n, nleaves, level, D + shiftD, strideD, E + shiftE, strideE, Q,
+                           W, strideQ, work, strideW, iwork, strideIW, eps);
+        hipLaunchKernelGGL(stedc_merge_secular_kernel<S>, gridK, threads, 0, stream, n, nleaves,
+                           level, E + shiftE, strideE, work, strideW, iwork, strideIW, eps);
+        hipLaunchKernelGGL(stedc_merge_zhat_kernel<S>, gridK, threads, 0, stream, n, nleaves,
+                           level, E + shiftE, strideE, work, strideW, iwork, strideIW);
+        hipLaunchKernelGGL(stedc_merge_vectors_kernel<S>, gridK, threads, 0, stream, n, nleaves,
+                           level, D + shiftD, strideD, W, strideQ, work, strideW, iwork, strideIW);
+
+        // update eigenvectors: Qnew = Q * W on each diagonal block
+        hipLaunchKernelGGL(set_zero<S>, grid2D, threads2D, 0, stream, n, n, Qnew, 0, n, strideQ);
+        for(rocblas_int j = 0; j < nmerges; j++)
+        {
+            rocblas_int off = stedc_split(j << level, n, nleaves);
+            rocblas_int m = stedc_split((j + 1) << level, n, nleaves) - off;
+            rocblasCall_gemm<false, true, S>(handle, rocblas_operation_none,
+                                             rocblas_operation_none, m, m, m, &one, Q,
+                                             off + off * n, n, strideQ, W, off + off * n, n,
+                                             strideQ, &zero, Qnew, off + off * n, n, strideQ,
+                                             batch_count, workArr);
+        }
+
+        S* temp = Q;
+        Q = Qnew;
+        Qnew = W;
+        W = temp;
+    }
+
+    // restore scaling
+    hipLaunchKernelGGL(stedc_unscale_kernel<S>, dim3((n - 1) / BLOCKSIZE + 1, batch_count),
+                       threads, 0, stream, n, D + shiftD, strideD, scal);
+
+    if(evect == rocblas_evect_tridiagonal)
+    {
+        // the eigenvectors are the columns of Q
+        hipLaunchKernelGGL((stedc_copy_vect<T>), grid2D, threads2D, 0, stream, n, Q, strideQ, C,
+                           shiftC, ldc, strideC);
+    }
+    else
+    {
+        // C = C * Q; complex C is handled as a real matrix with twice the rows,
+        // and the product is computed in panels of n rows
+        const rocblas_int cf = (is_complex<T> ? 2 : 1);
+        auto CR = stedc_real_view<S>(C);
+        for(rocblas_int p = 0; p < cf; p++)
+        {
+            rocblasCall_gemm<BATCHED, STRIDED, S>(handle, rocblas_operation_none,
+                                                  rocblas_operation_none, n, n, n, &one, CR,
+                                                  cf * shiftC + p * n, cf * ldc, cf * strideC, Q,
+                                                  0, n, strideQ, &zero, W, 0, n, strideQ,
+                                                  batch_count, workArr);
+            hipLaunchKernelGGL(copy_mat<S>, grid2D, threads2D, 0, stream, n, n, W, 0, n, strideQ,
+                               CR, cf * shiftC + p * n, cf * ldc, cf * strideC);
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,485 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+  STEIN computes the eigenvectors associated with the given eigenvalues of a
+  symmetric tridiagonal matrix by inverse iteration. Eigenvalues that are close
+  to each other (within the same sub-block) form a cluster, and the eigenvectors
+  of a cluster are reorthogonalized against each other. Different clusters are
+  independent, so they are distributed among several groups of threads. Within a
+  group, the (sequential) tridiagonal factorization and solves are executed by a
+  single thread, while the reorthogonalizations and norms use all the threads.
+***************************************************************************/
+
+/** STEIN_START_VALUE returns the i-th entry of the (pseudo-random) starting vector
+    of the inverse iterations for the j-th eigenvector; the entries are uniformly
+    distributed in (-1, 1) **/
+template <typename S>
+__device__ S stein_start_value(const rocblas_int i, const rocblas_int j)
+{
+    uint32_t h = (uint32_t(i + 1) * 2654435761u) ^ (uint32_t(j + 1) * 2246822519u);
+    h ^= h >> 15;
+    h *= 2654435761u;
+    h ^= h >> 13;
+    return S(h) / S(4294967296.0) * 2 - 1;
+}
+
+/** STEIN_FACTOR computes the LU factorization with partial pivoting of the
+    tridiagonal matrix T - x*I of order m. U is stored in a (diagonal), du and du2
+    (first and second super-diagonals); L is given by the multipliers in dl and the
+    interchanges in ipiv. It returns the tolerance used to perturb small pivots **/
+template <typename S>
+__device__ S stein_factor(const rocblas_int m,
+                          S* D,
+                          S* E,
+                          const S x,
+                          S* a,
+                          S* du,
+                          S* dl,
+                          S* du2,
+                          rocblas_int* ipiv,
+                          const S eps)
+{
+    for(rocblas_int i = 0; i < m; i++)
+    {
+        a[i] = D[i] - x;
+        if(i < m - 1)
+        {
+            du[i] = E[i];
+            dl[i] = E[i];
+            du2[i] = 0;
+        }
+    }
+
+    for(rocblas_int i = 0; i < m - 1; i++)
+    {
+        if(abs(a[i]) >= abs(dl[i]))
+        {
+            // no interchange
+            ipiv[i] = 0;
+            S f = (a[i] != 0 ? dl[i] / a[i] : 0);
+            dl[i] = f;
+            a[i + 1] -= f * du[i];
+        }
+        else
+        {
+            // interchange rows i and i+1
+            ipiv[i] = 1;
+            S f = a[i] / dl[i];
+            a[i] = dl[i];
+            dl[i] = f;
+            S temp = du[i];
+            du[i] = a[i + 1];
+            a[i + 1] = temp - f * a[i + 1];
+            if(i < m - 2)
+            {
+                du2[i] = du[i + 1];
+                du[i + 1] = -f * du[i + 1];
+            }
+        }
+    }
+
+    S tol = 0;
+    for(rocblas_int i = 0; i < m; i++)
+    {
+        tol = max(tol, abs(a[i]));
+        if(i < m - 1)
+            tol = max(tol, max(abs(du[i]), abs(du2[i])));
+    }
+    tol *= eps;
+    return (tol == 0 ? eps : tol);
+}
+
+/** STEIN_SOLVE overwrites x with the solution of (T - x*I) * y = x, using the
+    factorization computed by STEIN_FACTOR. Pivots smaller than tol are perturbed **/
+template <typename S>
+__device__ void stein_solve(const rocblas_int m,
+                            S* a,
+                            S* du,
+                            S* dl,
+                            S* du2,
+                            rocblas_int* ipiv,
+                            const S tol,
+                            S* x)
+{
+    // apply L^-1 * P
+    for(rocblas_int i = 0; i < m - 1; i++)
+    {
+        if(ipiv[i] == 0)
+            x[i + 1] -= dl[i] * x[i];
+        else
+        {
+            S temp = x[i];
+            x[i] = x[i + 1];
+            x[i + 1] = temp - dl[i] * x[i];
+        }
+    }
+
+    // apply U^-1
+    for(rocblas_int i = m - 1; i >= 0; i--)
+    {
+        S s = x[i];
+        if(i < m - 1)
+            s -= du[i] * x[i + 1];
+        if(i < m - 2)
+            s -= du2[i] * x[i + 2];
+
+        S p = a[i];
+        if(abs(p) < tol)
+            p = (p < 0 ? -tol : tol);
+        x[i] = s / p;
+    }
+}
+
+/** STEIN_KERNEL computes the eigenvectors by inverse iteration. Every group walks
+    through all the eigenvalues to determine the clusters (and the perturbations of
+    close eigenvalues), but only computes the eigenvectors of the clusters assigned
+    to it.
+    Call this kernel with batch_count groups in y, up to STEIN_MAX_GROUPS groups in x,
+    and BLOCKSIZE threads in x **/
+template <typename T, typename S, typename U>
+__global__ void stein_kernel(const rocblas_int n,
+                             S* DD,
+                             const rocblas_stride strideD,
+                             S* EE,
+                             const rocblas_stride strideE,
+                             rocblas_int* nevA,
+                             S* WW,
+                             const rocblas_stride strideW,
+                             rocblas_int* iblockA,
+                             const rocblas_stride strideIblock,
+                             rocblas_int* isplitA,
+                             const rocblas_stride strideIsplit,
+                             U ZZ,
+                             const rocblas_int shiftZ,
+                             const rocblas_int ldz,
+                             const rocblas_stride strideZ,
+                             rocblas_int* ifailA,
+                             const rocblas_stride strideF,
+                             rocblas_int* info,
+                             S* work,
+                             rocblas_int* iwork,
+                             const S eps)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int g = hipBlockIdx_x;
+    rocblas_int ngroups = hipGridDim_x;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    S* W = WW + (bid * strideW);
+    rocblas_int* iblock = iblockA + (bid * strideIblock);
+    rocblas_int* isplit = isplitA + (bid * strideIsplit);
+    rocblas_int* ifail = ifailA + (bid * strideF);
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    rocblas_int nev = nevA[bid];
+
+    // workspace of the group
+    S* x = work + (bid * ngroups + g) * 5 * n;
+    S* a = x + n;
+    S* du = a + n;
+    S* dl = du + n;
+    S* du2 = dl + n;
+    rocblas_int* ipiv = iwork + (bid * ngroups + g) * n;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+    __shared__ S tol;
+
+    rocblas_int blk = 0, b1 = 0, bsz = 0, jblk = 0, gpind = 0, cid = -1, idx;
+    S onenrm = 0, ortol = 0, dtpcrt = 0, xj, xjm = 0;
+
+    for(rocblas_int j = 0; j < nev; j++)
+    {
+        // set up a new sub-block
+        if(iblock[j] != blk)
+        {
+            blk = iblock[j];
+            b1 = (blk > 1 ? isplit[blk - 2] : 0);
+            bsz = isplit[blk - 1] - b1;
+            jblk = 0;
+
+            S r = 0;
+            idx = 0;
+            for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+            {
+                S t = abs(D[b1 + i]);
+                if(i > 0)
+                    t += abs(E[b1 + i - 1]);
+                if(i < bsz - 1)
+                    t += abs(E[b1 + i]);
+                r = max(r, t);
+            }
+            onenrm = block_reduce_max(r, idx, sval, sidx);
+            ortol = S(1e-3) * onenrm;
+            dtpcrt = sqrt(S(0.1) / bsz);
+        }
+        jblk++;
+
+        // perturb eigenvalues that are too close, and determine the clusters
+        xj = W[j];
+        if(jblk > 1)
+        {
+            S pertol = 10 * abs(eps * xj);
+            if(xj - xjm < pertol)
+                xj = xjm + pertol;
+        }
+        if(jblk == 1 || xj - xjm > ortol)
+        {
+            gpind = j;
+            cid++;
+        }
+        xjm = xj;
+
+        if(cid % ngroups != g)
+            continue;
+
+        if(bsz == 1)
+        {
+            for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+                Z[i + j * ldz] = (i == b1 ? T(1) : T(0));
+            __syncthreads();
+            continue;
+        }
+
+        // starting vector and factorization of T - xj*I
+        for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+            x[i] = stein_start_value<S>(i, j);
+        if(tid == 0)
+            tol = stein_factor(bsz, D + b1, E + b1, xj, a, du, dl, du2, ipiv, eps);
+        __syncthreads();
+
+        rocblas_int its = 0;
+        rocblas_int nrmchk = 0;
+        bool conv = false;
+        while(!conv && its < STEIN_MAX_ITERS)
+        {
+            its++;
+
+            // scale the vector to avoid overflow in the solve
+            S asum = 0;
+            for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+                asum += abs(x[i]);
+            asum = block_reduce_sum(asum, sval);
+            S scl = bsz * onenrm * max(eps, abs(a[bsz - 1])) / asum;
+            for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+                x[i] *= scl;
+            __syncthreads();
+
+            // solve (T - xj*I) * x = x
+            if(tid == 0)
+                stein_solve(bsz, a, du, dl, du2, ipiv, tol, x);
+            __syncthreads();
+
+            // reorthogonalize against the previous eigenvectors of the cluster
+            for(rocblas_int k = gpind; k < j; k++)
+            {
+                T* z = Z + b1 + k * ldz;
+                S dot = 0;
+                for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+                    dot += x[i] * std::real(z[i]);
+                dot = block_reduce_sum(dot, sval);
+                for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+                    x[i] -= dot * std::real(z[i]);
+                __syncthreads();
+            }
+
+            // check the infinity norm of the vector
+            S nrm = 0;
+            idx = 0;
+            for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+                nrm = max(nrm, abs(x[i]));
+            nrm = block_reduce_max(nrm, idx, sval, sidx);
+            if(nrm >= dtpcrt)
+            {
+                nrmchk++;
+                conv = (nrmchk >= STEIN_EXTRA_ITERS + 1);
+            }
+        }
+
+        // record failure to converge
+        if(!conv && tid == 0)
+            ifail[atomicAdd(info + bid, 1)] = j + 1;
+
+        // normalize so that the largest component is positive
+        S nrm2 = 0;
+        S amax = -1;
+        idx = 0;
+        for(rocblas_int i = tid; i < bsz; i += BLOCKSIZE)
+        {
+            nrm2 += x[i] * x[i];
+            if(abs(x[i]) > amax)
+            {
+                amax = abs(x[i]);
+                idx = i;
+            }
+        }
+        nrm2 = block_reduce_sum(nrm2, sval);
+        block_reduce_max(amax, idx, sval, sidx);
+        S scl = (x[idx] < 0 ? -1 : 1) / sqrt(nrm2);
+
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+        {
+            if(i >= b1 && i < b1 + bsz)
+                Z[i + j * ldz] = T(x[i - b1] * scl);
+            else
+                Z[i + j * ldz] = T(0);
+        }
+        __syncthreads();
+    }
+}
+
+/** STEIN_SORT_IFAIL sorts the indices of the eigenvectors that failed to converge
+    in increasing order **/
+template <typename T>
+__global__ void stein_sort_ifail(T* ifailA, const rocblas_stride strideF, T* info)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    T* ifail = ifailA + (bid * strideF);
+
+    for(rocblas_int i = 1; i < info[bid]; i++)
+    {
+        T f = ifail[i];
+        rocblas_int k = i;
+        for(; k > 0 && ifail[k - 1] > f; k--)
+            ifail[k] = ifail[k - 1];
+        ifail[k] = f;
+    }
+}
+
+template <typename S>
+void rocsolver_stein_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_iwork)
+{
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work = 0;
+        *size_iwork = 0;
+        return;
+    }
+
+    rocblas_int ngroups = min(n, STEIN_MAX_GROUPS);
+
+    // size of workspace (iteration vector and tridiagonal factorization for every group)
+    *size_work = sizeof(S) * 5 * n * ngroups * batch_count;
+
+    // size of integer workspace (pivots for every group)
+    *size_iwork = sizeof(rocblas_int) * n * ngroups * batch_count;
+}
+
+template <typename S, typename T>
+rocblas_status rocsolver_stein_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        S* E,
+                                        rocblas_int* nev,
+                                        S* W,
+                                        rocblas_int* iblock,
+                                        rocblas_int* isplit,
+                                        T Z,
+                                        const rocblas_int ldz,
+                                        rocblas_int* ifail,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+
+    // 2. invalid size
+    if(n < 0 || ldz < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n && !E) || !nev || (n && !W) || (n && !iblock) || (n && !isplit) || (n && !Z)
+       || (n && !ifail) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_stein_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* nev,
+                                        S* W,
+                                        const rocblas_int shiftW,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* iblock,
+                                        const rocblas_stride strideIblock,
+                                        rocblas_int* isplit,
+                                        const rocblas_stride strideIsplit,
+                                        U Z,
+                                        const rocblas_int shiftZ,
+                                        const rocblas_int ldz,
+                                        const rocblas_stride strideZ,
+                                        rocblas_int* ifail,
+                                        const rocblas_stride strideF,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        S* work,
+                                        rocblas_int* iwork)
+{
+    ROCSOLVER_ENTER("stein", "n:", n, "shiftD:", shiftD, "shiftE:", shiftE, "shiftW:", shiftW,
+                    "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // ifail = 0
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(reset_batch_info<rocblas_int>, dim3(blocks, batch_count), threads, 0,
+                       stream, ifail, strideF, n, 0);
+
+    S eps = get_epsilon<S>();
+    rocblas_int ngroups = min(n, STEIN_MAX_GROUPS);
+
+    hipLaunchKernelGGL((stein_kernel<T>), dim3(ngroups, batch_count), threads, 0, stream, n,
+                       D + shiftD, strideD, E + shiftE, strideE, nev, W + shiftW, strideW, iblock,
+                       strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, ifail, strideF,
+                       info, work, iwork, eps);
+
+    hipLaunchKernelGGL(stein_sort_ifail<rocblas_int>, dim3(batch_count), dim3(1), 0, stream, ifail,
+                       strideF, info);
+
+    return rocblas_status_success;
+}
@@ -15,39 +15,28 @@
 #include "rocsolver.h"
 
 /****************************************************************************
-(TODO:THIS IS BASIC IMPLEMENTATION. THE ONLY PARALLELISM INTRODUCED HERE IS
-  FOR THE BATCHED VERSIONS (A DIFFERENT THREAD WORKS ON EACH INSTANCE OF THE
-  BATCH).)
+(TODO:THE QL/QR ITERATION ITSELF IS STILL EXECUTED BY A SINGLE THREAD PER
+  INSTANCE OF THE BATCH. ONLY THE APPLICATION OF THE ROTATIONS TO THE
+  EIGENVECTORS IS PARALLELIZED.)
 ***************************************************************************/
 
-/** STEQR_KERNEL implements the main loop of the sterf algorithm
-    to compute the eigenvalues of a symmetric tridiagonal matrix given by D
-    and E **/
-template <typename S, typename T, typename U>
-__global__ void steqr_kernel(const rocblas_int n,
-                             S* DD,
-                             const rocblas_stride strideD,
-                             S* EE,
-                             const rocblas_stride strideE,
-                             U CC,
-                             const rocblas_int shiftC,
-                             const rocblas_int ldc,
-                             const rocblas_stride strideC,
-                             rocblas_int* info,
-                             S* WW,
-                             const rocblas_int max_iters,
-                             const S eps,
-                             const S ssfmin,
-                             const S ssfmax)
+/** RUN_STEQR implements the main loop of the steqr algorithm on the symmetric
+    tridiagonal matrix of order n given by D and E. The rotations are applied to
+    the n rows of C, and the eigenvalues and eigenvectors are sorted in increasing
+    order at the end. It returns the number of off-diagonal elements that did not
+    converge to zero. It is executed by a single thread. **/
+template <typename S, typename T>
+__device__ rocblas_int run_steqr(const rocblas_int n,
+                                 S* D,
+                                 S* E,
+                                 T* C,
+                                 const rocblas_int ldc,
+                                 S* work,
+                                 const rocblas_int max_iters,
+                                 const S eps,
+                                 const S ssfmin,
+                                 const S ssfmax)
 {
-    rocblas_int bid = hipBlockIdx_x;
-    rocblas_stride strideW = 2 * n - 2;
-
-    S* D = DD + (bid * strideD);
-    S* E = EE + (bid * strideE);
-    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
-    S* work = WW + (bid * strideW);
-
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
@@ -263,9 +252,10 @@ __global__ void steqr_kernel(const rocblas_int n,
     }
 
     // Check for convergence
+    rocblas_int nconv = 0;
     for(int i = 0; i < n - 1; i++)
         if(E[i] != 0)
-            info[bid]++;
+            nconv++;
 
     // Sort eigenvalues and eigenvectors by selection sort
     for(int ii = 1; ii < n; ii++)
@@ -288,6 +278,383 @@ __global__ void steqr_kernel(const rocblas_int n,
             swapvect(n, C + 0 + l * ldc, 1, C + 0 + m * ldc, 1);
         }
     }
+
+    return nconv;
+}
+
+/** STEQR_STATE keeps the position of the implicit QL/QR iteration of steqr so
+    that it can be suspended when the buffer of deferred rotations is full, and
+    resumed once the rotations have been applied to the eigenvectors. **/
+template <typename S>
+struct steqr_state
+{
+    rocblas_int l1, l, lsv, lend, lendsv, iters;
+    S anorm;
+    bool active, ql;
+};
+
+/** STEQR_DEFER_SWEEPS runs the implicit QL/QR iteration of steqr on the symmetric
+    tridiagonal matrix of order n given by D and E, starting from the state st.
+    Instead of being applied to the eigenvectors, the rotations of each sweep are
+    saved in the next free slot of the buffer work (of size 2n-2 per slot), and the
+    first column, number of columns and direction of the sweep are recorded in sweeps.
+    It returns true when the iteration has finished, or false when all the
+    STEQR_MAX_DEFERRED_SWEEPS slots are in use. It is executed by a single thread. **/
+template <typename S>
+__device__ bool steqr_defer_sweeps(const rocblas_int n,
+                                   S* D,
+                                   S* E,
+                                   S* work,
+                                   rocblas_int* sweeps,
+                                   rocblas_int& nsweeps,
+                                   steqr_state<S>& st,
+                                   const rocblas_int max_iters,
+                                   const S eps,
+                                   const S ssfmin,
+                                   const S ssfmax)
+{
+    rocblas_int m;
+    S p;
+
+    while(nsweeps < STEQR_MAX_DEFERRED_SWEEPS)
+    {
+        if(!st.active)
+        {
+            if(st.l1 >= n || st.iters >= max_iters)
+                return true;
+
+            // Determine submatrix indices
+            if(st.l1 > 0)
+                E[st.l1 - 1] = 0;
+            for(m = st.l1; m < n - 1; m++)
+            {
+                if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
+                {
+                    E[m] = 0;
+                    break;
+                }
+            }
+
+            st.lsv = st.l = st.l1;
+            st.lendsv = st.lend = m;
+            st.l1 = m + 1;
+            if(st.lend == st.l)
+                continue;
+
+            // Scale submatrix
+            st.anorm = find_max_tridiag(st.l, st.lend, D, E);
+            if(st.anorm == 0)
+                continue;
+            else if(st.anorm > ssfmax)
+                scale_tridiag(st.l, st.lend, D, E, st.anorm / ssfmax);
+            else if(st.anorm < ssfmin)
+                scale_tridiag(st.l, st.lend, D, E, st.anorm / ssfmin);
+
+            // Choose iteration type (QL or QR)
+            if(abs(D[st.lend]) < abs(D[st.l]))
+            {
+                st.lend = st.lsv;
+                st.l = st.lendsv;
+            }
+            st.ql = (st.lend >= st.l);
+            st.active = true;
+        }
+
+        rocblas_int l = st.l;
+        rocblas_int lend = st.lend;
+        S* rots = work + nsweeps * (2 * n - 2);
+        rocblas_int* sw = sweeps + 3 * nsweeps;
+
+        if((st.ql ? l > lend : l < lend) || st.iters >= max_iters)
+        {
+            // Undo scaling
+            if(st.anorm > ssfmax)
+                scale_tridiag(st.lsv, st.lendsv, D, E, ssfmax / st.anorm);
+            if(st.anorm < ssfmin)
+                scale_tridiag(st.lsv, st.lendsv, D, E, ssfmin / st.anorm);
+            st.active = false;
+            continue;
+        }
+
+        if(st.ql)
+        {
+            // QL iteration step
+            // Find small subdiagonal element
+            for(m = l; m <= lend - 1; m++)
+                if(abs(E[m] * E[m]) <= eps * eps * abs(D[m] * D[m + 1]))
+                    break;
+
+            if(m < lend)
+                E[m] = 0;
+            p = D[l];
+            if(m == l)
+                st.l = l + 1;
+            else if(m == l + 1)
+            {
+                // Use laev2 to compute 2x2 eigenvalues and eigenvectors
+                S rt1, rt2, c, s;
+                laev2(D[l], E[l], D[l + 1], rt1, rt2, c, s);
+                rots[l] = c;
+                rots[n - 1 + l] = s;
+                sw[0] = l;
+                sw[1] = 2;
+                sw[2] = rocblas_backward_direction;
+                nsweeps++;
+
+                D[l] = rt1;
+                D[l + 1] = rt2;
+                E[l] = 0;
+                st.l = l + 2;
+            }
+            else
+            {
+                st.iters++;
+
+                S f, g, c, s, b, r;
+
+                // Form shift
+                g = (D[l + 1] - p) / (2 * E[l]);
+                if(g >= 0)
+                    r = abs(sqrt(1 + g * g));
+                else
+                    r = -abs(sqrt(1 + g * g));
+                g = D[m] - p + (E[l] / (g + r));
+
+                c = 1;
+                s = 1;
+                p = 0;
+
+                for(int i = m - 1; i >= l; i--)
+                {
+                    f = s * E[i];
+                    b = c * E[i];
+                    lartg(g, f, c, s, r);
+                    s = -s; //get the transpose of the rotation
+                    if(i != m - 1)
+                        E[i + 1] = r;
+
+                    g = D[i + 1] - p;
+                    r = (D[i] - g) * s + 2 * c * b;
+                    p = s * r;
+                    D[i + 1] = g + p;
+                    g = c * r - b;
+
+                    // Save rotations
+                    rots[i] = c;
+                    rots[n - 1 + i] = -s;
+                }
+
+                // Defer the application of the saved rotations
+                sw[0] = l;
+                sw[1] = m - l + 1;
+                sw[2] = rocblas_backward_direction;
+                nsweeps++;
+
+                D[l] -= p;
+                E[l] = g;
+            }
+        }
+
+        else
+        {
+            // QR iteration step
+            // Find small subdiagonal element
+            for(m = l; m >= lend + 1; m--)
+                if(abs(E[m - 1] * E[m - 1]) <= eps * eps * abs(D[m] * D[m - 1]))
+                    break;
+
+            if(m > lend)
+                E[m - 1] = 0;
+            p = D[l];
+            if(m == l)
+                st.l = l - 1;
+            else if(m == l - 1)
+            {
+                // Use laev2 to compute 2x2 eigenvalues and eigenvectors
+                S rt1, rt2, c, s;
+                laev2(D[l - 1], E[l - 1], D[l], rt1, rt2, c, s);
+                rots[m] = c;
+                rots[n - 1 + m] = s;
+                sw[0] = l - 1;
+                sw[1] = 2;
+                sw[2] = rocblas_forward_direction;
+                nsweeps++;
+
+                D[l - 1] = rt1;
+                D[l] = rt2;
+                E[l - 1] = 0;
+                st.l = l - 2;
+            }
+            else
+            {
+                st.iters++;
+
+                S f, g, c, s, b, r;
+
+                // Form shift
+                g = (D[l - 1] - p) / (2 * E[l - 1]);
+                if(g >= 0)
+                    r = abs(sqrt(1 + g * g));
+                else
+                    r = -abs(sqrt(1 + g * g));
+                g = D[m] - p + (E[l - 1] / (g + r));
+
+                c = 1;
+                s = 1;
+                p = 0;
+
+                for(int i = m; i <= l - 1; i++)
+                {
+                    f = s * E[i];
+                    b = c * E[i];
+                    lartg(g, f, c, s, r);
+                    s = -s; //get the transpose of the rotation
+                    if(i != m)
+                        E[i - 1] = r;
+
+                    g = D[i] - p;
+                    r = (D[i + 1] - g) * s + 2 * c * b;
+                    p = s * r;
+                    D[i] = g + p;
+                    g = c * r - b;
+
+                    // Save rotations
+                    rots[i] = c;
+                    rots[n - 1 + i] = s;
+                }
+
+                // Defer the application of the saved rotations
+                sw[0] = m;
+                sw[1] = l - m + 1;
+                sw[2] = rocblas_forward_direction;
+                nsweeps++;
+
+                D[l] -= p;
+                E[l - 1] = g;
+            }
+        }
+    }
+
+    return false;
+}
+
+/** STEQR_KERNEL implements the steqr algorithm to compute the eigenvalues and
+    eigenvectors of a symmetric tridiagonal matrix given by D and E. Each matrix of
+    the batch is processed by a different thread-block. Thread 0 runs the QL/QR
+    iteration and records the rotations of up to STEQR_MAX_DEFERRED_SWEEPS sweeps at a
+    time; the rotations are then applied to the n rows of C by all the threads of the
+    block in parallel (each row is updated independently of the others), so that all
+    the recorded sweeps are applied to a row while it is in cache. **/
+template <typename S, typename T, typename U>
+__global__ void __launch_bounds__(STEQR_MAX_THDS) steqr_kernel(const rocblas_int n,
+                                                              S* DD,
+                                                              const rocblas_stride strideD,
+                                                              S* EE,
+                                                              const rocblas_stride strideE,
+                                                              U CC,
+                                                              const rocblas_int shiftC,
+                                                              const rocblas_int ldc,
+                                                              const rocblas_stride strideC,
+                                                              rocblas_int* info,
+                                                              S* WW,
+                                                              const rocblas_int max_iters,
+                                                              const S eps,
+                                                              const S ssfmin,
+                                                              const S ssfmax)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int nthds = hipBlockDim_x;
+    rocblas_stride strideW = STEQR_MAX_DEFERRED_SWEEPS * (2 * n - 2);
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    S* work = WW + (bid * strideW);
+
+    __shared__ rocblas_int sweeps[3 * STEQR_MAX_DEFERRED_SWEEPS];
+    __shared__ rocblas_int nsweeps;
+    __shared__ bool done;
+
+    steqr_state<S> st;
+    st.l1 = 0;
+    st.iters = 0;
+    st.active = false;
+
+    bool finished = false;
+    while(!finished)
+    {
+        // thread 0 advances the iteration until the buffer of rotations is full
+        if(tid == 0)
+        {
+            nsweeps = 0;
+            done = steqr_defer_sweeps<S>(n, D, E, work, sweeps, nsweeps, st, max_iters, eps,
+                                         ssfmin, ssfmax);
+        }
+        __syncthreads();
+        finished = done;
+
+        // apply the recorded sweeps to the rows of C
+        for(rocblas_int i = tid; i < n; i += nthds)
+        {
+            for(rocblas_int k = 0; k < nsweeps; k++)
+            {
+                rocblas_int j = sweeps[3 * k];
+                S* rots = work + k * (2 * n - 2);
+                lasr(rocblas_side_right, rocblas_direct(sweeps[3 * k + 2]), 1, sweeps[3 * k + 1],
+                     rots + j, rots + n - 1 + j, C + i + j * ldc, ldc);
+            }
+        }
+        __syncthreads();
+    }
+
+    // Check for convergence
+    if(tid == 0)
+    {
+        rocblas_int nconv = 0;
+        for(int i = 0; i < n - 1; i++)
+            if(E[i] != 0)
+                nconv++;
+        info[bid] += nconv;
+    }
+
+    // Sort eigenvalues and eigenvectors by selection sort
+    __shared__ rocblas_int piv;
+    for(rocblas_int l = 0; l < n - 1; l++)
+    {
+        if(tid == 0)
+        {
+            rocblas_int m = l;
+            S p = D[l];
+            for(int j = l + 1; j < n; j++)
+            {
+                if(D[j] < p)
+                {
+                    m = j;
+                    p = D[j];
+                }
+            }
+            if(m != l)
+            {
+                D[m] = D[l];
+                D[l] = p;
+            }
+            piv = m;
+        }
+        __syncthreads();
+
+        rocblas_int m = piv;
+        if(m != l)
+        {
+            for(rocblas_int i = tid; i < n; i += nthds)
+            {
+                T temp = C[i + l * ldc];
+                C[i + l * ldc] = C[i + m * ldc];
+                C[i + m * ldc] = temp;
+            }
+        }
+        __syncthreads();
+    }
 }
 
 template <typename S, typename T>
@@ -306,8 +673,9 @@ void rocsolver_steqr_getMemorySize(const rocblas_evect compc,
     // size of stack (for lasrt)
     if(compc == rocblas_evect_none)
         *size_work_stack = sizeof(rocblas_int) * (2 * 32) * batch_count;
+    // size of the buffer of deferred rotations (for steqr)
     else
-        *size_work_stack = sizeof(S) * (2 * n - 2) * batch_count;
+        *size_work_stack = sizeof(S) * (2 * n - 2) * STEQR_MAX_DEFERRED_SWEEPS * batch_count;
 }
 
 template <typename S, typename T>
@@ -405,9 +773,12 @@ rocblas_status rocsolver_steqr_template(rocblas_handle handle,
                            strideD, E + shiftE, strideE, info, (rocblas_int*)work_stack, 30 * n,
                            eps, ssfmin, ssfmax);
     else
-        hipLaunchKernelGGL((steqr_kernel<S, T>), dim3(batch_count), dim3(1), 0, stream, n,
+    {
+        rocblas_int nthds = min(n, STEQR_MAX_THDS);
+        hipLaunchKernelGGL((steqr_kernel<S, T>), dim3(batch_count), dim3(nthds), 0, stream, n,
                            D + shiftD, strideD, E + shiftE, strideE, C, shiftC, ldc, strideC, info,
                            (S*)work_stack, 30 * n, eps, ssfmin, ssfmax);
+    }
 
     return rocblas_status_success;
 }
@@ -282,6 +282,133 @@ __global__ void sterf_kernel(const rocblas_int n,
     }
 }
 
+/** STERF_STURM_COUNT returns the number of eigenvalues smaller than x of the
+    symmetric tridiagonal matrix with diagonal dd and squared off-diagonal ee.
+    Pivots smaller than pivmin are perturbed to avoid overflow **/
+template <typename T>
+__device__ rocblas_int
+    sterf_sturm_count(const rocblas_int n, T* dd, T* ee, const T x, const T pivmin)
+{
+    rocblas_int count = 0;
+    T q = dd[0] - x;
+    if(abs(q) <= pivmin)
+        q = -pivmin;
+    if(q < 0)
+        count++;
+
+    for(rocblas_int i = 1; i < n; i++)
+    {
+        q = dd[i] - x - ee[i - 1] / q;
+        if(abs(q) <= pivmin)
+            q = -pivmin;
+        if(q < 0)
+            count++;
+    }
+
+    return count;
+}
+
+/** STERF_BISECT_SCALE_KERNEL copies the diagonal and squared off-diagonal elements
+    of the tridiagonal matrix given by D and E into the workspace, scaled so that all
+    the eigenvalues lie in [-1, 1]. The scale factor is stored in scal.
+    Call this kernel with batch_count groups in y, and BLOCKSIZE threads in x **/
+template <typename T>
+__global__ void sterf_bisect_scale_kernel(const rocblas_int n,
+                                          T* DD,
+                                          const rocblas_stride strideD,
+                                          T* EE,
+                                          const rocblas_stride strideE,
+                                          T* work,
+                                          T* scal)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+    T* dd = work + (bid * 2 * n);
+    T* ee = dd + n;
+
+    __shared__ T sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // bound the spectrum with the Gershgorin circles
+    T bound = 0;
+    rocblas_int idx = 0;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        T r = abs(D[i]);
+        if(i > 0)
+            r += abs(E[i - 1]);
+        if(i < n - 1)
+            r += abs(E[i]);
+        bound = max(bound, r);
+    }
+    bound = block_reduce_max(bound, idx, sval, sidx);
+    if(bound == 0)
+        bound = 1;
+
+    // copy scaled matrix
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        dd[i] = D[i] / bound;
+        if(i < n - 1)
+        {
+            T e = E[i] / bound;
+            ee[i] = e * e;
+        }
+    }
+
+    if(tid == 0)
+        scal[bid] = bound;
+}
+
+/** STERF_BISECT_KERNEL computes the eigenvalues of the scaled tridiagonal matrices
+    in the workspace by bisection. Each thread finds one eigenvalue independently (the
+    k-th thread the k-th smallest one), so that the eigenvalues are returned in D
+    already sorted in increasing order.
+    Call this kernel with batch_count groups in y, and enough groups of BLOCKSIZE
+    threads in x to cover the n eigenvalues **/
+template <typename T>
+__global__ void sterf_bisect_kernel(const rocblas_int n,
+                                    T* DD,
+                                    const rocblas_stride strideD,
+                                    T* work,
+                                    T* scal,
+                                    const T eps,
+                                    const T pivmin)
+{
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(k < n)
+    {
+        T* D = DD + (bid * strideD);
+        T* dd = work + (bid * 2 * n);
+        T* ee = dd + n;
+
+        // the interval is widened to be safe from rounding in the scaled matrix
+        T lo = -2;
+        T hi = 2;
+        T mid;
+
+        // stop at the absolute (eps * norm) or relative (2 * eps) tolerance
+        while(hi - lo > max(eps, 2 * eps * max(abs(lo), abs(hi))))
+        {
+            mid = (lo + hi) / 2;
+            if(mid <= lo || mid >= hi)
+                break;
+
+            if(sterf_sturm_count(n, dd, ee, mid, pivmin) > k)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        D[k] = scal[bid] * ((lo + hi) / 2);
+    }
+}
+
 template <typename T>
 void rocsolver_sterf_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -365,3 +492,70 @@ rocblas_status rocsolver_sterf_template(rocblas_handle handle,
 
     return rocblas_status_success;
 }
+
+template <typename T>
+void rocsolver_sterf_bisect_getMemorySize(const rocblas_int n,
+                                          const rocblas_int batch_count,
+                                          size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || !batch_count)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of workspace (for the scaled copies of D and E, and the scale factors)
+    *size_work = sizeof(T) * (2 * n + 1) * batch_count;
+}
+
+/** ROCSOLVER_STERF_BISECT_TEMPLATE computes the eigenvalues of a symmetric tridiagonal
+    matrix as STERF does, but by bisection with Sturm counts, with one thread working on
+    each eigenvalue. Unlike STERF it never fails to converge, and E is not modified **/
+template <typename T, typename U>
+rocblas_status rocsolver_sterf_bisect_template(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               U D,
+                                               const rocblas_int shiftD,
+                                               const rocblas_stride strideD,
+                                               U E,
+                                               const rocblas_int shiftE,
+                                               const rocblas_stride strideE,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               T* work)
+{
+    ROCSOLVER_ENTER("sterf_bisect", "n:", n, "shiftD:", shiftD, "shiftE:", shiftE, "bc:",
+                    batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n <= 1)
+        return rocblas_status_success;
+
+    T eps = get_epsilon<T>();
+    T sfmin = get_safemin<T>();
+    T* scal = work + 2 * n * batch_count;
+
+    hipLaunchKernelGGL(sterf_bisect_scale_kernel<T>, dim3(1, batch_count), threads, 0, stream, n,
+                       D + shiftD, strideD, E + shiftE, strideE, work, scal);
+
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(sterf_bisect_kernel<T>, dim3(blocks, batch_count), threads, 0, stream, n,
+                       D + shiftD, strideD, work, scal, eps, sfmin);
+
+    return rocblas_status_success;
+}
@@ -21,6 +21,8 @@
 
 // ormxx/unmxx
 #define ORMxx_ORMxx_BLOCKSIZE 32
+#define ORMxx_ORMxx_SMALLSIZE 64
+#define ORMxx_ORMxx_SMALL_MAXLDS 65536 // bytes of shared memory available to a group
 
 // getf2/getfr
 #define GETF2_MAX_THDS 256
@@ -41,6 +43,17 @@
 #define GETRF_NPVT_BATCH_INTERVALS 45, 181, 2049
 #define GETRF_NPVT_BATCH_BLKSIZES 1, 16, 32, 64
 
+// trti2/trtri
+#define TRTRI_SWITCHSIZE 64 // largest size inverted by a single kernel (at most 64)
+#define TRTRI_BLOCKSIZE 32 // size of the diagonal blocks (8, 16, 32 or 64)
+
+// lauu2/lauum
+#define LAUUM_SWITCHSIZE 64 // largest size computed by a single kernel (at most 64)
+#define LAUUM_BLOCKSIZE 32 // size of the diagonal blocks (at most 64)
+
+// potri
+#define POTRI_SWITCHSIZE 64 // largest size inverted by a single kernel (at most 64)
+
 // getri
 #define GETRI_SWITCHSIZE_MID 64
 #define GETRI_SWITCHSIZE_LARGE 320
@@ -49,13 +62,27 @@
 // potf2/potrf
 #define POTRF_POTF2_SWITCHSIZE 64
 
+// pstrf
+#define PSTRF_PSTF2_SWITCHSIZE 128 // smaller matrices are factorized by a single kernel
+#define PSTRF_BLOCKSIZE 64
+
+// sytf2/sytrf
+#define SYTRF_SYTF2_SWITCHSIZE 128
+#define SYTRF_BLOCKSIZE 32
+#define SYTF2_SWITCHSIZE 64 // largest size factorized in registers by a single kernel (at most 64)
+
 // geqx2/geqxf
 #define GEQxF_GEQx2_SWITCHSIZE 128
 #define GEQxF_GEQx2_BLOCKSIZE 64
+#define GEQxF_LOOKAHEAD_MINSIZE 1024
+
+// geqp3
+#define GEQP3_BLOCKSIZE 32
 
 // gexq2/gexqf
 #define GExQF_GExQ2_SWITCHSIZE 128
 #define GExQF_GExQ2_BLOCKSIZE 64
+#define GExQF_LOOKAHEAD_MINSIZE 1024
 
 // gebd2/gebrd
 #define GEBRD_GEBD2_SWITCHSIZE 32
@@ -67,8 +94,47 @@
 // xxgs2/xxgst
 #define xxGST_xxGS2_BLOCKSIZE 64
 
+// bdsqr
+#define BDSQR_MAX_THDS 256 // max number of threads updating the singular vectors
+#define BDSQR_MAX_DEFERRED_SWEEPS 8 // number of QR steps recorded before they are applied
+
+// bdsvals
+#define BDSVALS_MAX_ITERS 100 // max number of dqds iterations per singular value
+
+// bdsdc
+#define BDSDC_MIN_DC_SIZE 32 // largest size solved directly with bdsqr (leaf size)
+
 // gesvd
 #define THIN_SVD_SWITCH 1.6
+#define GESVD_SMALL_MAX_SWEEPS 10 // max number of one-sided Jacobi sweeps when m, n <= 3
+
+// gesvdj
+#define GESVDJ_SMALL_MAXLDS 32768 // bytes of shared memory used to stage small matrices
+
+// gepolar
+#define GEPOLAR_QR_SWITCH 100
+#define GEPOLAR_MAX_SWEEPS 4 // max number of QDWH sweeps (each restarted from l0 = eps)
+
+// syev/heev
+#define SYEV_BISECTION_SWITCHSIZE 64 // smallest n using bisection when only eigenvalues are needed
+#define SYEV_SMALL_MAX_SWEEPS 10 // max number of Jacobi sweeps of the 3-by-3 closed-form kernel
+
+// syevj/heevj
+#define SYEVJ_MAX_THDS 256 // max number of threads applying the rotations to a matrix
+#define SYEVJ_SMALL_MAXLDS 32768 // bytes of shared memory used to stage small matrices
+
+// steqr
+#define STEQR_MAX_THDS 256 // max number of threads applying the rotations to the eigenvectors
+#define STEQR_MAX_DEFERRED_SWEEPS 8 // number of QL/QR sweeps recorded before they are applied
+
+// stedc
+#define STEDC_MIN_DC_SIZE 32 // largest size solved directly with steqr (size of the leaves)
+#define STEDC_MAX_SECULAR_ITERS 64 // max number of iterations to find a root of the secular eq.
+
+// stein
+#define STEIN_MAX_ITERS 5 // max number of inverse iterations for each eigenvector
+#define STEIN_EXTRA_ITERS 2 // number of iterations after the norm criterion is first satisfied
+#define STEIN_MAX_GROUPS 64 // max number of clusters of eigenvectors computed concurrently
 
 // THESE FOLLOWING VALUES ARE TO MATCH ROCBLAS C++ INTERFACE
 // THEY ARE DEFINED/TUNNED IN ROCBLAS
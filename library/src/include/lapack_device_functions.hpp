@@ -275,6 +275,138 @@ __device__ void gemm_kernel(const rocblas_int m,
     }
 }
 
+/** TRI_SMALL_DIM returns the size of the register arrays used to work with an
+    n-by-n triangular matrix in a single group (n <= 64). **/
+inline rocblas_int tri_small_dim(const rocblas_int n)
+{
+    return (n <= 8 ? 8 : (n <= 16 ? 16 : (n <= 32 ? 32 : 64)));
+}
+
+/** TRI_LOAD_REGS reads row i of the n-by-n upper triangular matrix A (or
+    column i, if A is lower triangular) into the local array rA. Entries to
+    the left of the diagonal are set to zero, and rows beyond n are padded
+    with the identity up to size DIM. **/
+template <rocblas_int DIM, typename T>
+__device__ void tri_load_regs(const bool upper,
+                              const rocblas_int i,
+                              const rocblas_int n,
+                              T* A,
+                              const rocblas_int lda,
+                              T* rA)
+{
+#pragma unroll
+    for(rocblas_int j = 0; j < DIM; j++)
+    {
+        if(i < n && j < n && j >= i)
+            rA[j] = upper ? A[i + j * lda] : A[j + i * lda];
+        else
+            rA[j] = (i == j ? 1 : 0);
+    }
+}
+
+/** TRI_STORE_REGS writes back the triangular row (or column) read by
+    TRI_LOAD_REGS. The diagonal element is not written if unit = true. **/
+template <rocblas_int DIM, typename T>
+__device__ void tri_store_regs(const bool upper,
+                               const bool unit,
+                               const rocblas_int i,
+                               const rocblas_int n,
+                               T* A,
+                               const rocblas_int lda,
+                               T* rA)
+{
+#pragma unroll
+    for(rocblas_int j = 0; j < DIM; j++)
+    {
+        if(i < n && j < n && (j > i || (j == i && !unit)))
+        {
+            if(upper)
+                A[i + j * lda] = rA[j];
+            else
+                A[j + i * lda] = rA[j];
+        }
+    }
+}
+
+/** TRTI2_REGS computes the inverse of a DIM-by-DIM upper triangular matrix
+    held in registers, where thread i keeps row i in rA. Lower triangular
+    matrices can be inverted by keeping their transpose. The shared arrays
+    common and diag must have size DIM. **/
+template <rocblas_int DIM, typename T>
+__device__ void trti2_regs(const bool unit, const rocblas_int i, T* rA, T* common, T* diag)
+{
+    // diagonal element
+#pragma unroll
+    for(rocblas_int j = 0; j < DIM; j++)
+    {
+        if(j == i)
+        {
+            if(unit)
+                rA[j] = 1;
+            else
+                rA[j] = 1.0 / rA[j];
+            diag[i] = rA[j];
+        }
+    }
+
+    // compute element i of each column j
+#pragma unroll
+    for(rocblas_int j = 1; j < DIM; j++)
+    {
+        // share current column
+        common[i] = rA[j];
+        __syncthreads();
+
+        if(i < j)
+        {
+            T temp = 0;
+#pragma unroll
+            for(rocblas_int k = 0; k < j; k++)
+            {
+                if(k >= i)
+                    temp += rA[k] * common[k];
+            }
+
+            rA[j] = -diag[j] * temp;
+        }
+        __syncthreads();
+    }
+}
+
+/** LAUU2_REGS computes the product U * U' of a DIM-by-DIM upper triangular
+    matrix U held in registers, where thread i keeps row i in rA. The upper
+    triangular part of the result overwrites rA. The shared array common must
+    have size DIM. **/
+template <rocblas_int DIM, typename T>
+__device__ void lauu2_regs(const rocblas_int i, T* rA, T* common)
+{
+    // row j of U is only needed to compute column j of the result, so the
+    // rows can be overwritten in order
+#pragma unroll
+    for(rocblas_int j = 0; j < DIM; j++)
+    {
+        // share row j
+        if(i == j)
+        {
+#pragma unroll
+            for(rocblas_int k = j; k < DIM; k++)
+                common[k] = rA[k];
+        }
+        __syncthreads();
+
+        if(i <= j)
+        {
+            T temp = 0;
+#pragma unroll
+            for(rocblas_int k = j; k < DIM; k++)
+                temp += rA[k] * sconj(common[k]);
+
+            rA[j] = temp;
+        }
+        __syncthreads();
+    }
+}
+
 /** LARTG device function computes the sine (s) and cosine (c) values
     to create a givens rotation such that:
     [  c s ]' * [ f ] = [ r ]
@@ -313,6 +445,96 @@ __device__ void lartg(T& f, T& g, T& c, T& s, T& r)
     }
 }
 
+/** LARTG device function computes the cosine (c) and sine (s) values
+    to create a complex givens rotation such that:
+    [  c     s ]' * [ f ] = [ r ]
+    [ -s'    c ]    [ g ]   [ 0 ]
+    where c is real and s' is the conjugate of s **/
+template <typename T, typename S, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ void lartg(T& f, T& g, S& c, T& s, T& r)
+{
+    if(g == 0)
+    {
+        c = 1;
+        s = 0;
+        r = f;
+    }
+    else if(f == 0)
+    {
+        c = 0;
+        s = 1;
+        r = -g;
+    }
+    else
+    {
+        S af = std::abs(f);
+        S ag = std::abs(g);
+        S t, rho;
+        if(ag > af)
+        {
+            t = af / ag;
+            rho = ag * std::sqrt(1 + t * t);
+        }
+        else
+        {
+            t = ag / af;
+            rho = af * std::sqrt(1 + t * t);
+        }
+        c = af / rho;
+        s = -(f / af) * conj(g) / rho;
+        r = (f / af) * rho;
+    }
+}
+
+/** ROT device function applies a givens rotation (as computed by LARTG)
+    to the vectors x and y, i.e.:
+    [ x ] = [  c     s ]' * [ x ]
+    [ y ]   [ -s'    c ]    [ y ]
+    All the threads in the x dimension of the group cooperate. **/
+template <typename T, typename S>
+__device__ void rot(const rocblas_int n,
+                    T* x,
+                    const rocblas_int incx,
+                    T* y,
+                    const rocblas_int incy,
+                    const S c,
+                    const T s)
+{
+    T temp;
+    for(rocblas_int i = hipThreadIdx_x; i < n; i += hipBlockDim_x)
+    {
+        temp = x[i * incx];
+        x[i * incx] = c * temp - s * y[i * incy];
+        y[i * incy] = sconj(s) * temp + c * y[i * incy];
+    }
+}
+
+/** JACOBI_ROT device function computes the cosine (c) and sine (s) values
+    of the Jacobi rotation that diagonalizes the 2-by-2 hermitian matrix M, i.e.:
+    [  c  -s ] * [ a   g ] * [  c  -s ]' = [ x  0 ]
+    [  s'  c ]   [ g'  b ]   [  s'  c ]    [ 0  y ]
+    where c is real and s' is the conjugate of s. Applied from the right to the
+    columns x and y of a matrix, the rotation gives c*x - s'*y and s*x + c*y. **/
+template <typename T, typename S>
+__device__ void jacobi_rot(const S a, const S b, const T g, S& c, T& s)
+{
+    S ag = std::abs(g);
+    if(ag == 0)
+    {
+        c = 1;
+        s = 0;
+    }
+    else
+    {
+        S theta = (b - a) / (2 * ag);
+        S t = 1 / (std::abs(theta) + std::sqrt(1 + theta * theta));
+        if(theta < 0)
+            t = -t;
+        c = 1 / std::sqrt(1 + t * t);
+        s = g * T(t * c / ag);
+    }
+}
+
 /** LASR device function applies a sequence of rotations P(i) i=1,2,...z
     to a m-by-n matrix A from either the left (P*A with z=m) or the right (A*P'
     with z=n). P = P(z-1)*...*P(1) if forward direction, P = P(1)*...*P(z-1) if
@@ -32,6 +32,20 @@ __device__ S aabs(T val)
     return asum(val);
 }
 
+/** SCONJ returns the complex conjugate of a complex scalar, and the
+    scalar itself if it is real **/
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ T sconj(T scalar)
+{
+    return scalar;
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ T sconj(T scalar)
+{
+    return conj(scalar);
+}
+
 template <typename T>
 __device__ void swap(const rocblas_int n, T* a, const rocblas_int inca, T* b, const rocblas_int incb)
 {
@@ -82,6 +96,62 @@ __device__ void scale_tridiag(const rocblas_int start, const rocblas_int end, T*
     }
 }
 
+/** BLOCK_REDUCE_SUM returns the sum of the values val given by all the
+    threads in the group. It must be called by all the BLOCKSIZE threads,
+    and uses the shared array sval of size BLOCKSIZE **/
+template <typename T>
+__device__ T block_reduce_sum(T val, T* sval)
+{
+    const auto tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            sval[tid] += sval[tid + s];
+        __syncthreads();
+    }
+
+    val = sval[0];
+    __syncthreads();
+    return val;
+}
+
+/** BLOCK_REDUCE_MAX returns the largest of the values val given by all the
+    threads in the group, together with its index idx (ties are resolved in favor of
+    the smallest index). It must be called by all the BLOCKSIZE threads, and uses
+    the shared arrays sval and sidx of size BLOCKSIZE **/
+template <typename S>
+__device__ S block_reduce_max(S val, rocblas_int& idx, S* sval, rocblas_int* sidx)
+{
+    const auto tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    sidx[tid] = idx;
+    __syncthreads();
+
+    for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+        {
+            if(sval[tid + s] > sval[tid]
+               || (sval[tid + s] == sval[tid] && sidx[tid + s] < sidx[tid]))
+            {
+                sval[tid] = sval[tid + s];
+                sidx[tid] = sidx[tid + s];
+            }
+        }
+        __syncthreads();
+    }
+
+    val = sval[0];
+    idx = sidx[0];
+    __syncthreads();
+    return val;
+}
+
 // **********************************************************
 // GPU kernels that are used by many rocsolver functions
 // **********************************************************
@@ -312,6 +382,46 @@ __global__ void copy_mat(const rocblas_int m,
     }
 }
 
+/** COPY_TRANS_MAT copies the conjugate transpose of the m-by-n array A into
+    the n-by-m array B. Each tile of A is staged in shared memory so that both
+    the reads from A and the writes to B are coalesced.
+    Call this kernel with BS-by-BS groups of threads. **/
+template <typename T, typename U1, typename U2>
+__global__ void copy_trans_mat(const rocblas_int m,
+                               const rocblas_int n,
+                               U1 A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               U2 B,
+                               const rocblas_int shiftB,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto tx = hipThreadIdx_x;
+    const auto ty = hipThreadIdx_y;
+
+    // (the extra column avoids bank conflicts when reading the tile transposed)
+    __shared__ T tile[BS][BS + 1];
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+
+    // read tile of A
+    rocblas_int i = hipBlockIdx_x * BS + tx;
+    rocblas_int j = hipBlockIdx_y * BS + ty;
+    if(i < m && j < n)
+        tile[ty][tx] = sconj(Ap[i + j * lda]);
+    __syncthreads();
+
+    // write transposed tile into B
+    i = hipBlockIdx_y * BS + tx;
+    j = hipBlockIdx_x * BS + ty;
+    if(i < n && j < m)
+        Bp[i + j * ldb] = tile[tx][ty];
+}
+
 template <typename T, typename U>
 __global__ void copyshift_right(const bool copy,
                                 const rocblas_int dim,
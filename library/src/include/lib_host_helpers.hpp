@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include "rocblascommon/utility.hpp"
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
 #include <hip/hip_runtime.h>
 #include <limits>
+#include <memory>
 #include <rocblas.h>
+#include <unordered_map>
 
 /*
  * ===========================================================================
@@ -80,6 +83,82 @@ T* const* cast2constPointer(T** array)
     return array;
 }
 
+/** ROCSOLVER_LOOKAHEAD_STREAM holds the second stream, the events, and a rocblas handle
+    bound to that stream, used by the blocked factorizations with look-ahead. The objects
+    are created on first use and cached per thread and device (see
+    rocsolver_get_lookahead_stream), so the factorizations do not create them on every
+    call and never change the stream of the user's handle. **/
+struct rocsolver_lookahead_stream
+{
+    hipStream_t stream = nullptr;
+    hipEvent_t update_done = nullptr;
+    hipEvent_t panel_done = nullptr;
+    rocblas_handle handle = nullptr;
+
+    rocsolver_lookahead_stream() = default;
+    rocsolver_lookahead_stream(const rocsolver_lookahead_stream&) = delete;
+    rocsolver_lookahead_stream& operator=(const rocsolver_lookahead_stream&) = delete;
+
+    rocblas_status init()
+    {
+        hipError_t status = hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+        if(status == hipSuccess)
+            status = hipEventCreateWithFlags(&update_done, hipEventDisableTiming);
+        if(status == hipSuccess)
+            status = hipEventCreateWithFlags(&panel_done, hipEventDisableTiming);
+        if(status != hipSuccess)
+            return get_rocblas_status_for_hip_status(status);
+
+        rocblas_status st = rocblas_create_handle(&handle);
+        if(st == rocblas_status_success)
+            st = rocblas_set_stream(handle, stream);
+        return st;
+    }
+
+    ~rocsolver_lookahead_stream()
+    {
+        if(handle)
+            (void)rocblas_destroy_handle(handle);
+        if(panel_done)
+            (void)hipEventDestroy(panel_done);
+        if(update_done)
+            (void)hipEventDestroy(update_done);
+        if(stream)
+            (void)hipStreamDestroy(stream);
+    }
+};
+
+/** ROCSOLVER_GET_LOOKAHEAD_STREAM returns in la the look-ahead objects of the calling
+    thread and the current device, creating them the first time. The pointer mode of the
+    cached handle is set to the one of handle. **/
+inline rocblas_status rocsolver_get_lookahead_stream(rocblas_handle handle,
+                                                     rocsolver_lookahead_stream** la)
+{
+    thread_local std::unordered_map<int, std::unique_ptr<rocsolver_lookahead_stream>> cache;
+
+    int device;
+    hipError_t status = hipGetDevice(&device);
+    if(status != hipSuccess)
+        return get_rocblas_status_for_hip_status(status);
+
+    std::unique_ptr<rocsolver_lookahead_stream>& entry = cache[device];
+    if(!entry)
+    {
+        auto created = std::make_unique<rocsolver_lookahead_stream>();
+        rocblas_status st = created->init();
+        if(st != rocblas_status_success)
+            return st;
+        entry = std::move(created);
+    }
+
+    rocblas_pointer_mode mode;
+    rocblas_get_pointer_mode(handle, &mode);
+    rocblas_set_pointer_mode(entry->handle, mode);
+
+    *la = entry.get();
+    return rocblas_status_success;
+}
+
 #ifdef ROCSOLVER_VERIFY_ASSUMPTIONS
 // Ensure __assert_fail is declared.
 #if !__is_identifier(__assert_fail)
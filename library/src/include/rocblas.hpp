@@ -885,6 +885,47 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
         strideB, batch_count);
 }
 
+// trmm overload
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocblasCall_trmm(rocblas_handle handle,
+                                rocblas_side side,
+                                rocblas_fill uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal diag,
+                                rocblas_int m,
+                                rocblas_int n,
+                                U alpha,
+                                rocblas_stride stride_alpha,
+                                T* A,
+                                rocblas_int offsetA,
+                                rocblas_int lda,
+                                rocblas_stride strideA,
+                                T* const B[],
+                                rocblas_int offsetB,
+                                rocblas_int ldb,
+                                rocblas_stride strideB,
+                                rocblas_int batch_count,
+                                T** workArr)
+{
+    // TODO: How to get alpha for trace logging
+    ROCBLAS_ENTER("trmm", "side:", side, "uplo:", uplo, "trans:", transA, "diag:", diag, "m:", m,
+                  "n:", n, "shiftA:", offsetA, "lda:", lda, "shiftB:", offsetB, "ldb:", ldb,
+                  "bc:", batch_count);
+
+    constexpr rocblas_int nb = (!is_complex<T> ? ROCBLAS_TRMM_REAL_NB : ROCBLAS_TRMM_COMPLEX_NB);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, A, strideA,
+                       batch_count);
+
+    return rocblas_trmm_recursive_template<nb, BATCHED, T>(
+        handle, side, uplo, transA, diag, m, n, cast2constType<T>(alpha), stride_alpha,
+        cast2constType<T>(workArr), offsetA, lda, strideA, B, offsetB, ldb, strideB, batch_count);
+}
+
 // syr2
 template <typename T, typename U, typename V, std::enable_if_t<!is_complex<T>, int> = 0>
 rocblas_status rocblasCall_syr2_her2(rocblas_handle handle,
@@ -1153,6 +1194,49 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
         offsetC, ldc, strideC, batch_count);
 }
 
+// syr2k overload
+template <typename T, typename Ua, typename Ub, std::enable_if_t<!is_complex<T>, int> = 0>
+rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_operation trans,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       Ua alpha,
+                                       T* A,
+                                       rocblas_int offsetA,
+                                       rocblas_int lda,
+                                       rocblas_stride strideA,
+                                       T* B,
+                                       rocblas_int offsetB,
+                                       rocblas_int ldb,
+                                       rocblas_stride strideB,
+                                       Ub beta,
+                                       T* const C[],
+                                       rocblas_int offsetC,
+                                       rocblas_int ldc,
+                                       rocblas_stride strideC,
+                                       rocblas_int batch_count,
+                                       T** work)
+{
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER("syr2k", "uplo:", uplo, "trans:", trans, "n:", n, "k:", k, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA, batch_count);
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, B,
+                       strideB, batch_count);
+
+    return rocblas_syr2k_template<true>(
+        handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(work), offsetA, lda,
+        strideA, cast2constType<T>(work + batch_count), offsetB, ldb, strideB,
+        cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
+}
+
 // her2k
 template <typename T, typename Ua, typename Ub, typename V, std::enable_if_t<is_complex<T>, int> = 0>
 rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
@@ -1233,6 +1317,129 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
         offsetC, ldc, strideC, batch_count);
 }
 
+// her2k overload
+template <typename T, typename Ua, typename Ub, std::enable_if_t<is_complex<T>, int> = 0>
+rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_operation trans,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       Ua alpha,
+                                       T* A,
+                                       rocblas_int offsetA,
+                                       rocblas_int lda,
+                                       rocblas_stride strideA,
+                                       T* B,
+                                       rocblas_int offsetB,
+                                       rocblas_int ldb,
+                                       rocblas_stride strideB,
+                                       Ub beta,
+                                       T* const C[],
+                                       rocblas_int offsetC,
+                                       rocblas_int ldc,
+                                       rocblas_stride strideC,
+                                       rocblas_int batch_count,
+                                       T** work)
+{
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER("her2k", "uplo:", uplo, "trans:", trans, "n:", n, "k:", k, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA, batch_count);
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, B,
+                       strideB, batch_count);
+
+    return rocblas_her2k_template<true>(
+        handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(work), offsetA, lda,
+        strideA, cast2constType<T>(work + batch_count), offsetB, ldb, strideB,
+        cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
+}
+
+// syr2k (symmetric also for complex types)
+template <typename T, typename U, typename V>
+rocblas_status rocblasCall_syr2k(rocblas_handle handle,
+                                 rocblas_fill uplo,
+                                 rocblas_operation trans,
+                                 rocblas_int n,
+                                 rocblas_int k,
+                                 U alpha,
+                                 V A,
+                                 rocblas_int offsetA,
+                                 rocblas_int lda,
+                                 rocblas_stride strideA,
+                                 V B,
+                                 rocblas_int offsetB,
+                                 rocblas_int ldb,
+                                 rocblas_stride strideB,
+                                 U beta,
+                                 V C,
+                                 rocblas_int offsetC,
+                                 rocblas_int ldc,
+                                 rocblas_stride strideC,
+                                 rocblas_int batch_count,
+                                 T** work = nullptr)
+{
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER("syr2k", "uplo:", uplo, "trans:", trans, "n:", n, "k:", k, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    return rocblas_syr2k_template<true>(
+        handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
+        strideA, cast2constType<T>(B), offsetB, ldb, strideB, cast2constType<T>(beta), C, offsetC,
+        ldc, strideC, batch_count);
+}
+
+// syr2k overload
+template <typename T, typename U>
+rocblas_status rocblasCall_syr2k(rocblas_handle handle,
+                                 rocblas_fill uplo,
+                                 rocblas_operation trans,
+                                 rocblas_int n,
+                                 rocblas_int k,
+                                 U alpha,
+                                 T* A,
+                                 rocblas_int offsetA,
+                                 rocblas_int lda,
+                                 rocblas_stride strideA,
+                                 T* B,
+                                 rocblas_int offsetB,
+                                 rocblas_int ldb,
+                                 rocblas_stride strideB,
+                                 U beta,
+                                 T* const C[],
+                                 rocblas_int offsetC,
+                                 rocblas_int ldc,
+                                 rocblas_stride strideC,
+                                 rocblas_int batch_count,
+                                 T** work)
+{
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER("syr2k", "uplo:", uplo, "trans:", trans, "n:", n, "k:", k, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA, batch_count);
+    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, B,
+                       strideB, batch_count);
+
+    return rocblas_syr2k_template<true>(
+        handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(work), offsetA, lda,
+        strideA, cast2constType<T>(work + batch_count), offsetB, ldb, strideB,
+        cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
+}
+
 // symv
 template <typename T, typename U, typename V, std::enable_if_t<!is_complex<T>, int> = 0>
 rocblas_status rocblasCall_symv_hemv(rocblas_handle handle,
@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gecon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_impl(rocblas_handle handle,
+                                    const rocblas_norm_type norm_type,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    const S* anorm,
+                                    S* rcond)
+{
+    ROCSOLVER_ENTER_TOP("gecon", "--norm", norm_type, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gecon_argCheck(handle, norm_type, n, lda, A, anorm, rcond);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the iterate in the estimation of the norm of the inverse
+    size_t size_work;
+    rocsolver_gecon_getMemorySize<T>(n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_gecon_template<T>(handle, norm_type, n, A, shiftA, lda, strideA, anorm, rcond,
+                                       batch_count, (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgecon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                const float* anorm,
+                                float* rcond)
+{
+    return rocsolver_gecon_impl<float>(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+rocblas_status rocsolver_dgecon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                const double* anorm,
+                                double* rcond)
+{
+    return rocsolver_gecon_impl<double>(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+rocblas_status rocsolver_cgecon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                const float* anorm,
+                                float* rcond)
+{
+    return rocsolver_gecon_impl<rocblas_float_complex>(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+rocblas_status rocsolver_zgecon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                const double* anorm,
+                                double* rcond)
+{
+    return rocsolver_gecon_impl<rocblas_double_complex>(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+} // extern C
@@ -0,0 +1,453 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** The factorization of A from which the reciprocal condition number is estimated:
+    con_lu is P*A = L*U as given by GETRF, con_cholesky is A = U'*U or A = L*L' as given
+    by POTRF, and con_triangular is the triangular matrix A itself **/
+typedef enum con_factor_
+{
+    con_lu,
+    con_cholesky,
+    con_triangular,
+} con_factor;
+
+/** CON_SIGN returns the sign of a real scalar, or the complex scalar scaled to
+    have absolute value one (as in LAPACK's LACN2) **/
+template <typename T, typename S, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ T con_sign(T x, const S safmin)
+{
+    return x >= 0 ? T(1) : T(-1);
+}
+
+template <typename T, typename S, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ T con_sign(T x, const S safmin)
+{
+    S absx = std::abs(x);
+    return absx > safmin ? x / absx : T(1);
+}
+
+/** CON_JVAL returns the value that LACN2 compares with the largest absolute value of
+    the current iterate to decide whether the iteration has converged **/
+template <typename S, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ S con_jval(T x)
+{
+    return x;
+}
+
+template <typename S, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ S con_jval(T x)
+{
+    return std::abs(x);
+}
+
+/** CON_ASUM returns the sum of the absolute values of the n elements of x.
+    All the BLOCKSIZE threads in the group must call this function **/
+template <typename T, typename S>
+__device__ S con_asum(const rocblas_int n, T* x, S* sval)
+{
+    const auto tid = hipThreadIdx_x;
+
+    S val = 0;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+        val += std::abs(x[i]);
+
+    return block_reduce_sum(val, sval);
+}
+
+/** CON_IAMAX returns the (first) index of the element of x with largest absolute value.
+    All the BLOCKSIZE threads in the group must call this function **/
+template <typename T, typename S>
+__device__ rocblas_int con_iamax(const rocblas_int n, T* x, S* sval, rocblas_int* sidx)
+{
+    const auto tid = hipThreadIdx_x;
+
+    S val = -1, temp;
+    rocblas_int idx = n;
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        temp = std::abs(x[i]);
+        if(temp > val)
+        {
+            val = temp;
+            idx = i;
+        }
+    }
+
+    block_reduce_max(val, idx, sval, sidx);
+    return idx;
+}
+
+/** CON_TRSV overwrites x with the solution of the triangular system op(A)*y = x,
+    where op(A) = A if trans is false, or op(A) = A' if trans is true.
+    All the BLOCKSIZE threads in the group must call this function **/
+template <typename T>
+__device__ void con_trsv(const rocblas_fill uplo,
+                         const bool trans,
+                         const rocblas_diagonal diag,
+                         const rocblas_int n,
+                         T* A,
+                         const rocblas_int lda,
+                         T* x,
+                         T* sval)
+{
+    const auto tid = hipThreadIdx_x;
+    const bool upper = (uplo == rocblas_fill_upper);
+    rocblas_int j;
+    T temp;
+
+    if(!trans)
+    {
+        // column oriented substitution: once x(j) is known, the rest of the
+        // elements of x are updated in parallel
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            j = upper ? n - 1 - k : k;
+
+            if(tid == 0 && diag == rocblas_diagonal_non_unit)
+                x[j] = x[j] / A[j + j * lda];
+            __syncthreads();
+
+            temp = x[j];
+            if(upper)
+            {
+                for(rocblas_int i = tid; i < j; i += BLOCKSIZE)
+                    x[i] = x[i] - temp * A[i + j * lda];
+            }
+            else
+            {
+                for(rocblas_int i = j + 1 + tid; i < n; i += BLOCKSIZE)
+                    x[i] = x[i] - temp * A[i + j * lda];
+            }
+            __syncthreads();
+        }
+    }
+
+    else
+    {
+        // row oriented substitution: x(j) is computed with a dot product
+        // of the (contiguous) column j of A and the known elements of x
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            j = upper ? k : n - 1 - k;
+
+            temp = 0;
+            if(upper)
+            {
+                for(rocblas_int i = tid; i < j; i += BLOCKSIZE)
+                    temp += sconj(A[i + j * lda]) * x[i];
+            }
+            else
+            {
+                for(rocblas_int i = j + 1 + tid; i < n; i += BLOCKSIZE)
+                    temp += sconj(A[i + j * lda]) * x[i];
+            }
+            temp = block_reduce_sum(temp, sval);
+
+            if(tid == 0)
+            {
+                temp = x[j] - temp;
+                x[j] = (diag == rocblas_diagonal_non_unit) ? temp / sconj(A[j + j * lda]) : temp;
+            }
+            __syncthreads();
+        }
+    }
+}
+
+/** CON_SOLVE overwrites x with inv(A)*x if trans is false, or with inv(A')*x if
+    trans is true, using the given factorization of A.
+    All the BLOCKSIZE threads in the group must call this function **/
+template <typename T>
+__device__ void con_solve(const con_factor factor,
+                          const bool trans,
+                          const rocblas_fill uplo,
+                          const rocblas_diagonal diag,
+                          const rocblas_int n,
+                          T* A,
+                          const rocblas_int lda,
+                          T* x,
+                          T* sval)
+{
+    if(factor == con_lu)
+    {
+        // inv(A) = inv(U)*inv(L) and inv(A') = inv(L')*inv(U')
+        // (the row permutations do not change the norms)
+        if(!trans)
+        {
+            con_trsv(rocblas_fill_lower, false, rocblas_diagonal_unit, n, A, lda, x, sval);
+            con_trsv(rocblas_fill_upper, false, rocblas_diagonal_non_unit, n, A, lda, x, sval);
+        }
+        else
+        {
+            con_trsv(rocblas_fill_upper, true, rocblas_diagonal_non_unit, n, A, lda, x, sval);
+            con_trsv(rocblas_fill_lower, true, rocblas_diagonal_unit, n, A, lda, x, sval);
+        }
+    }
+
+    else if(factor == con_cholesky)
+    {
+        // A is hermitian: inv(A) = inv(U)*inv(U') or inv(A) = inv(L')*inv(L)
+        const bool upper = (uplo == rocblas_fill_upper);
+        con_trsv(uplo, upper, rocblas_diagonal_non_unit, n, A, lda, x, sval);
+        con_trsv(uplo, !upper, rocblas_diagonal_non_unit, n, A, lda, x, sval);
+    }
+
+    else
+        con_trsv(uplo, trans, diag, n, A, lda, x, sval);
+}
+
+/** CON_KERNEL estimates the reciprocal of the condition number of a n-by-n matrix A,
+    in the 1-norm (if onenorm is true) or the infinity-norm, given the norm of A in anorm
+    and the factorization of A indicated by factor. The norm of inv(A) is estimated with
+    Hager's method, as refined by Higham (LAPACK's LACN2): only a few triangular solves
+    with the factors are needed, so that the cost is O(n^2) instead of the O(n^3) required
+    to compute the inverse.
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) con_kernel(const con_factor factor,
+                                                        const bool onenorm,
+                                                        const rocblas_fill uplo,
+                                                        const rocblas_diagonal diag,
+                                                        const rocblas_int n,
+                                                        U AA,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        const S* anormA,
+                                                        S* rcondA,
+                                                        T* WW,
+                                                        const S safmin)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int itmax = 5;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* x = WW + b * 2 * rocblas_stride(n);
+    T* sgn = x + n;
+
+    __shared__ T tval[BLOCKSIZE];
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    S anorm = anormA[b];
+    S est, estold, temp;
+    rocblas_int j, jlast, iter;
+
+    // quick return if A is zero
+    if(anorm == 0)
+    {
+        if(tid == 0)
+            rcondA[b] = 0;
+        return;
+    }
+
+    // quick return if A is singular
+    temp = 0;
+    if(factor != con_triangular || diag == rocblas_diagonal_non_unit)
+    {
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+        {
+            if(A[i + i * lda] == 0)
+                temp = 1;
+        }
+    }
+    temp = block_reduce_sum(temp, sval);
+    if(temp > 0)
+    {
+        if(tid == 0)
+            rcondA[b] = 0;
+        return;
+    }
+
+    // the 1-norm of inv(A) is estimated by applying inv(A) (kase 1) and inv(A') (kase 2);
+    // the infinity-norm of inv(A) is the 1-norm of inv(A'), and so the roles are exchanged
+    const bool kase1 = !onenorm;
+    const bool kase2 = onenorm;
+
+    // start with x = [1/n, ..., 1/n]
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+        x[i] = T(S(1) / S(n));
+    __syncthreads();
+
+    con_solve(factor, kase1, uplo, diag, n, A, lda, x, tval);
+
+    if(n == 1)
+    {
+        est = std::abs(x[0]);
+        if(tid == 0)
+            rcondA[b] = (1 / est) / anorm;
+        return;
+    }
+
+    est = con_asum(n, x, sval);
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        x[i] = con_sign(x[i], safmin);
+        sgn[i] = x[i];
+    }
+    __syncthreads();
+
+    con_solve(factor, kase2, uplo, diag, n, A, lda, x, tval);
+    j = con_iamax(n, x, sval, sidx);
+    iter = 2;
+
+    // main iteration: x = e_j
+    while(true)
+    {
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+            x[i] = (i == j) ? T(1) : T(0);
+        __syncthreads();
+
+        con_solve(factor, kase1, uplo, diag, n, A, lda, x, tval);
+        estold = est;
+        est = con_asum(n, x, sval);
+
+        // (real case) stop if the signs are repeated
+        if(!is_complex<T>)
+        {
+            temp = 0;
+            for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+            {
+                if(con_sign(x[i], safmin) != sgn[i])
+                    temp = 1;
+            }
+            if(block_reduce_sum(temp, sval) == 0)
+                break;
+        }
+
+        // stop if there is no improvement
+        if(est <= estold)
+            break;
+
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+        {
+            x[i] = con_sign(x[i], safmin);
+            sgn[i] = x[i];
+        }
+        __syncthreads();
+
+        con_solve(factor, kase2, uplo, diag, n, A, lda, x, tval);
+        jlast = j;
+        j = con_iamax(n, x, sval, sidx);
+
+        // stop if the largest element did not change, or after itmax iterations
+        if(con_jval<S>(x[jlast]) == std::abs(x[j]) || iter >= itmax)
+            break;
+        iter++;
+    }
+
+    // iterative refinement: try x = [1, -(1+1/(n-1)), 1+2/(n-1), ...]
+    for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+    {
+        temp = 1 + S(i) / S(n - 1);
+        x[i] = (i % 2 == 0) ? T(temp) : T(-temp);
+    }
+    __syncthreads();
+
+    con_solve(factor, kase1, uplo, diag, n, A, lda, x, tval);
+    temp = 2 * con_asum(n, x, sval) / S(3 * n);
+    est = temp > est ? temp : est;
+
+    if(tid == 0)
+        rcondA[b] = (est != 0) ? (1 / est) / anorm : 0;
+}
+
+template <typename T>
+void rocsolver_gecon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the iterate x and of its signs in the 1-norm estimation
+    *size_work = sizeof(T) * 2 * n * batch_count;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gecon_argCheck(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_template(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        T* work)
+{
+    ROCSOLVER_ENTER("gecon", "norm_type:", norm_type, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions (the empty matrix is perfectly conditioned)
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, rcond,
+                           batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // every step of the estimation depends on the previous one, so the
+    // estimate for every matrix in the batch is computed by a single group of threads
+    S safmin = get_safemin<S>();
+    hipLaunchKernelGGL(con_kernel<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, con_lu,
+                       norm_type == rocblas_norm_one, rocblas_fill_full, rocblas_diagonal_non_unit,
+                       n, A, shiftA, lda, strideA, anorm, rcond, work, safmin);
+
+    return rocblas_status_success;
+}
@@ -37,18 +37,19 @@ rocblas_status rocsolver_gelq2_impl(rocblas_handle handle,
     size_t size_work_workArr;
     // extra requirements for calling LARF and LARFG
     size_t size_Abyx_norms;
-    // size of temporary array to store diagonal elements
-    size_t size_diag;
+    // size of temporary array to store diagonal elements and the transposed copy of A
+    size_t size_diag_Atmp;
     rocsolver_gelq2_getMemorySize<T, false>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                            &size_Abyx_norms, &size_diag);
+                                            &size_Abyx_norms, &size_diag_Atmp);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
-                                                      size_Abyx_norms, size_diag);
+                                                      size_Abyx_norms, size_diag_Atmp);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms, *diag;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_diag);
+    void *scalars, *work_workArr, *Abyx_norms, *diag_Atmp;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms,
+                              size_diag_Atmp);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -56,14 +57,14 @@ rocblas_status rocsolver_gelq2_impl(rocblas_handle handle,
     scalars = mem[0];
     work_workArr = mem[1];
     Abyx_norms = mem[2];
-    diag = mem[3];
+    diag_Atmp = mem[3];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
     // execution
     return rocsolver_gelq2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, stridep,
                                        batch_count, (T*)scalars, work_workArr, (T*)Abyx_norms,
-                                       (T*)diag);
+                                       (T*)diag_Atmp);
 }
 
 /*
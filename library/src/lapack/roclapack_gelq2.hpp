@@ -9,10 +9,8 @@
 
 #pragma once
 
-#include "auxiliary/rocauxiliary_lacgv.hpp"
-#include "auxiliary/rocauxiliary_larf.hpp"
-#include "auxiliary/rocauxiliary_larfg.hpp"
 #include "rocblas.hpp"
+#include "roclapack_geqr2.hpp"
 #include "rocsolver.h"
 
 template <typename T, bool BATCHED>
@@ -22,7 +20,7 @@ void rocsolver_gelq2_getMemorySize(const rocblas_int m,
                                    size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms,
-                                   size_t* size_diag)
+                                   size_t* size_diag_Atmp)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
@@ -30,21 +28,18 @@ void rocsolver_gelq2_getMemorySize(const rocblas_int m,
         *size_scalars = 0;
         *size_work_workArr = 0;
         *size_Abyx_norms = 0;
-        *size_diag = 0;
+        *size_diag_Atmp = 0;
         return;
     }
 
-    // size of Abyx_norms is maximum of what is needed by larf and larfg
-    // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
-    size_t s1, s2, w1, w2;
-    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_right, m, n, batch_count, size_scalars,
-                                             &s1, &w1);
-    rocsolver_larfg_getMemorySize<T>(n, batch_count, &w2, &s2);
-    *size_work_workArr = max(w1, w2);
-    *size_Abyx_norms = max(s1, s2);
-
-    // size of array to store temporary diagonal values
-    *size_diag = sizeof(T) * batch_count;
+    // requirements for calling GEQR2 on the n-by-m copy of A'
+    // (the copy is always strided, even in the batched case)
+    size_t size_diag;
+    rocsolver_geqr2_getMemorySize<T, false>(n, m, batch_count, size_scalars, size_work_workArr,
+                                            size_Abyx_norms, &size_diag);
+
+    // size of array to store temporary diagonal values, followed by the copy of A'
+    *size_diag_Atmp = size_diag + sizeof(T) * m * n * batch_count;
 }
 
 template <typename T, typename U>
@@ -76,7 +71,7 @@ rocblas_status rocsolver_gelq2_gelqf_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = is_complex<T>>
+template <typename T, typename U>
 rocblas_status rocsolver_gelq2_template(rocblas_handle handle,
                                         const rocblas_int m,
                                         const rocblas_int n,
@@ -90,7 +85,7 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle,
                                         T* scalars,
                                         void* work_workArr,
                                         T* Abyx_norms,
-                                        T* diag)
+                                        T* diag_Atmp)
 {
     ROCSOLVER_ENTER("gelq2", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
 
@@ -101,43 +96,29 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int dim = min(m, n); // total number of pivots
-    rocblas_int blocks = (n - 1) / 1024 + 1;
-
-    for(rocblas_int j = 0; j < dim; ++j)
-    {
-        // conjugate the jth row of A
-        if(COMPLEX)
-            rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        batch_count);
-
-        // generate Householder reflector to work on row j
-        rocsolver_larfg_template(handle, n - j, A, shiftA + idx2D(j, j, lda), A,
-                                 shiftA + idx2D(j, min(j + 1, n - 1), lda), lda, strideA,
-                                 (ipiv + j), strideP, batch_count, (T*)work_workArr, Abyx_norms);
-
-        // insert one in A(j,j) tobuild/apply the householder matrix
-        hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag, 0,
-                           1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, true);
-
-        // Apply Householder reflector to the rest of matrix from the right
-        if(j < m - 1)
-        {
-            rocsolver_larf_template(handle, rocblas_side_right, m - j - 1, n - j, A,
-                                    shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, A,
-                                    shiftA + idx2D(j + 1, j, lda), lda, strideA, batch_count,
-                                    scalars, Abyx_norms, (T**)work_workArr);
-        }
-
-        // restore original value of A(j,j)
-        hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag,
-                           0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1);
-
-        // restore the jth row of A
-        if(COMPLEX)
-            rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        batch_count);
-    }
+    // The LQ factorization of A is the conjugate transpose of the QR factorization of A'
+    // (with the same Householder scalars). Factorizing the columns of A' instead of the rows
+    // of A avoids the strided row accesses and the conjugation of every row in the complex
+    // case.
+    T* diag = diag_Atmp;
+    T* Atmp = diag_Atmp + batch_count;
+    rocblas_int ldt = n;
+    rocblas_stride strideT = rocblas_stride(ldt) * m;
+
+    rocblas_int blocks_m = (m - 1) / BS + 1;
+    rocblas_int blocks_n = (n - 1) / BS + 1;
+
+    // copy A' into the workspace
+    hipLaunchKernelGGL(copy_trans_mat<T>, dim3(blocks_m, blocks_n, batch_count), dim3(BS, BS), 0,
+                       stream, m, n, A, shiftA, lda, strideA, Atmp, 0, ldt, strideT);
+
+    // compute the QR factorization of A'
+    rocsolver_geqr2_template<T>(handle, n, m, Atmp, 0, ldt, strideT, ipiv, strideP, batch_count,
+                                scalars, work_workArr, Abyx_norms, diag);
+
+    // copy the result back into A
+    hipLaunchKernelGGL(copy_trans_mat<T>, dim3(blocks_n, blocks_m, batch_count), dim3(BS, BS), 0,
+                       stream, n, m, Atmp, 0, ldt, strideT, A, shiftA, lda, strideA);
 
     return rocblas_status_success;
 }
@@ -45,15 +45,20 @@ void rocsolver_gelqf_getMemorySize(const rocblas_int m,
     }
     else
     {
-        size_t w1, w2, unused, s1, s2;
+        size_t w1, w2, w3, unused, s1, s2, s3, s4, s5;
         rocblas_int jb = GExQF_GExQ2_BLOCKSIZE;
+        rocblas_int dim = min(m, n);
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
 
         // requirements for calling GELQ2 with sub blocks
-        rocsolver_gelq2_getMemorySize<T, BATCHED>(jb, n, batch_count, size_scalars, &w1, &s2, &s1);
-        *size_Abyx_norms_trfact = max(s2, *size_Abyx_norms_trfact);
+        rocsolver_gelq2_getMemorySize<T, BATCHED>(jb, n, batch_count, size_scalars, &w1, &s3, &s1);
+
+        // requirements for calling GELQ2 with the last block
+        rocblas_int j = ((dim - GExQF_GExQ2_SWITCHSIZE - 1) / jb + 1) * jb;
+        rocsolver_gelq2_getMemorySize<T, BATCHED>(m - j, n - j, batch_count, &unused, &w3, &s4,
+                                                  &s5);
 
         // requirements for calling LARFT
         rocsolver_larft_getMemorySize<T, BATCHED>(n, jb, batch_count, &unused, &w2, size_workArr);
@@ -62,8 +67,19 @@ void rocsolver_gelqf_getMemorySize(const rocblas_int m,
         rocsolver_larfb_getMemorySize<T, BATCHED>(rocblas_side_right, m - jb, n, jb, batch_count,
                                                   &s2, &unused);
 
-        *size_work_workArr = max(w1, w2);
-        *size_diag_tmptr = max(s1, s2);
+        *size_work_workArr = max(max(w1, w2), w3);
+        if(dim >= GExQF_LOOKAHEAD_MINSIZE)
+        {
+            // with look-ahead, GELQ2 runs concurrently with LARFB,
+            // so it needs its own space after the triangular factor and tmptr
+            *size_Abyx_norms_trfact = max(*size_Abyx_norms_trfact + s3, s4);
+            *size_diag_tmptr = max(s2 + s1, s5);
+        }
+        else
+        {
+            *size_Abyx_norms_trfact = max(max(s3, s4), *size_Abyx_norms_trfact);
+            *size_diag_tmptr = max(max(s1, s5), s2);
+        }
 
         // size of workArr is double to accomodate
         // LARFB's TRMM calls in the batched case
@@ -106,18 +122,33 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle,
                                            diag_tmptr);
 
     rocblas_int dim = min(m, n); // total number of pivots
-    rocblas_int jb, j = 0;
+    rocblas_int jb, jbn, j = 0;
 
     rocblas_int ldw = GExQF_GExQ2_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
+    // for large matrices, the next panel is updated first and factorized in a
+    // second stream, overlapping with the update of the rest of the matrix
+    // (look-ahead). The panel factorization then uses its own workspace.
+    bool lookahead = (dim >= GExQF_LOOKAHEAD_MINSIZE);
+    bool panel_ready = false;
+    rocsolver_lookahead_stream* la = nullptr;
+    T* Abyx_norms = Abyx_norms_trfact + strideW * batch_count;
+    T* diag = diag_tmptr + rocblas_stride(ldw) * m * batch_count;
+    if(lookahead)
+        RETURN_IF_ROCBLAS_ERROR(rocsolver_get_lookahead_stream(handle, &la));
+
     while(j < dim - GExQF_GExQ2_SWITCHSIZE)
     {
         // Factor diagonal and subdiagonal blocks
         jb = min(dim - j, GExQF_GExQ2_BLOCKSIZE); // number of rows in the block
-        rocsolver_gelq2_template<T>(handle, jb, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                    (ipiv + j), strideP, batch_count, scalars, work_workArr,
-                                    Abyx_norms_trfact, diag_tmptr);
+        if(panel_ready)
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, la->panel_done, 0));
+        else
+            rocsolver_gelq2_template<T>(handle, jb, n - j, A, shiftA + idx2D(j, j, lda), lda,
+                                        strideA, (ipiv + j), strideP, batch_count, scalars,
+                                        work_workArr, Abyx_norms_trfact, diag_tmptr);
+        panel_ready = false;
 
         // apply transformation to the rest of the matrix
         if(j + jb < m)
@@ -129,11 +160,41 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle,
                                         scalars, (T*)work_workArr, workArr);
 
             // apply the block reflector
-            rocsolver_larfb_template<BATCHED, STRIDED, T>(
-                handle, rocblas_side_right, rocblas_operation_none, rocblas_forward_direction,
-                rocblas_row_wise, m - j - jb, n - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                Abyx_norms_trfact, 0, ldw, strideW, A, shiftA + idx2D(j + jb, j, lda), lda, strideA,
-                batch_count, diag_tmptr, workArr);
+            if(lookahead && j + jb < dim - GExQF_GExQ2_SWITCHSIZE)
+            {
+                // update the next panel
+                jbn = min(dim - j - jb, GExQF_GExQ2_BLOCKSIZE);
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_none, rocblas_forward_direction,
+                    rocblas_row_wise, jbn, n - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                    Abyx_norms_trfact, 0, ldw, strideW, A, shiftA + idx2D(j + jb, j, lda), lda,
+                    strideA, batch_count, diag_tmptr, workArr);
+                RETURN_IF_HIP_ERROR(hipEventRecord(la->update_done, stream));
+
+                // factorize the next panel in the second stream
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(la->stream, la->update_done, 0));
+                rocsolver_gelq2_template<T>(la->handle, jbn, n - j - jb, A,
+                                            shiftA + idx2D(j + jb, j + jb, lda), lda, strideA,
+                                            (ipiv + j + jb), strideP, batch_count, scalars,
+                                            work_workArr, Abyx_norms, diag);
+                RETURN_IF_HIP_ERROR(hipEventRecord(la->panel_done, la->stream));
+                panel_ready = true;
+
+                // update the rest of the matrix
+                if(j + jb + jbn < m)
+                    rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_right, rocblas_operation_none,
+                        rocblas_forward_direction, rocblas_row_wise, m - j - jb - jbn, n - j, jb,
+                        A, shiftA + idx2D(j, j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw,
+                        strideW, A, shiftA + idx2D(j + jb + jbn, j, lda), lda, strideA,
+                        batch_count, diag_tmptr, workArr);
+            }
+            else
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_none, rocblas_forward_direction,
+                    rocblas_row_wise, m - j - jb, n - j, jb, A, shiftA + idx2D(j, j, lda), lda,
+                    strideA, Abyx_norms_trfact, 0, ldw, strideW, A,
+                    shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count, diag_tmptr, workArr);
         }
         j += GExQF_GExQ2_BLOCKSIZE;
     }
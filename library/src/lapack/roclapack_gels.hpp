@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
 #include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
 #include "rocblas.hpp"
+#include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
 #include "rocsolver.h"
 
@@ -74,17 +76,29 @@ void rocsolver_gels_getMemorySize(const rocblas_int m,
         return;
     }
 
+    // if m >= n, the QR factorization of A is used; otherwise the LQ factorization
+    const rocblas_int k = std::min(m, n);
     size_t geqrf_scalars, geqrf_work, geqrf_workArr, geqrf_diag, geqrf_trfact;
-    rocsolver_geqrf_getMemorySize<T, BATCHED>(m, n, batch_count, &geqrf_scalars, &geqrf_work,
-                                              &geqrf_workArr, &geqrf_diag, &geqrf_trfact);
-
     size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
-    rocsolver_ormqr_unmqr_getMemorySize<T, BATCHED>(rocblas_side_left, m, nrhs, n, batch_count,
-                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
-                                                    &ormqr_trfact, &ormqr_workTrmm);
+    if(m >= n)
+    {
+        rocsolver_geqrf_getMemorySize<T, BATCHED>(m, n, batch_count, &geqrf_scalars, &geqrf_work,
+                                                  &geqrf_workArr, &geqrf_diag, &geqrf_trfact);
+        rocsolver_ormqr_unmqr_getMemorySize<T, BATCHED>(rocblas_side_left, m, nrhs, n, batch_count,
+                                                        &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                        &ormqr_trfact, &ormqr_workTrmm);
+    }
+    else
+    {
+        rocsolver_gelqf_getMemorySize<T, BATCHED>(m, n, batch_count, &geqrf_scalars, &geqrf_work,
+                                                  &geqrf_workArr, &geqrf_diag, &geqrf_trfact);
+        rocsolver_ormlq_unmlq_getMemorySize<T, BATCHED>(rocblas_side_left, n, nrhs, m, batch_count,
+                                                        &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                        &ormqr_trfact, &ormqr_workTrmm);
+    }
 
     size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
-    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, n, nrhs, batch_count, &trsm_x_temp,
+    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, k, nrhs, batch_count, &trsm_x_temp,
                                      &trsm_x_temp_arr, &trsm_invA, &trsm_invA_arr);
 
     ROCSOLVER_ASSUME_X(geqrf_scalars == ormqr_scalars, "GEQRF and ORMQR use the same scalars");
@@ -95,11 +109,12 @@ void rocsolver_gels_getMemorySize(const rocblas_int m,
     *size_workArr_temp_arr = std::max({geqrf_workArr, ormqr_workArr, trsm_x_temp_arr});
     *size_diag_trfac_invA = std::max({geqrf_diag, ormqr_trfact, trsm_invA});
     *size_trfact_workTrmm_invA_arr = std::max({geqrf_trfact, ormqr_workTrmm, trsm_invA_arr});
-    // size_ipiv = sizeof(T) * std::min(m, n) * batch_count, which is always less than size_savedB
-    *size_ipiv_savedB = sizeof(T) * n * nrhs * batch_count;
+    // size of ipiv followed by the copy of B; in the underdetermined cases the
+    // Householder scalars are still needed after B is saved
+    *size_ipiv_savedB = sizeof(T) * (k + std::max(m, n) * nrhs) * batch_count;
 }
 
-template <typename T>
+template <bool COMPLEX, typename T>
 rocblas_status rocsolver_gels_argCheck(rocblas_handle handle,
                                        rocblas_operation trans,
                                        const rocblas_int m,
@@ -113,15 +128,15 @@ rocblas_status rocsolver_gels_argCheck(rocblas_handle handle,
                                        const rocblas_int batch_count = 1)
 {
     // order is important for unit tests:
-    // 1. non-supported values
-    if(m < n || trans == rocblas_operation_transpose || trans == rocblas_operation_conjugate_transpose)
-        return rocblas_status_not_implemented;
-
-    // 2. invalid values
-    if(trans != rocblas_operation_none)
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
         return rocblas_status_invalid_value;
 
-    // 3. invalid size
+    // 2. invalid size
     if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
         return rocblas_status_invalid_size;
 
@@ -129,7 +144,7 @@ rocblas_status rocsolver_gels_argCheck(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_status_continue;
 
-    // 4. invalid pointers
+    // 3. invalid pointers
     if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (batch_count && !info))
         return rocblas_status_invalid_pointer;
 
@@ -200,42 +215,89 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
 
     // TODO: apply scaling to improve accuracy over a larger range of values
 
-    ROCSOLVER_ASSUME_X(m >= n, "argCheck rejects all other cases as not implemented");
-
-    // compute QR factorization of A
-    const rocblas_stride strideP = std::min(m, n);
-    rocsolver_geqrf_template<BATCHED, STRIDED>(
-        handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
-        work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
-    rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A, shiftA,
-        lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
-        (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int rowsB = std::max(m, n);
+    const rocblas_stride strideP = k;
+    const bool transpose = (trans != rocblas_operation_none);
+    T* ipiv = ipiv_savedB;
+    T* savedB = ipiv_savedB + strideP * batch_count;
+
+    // compute QR factorization of A (or LQ factorization if m < n)
+    if(m >= n)
+        rocsolver_geqrf_template<BATCHED, STRIDED>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work_x_temp,
+            workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+    else
+        rocsolver_gelqf_template<BATCHED, STRIDED>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work_x_temp,
+            workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+    // overdetermined cases: compute Q'B (or QB if transposed)
+    if(m >= n && !transpose)
+        rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A, shiftA,
+            lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+            (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+            (T**)trfact_workTrmm_invA_arr);
+    if(m < n && transpose)
+        rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_none, n, nrhs, m, A, shiftA, lda, strideA,
+            ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars, (T*)work_x_temp,
+            (T*)workArr_temp_arr, (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
 
     // do the equivalent of trtrs
-    const rocblas_int check_threads = min(((n - 1) / 64 + 1) * 64, BLOCKSIZE);
+    const rocblas_int check_threads = min(((k - 1) / 64 + 1) * 64, BLOCKSIZE);
     hipLaunchKernelGGL(check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, check_threads, 1), 0,
-                       stream, n, A, shiftA, lda, strideA, info);
+                       stream, k, A, shiftA, lda, strideA, info);
 
-    // save elements of B that will be overwritten by TRSM for cases where info is nonzero
+    // save elements of B that will be overwritten for cases where info is nonzero
+    // (in the underdetermined cases, all the rows of B are overwritten)
+    const bool underdetermined = ((m >= n) == transpose);
+    const rocblas_int rowsSaved = underdetermined ? rowsB : k;
     const rocblas_int copyblocksx = (nrhs - 1) / 32 + 1;
-    const rocblas_int copyblocksy = (n - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (rowsSaved - 1) / 32 + 1;
     hipLaunchKernelGGL((masked_copymat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
-                       dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb, strideB,
-                       ipiv_savedB, info);
+                       dim3(32, 32), 0, stream, copymat_to_buffer, rowsSaved, nrhs, B, shiftB, ldb,
+                       strideB, savedB, info);
 
     const T one = 1; // constant 1 in host memory
-    // solve RX = Q'B, overwriting B with X
-    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_upper,
-                                 rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs, &one,
-                                 A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
-                                 optim_mem, work_x_temp, workArr_temp_arr, diag_trfac_invA,
-                                 trfact_workTrmm_invA_arr);
-
-    // restore elements of B that were overwritten by TRSM in cases where info is nonzero
+    // solve RX = Q'B, R'X = B, LX = B or L'X = QB, overwriting B with X
+    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left,
+                                 (m >= n ? rocblas_fill_upper : rocblas_fill_lower), trans,
+                                 rocblas_diagonal_non_unit, k, nrhs, &one, A, shiftA, lda, strideA,
+                                 B, shiftB, ldb, strideB, batch_count, optim_mem, work_x_temp,
+                                 workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+    // underdetermined cases: the minimum norm solution is Q[X; 0] (or Q'[X; 0] if not
+    // transposed)
+    if(underdetermined)
+    {
+        if(rowsB > k)
+        {
+            const rocblas_int zeroblocksx = (rowsB - k - 1) / 32 + 1;
+            hipLaunchKernelGGL(set_zero<T>, dim3(zeroblocksx, copyblocksx, batch_count),
+                               dim3(32, 32), 0, stream, rowsB - k, nrhs, B, shiftB + k, ldb,
+                               strideB);
+        }
+
+        if(m >= n)
+            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
+                strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+                (T**)trfact_workTrmm_invA_arr);
+        else
+            rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, nrhs, m, A,
+                shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+                (T**)trfact_workTrmm_invA_arr);
+    }
+
+    // restore elements of B that were overwritten in cases where info is nonzero
     hipLaunchKernelGGL((masked_copymat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
-                       dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB, ldb,
-                       strideB, ipiv_savedB, info);
+                       dim3(32, 32), 0, stream, copymat_from_buffer, rowsSaved, nrhs, B, shiftB,
+                       ldb, strideB, savedB, info);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
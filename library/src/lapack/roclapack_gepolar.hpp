@@ -0,0 +1,613 @@
+/************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_syev_heev.hpp"
+#include "rocsolver.h"
+
+template <typename S, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ S polar_sqabs(T val)
+{
+    return val * val;
+}
+
+template <typename S, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ S polar_sqabs(T val)
+{
+    return val.real() * val.real() + val.imag() * val.imag();
+}
+
+/** POLAR_NORMALIZE copies the m-by-n matrices A_j into X_j scaled by the inverse
+    of their Frobenius norm, so that all the singular values of X_j are at most 1.
+    Call this kernel with one group of BLOCKSIZE threads per matrix in the batch. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) polar_normalize(const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             U A,
+                                                             const rocblas_int shiftA,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             T* X,
+                                                             const rocblas_stride strideX)
+{
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int mn = m * n;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* Xp = X + b * strideX;
+
+    __shared__ S sval[BLOCKSIZE];
+
+    // squared Frobenius norm
+    S sum = 0;
+    for(rocblas_int k = tid; k < mn; k += BLOCKSIZE)
+        sum += polar_sqabs<S>(Ap[(k % m) + (k / m) * lda]);
+    sval[tid] = sum;
+    __syncthreads();
+
+    for(rocblas_int r = BLOCKSIZE / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    // (a zero matrix is left as it is)
+    S nrm = sqrt(sval[0]);
+    T scl = (nrm > 0) ? T(1 / nrm) : T(1);
+
+    for(rocblas_int k = tid; k < mn; k += BLOCKSIZE)
+        Xp[k] = scl * Ap[(k % m) + (k / m) * lda];
+}
+
+/** POLAR_STACK forms the (m+n)-by-n matrices W_j = [sqrt(c) * X_j; I] required by
+    the QR-based iteration **/
+template <typename T>
+__global__ void polar_stack(const rocblas_int m,
+                            const rocblas_int n,
+                            const T sqrtc,
+                            T* X,
+                            const rocblas_stride strideX,
+                            T* W,
+                            const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m + n && j < n)
+    {
+        T* Xp = X + b * strideX;
+        T* Wp = W + b * strideW;
+
+        if(i < m)
+            Wp[i + j * (m + n)] = sqrtc * Xp[i + j * m];
+        else
+            Wp[i + j * (m + n)] = (i - m == j) ? T(1) : T(0);
+    }
+}
+
+/** POLAR_UPDATE computes X_j = alpha * Y_j + beta * X_j, where X_j and Y_j are
+    stored contiguously with n elements each **/
+template <typename T>
+__global__ void polar_update(const rocblas_int n,
+                             const T alpha,
+                             T* Y,
+                             const rocblas_stride strideY,
+                             const T beta,
+                             T* X,
+                             const rocblas_stride strideX)
+{
+    const auto b = hipBlockIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n)
+    {
+        T* Xp = X + b * strideX;
+        T* Yp = Y + b * strideY;
+        Xp[i] = alpha * Yp[i] + beta * Xp[i];
+    }
+}
+
+/** POLAR_SYMMETRIZE replaces the n-by-n matrices H_j with (H_j + H_j') / 2 to
+    remove the rounding errors that make them lose their symmetry **/
+template <typename T>
+__global__ void
+    polar_symmetrize(const rocblas_int n, T* H, const rocblas_int ldh, const rocblas_stride strideH)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < n && i <= j)
+    {
+        T* Hp = H + b * strideH;
+        T avg = T(0.5) * (Hp[i + j * ldh] + sconj(Hp[j + i * ldh]));
+        Hp[i + j * ldh] = avg;
+        Hp[j + i * ldh] = sconj(avg);
+    }
+}
+
+/** POLAR_FLIP reverses the order of the eigenpairs of H_j (given in ascending order by
+    SYEV/HEEV) so that the singular values and vectors come in descending order **/
+template <typename T, typename S>
+__global__ void polar_flip(const rocblas_int n,
+                           T* H,
+                           const rocblas_int ldh,
+                           const rocblas_stride strideH,
+                           S* D,
+                           S* SS,
+                           const rocblas_stride strideS)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < n)
+    {
+        T* Hp = H + b * strideH;
+
+        if(i == 0)
+        {
+            // H is positive semi-definite; negative eigenvalues can only come from rounding
+            S s = D[b * n + n - 1 - j];
+            SS[b * strideS + j] = (s > 0) ? s : S(0);
+        }
+
+        if(j < n / 2)
+        {
+            T temp = Hp[i + j * ldh];
+            Hp[i + j * ldh] = Hp[i + (n - 1 - j) * ldh];
+            Hp[i + (n - 1 - j) * ldh] = temp;
+        }
+    }
+}
+
+/** POLAR_CHECK_ORTH computes the Frobenius norm of Z_j - I, where Z_j = X_j'X_j is
+    given in its upper triangular part, and flags the iterates X_j that do not have
+    orthonormal columns up to the tolerance tol. The number of flagged iterates is
+    accumulated in count.
+    Call this kernel with one group of BLOCKSIZE threads per matrix in the batch. **/
+template <typename T, typename S>
+__global__ void __launch_bounds__(BLOCKSIZE) polar_check_orth(const rocblas_int n,
+                                                              T* Z,
+                                                              const rocblas_int ldz,
+                                                              const rocblas_stride strideZ,
+                                                              const S tol,
+                                                              rocblas_int* notconv,
+                                                              rocblas_int* count)
+{
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int nn = n * n;
+
+    T* Zp = Z + b * strideZ;
+
+    __shared__ S sval[BLOCKSIZE];
+
+    // squared Frobenius norm of Z - I (from its upper triangular part)
+    S sum = 0;
+    for(rocblas_int k = tid; k < nn; k += BLOCKSIZE)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        if(i < j)
+            sum += 2 * polar_sqabs<S>(Zp[i + j * ldz]);
+        else if(i == j)
+            sum += polar_sqabs<S>(Zp[i + j * ldz] - T(1));
+    }
+    sval[tid] = sum;
+    __syncthreads();
+
+    for(rocblas_int r = BLOCKSIZE / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        bool nc = !(sqrt(sval[0]) <= tol);
+        notconv[b] = nc ? 1 : 0;
+        if(nc)
+            atomicAdd(count, 1);
+    }
+}
+
+/** POLAR_SET_INFO sets info_j = n + 1 for the matrices whose polar factor did not
+    converge (unless info_j was already set by the eigensolver) **/
+__global__ void polar_set_info(const rocblas_int n,
+                               rocblas_int* notconv,
+                               rocblas_int* info,
+                               const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count && notconv[b] && info[b] == 0)
+        info[b] = n + 1;
+}
+
+/** QDWH_WEIGHTS computes the dynamical weights a, b and c of the next QDWH iteration
+    from the current lower bound l of the smallest singular value of the iterate.
+    l is updated with the new lower bound. **/
+inline void qdwh_weights(double& l, double& a, double& b, double& c)
+{
+    double l2 = l * l;
+    double d = std::cbrt(4 * (1 - l2) / (l2 * l2));
+    double sqd = std::sqrt(1 + d);
+
+    a = sqd + 0.5 * std::sqrt(8 - 4 * d + 8 * (2 - l2) / (l2 * sqd));
+    b = (a - 1) * (a - 1) / 4;
+    c = a + b - 1;
+    l = l * (a + b * l2) / (1 + c * l2);
+}
+
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gepolar_argCheck(rocblas_handle handle,
+                                          const rocblas_svect svect,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          W A,
+                                          const rocblas_int lda,
+                                          T* H,
+                                          const rocblas_int ldh,
+                                          TT* S,
+                                          rocblas_int* info,
+                                          const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(svect != rocblas_svect_singular && svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < n || lda < m || ldh < n || ldh < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !H) || (svect == rocblas_svect_singular && n && !S)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gepolar_getMemorySize(const rocblas_svect svect,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int batch_count,
+                                     size_t* size_scalars,
+                                     size_t* size_work1,
+                                     size_t* size_work2,
+                                     size_t* size_work3,
+                                     size_t* size_work4,
+                                     size_t* size_tau,
+                                     size_t* size_pivots_workArr,
+                                     size_t* size_iinfo,
+                                     size_t* size_X,
+                                     size_t* size_W,
+                                     size_t* size_DE)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_tau = 0;
+        *size_pivots_workArr = 0;
+        *size_iinfo = 0;
+        *size_X = 0;
+        *size_W = 0;
+        *size_DE = 0;
+        return;
+    }
+
+    size_t w[5] = {}, a[4] = {}, x[5] = {}, y[3] = {}, r[3] = {};
+    size_t unused, t = 0;
+
+    // size of the iterate X, and of the stacked matrix W used by the
+    // QR-based iterations (also used to store Z = I + c * X'X and a copy of X
+    // in the Cholesky-based iterations)
+    *size_X = sizeof(T) * m * n * batch_count;
+    *size_W = sizeof(T) * (m + n) * n * batch_count;
+
+    // requirements for the QR-based iterations
+    rocsolver_geqrf_getMemorySize<T, false>(m + n, n, batch_count, size_scalars, &w[0], &x[0],
+                                            &y[0], &unused);
+    rocsolver_orgqr_ungqr_getMemorySize<T, false>(m + n, n, n, batch_count, &unused, &w[1], &a[0],
+                                                  &x[1], &unused);
+
+    // requirements for the Cholesky-based iterations
+    rocsolver_potrf_getMemorySize<false, T>(n, rocblas_fill_upper, batch_count, &unused, &w[2],
+                                            &a[1], &x[2], &y[1], &r[0], size_iinfo);
+    rocblasCall_trsm_mem<false, T>(rocblas_side_right, m, n, batch_count, &w[3], &a[2], &x[3],
+                                   &y[2]);
+
+    // (the info of POTRF is stored after its temporary info, followed by the
+    // convergence flags and the number of non-converged iterates)
+    *size_iinfo = max(*size_iinfo, sizeof(rocblas_int) * batch_count);
+    *size_iinfo += sizeof(rocblas_int) * (2 * batch_count + 1);
+
+    // requirements for the eigendecomposition of H
+    if(svect == rocblas_svect_singular)
+    {
+        rocsolver_syev_heev_getMemorySize<false, T, S>(rocblas_evect_original, rocblas_fill_upper,
+                                                       n, batch_count, &unused, &w[4], &a[3], &x[4],
+                                                       &t, &r[1]);
+        *size_DE = sizeof(S) * 2 * n * batch_count;
+    }
+    else
+        *size_DE = 0;
+
+    *size_tau = max(t, sizeof(T) * n * batch_count);
+
+    // size of array of pointers (batched case, for the mixed gemm calls)
+    r[2] = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
+
+    // get max sizes
+    *size_work1 = *std::max_element(std::begin(w), std::end(w));
+    *size_work2 = *std::max_element(std::begin(a), std::end(a));
+    *size_work3 = *std::max_element(std::begin(x), std::end(x));
+    *size_work4 = *std::max_element(std::begin(y), std::end(y));
+    *size_pivots_workArr = *std::max_element(std::begin(r), std::end(r));
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
+rocblas_status rocsolver_gepolar_template(rocblas_handle handle,
+                                          const rocblas_svect svect,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          W A,
+                                          const rocblas_int shiftA,
+                                          const rocblas_int lda,
+                                          const rocblas_stride strideA,
+                                          T* H,
+                                          const rocblas_int ldh,
+                                          const rocblas_stride strideH,
+                                          TT* S,
+                                          const rocblas_stride strideS,
+                                          rocblas_int* info,
+                                          const rocblas_int batch_count,
+                                          T* scalars,
+                                          void* work1,
+                                          void* work2,
+                                          void* work3,
+                                          void* work4,
+                                          T* tau,
+                                          void* pivots_workArr,
+                                          rocblas_int* iinfo,
+                                          T* X,
+                                          T* Wk,
+                                          TT* DE,
+                                          bool optim_mem)
+{
+    ROCSOLVER_ENTER("gepolar", "svect:", svect, "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "ldh:", ldh, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants to use when calling rocablas functions
+    T one = 1;
+    T zero = 0;
+    TT s_one = 1;
+    TT s_zero = 0;
+
+    // dimensions and strides of the internal buffers
+    // (in the Cholesky-based iterations, W holds Z = I + c * X'X followed by
+    // a copy of X)
+    const rocblas_int ldw = m + n;
+    const rocblas_stride strideX = rocblas_stride(m) * n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * n;
+    T* Z = Wk;
+    T* Y = Wk + rocblas_stride(n) * n;
+    rocblas_int* pinfo = iinfo + batch_count;
+    rocblas_int* notconv = pinfo + batch_count;
+    rocblas_int* count = notconv + batch_count;
+
+    // common block sizes and number of threads for internal kernels
+    constexpr rocblas_int thread_count = BS;
+    const rocblas_int blocks_m = (m - 1) / thread_count + 1;
+    const rocblas_int blocks_n = (n - 1) / thread_count + 1;
+    const rocblas_int blocks_w = (ldw - 1) / thread_count + 1;
+    const rocblas_int blocks_x = (m * n - 1) / BLOCKSIZE + 1;
+
+    // 1. X0 = A / ||A||_F, so that the singular values of X0 lie in [l0, 1]
+    hipLaunchKernelGGL((polar_normalize<T, TT>), dim3(1, batch_count, 1), threads, 0, stream, m, n,
+                       A, shiftA, lda, strideA, X, strideX);
+
+    // 2. QDWH iterations. The weights depend only on the lower bound l of the
+    // smallest singular value of the iterate, which is taken as l0 = eps (no
+    // condition estimation), so the sequence of weights of a sweep can be computed
+    // on the host without synchronizing with the device. If the condition number
+    // of A is too large for l0, the singular values below l0 are only magnified
+    // by about 1/eps during the sweep; thus, at the end of each sweep, the
+    // orthonormality of the iterates is checked and, if needed, a new sweep is
+    // started from l0 = eps.
+    const double eps = get_epsilon<TT>();
+    const TT tol = 10 * m * eps;
+    rocblas_int sweeps = 0;
+    double l = eps;
+    double a, b, c;
+    while(true)
+    {
+        qdwh_weights(l, a, b, c);
+
+        if(c > GEPOLAR_QR_SWITCH)
+        {
+            // QR-based iteration:
+            // [sqrt(c) * X; I] = [Q1; Q2] * R,
+            // X = (b/c) * X + (a - b/c) / sqrt(c) * Q1 * Q2'
+            T sqrtc = std::sqrt(c);
+            T alpha = (a - b / c) / std::sqrt(c);
+            T beta = b / c;
+
+            hipLaunchKernelGGL(polar_stack<T>, dim3(blocks_w, blocks_n, batch_count),
+                               dim3(thread_count, thread_count, 1), 0, stream, m, n, sqrtc, X,
+                               strideX, Wk, strideW);
+
+            rocsolver_geqrf_template<false, true, T>(
+                handle, ldw, n, Wk, 0, ldw, strideW, tau, n, batch_count, scalars, work1,
+                (T*)work3, (T*)work4, (T**)pivots_workArr);
+
+            rocsolver_orgqr_ungqr_template<false, true, T>(
+                handle, ldw, n, n, Wk, 0, ldw, strideW, tau, n, batch_count, scalars, (T*)work1,
+                (T*)work2, (T*)work3, (T**)pivots_workArr);
+
+            rocblasCall_gemm<false, true>(handle, rocblas_operation_none,
+                                          rocblas_operation_conjugate_transpose, m, n, n, &alpha,
+                                          Wk, 0, ldw, strideW, Wk, m, ldw, strideW, &beta, X, 0, m,
+                                          strideX, batch_count, (T**)pivots_workArr);
+        }
+        else
+        {
+            // Cholesky-based iteration:
+            // Z = I + c * X'X = R'R,
+            // X = (b/c) * X + (a - b/c) * X * inv(Z)
+            TT cc = c;
+            T alpha = a - b / c;
+            T beta = b / c;
+
+            hipLaunchKernelGGL(init_ident<T>, dim3(blocks_n, blocks_n, batch_count),
+                               dim3(thread_count, thread_count, 1), 0, stream, n, n, Z, 0, n,
+                               strideW);
+
+            rocblasCall_syrk_herk<TT, T>(handle, rocblas_fill_upper,
+                                         rocblas_operation_conjugate_transpose, n, m, &cc, X, 0, m,
+                                         strideX, &s_one, Z, 0, n, strideW, batch_count);
+
+            rocsolver_potrf_template<false, TT, T>(handle, rocblas_fill_upper, n, Z, 0, n, strideW,
+                                                   pinfo, batch_count, scalars, work1, work2,
+                                                   work3, work4, (T*)pivots_workArr, iinfo,
+                                                   optim_mem);
+
+            hipLaunchKernelGGL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
+                               dim3(thread_count, thread_count, 1), 0, stream, m, n, X, 0, m,
+                               strideX, Y, 0, m, strideW);
+
+            rocblasCall_trsm<false, T>(handle, rocblas_side_right, rocblas_fill_upper,
+                                       rocblas_operation_none, rocblas_diagonal_non_unit, m, n,
+                                       &one, Z, 0, n, strideW, Y, 0, m, strideW, batch_count,
+                                       optim_mem, work1, work2, work3, work4);
+            rocblasCall_trsm<false, T>(handle, rocblas_side_right, rocblas_fill_upper,
+                                       rocblas_operation_conjugate_transpose,
+                                       rocblas_diagonal_non_unit, m, n, &one, Z, 0, n, strideW, Y,
+                                       0, m, strideW, batch_count, optim_mem, work1, work2, work3,
+                                       work4);
+
+            hipLaunchKernelGGL(polar_update<T>, dim3(blocks_x, batch_count, 1), threads, 0, stream,
+                               m * n, alpha, Y, strideW, beta, X, strideX);
+        }
+
+        if(1 - l <= 10 * eps)
+        {
+            // end of sweep: check the orthonormality of the iterates, Z = X'X
+            sweeps++;
+
+            rocblasCall_syrk_herk<TT, T>(handle, rocblas_fill_upper,
+                                         rocblas_operation_conjugate_transpose, n, m, &s_one, X, 0,
+                                         m, strideX, &s_zero, Z, 0, n, strideW, batch_count);
+
+            hipLaunchKernelGGL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, count, 1, 0);
+            hipLaunchKernelGGL((polar_check_orth<T, TT>), dim3(1, batch_count, 1), threads, 0,
+                               stream, n, Z, n, strideW, tol, notconv, count);
+
+            rocblas_int nconv = 0;
+            hipError_t herr = hipMemcpyAsync(&nconv, count, sizeof(rocblas_int),
+                                             hipMemcpyDeviceToHost, stream);
+            if(herr == hipSuccess)
+                herr = hipStreamSynchronize(stream);
+            if(herr != hipSuccess)
+            {
+                rocblas_set_pointer_mode(handle, old_mode);
+                return get_rocblas_status_for_hip_status(herr);
+            }
+
+            if(nconv == 0 || sweeps == GEPOLAR_MAX_SWEEPS)
+                break;
+
+            l = eps;
+        }
+    }
+
+    // 3. Hermitian factor H = Up' * A
+    rocblasCall_gemm<BATCHED, STRIDED>(handle, rocblas_operation_conjugate_transpose,
+                                       rocblas_operation_none, n, n, m, &one, X, 0, m, strideX, A,
+                                       shiftA, lda, strideA, &zero, H, 0, ldh, strideH, batch_count,
+                                       (T**)pivots_workArr);
+
+    hipLaunchKernelGGL(polar_symmetrize<T>, dim3(blocks_n, blocks_n, batch_count),
+                       dim3(thread_count, thread_count, 1), 0, stream, n, H, ldh, strideH);
+
+    if(svect == rocblas_svect_singular)
+    {
+        // 4. SVD mode: H = V * S * V' and A = (Up * V) * S * V'
+        TT* D = DE;
+        TT* E = DE + n * batch_count;
+
+        rocsolver_syev_heev_template<false, true, T>(
+            handle, rocblas_evect_original, rocblas_fill_upper, n, H, 0, ldh, strideH, D, n, E, n,
+            info, batch_count, scalars, work1, (T*)work2, (T*)work3, tau, (T**)pivots_workArr);
+
+        hipLaunchKernelGGL(polar_flip<T>, dim3(blocks_n, blocks_n, batch_count),
+                           dim3(thread_count, thread_count, 1), 0, stream, n, H, ldh, strideH, D, S,
+                           strideS);
+
+        rocblasCall_gemm<BATCHED, STRIDED>(handle, rocblas_operation_none, rocblas_operation_none,
+                                           m, n, n, &one, X, 0, m, strideX, H, 0, ldh, strideH,
+                                           &zero, A, shiftA, lda, strideA, batch_count,
+                                           (T**)pivots_workArr);
+    }
+    else
+    {
+        // 4. polar factor Up is returned in A
+        hipLaunchKernelGGL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
+                           dim3(thread_count, thread_count, 1), 0, stream, m, n, X, 0, m, strideX,
+                           A, shiftA, lda, strideA);
+    }
+
+    // 5. flag the matrices for which the iterations did not converge
+    hipLaunchKernelGGL(polar_set_info, gridReset, threads, 0, stream, n, notconv, info,
+                       batch_count);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
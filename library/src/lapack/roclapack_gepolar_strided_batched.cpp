@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gepolar.hpp"
+
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gepolar_strided_batched_impl(rocblas_handle handle,
+                                                      const rocblas_svect svect,
+                                                      const rocblas_int m,
+                                                      const rocblas_int n,
+                                                      W A,
+                                                      const rocblas_int lda,
+                                                      const rocblas_stride strideA,
+                                                      T* H,
+                                                      const rocblas_int ldh,
+                                                      const rocblas_stride strideH,
+                                                      TT* S,
+                                                      const rocblas_stride strideS,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gepolar_strided_batched", "--leftsv", svect, "-m", m, "-n", n, "--lda",
+                        lda, "--bsa", strideA, "--ldb", ldh, "--bsb", strideH, "--bsc", strideS,
+                        "--batch", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gepolar_argCheck(handle, svect, m, n, A, lda, H, ldh, S, info,
+                                                   batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspaces (for calling GEQRF, ORGQR/UNGQR, POTRF, TRSM and SYEV/HEEV)
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of array tau to store householder scalars
+    size_t size_tau;
+    // size of array of pointers (batched case) and pivots (for calling POTRF)
+    size_t size_pivots_workArr;
+    // size of temporary info arrays
+    size_t size_iinfo;
+    // size of the iterate, the stacked matrix, and the eigenvalues of H
+    size_t size_X, size_W, size_DE;
+
+    rocsolver_gepolar_getMemorySize<false, T, TT>(
+        svect, m, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_tau, &size_pivots_workArr, &size_iinfo, &size_X, &size_W, &size_DE);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_tau,
+            size_pivots_workArr, size_iinfo, size_X, size_W, size_DE);
+
+    // always allocate all required memory for TRSM optimal performance
+    bool optim_mem = true;
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *tau, *pivots_workArr, *iinfo;
+    void *X, *Wk, *DE;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_tau, size_pivots_workArr, size_iinfo, size_X, size_W, size_DE);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    tau = mem[5];
+    pivots_workArr = mem[6];
+    iinfo = mem[7];
+    X = mem[8];
+    Wk = mem[9];
+    DE = mem[10];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gepolar_template<false, true, T>(
+        handle, svect, m, n, A, shiftA, lda, strideA, H, ldh, strideH, S, strideS, info,
+        batch_count, (T*)scalars, work1, work2, work3, work4, (T*)tau, pivots_workArr,
+        (rocblas_int*)iinfo, (T*)X, (T*)Wk, (TT*)DE, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgepolar_strided_batched(rocblas_handle handle,
+                                                  const rocblas_svect svect,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  float* A,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  float* H,
+                                                  const rocblas_int ldh,
+                                                  const rocblas_stride strideH,
+                                                  float* S,
+                                                  const rocblas_stride strideS,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gepolar_strided_batched_impl<float>(
+        handle, svect, m, n, A, lda, strideA, H, ldh, strideH, S, strideS, info, batch_count);
+}
+
+rocblas_status rocsolver_dgepolar_strided_batched(rocblas_handle handle,
+                                                  const rocblas_svect svect,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  double* A,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  double* H,
+                                                  const rocblas_int ldh,
+                                                  const rocblas_stride strideH,
+                                                  double* S,
+                                                  const rocblas_stride strideS,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gepolar_strided_batched_impl<double>(
+        handle, svect, m, n, A, lda, strideA, H, ldh, strideH, S, strideS, info, batch_count);
+}
+
+rocblas_status rocsolver_cgepolar_strided_batched(rocblas_handle handle,
+                                                  const rocblas_svect svect,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  rocblas_float_complex* A,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  rocblas_float_complex* H,
+                                                  const rocblas_int ldh,
+                                                  const rocblas_stride strideH,
+                                                  float* S,
+                                                  const rocblas_stride strideS,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gepolar_strided_batched_impl<rocblas_float_complex>(
+        handle, svect, m, n, A, lda, strideA, H, ldh, strideH, S, strideS, info, batch_count);
+}
+
+rocblas_status rocsolver_zgepolar_strided_batched(rocblas_handle handle,
+                                                  const rocblas_svect svect,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  rocblas_double_complex* A,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  rocblas_double_complex* H,
+                                                  const rocblas_int ldh,
+                                                  const rocblas_stride strideH,
+                                                  double* S,
+                                                  const rocblas_stride strideS,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gepolar_strided_batched_impl<rocblas_double_complex>(
+        handle, svect, m, n, A, lda, strideA, H, ldh, strideH, S, strideS, info, batch_count);
+}
+
+} // extern C
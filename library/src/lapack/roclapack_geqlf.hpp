@@ -45,15 +45,14 @@ void rocsolver_geqlf_getMemorySize(const rocblas_int m,
     }
     else
     {
-        size_t w1, w2, unused, s1, s2;
+        size_t w1, w2, unused, s1, s2, s3;
         rocblas_int jb = GEQxF_GEQx2_BLOCKSIZE;
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
 
         // requirements for calling GEQL2 with sub blocks
-        rocsolver_geql2_getMemorySize<T, BATCHED>(m, jb, batch_count, size_scalars, &w1, &s2, &s1);
-        *size_Abyx_norms_trfact = max(s2, *size_Abyx_norms_trfact);
+        rocsolver_geql2_getMemorySize<T, BATCHED>(m, jb, batch_count, size_scalars, &w1, &s3, &s1);
 
         // requirements for calling LARFT
         rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &unused, &w2, size_workArr);
@@ -63,7 +62,18 @@ void rocsolver_geqlf_getMemorySize(const rocblas_int m,
                                                   &s2, &unused);
 
         *size_work_workArr = max(w1, w2);
-        *size_diag_tmptr = max(s1, s2);
+        if(min(m, n) >= GEQxF_LOOKAHEAD_MINSIZE)
+        {
+            // with look-ahead, GEQL2 runs concurrently with LARFB,
+            // so it needs its own space after the triangular factor and tmptr
+            *size_Abyx_norms_trfact += s3;
+            *size_diag_tmptr = s2 + s1;
+        }
+        else
+        {
+            *size_Abyx_norms_trfact = max(s3, *size_Abyx_norms_trfact);
+            *size_diag_tmptr = max(s1, s2);
+        }
 
         // size of workArr is double to accomodate
         // LARFB's TRMM calls in the batched case
@@ -115,13 +125,29 @@ rocblas_status rocsolver_geqlf_template(rocblas_handle handle,
     rocblas_int ldw = GEQxF_GEQx2_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
+    // for large matrices, the next panel is updated first and factorized in a
+    // second stream, overlapping with the update of the rest of the matrix
+    // (look-ahead). The panel factorization then uses its own workspace.
+    bool lookahead = (k >= GEQxF_LOOKAHEAD_MINSIZE);
+    bool panel_ready = false;
+    rocsolver_lookahead_stream* la = nullptr;
+    T* Abyx_norms = Abyx_norms_trfact + strideW * batch_count;
+    T* diag = diag_tmptr + rocblas_stride(ldw) * n * batch_count;
+    if(lookahead)
+        RETURN_IF_ROCBLAS_ERROR(rocsolver_get_lookahead_stream(handle, &la));
+
     while(j >= k - kk)
     {
         // Factor diagonal and subdiagonal blocks
         jb = min(k - j, nb); // number of columns in the block
-        rocsolver_geql2_template<T>(handle, m - k + j + jb, jb, A, shiftA + idx2D(0, n - k + j, lda),
-                                    lda, strideA, (ipiv + j), strideP, batch_count, scalars,
-                                    work_workArr, Abyx_norms_trfact, diag_tmptr);
+        if(panel_ready)
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, la->panel_done, 0));
+        else
+            rocsolver_geql2_template<T>(handle, m - k + j + jb, jb, A,
+                                        shiftA + idx2D(0, n - k + j, lda), lda, strideA, (ipiv + j),
+                                        strideP, batch_count, scalars, work_workArr,
+                                        Abyx_norms_trfact, diag_tmptr);
+        panel_ready = false;
 
         // apply transformation to the rest of the matrix
         if(n - k + j > 0)
@@ -133,11 +159,41 @@ rocblas_status rocsolver_geqlf_template(rocblas_handle handle,
                                         strideW, batch_count, scalars, (T*)work_workArr, workArr);
 
             // apply the block reflector
-            rocsolver_larfb_template<BATCHED, STRIDED, T>(
-                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
-                rocblas_backward_direction, rocblas_column_wise, m - k + j + jb, n - k + j, jb, A,
-                shiftA + idx2D(0, n - k + j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw, strideW,
-                A, shiftA, lda, strideA, batch_count, diag_tmptr, workArr);
+            if(lookahead && j - nb >= k - kk)
+            {
+                // update the next panel (the last nb columns of the rest of the matrix)
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_backward_direction, rocblas_column_wise, m - k + j + jb, nb, jb, A,
+                    shiftA + idx2D(0, n - k + j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw,
+                    strideW, A, shiftA + idx2D(0, n - k + j - nb, lda), lda, strideA, batch_count,
+                    diag_tmptr, workArr);
+                RETURN_IF_HIP_ERROR(hipEventRecord(la->update_done, stream));
+
+                // factorize the next panel in the second stream
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(la->stream, la->update_done, 0));
+                rocsolver_geql2_template<T>(la->handle, m - k + j, nb, A,
+                                            shiftA + idx2D(0, n - k + j - nb, lda), lda,
+                                            strideA, (ipiv + j - nb), strideP, batch_count,
+                                            scalars, work_workArr, Abyx_norms, diag);
+                RETURN_IF_HIP_ERROR(hipEventRecord(la->panel_done, la->stream));
+                panel_ready = true;
+
+                // update the rest of the matrix
+                if(n - k + j - nb > 0)
+                    rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                        rocblas_backward_direction, rocblas_column_wise, m - k + j + jb,
+                        n - k + j - nb, jb, A, shiftA + idx2D(0, n - k + j, lda), lda, strideA,
+                        Abyx_norms_trfact, 0, ldw, strideW, A, shiftA, lda, strideA, batch_count,
+                        diag_tmptr, workArr);
+            }
+            else
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_backward_direction, rocblas_column_wise, m - k + j + jb, n - k + j, jb,
+                    A, shiftA + idx2D(0, n - k + j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw,
+                    strideW, A, shiftA, lda, strideA, batch_count, diag_tmptr, workArr);
         }
         j -= nb;
         mu = m - k + j + jb;
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqp3.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* jpvt,
+                                    T* ipiv)
+{
+    ROCSOLVER_ENTER_TOP("geqp3", "-m", m, "-n", n, "--lda", lda);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqp3_argCheck(handle, m, n, lda, A, jpvt, ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideJ = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr;
+    // extra requirements for calling LARFG
+    size_t size_norms, size_diag;
+    // size of the auxiliary matrix and vector of the blocked algorithm
+    size_t size_F, size_auxv;
+    // size of the partial column norms
+    size_t size_colnorms;
+    rocsolver_geqp3_getMemorySize<false, T, S>(m, n, batch_count, &size_scalars,
+                                               &size_work_workArr, &size_norms, &size_diag,
+                                               &size_F, &size_auxv, &size_colnorms);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_norms, size_diag, size_F, size_auxv,
+                                                      size_colnorms);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *norms, *diag, *F, *auxv, *colnorms;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_norms, size_diag,
+                              size_F, size_auxv, size_colnorms);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    norms = mem[2];
+    diag = mem[3];
+    F = mem[4];
+    auxv = mem[5];
+    colnorms = mem[6];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_geqp3_template<false, false, T>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, ipiv, strideP, batch_count,
+        (T*)scalars, work_workArr, (T*)norms, (T*)diag, (T*)F, (T*)auxv, (S*)colnorms);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                float* ipiv)
+{
+    return rocsolver_geqp3_impl<float>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+rocblas_status rocsolver_dgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                double* ipiv)
+{
+    return rocsolver_geqp3_impl<double>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+rocblas_status rocsolver_cgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                rocblas_float_complex* ipiv)
+{
+    return rocsolver_geqp3_impl<rocblas_float_complex>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+rocblas_status rocsolver_zgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                rocblas_double_complex* ipiv)
+{
+    return rocsolver_geqp3_impl<rocblas_double_complex>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+} // extern C
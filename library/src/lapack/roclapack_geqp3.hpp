@@ -0,0 +1,490 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** GEQP3_INIT computes the initial norms of the columns of A, and initializes jpvt
+    with the identity permutation. Call this kernel with batch_count groups in y,
+    n groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) geqp3_init(const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        U A,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        rocblas_int* jpvt,
+                                                        const rocblas_stride strideJ,
+                                                        S* norms,
+                                                        const rocblas_stride strideN)
+{
+    const auto b = hipBlockIdx_y;
+    const auto j = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    S* vn1 = norms + b * strideN;
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BLOCKSIZE];
+
+    // partial sums of squares
+    S a, sum = 0;
+    if(m > 0)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+        {
+            a = std::abs(Ap[i + j * lda]);
+            sum += a * a;
+        }
+    }
+    sval[tid] = sum;
+    __syncthreads();
+
+    // reduction
+    for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            sval[tid] += sval[tid + s];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        vn1[j] = sqrt(sval[0]);
+        vn2[j] = vn1[j];
+        jpvt[j + b * strideJ] = j + 1;
+    }
+}
+
+/** GEQP3_PIVOT finds the column with the largest partial norm among columns
+    c = j+kk to n-1, and interchanges it with column c. Rows 0 to kk-1 of the
+    corresponding rows of F, the permutation jpvt, and the column norms are
+    updated accordingly. Call this kernel with batch_count groups in x and
+    BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) geqp3_pivot(const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int j,
+                                                         const rocblas_int kk,
+                                                         U A,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* F,
+                                                         const rocblas_int ldf,
+                                                         const rocblas_stride strideF,
+                                                         rocblas_int* jpvt,
+                                                         const rocblas_stride strideJ,
+                                                         S* norms,
+                                                         const rocblas_stride strideN)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int c = j + kk;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* Fp = F + b * strideF;
+    rocblas_int* jp = jpvt + b * strideJ;
+    S* vn1 = norms + b * strideN;
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // local maximum
+    S val = -1;
+    rocblas_int idx = c;
+    for(rocblas_int i = c + tid; i < n; i += BLOCKSIZE)
+    {
+        if(vn1[i] > val)
+        {
+            val = vn1[i];
+            idx = i;
+        }
+    }
+    sval[tid] = val;
+    sidx[tid] = idx;
+    __syncthreads();
+
+    // reduction (ties are resolved in favor of the smallest index)
+    for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+        {
+            if(sval[tid + s] > sval[tid] || (sval[tid + s] == sval[tid] && sidx[tid + s] < sidx[tid]))
+            {
+                sval[tid] = sval[tid + s];
+                sidx[tid] = sidx[tid + s];
+            }
+        }
+        __syncthreads();
+    }
+    rocblas_int p = sidx[0];
+
+    // interchange columns
+    if(p != c)
+    {
+        T temp;
+        for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+        {
+            temp = Ap[i + c * lda];
+            Ap[i + c * lda] = Ap[i + p * lda];
+            Ap[i + p * lda] = temp;
+        }
+        for(rocblas_int i = tid; i < kk; i += BLOCKSIZE)
+        {
+            temp = Fp[(c - j) + i * ldf];
+            Fp[(c - j) + i * ldf] = Fp[(p - j) + i * ldf];
+            Fp[(p - j) + i * ldf] = temp;
+        }
+
+        if(tid == 0)
+        {
+            rocblas_int itemp = jp[c];
+            jp[c] = jp[p];
+            jp[p] = itemp;
+            vn1[p] = vn1[c];
+            vn2[p] = vn2[c];
+        }
+    }
+}
+
+/** GEQP3_UPDATE_NORMS downdates the partial norms of the trailing columns after
+    the generation of the reflector for column c = j+kk. When cancellation makes a
+    downdated norm unreliable, the norm is recomputed, taking into account the
+    updates of the current block that have not been applied to A yet
+    (i.e. A - V*F'). Call this kernel with batch_count groups in y, n-c-1 groups
+    in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) geqp3_update_norms(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int j,
+                                                                const rocblas_int kk,
+                                                                U A,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* F,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF,
+                                                                S* norms,
+                                                                const rocblas_stride strideN,
+                                                                const S tol3z)
+{
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int c = j + kk;
+    const rocblas_int jc = c + 1 + hipBlockIdx_x;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* Fp = F + b * strideF;
+    S* vn1 = norms + b * strideN;
+    S* vn2 = vn1 + n;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ bool recompute;
+
+    // downdate the partial norm
+    if(tid == 0)
+    {
+        recompute = false;
+        if(vn1[jc] != 0)
+        {
+            S temp = std::abs(Ap[c + jc * lda]) / vn1[jc];
+            temp = (1 + temp) * (1 - temp);
+            temp = temp > 0 ? temp : 0;
+            S temp2 = vn1[jc] / vn2[jc];
+            temp2 = temp * temp2 * temp2;
+
+            if(temp2 <= tol3z)
+                recompute = true;
+            else
+                vn1[jc] *= sqrt(temp);
+        }
+    }
+    __syncthreads();
+
+    // recompute the norm if needed
+    if(recompute)
+    {
+        T t;
+        S a, sum = 0;
+        for(rocblas_int i = c + 1 + tid; i < m; i += BLOCKSIZE)
+        {
+            t = Ap[i + jc * lda];
+            for(rocblas_int l = 0; l <= kk; ++l)
+                t -= Ap[i + (j + l) * lda] * sconj(Fp[(jc - j) + l * ldf]);
+            a = std::abs(t);
+            sum += a * a;
+        }
+        sval[tid] = sum;
+        __syncthreads();
+
+        for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sval[tid] += sval[tid + s];
+            __syncthreads();
+        }
+
+        if(tid == 0)
+        {
+            vn1[jc] = sqrt(sval[0]);
+            vn2[jc] = vn1[jc];
+        }
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_geqp3_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_norms,
+                                   size_t* size_diag,
+                                   size_t* size_F,
+                                   size_t* size_auxv,
+                                   size_t* size_colnorms)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_norms = 0;
+        *size_diag = 0;
+        *size_F = 0;
+        *size_auxv = 0;
+        *size_colnorms = 0;
+        return;
+    }
+
+    // size of partial and reference column norms
+    *size_colnorms = sizeof(S) * 2 * n * batch_count;
+
+    // if m = 0, only the permutation is initialized
+    if(m == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_norms = 0;
+        *size_diag = 0;
+        *size_F = 0;
+        *size_auxv = 0;
+        return;
+    }
+
+    // size of scalars (constants)
+    *size_scalars = sizeof(T) * 3;
+
+    // size of work_workArr is maximum of re-usable work space for larfg and
+    // array of pointers to workspace
+    size_t w;
+    rocsolver_larfg_getMemorySize<T>(m, batch_count, &w, size_norms);
+    if(BATCHED)
+        *size_work_workArr = max(w, sizeof(T*) * batch_count);
+    else
+        *size_work_workArr = w;
+
+    // size of array to store temporary diagonal values
+    *size_diag = sizeof(T) * batch_count;
+
+    // size of the auxiliary matrix F and vector auxv used by the blocked algorithm
+    rocblas_int nb = min(GEQP3_BLOCKSIZE, min(m, n));
+    *size_F = sizeof(T) * n * nb * batch_count;
+    *size_auxv = sizeof(T) * nb * batch_count;
+}
+
+template <typename T, typename I, typename U>
+rocblas_status rocsolver_geqp3_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        I jpvt,
+                                        U ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (n && !jpvt) || (m * n && !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* norms,
+                                        T* diag,
+                                        T* F,
+                                        T* auxv,
+                                        S* colnorms)
+{
+    ROCSOLVER_ENTER("geqp3", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // compute the initial column norms and set jpvt to the identity
+    rocblas_stride strideN = 2 * n;
+    hipLaunchKernelGGL(geqp3_init<T>, dim3(n, batch_count), dim3(BLOCKSIZE), 0, stream, m, n, A,
+                       shiftA, lda, strideA, jpvt, strideJ, colnorms, strideN);
+
+    // quick return
+    if(m == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the device
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    rocblas_int dim = min(m, n); // total number of pivots
+    rocblas_int nb = min(GEQP3_BLOCKSIZE, dim);
+    rocblas_int ldf = n;
+    rocblas_stride strideF = rocblas_stride(ldf) * nb;
+    rocblas_stride strideX = nb;
+    S tol3z = sqrt(get_epsilon<T>());
+
+    // **** THE BLOCKED ALGORITHM DOES NOT STOP A BLOCK EARLY WHEN A PARTIAL
+    //      COLUMN NORM LOSES ACCURACY, AS THIS WOULD REQUIRE SYNCHRONIZATION
+    //      WITH THE GPU. INSTEAD, THE AFFECTED NORMS ARE RECOMPUTED IN PLACE,
+    //      ACCOUNTING FOR THE PENDING UPDATES OF THE CURRENT BLOCK ****
+
+    rocblas_int jb, c;
+    for(rocblas_int j = 0; j < dim; j += jb)
+    {
+        jb = min(dim - j, nb); // number of columns in the block
+
+        for(rocblas_int kk = 0; kk < jb; ++kk)
+        {
+            c = j + kk; // current column
+
+            // determine the pivot column and move it to position c
+            hipLaunchKernelGGL(geqp3_pivot<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, m, n,
+                               j, kk, A, shiftA, lda, strideA, F, ldf, strideF, jpvt, strideJ,
+                               colnorms, strideN);
+
+            // apply the previous reflectors of the block to column c
+            // (A(c:m,c) = A(c:m,c) - A(c:m,j:c-1) * F(kk,0:kk-1)')
+            if(kk > 0)
+            {
+                rocsolver_lacgv_template<T>(handle, kk, F, kk, ldf, strideF, batch_count);
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, m - c, kk, scalars, 0, A,
+                                    shiftA + idx2D(c, j, lda), lda, strideA, F, kk, ldf, strideF,
+                                    scalars + 2, 0, A, shiftA + idx2D(c, c, lda), 1, strideA,
+                                    batch_count, (T**)work_workArr);
+                rocsolver_lacgv_template<T>(handle, kk, F, kk, ldf, strideF, batch_count);
+            }
+
+            // generate Householder reflector to work on column c
+            rocsolver_larfg_template(handle, m - c, A, shiftA + idx2D(c, c, lda), A,
+                                     shiftA + idx2D(min(c + 1, m - 1), c, lda), 1, strideA,
+                                     (ipiv + c), strideP, batch_count, (T*)work_workArr, norms);
+
+            // insert one in A(c,c) to build/apply the householder matrix
+            hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                               diag, 0, 1, A, shiftA + idx2D(c, c, lda), lda, strideA, 1, true);
+
+            if(c < n - 1)
+            {
+                // compute column kk of F
+                // (F(kk+1:,kk) = tau * A(c:m,c+1:n)' * v)
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - c, n - c - 1,
+                                    (ipiv + c), strideP, A, shiftA + idx2D(c, c + 1, lda), lda,
+                                    strideA, A, shiftA + idx2D(c, c, lda), 1, strideA, scalars + 1,
+                                    0, F, idx2D(kk + 1, kk, ldf), 1, strideF, batch_count,
+                                    (T**)work_workArr);
+
+                // incremental update of F
+                // (F(kk+1:,kk) = F(kk+1:,kk) - F(kk+1:,0:kk-1) * tau * A(c:m,j:c-1)' * v)
+                if(kk > 0)
+                {
+                    rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - c, kk,
+                                        (ipiv + c), strideP, A, shiftA + idx2D(c, j, lda), lda,
+                                        strideA, A, shiftA + idx2D(c, c, lda), 1, strideA,
+                                        scalars + 1, 0, auxv, 0, 1, strideX, batch_count,
+                                        (T**)work_workArr);
+
+                    rocblasCall_gemv<T>(handle, rocblas_operation_none, n - c - 1, kk, scalars, 0,
+                                        F, idx2D(kk + 1, 0, ldf), ldf, strideF, auxv, 0, 1,
+                                        strideX, scalars + 2, 0, F, idx2D(kk + 1, kk, ldf), 1,
+                                        strideF, batch_count, (T**)work_workArr);
+                }
+
+                // update row c of the trailing columns
+                // (A(c,c+1:n) = A(c,c+1:n) - A(c,j:c) * F(kk+1:,0:kk)')
+                rocblasCall_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, 1,
+                    n - c - 1, kk + 1, scalars, A, shiftA + idx2D(c, j, lda), lda, strideA, F,
+                    idx2D(kk + 1, 0, ldf), ldf, strideF, scalars + 2, A,
+                    shiftA + idx2D(c, c + 1, lda), lda, strideA, batch_count, (T**)work_workArr);
+
+                // update partial column norms
+                if(c < dim - 1)
+                    hipLaunchKernelGGL(geqp3_update_norms<T>, dim3(n - c - 1, batch_count),
+                                       dim3(BLOCKSIZE), 0, stream, m, n, j, kk, A, shiftA, lda,
+                                       strideA, F, ldf, strideF, colnorms, strideN, tol3z);
+            }
+
+            // restore original value of A(c,c)
+            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                               diag, 0, 1, A, shiftA + idx2D(c, c, lda), lda, strideA, 1);
+        }
+
+        // apply the block update to the rest of the matrix
+        // (A(j+jb:m,j+jb:n) = A(j+jb:m,j+jb:n) - A(j+jb:m,j:j+jb-1) * F(jb:,0:jb-1)')
+        if(j + jb < m && j + jb < n)
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, m - j - jb,
+                n - j - jb, jb, scalars, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, F,
+                idx2D(jb, 0, ldf), ldf, strideF, scalars + 2, A,
+                shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count, (T**)work_workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,291 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_bdsdc.hpp"
+#include "auxiliary/rocauxiliary_ormbr_unmbr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gebrd.hpp"
+#include "roclapack_gesvd.hpp"
+#include "rocsolver.h"
+
+/** Argument checking **/
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesdd_argCheck(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        W A,
+                                        const rocblas_int lda,
+                                        TT* S,
+                                        T* U,
+                                        const rocblas_int ldu,
+                                        T* V,
+                                        const rocblas_int ldv,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(svect != rocblas_svect_all && svect != rocblas_svect_singular
+       && svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || lda < m || ldu < 1 || ldv < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(svect != rocblas_svect_none && ldu < m)
+        return rocblas_status_invalid_size;
+    if((svect == rocblas_svect_all && ldv < n)
+       || (svect == rocblas_svect_singular && ldv < min(m, n)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (min(m, n) && !S) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if((svect == rocblas_svect_all && m && !U)
+       || (svect == rocblas_svect_singular && min(m, n) && !U))
+        return rocblas_status_invalid_pointer;
+    if(svect != rocblas_svect_none && n && !V)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gesdd_getMemorySize(const rocblas_svect svect,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms_tmptr,
+                                   size_t* size_Abyx_norms_trfact_X,
+                                   size_t* size_diag_tmptr_Y,
+                                   size_t* size_tau,
+                                   size_t* size_E,
+                                   size_t* size_tempvect,
+                                   size_t* size_workArr)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || m == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_Abyx_norms_trfact_X = 0;
+        *size_diag_tmptr_Y = 0;
+        *size_tau = 0;
+        *size_E = 0;
+        *size_tempvect = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    const rocblas_int k = min(m, n);
+
+    // size of the off-diagonal of the bidiagonal form
+    *size_E = sizeof(S) * k * batch_count;
+
+    // the closed-form kernels (m, n <= 3) need no other workspace
+    if(m <= 3 && n <= 3)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_Abyx_norms_trfact_X = 0;
+        *size_diag_tmptr_Y = 0;
+        *size_tau = 0;
+        *size_tempvect = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t w[2] = {};
+    size_t a[3] = {};
+    size_t x[3] = {};
+    size_t y[3] = {};
+    size_t unused;
+
+    // number of columns of U and rows of V
+    const rocblas_int nu = (svect == rocblas_svect_all) ? m : k;
+    const rocblas_int nv = (svect == rocblas_svect_all) ? n : k;
+
+    // size of array of pointers (batched case)
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+
+    // size of arrays tauq and taup
+    *size_tau = 2 * sizeof(T) * k * batch_count;
+
+    // workspace required for the bidiagonalization
+    rocsolver_gebrd_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, &w[0], &a[0], &x[0],
+                                              &y[0]);
+
+    // workspace required for the SVD of the bidiagonal form
+    rocsolver_bdsdc_getMemorySize<S>(svect, k, batch_count, &w[1], size_tempvect);
+
+    // workspace required to update the singular vectors
+    if(svect != rocblas_svect_none)
+    {
+        rocsolver_ormbr_unmbr_getMemorySize<T, BATCHED>(rocblas_column_wise, rocblas_side_left, m,
+                                                        nu, n, batch_count, &unused, &a[1], &y[1],
+                                                        &x[1], &unused);
+        rocsolver_ormbr_unmbr_getMemorySize<T, BATCHED>(rocblas_row_wise, rocblas_side_right, nv,
+                                                        n, m, batch_count, &unused, &a[2], &y[2],
+                                                        &x[2], &unused);
+    }
+
+    // get max sizes
+    *size_work_workArr = *std::max_element(std::begin(w), std::end(w));
+    *size_Abyx_norms_tmptr = *std::max_element(std::begin(a), std::end(a));
+    *size_Abyx_norms_trfact_X = *std::max_element(std::begin(x), std::end(x));
+    *size_diag_tmptr_Y = *std::max_element(std::begin(y), std::end(y));
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
+rocblas_status rocsolver_gesdd_template(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        W A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        TT* S,
+                                        const rocblas_stride strideS,
+                                        T* U,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        T* V,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms_tmptr,
+                                        T* Abyx_norms_trfact_X,
+                                        T* diag_tmptr_Y,
+                                        T* tau,
+                                        TT* E,
+                                        TT* tempvect,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("gesdd", "svect:", svect, "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "ldu:", ldu, "ldv:", ldv, "bc:", batch_count);
+
+    constexpr bool COMPLEX = is_complex<T>;
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if the matrices are empty
+    if(n == 0 || m == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream,
+                           info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    const rocblas_int k = min(m, n);
+    const rocblas_stride strideE = k;
+
+    // closed-form kernels for matrices with at most 3 rows and columns
+    // (one thread per matrix)
+    if(m <= 3 && n <= 3)
+    {
+        gesvd_small_template<T>(handle, svect, svect, m, n, A, shiftA, lda, strideA, S, strideS, U,
+                                ldu, strideU, V, ldv, strideV, E, strideE, info, batch_count);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // auxiliary sizes and variables
+    const rocblas_fill uplo = (m >= n) ? rocblas_fill_upper : rocblas_fill_lower;
+    const rocblas_int nu = (svect == rocblas_svect_all) ? m : k;
+    const rocblas_int nv = (svect == rocblas_svect_all) ? n : k;
+    const rocblas_int ldx = m;
+    const rocblas_int ldy = n;
+    const rocblas_stride strideX = ldx * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideY = ldy * GEBRD_GEBD2_SWITCHSIZE;
+    T* tauq = tau;
+    T* taup = tau + k * batch_count;
+    const rocblas_operation trans
+        = COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+    constexpr rocblas_int thread_count = 32;
+    const rocblas_int blocks_m = (m - 1) / thread_count + 1;
+    const rocblas_int blocks_n = (n - 1) / thread_count + 1;
+    const rocblas_int blocks_u = (nu - 1) / thread_count + 1;
+    const rocblas_int blocks_v = (nv - 1) / thread_count + 1;
+
+    // 1. reduce A to bidiagonal form, A = Q * B * P'
+    // (B is upper bidiagonal if m >= n, lower bidiagonal otherwise)
+    rocsolver_gebrd_template<BATCHED, STRIDED>(
+        handle, m, n, A, shiftA, lda, strideA, S, strideS, E, strideE, tauq, k, taup, k,
+        Abyx_norms_trfact_X, 0, ldx, strideX, diag_tmptr_Y, 0, ldy, strideY, batch_count, scalars,
+        work_workArr, Abyx_norms_tmptr);
+
+    if(svect == rocblas_svect_none)
+    {
+        // 2. singular values of the bidiagonal form
+        rocsolver_bdsdc_template<TT, T>(handle, uplo, svect, k, S, strideS, E, strideE,
+                                        (T*)nullptr, 0, 1, 0, (T*)nullptr, 0, 1, 0, info,
+                                        batch_count, work_workArr, tempvect);
+    }
+    else
+    {
+        // 2. SVD of the bidiagonal form by divide and conquer, B = Ub * S * Vb'.
+        // Ub and Vb' are written in the leading k-by-k blocks of U and V, which are
+        // completed with the identity when all the singular vectors are required
+        hipLaunchKernelGGL(init_ident<T>, dim3(blocks_m, blocks_u, batch_count),
+                           dim3(thread_count, thread_count, 1), 0, stream, m, nu, U, 0, ldu,
+                           strideU);
+        hipLaunchKernelGGL(init_ident<T>, dim3(blocks_v, blocks_n, batch_count),
+                           dim3(thread_count, thread_count, 1), 0, stream, nv, n, V, 0, ldv,
+                           strideV);
+
+        rocsolver_bdsdc_template<TT, T>(handle, uplo, svect, k, S, strideS, E, strideE, U, 0, ldu,
+                                        strideU, V, 0, ldv, strideV, info, batch_count,
+                                        work_workArr, tempvect);
+
+        // 3. back-transform the singular vectors, U = Q * Ub and V' = Vb' * P'
+        local_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, m, nu, n, A,
+            shiftA, lda, strideA, tauq, k, U, 0, ldu, strideU, batch_count, scalars,
+            Abyx_norms_tmptr, diag_tmptr_Y, Abyx_norms_trfact_X, workArr);
+
+        local_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_row_wise, rocblas_side_right, trans, nv, n, m, A, shiftA, lda, strideA,
+            taup, k, V, 0, ldv, strideV, batch_count, scalars, Abyx_norms_tmptr, diag_tmptr_Y,
+            Abyx_norms_trfact_X, workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -10,8 +10,10 @@
 #pragma once
 
 #include "auxiliary/rocauxiliary_bdsqr.hpp"
+#include "auxiliary/rocauxiliary_bdsvals.hpp"
 #include "auxiliary/rocauxiliary_orgbr_ungbr.hpp"
 #include "auxiliary/rocauxiliary_ormbr_unmbr.hpp"
+#include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gebrd.hpp"
 #include "roclapack_gelqf.hpp"
@@ -181,6 +183,29 @@ void local_bdsqr_template(rocblas_handle handle,
                                 (T* const*)nullptr, 0, 1, 1, info, batch_count, work);
 }
 
+/** wrapper to BDSVALS_TEMPLATE
+    the matrices for which the dqds algorithm does not converge (and that are left
+    unchanged) are handed to the implicit QR algorithm of BDSQR, as in LAPACK's xBDSQR **/
+template <typename TT, rocblas_int MAXITER>
+void local_bdsvals_template(rocblas_handle handle,
+                            const rocblas_int n,
+                            TT* D,
+                            const rocblas_stride strideD,
+                            TT* E,
+                            const rocblas_stride strideE,
+                            rocblas_int* info,
+                            const rocblas_int batch_count,
+                            TT* work)
+{
+    rocsolver_bdsvals_template<TT, MAXITER>(handle, n, D, strideD, E, strideE, info, batch_count,
+                                            work);
+
+    // (the singular values do not depend on whether B is upper or lower bidiagonal)
+    rocsolver_bdsqr_template<TT>(handle, rocblas_fill_upper, n, 0, 0, 0, D, strideD, E, strideE,
+                                 (TT*)nullptr, 0, 1, 1, (TT*)nullptr, 0, 1, 1, (TT*)nullptr, 0, 1,
+                                 1, info, batch_count, work, true);
+}
+
 /** wrapper to ORMBR_UNMBR_TEMPLATE **/
 template <bool BATCHED, bool STRIDED, typename T>
 void local_ormbr_unmbr_template(rocblas_handle handle,
@@ -292,6 +317,366 @@ void local_ormbr_unmbr_template(rocblas_handle handle,
         (workArr + batch_count));
 }
 
+/** GESVD_SMALL_KERNEL computes the SVD of the m-by-n matrices in the batch when
+    R = max(m,n) and C = min(m,n) are at most 3. Every matrix is kept in registers and
+    processed by a single thread with the one-sided Jacobi method: plane rotations,
+    accumulated in Z, orthogonalize the columns of X = A (or X = A' if m < n) so that
+    X * Z = U_X * S. At most GESVD_SMALL_MAX_SWEEPS sweeps are executed. Call this
+    kernel with one thread per matrix. **/
+template <rocblas_int R, rocblas_int C, typename T, typename TT, typename W>
+__global__ void gesvd_small_kernel(const rocblas_svect left_svect,
+                                   const rocblas_svect right_svect,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   W AA,
+                                   const rocblas_int shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   TT* SS,
+                                   const rocblas_stride strideS,
+                                   T* UU,
+                                   const rocblas_int ldu,
+                                   const rocblas_stride strideU,
+                                   T* VV,
+                                   const rocblas_int ldv,
+                                   const rocblas_stride strideV,
+                                   TT* EE,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* info,
+                                   const TT eps,
+                                   const rocblas_int bc)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < bc)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        const bool row = (m >= n);
+
+        // load X and initialize Z as the identity
+        T x[R * C];
+        T z[C * C];
+#pragma unroll
+        for(rocblas_int j = 0; j < C; j++)
+        {
+#pragma unroll
+            for(rocblas_int i = 0; i < R; i++)
+                x[i + j * R] = (row ? A[i + j * lda] : sconj(A[j + i * lda]));
+#pragma unroll
+            for(rocblas_int i = 0; i < C; i++)
+                z[i + j * C] = (i == j ? 1 : 0);
+        }
+
+        // one-sided Jacobi sweeps
+        for(rocblas_int sweep = 0; sweep < GESVD_SMALL_MAX_SWEEPS; sweep++)
+        {
+            bool rotated = false;
+#pragma unroll
+            for(rocblas_int p = 0; p < C - 1; p++)
+            {
+#pragma unroll
+                for(rocblas_int q = p + 1; q < C; q++)
+                {
+                    // entries of X' * X associated with columns p and q
+                    TT alpha = 0;
+                    TT beta = 0;
+                    T gamma = 0;
+#pragma unroll
+                    for(rocblas_int i = 0; i < R; i++)
+                    {
+                        TT t = std::abs(x[i + p * R]);
+                        alpha += t * t;
+                        t = std::abs(x[i + q * R]);
+                        beta += t * t;
+                        gamma += sconj(x[i + p * R]) * x[i + q * R];
+                    }
+
+                    if(std::abs(gamma) > eps * std::sqrt(alpha * beta))
+                    {
+                        rotated = true;
+                        TT c;
+                        T s;
+                        jacobi_rot(alpha, beta, gamma, c, s);
+
+#pragma unroll
+                        for(rocblas_int i = 0; i < R; i++)
+                        {
+                            T xp = x[i + p * R];
+                            T xq = x[i + q * R];
+                            x[i + p * R] = c * xp - sconj(s) * xq;
+                            x[i + q * R] = s * xp + c * xq;
+                        }
+#pragma unroll
+                        for(rocblas_int i = 0; i < C; i++)
+                        {
+                            T zp = z[i + p * C];
+                            T zq = z[i + q * C];
+                            z[i + p * C] = c * zp - sconj(s) * zq;
+                            z[i + q * C] = s * zp + c * zq;
+                        }
+                    }
+                }
+            }
+            if(!rotated)
+                break;
+        }
+
+        // the singular values are the norms of the columns of X (sorted in decreasing order)
+        TT sv[C];
+        rocblas_int idx[C];
+#pragma unroll
+        for(rocblas_int j = 0; j < C; j++)
+        {
+            TT nrm = 0;
+#pragma unroll
+            for(rocblas_int i = 0; i < R; i++)
+            {
+                TT t = std::abs(x[i + j * R]);
+                nrm += t * t;
+            }
+            sv[j] = std::sqrt(nrm);
+            idx[j] = j;
+        }
+#pragma unroll
+        for(rocblas_int j = 0; j < C - 1; j++)
+        {
+#pragma unroll
+            for(rocblas_int i = 0; i < C - 1 - j; i++)
+            {
+                if(sv[i + 1] > sv[i])
+                {
+                    TT t = sv[i];
+                    sv[i] = sv[i + 1];
+                    sv[i + 1] = t;
+                    rocblas_int k = idx[i];
+                    idx[i] = idx[i + 1];
+                    idx[i + 1] = k;
+                }
+            }
+        }
+
+        // left singular vectors of X: the normalized columns of X, completed to an
+        // orthonormal basis with the canonical vectors farthest from their span
+        T u[R * R];
+#pragma unroll
+        for(rocblas_int j = 0; j < R; j++)
+        {
+            if(j < C && sv[j] > 0)
+            {
+#pragma unroll
+                for(rocblas_int k = 0; k < C; k++)
+                {
+                    if(idx[j] == k)
+                    {
+#pragma unroll
+                        for(rocblas_int i = 0; i < R; i++)
+                            u[i + j * R] = x[i + k * R] * T(1 / sv[j]);
+                    }
+                }
+            }
+            else
+            {
+                TT best = -1;
+#pragma unroll
+                for(rocblas_int l = 0; l < R; l++)
+                {
+                    T w[R];
+#pragma unroll
+                    for(rocblas_int i = 0; i < R; i++)
+                        w[i] = (i == l ? 1 : 0);
+
+                    // (classical Gram-Schmidt, applied twice)
+#pragma unroll
+                    for(rocblas_int pass = 0; pass < 2; pass++)
+                    {
+#pragma unroll
+                        for(rocblas_int k = 0; k < j; k++)
+                        {
+                            T d = 0;
+#pragma unroll
+                            for(rocblas_int i = 0; i < R; i++)
+                                d += sconj(u[i + k * R]) * w[i];
+#pragma unroll
+                            for(rocblas_int i = 0; i < R; i++)
+                                w[i] -= d * u[i + k * R];
+                        }
+                    }
+
+                    TT nrm = 0;
+#pragma unroll
+                    for(rocblas_int i = 0; i < R; i++)
+                    {
+                        TT t = std::abs(w[i]);
+                        nrm += t * t;
+                    }
+                    nrm = std::sqrt(nrm);
+
+                    if(nrm > best)
+                    {
+                        best = nrm;
+#pragma unroll
+                        for(rocblas_int i = 0; i < R; i++)
+                            u[i + j * R] = w[i] * T(1 / nrm);
+                    }
+                }
+            }
+        }
+
+        // write results
+        TT* Sv = SS + b * strideS;
+        TT* E = EE + b * strideE;
+#pragma unroll
+        for(rocblas_int j = 0; j < C; j++)
+            Sv[j] = sv[j];
+#pragma unroll
+        for(rocblas_int j = 0; j < C - 1; j++)
+            E[j] = 0;
+        info[b] = 0;
+
+        // left singular vectors of A: U_X if m >= n, or Z otherwise
+        if(left_svect != rocblas_svect_none)
+        {
+            const bool ovw = (left_svect == rocblas_svect_overwrite);
+            T* U = (ovw ? A : UU + b * strideU);
+            const rocblas_int ldU = (ovw ? lda : ldu);
+            const rocblas_int nc = (left_svect == rocblas_svect_all ? m : C);
+
+            if(row)
+            {
+#pragma unroll
+                for(rocblas_int j = 0; j < R; j++)
+                {
+                    if(j < nc)
+                    {
+#pragma unroll
+                        for(rocblas_int i = 0; i < R; i++)
+                            U[i + j * ldU] = u[i + j * R];
+                    }
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(rocblas_int j = 0; j < C; j++)
+                {
+#pragma unroll
+                    for(rocblas_int k = 0; k < C; k++)
+                    {
+                        if(idx[j] == k)
+                        {
+#pragma unroll
+                            for(rocblas_int i = 0; i < C; i++)
+                                U[i + j * ldU] = z[i + k * C];
+                        }
+                    }
+                }
+            }
+        }
+
+        // right singular vectors of A (stored as rows): Z' if m >= n, or U_X' otherwise
+        if(right_svect != rocblas_svect_none)
+        {
+            const bool ovw = (right_svect == rocblas_svect_overwrite);
+            T* V = (ovw ? A : VV + b * strideV);
+            const rocblas_int ldV = (ovw ? lda : ldv);
+            const rocblas_int nr = (right_svect == rocblas_svect_all ? n : C);
+
+            if(row)
+            {
+#pragma unroll
+                for(rocblas_int i = 0; i < C; i++)
+                {
+#pragma unroll
+                    for(rocblas_int k = 0; k < C; k++)
+                    {
+                        if(idx[i] == k)
+                        {
+#pragma unroll
+                            for(rocblas_int j = 0; j < C; j++)
+                                V[i + j * ldV] = sconj(z[j + k * C]);
+                        }
+                    }
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(rocblas_int i = 0; i < R; i++)
+                {
+                    if(i < nr)
+                    {
+#pragma unroll
+                        for(rocblas_int j = 0; j < R; j++)
+                            V[i + j * ldV] = sconj(u[j + i * R]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** GESVD_SMALL_TEMPLATE launches the closed-form kernel that computes the SVD
+    of the m-by-n matrices in the batch when m, n <= 3 **/
+template <typename T, typename TT, typename W>
+void gesvd_small_template(rocblas_handle handle,
+                          const rocblas_svect left_svect,
+                          const rocblas_svect right_svect,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          W A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          TT* S,
+                          const rocblas_stride strideS,
+                          T* U,
+                          const rocblas_int ldu,
+                          const rocblas_stride strideU,
+                          T* V,
+                          const rocblas_int ldv,
+                          const rocblas_stride strideV,
+                          TT* E,
+                          const rocblas_stride strideE,
+                          rocblas_int* info,
+                          const rocblas_int batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    TT eps = get_epsilon<T>();
+    const rocblas_int r = max(m, n);
+    const rocblas_int c = min(m, n);
+
+    if(r == 1)
+        hipLaunchKernelGGL((gesvd_small_kernel<1, 1, T>), grid, threads, 0, stream, left_svect,
+                           right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu,
+                           strideU, V, ldv, strideV, E, strideE, info, eps, batch_count);
+    else if(r == 2 && c == 1)
+        hipLaunchKernelGGL((gesvd_small_kernel<2, 1, T>), grid, threads, 0, stream, left_svect,
+                           right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu,
+                           strideU, V, ldv, strideV, E, strideE, info, eps, batch_count);
+    else if(r == 2)
+        hipLaunchKernelGGL((gesvd_small_kernel<2, 2, T>), grid, threads, 0, stream, left_svect,
+                           right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu,
+                           strideU, V, ldv, strideV, E, strideE, info, eps, batch_count);
+    else if(c == 1)
+        hipLaunchKernelGGL((gesvd_small_kernel<3, 1, T>), grid, threads, 0, stream, left_svect,
+                           right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu,
+                           strideU, V, ldv, strideV, E, strideE, info, eps, batch_count);
+    else if(c == 2)
+        hipLaunchKernelGGL((gesvd_small_kernel<3, 2, T>), grid, threads, 0, stream, left_svect,
+                           right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu,
+                           strideU, V, ldv, strideV, E, strideE, info, eps, batch_count);
+    else
+        hipLaunchKernelGGL((gesvd_small_kernel<3, 3, T>), grid, threads, 0, stream, left_svect,
+                           right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu,
+                           strideU, V, ldv, strideV, E, strideE, info, eps, batch_count);
+}
+
 /** Argument checking **/
 template <typename T, typename TT, typename W>
 rocblas_status rocsolver_gesvd_argCheck(rocblas_handle handle,
@@ -363,8 +748,9 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                                    size_t* size_tempArrayC,
                                    size_t* size_workArr)
 {
-    // if quick return, set workspace to zero
-    if(n == 0 || m == 0 || batch_count == 0)
+    // if quick return, or if the matrices are solved with the closed-form
+    // kernels (m, n <= 3), set workspace to zero
+    if(n == 0 || m == 0 || batch_count == 0 || (m <= 3 && n <= 3))
     {
         *size_scalars = 0;
         *size_work_workArr = 0;
@@ -440,7 +826,11 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                                                   &x[0], &y[0]);
 
     // workspace required for the SVD of the bidiagonal form
-    rocsolver_bdsqr_getMemorySize<S>(k, nv, nu, 0, batch_count, &w[1]);
+    // (when no singular vectors are requested, the dqds algorithm is used instead)
+    if(leftvN && rightvN)
+        rocsolver_bdsvals_getMemorySize<S>(k, batch_count, &w[1]);
+    else
+        rocsolver_bdsqr_getMemorySize<S>(k, nv, nu, 0, batch_count, &w[1]);
 
     // extra requirements for QR/LQ factorization
     if(thinSVD)
@@ -517,7 +907,14 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     *size_diag_tmptr_Y = *std::max_element(std::begin(y), std::end(y));
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
+/** MAXITER is the max number of dqds iterations per singular value when only the
+    singular values are computed (it is only lowered to test the fallback to BDSQR) **/
+template <bool BATCHED,
+          bool STRIDED,
+          typename T,
+          typename TT,
+          typename W,
+          rocblas_int MAXITER = BDSVALS_MAX_ITERS>
 rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                         const rocblas_svect left_svect,
                                         const rocblas_svect right_svect,
@@ -560,6 +957,16 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     if(n == 0 || m == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    // closed-form kernels for matrices with at most 3 rows and columns
+    // (one thread per matrix)
+    if(m <= 3 && n <= 3)
+    {
+        gesvd_small_template<T>(handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, S,
+                                strideS, U, ldu, strideU, V, ldv, strideV, E, strideE, info,
+                                batch_count);
+        return rocblas_status_success;
+    }
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -727,7 +1134,10 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                     workArr);
 
             //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
-            if(row)
+            if(othervN)
+                local_bdsvals_template<TT, MAXITER>(handle, k, S, strideS, E, strideE, info,
+                                                    batch_count, (TT*)work_workArr);
+            else if(row)
                 local_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, S, strideS, E,
                                         strideE, A, shiftA, lda, strideA, U, shiftU, ldu, strideU,
                                         info, batch_count, (TT*)work_workArr, workArr);
@@ -1082,7 +1492,13 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         }
 
         //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
-        if(!leftvO && !rightvO)
+        if(leftvN && rightvN)
+        {
+            local_bdsvals_template<TT, MAXITER>(handle, k, S, strideS, E, strideE, info,
+                                                batch_count, (TT*)work_workArr);
+        }
+
+        else if(!leftvO && !rightvO)
         {
             local_bdsqr_template<T>(handle, uplo, k, nv, nu, S, strideS, E, strideE, V, shiftV, ldv,
                                     strideV, U, shiftU, ldu, strideU, info, batch_count,
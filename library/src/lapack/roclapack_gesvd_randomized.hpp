@@ -0,0 +1,390 @@
+/************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_gesvd.hpp"
+#include "rocsolver.h"
+
+/** SPLITMIX64 is a counter-based hash used to generate the (reproducible)
+    random sketching matrix without depending on a device RNG library **/
+__device__ inline uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/** GAUSSIAN_PAIR computes two independent standard normal samples from the
+    given counter using the Box-Muller transform **/
+template <typename S>
+__device__ void gaussian_pair(const uint64_t counter, S& g1, S& g2)
+{
+    const double two_pi = 6.283185307179586;
+    const double scale = 1.0 / 9007199254740992.0; // 2^-53
+
+    // uniform samples in (0,1] and [0,1)
+    double u1 = ((splitmix64(2 * counter) >> 11) + 1) * scale;
+    double u2 = (splitmix64(2 * counter + 1) >> 11) * scale;
+
+    double r = sqrt(-2.0 * log(u1));
+    g1 = S(r * cos(two_pi * u2));
+    g2 = S(r * sin(two_pi * u2));
+}
+
+template <typename T, typename S, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ T gaussian_sample(const uint64_t counter)
+{
+    S g1, g2;
+    gaussian_pair(counter, g1, g2);
+    return g1;
+}
+
+template <typename T, typename S, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ T gaussian_sample(const uint64_t counter)
+{
+    S g1, g2;
+    gaussian_pair(counter, g1, g2);
+    return T(g1, g2);
+}
+
+/** GAUSSIAN_SKETCH fills the m-by-n matrices X_j with independent samples
+    of the standard normal distribution **/
+template <typename T, typename S>
+__global__ void gaussian_sketch(const rocblas_int m,
+                                const rocblas_int n,
+                                T* X,
+                                const rocblas_int ldx,
+                                const rocblas_stride strideX)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m && j < n)
+    {
+        uint64_t counter = (uint64_t(b) * n + j) * m + i;
+        X[b * strideX + i + j * ldx] = gaussian_sample<T, S>(counter);
+    }
+}
+
+/** Orthonormalizes the columns of the m-by-n matrices A_j
+    (Q factor of the QR factorization) **/
+template <typename T>
+void local_orthonormalize(rocblas_handle handle,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          T* A,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          T* tau,
+                          const rocblas_int batch_count,
+                          T* scalars,
+                          void* work_workArr,
+                          T* Abyx_norms_tmptr,
+                          T* Abyx_norms_trfact_X,
+                          T* diag_tmptr_Y,
+                          T** workArr)
+{
+    rocsolver_geqrf_template<false, true, T>(handle, m, n, A, 0, lda, strideA, tau, n, batch_count,
+                                             scalars, work_workArr, Abyx_norms_trfact_X,
+                                             diag_tmptr_Y, workArr);
+
+    rocsolver_orgqr_ungqr_template<false, true, T>(handle, m, n, n, A, 0, lda, strideA, tau, n,
+                                                   batch_count, scalars, (T*)work_workArr,
+                                                   Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr);
+}
+
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesvd_randomized_argCheck(rocblas_handle handle,
+                                                   const rocblas_svect left_svect,
+                                                   const rocblas_svect right_svect,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int k,
+                                                   const rocblas_int p,
+                                                   const rocblas_int q,
+                                                   W A,
+                                                   const rocblas_int lda,
+                                                   TT* S,
+                                                   T* U,
+                                                   const rocblas_int ldu,
+                                                   T* V,
+                                                   const rocblas_int ldv,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if((left_svect != rocblas_svect_singular && left_svect != rocblas_svect_none)
+       || (right_svect != rocblas_svect_singular && right_svect != rocblas_svect_none))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || k < 0 || p < 0 || q < 0 || k + p > min(m, n) || lda < m || ldu < 1
+       || ldv < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if((left_svect == rocblas_svect_singular && ldu < m)
+       || (right_svect == rocblas_svect_singular && ldv < k))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (k && !S) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if((left_svect == rocblas_svect_singular && k && !U)
+       || (right_svect == rocblas_svect_singular && k && !V))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gesvd_randomized_getMemorySize(const rocblas_svect left_svect,
+                                              const rocblas_svect right_svect,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              const rocblas_int k,
+                                              const rocblas_int p,
+                                              const rocblas_int batch_count,
+                                              size_t* size_scalars,
+                                              size_t* size_work_workArr,
+                                              size_t* size_Abyx_norms_tmptr,
+                                              size_t* size_Abyx_norms_trfact_X,
+                                              size_t* size_diag_tmptr_Y,
+                                              size_t* size_tau,
+                                              size_t* size_tempArrayT,
+                                              size_t* size_tempArrayC,
+                                              size_t* size_workArr,
+                                              size_t* size_sketch,
+                                              size_t* size_range,
+                                              size_t* size_proj,
+                                              size_t* size_projU,
+                                              size_t* size_projSE)
+{
+    // if quick return, set workspace to zero
+    if(k == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_Abyx_norms_trfact_X = 0;
+        *size_diag_tmptr_Y = 0;
+        *size_tau = 0;
+        *size_tempArrayT = 0;
+        *size_tempArrayC = 0;
+        *size_workArr = 0;
+        *size_sketch = 0;
+        *size_range = 0;
+        *size_proj = 0;
+        *size_projU = 0;
+        *size_projSE = 0;
+        return;
+    }
+
+    // number of columns of the sketch
+    const rocblas_int l = k + p;
+
+    size_t w[5], a[3], x[5], y[3], r[2];
+    size_t unused;
+
+    // size of the sketch (also used to store the right singular vectors
+    // of the projected matrix) and of the range basis
+    *size_sketch = sizeof(T) * n * l * batch_count;
+    *size_range = sizeof(T) * m * l * batch_count;
+
+    // size of the projected matrix, its left singular vectors and
+    // its singular values (with the off-diagonal used by BDSQR)
+    *size_proj = sizeof(T) * l * n * batch_count;
+    *size_projU = (left_svect == rocblas_svect_singular) ? sizeof(T) * l * l * batch_count : 0;
+    *size_projSE = sizeof(S) * 2 * l * batch_count;
+
+    // requirements for the SVD of the projected matrix
+    rocsolver_gesvd_getMemorySize<false, T, S>(
+        left_svect, right_svect, l, n, batch_count, rocblas_outofplace, size_scalars, &w[0], &a[0],
+        &x[0], &y[0], size_tau, size_tempArrayT, size_tempArrayC, &r[0]);
+
+    // requirements for the orthonormalization of the range and co-range bases
+    rocsolver_geqrf_getMemorySize<T, false>(m, l, batch_count, &unused, &w[1], &x[1], &y[1],
+                                            &unused);
+    rocsolver_geqrf_getMemorySize<T, false>(n, l, batch_count, &unused, &w[2], &x[2], &y[2],
+                                            &unused);
+    rocsolver_orgqr_ungqr_getMemorySize<T, false>(m, l, l, batch_count, &unused, &w[3], &a[1],
+                                                  &x[3], &unused);
+    rocsolver_orgqr_ungqr_getMemorySize<T, false>(n, l, l, batch_count, &unused, &w[4], &a[2],
+                                                  &x[4], &unused);
+    *size_tau = max(*size_tau, sizeof(T) * l * batch_count);
+
+    // size of array of pointers (batched case, for the mixed gemm calls)
+    r[1] = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
+
+    // get max sizes
+    *size_work_workArr = *std::max_element(std::begin(w), std::end(w));
+    *size_Abyx_norms_tmptr = *std::max_element(std::begin(a), std::end(a));
+    *size_Abyx_norms_trfact_X = *std::max_element(std::begin(x), std::end(x));
+    *size_diag_tmptr_Y = *std::max_element(std::begin(y), std::end(y));
+    *size_workArr = *std::max_element(std::begin(r), std::end(r));
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
+rocblas_status rocsolver_gesvd_randomized_template(rocblas_handle handle,
+                                                   const rocblas_svect left_svect,
+                                                   const rocblas_svect right_svect,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int k,
+                                                   const rocblas_int p,
+                                                   const rocblas_int q,
+                                                   W A,
+                                                   const rocblas_int shiftA,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   TT* S,
+                                                   const rocblas_stride strideS,
+                                                   T* U,
+                                                   const rocblas_int ldu,
+                                                   const rocblas_stride strideU,
+                                                   T* V,
+                                                   const rocblas_int ldv,
+                                                   const rocblas_stride strideV,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count,
+                                                   T* scalars,
+                                                   void* work_workArr,
+                                                   T* Abyx_norms_tmptr,
+                                                   T* Abyx_norms_trfact_X,
+                                                   T* diag_tmptr_Y,
+                                                   T* tau,
+                                                   T* tempArrayT,
+                                                   T* tempArrayC,
+                                                   T** workArr,
+                                                   T* sketch,
+                                                   T* range,
+                                                   T* proj,
+                                                   T* projU,
+                                                   TT* projSE)
+{
+    ROCSOLVER_ENTER("gesvd_randomized", "leftsv:", left_svect, "rightsv:", right_svect, "m:", m,
+                    "n:", n, "k:", k, "p:", p, "q:", q, "shiftA:", shiftA, "lda:", lda, "ldu:", ldu,
+                    "ldv:", ldv, "bc:", batch_count);
+
+    constexpr bool COMPLEX = is_complex<T>;
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no singular triplets are requested
+    if(k == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / 32 + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream, info,
+                           batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants to use when calling rocablas functions
+    T one = 1;
+    T zero = 0;
+
+    const rocblas_operation trans
+        = COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+    // dimensions and strides of the internal buffers
+    const rocblas_int l = k + p;
+    const rocblas_stride strideX = rocblas_stride(n) * l;
+    const rocblas_stride strideY = rocblas_stride(m) * l;
+    const rocblas_stride strideB = rocblas_stride(l) * n;
+    const rocblas_stride strideUb = rocblas_stride(l) * l;
+    TT* projE = projSE + l * batch_count;
+
+    // common block sizes and number of threads for internal kernels
+    constexpr rocblas_int thread_count = 32;
+    const rocblas_int blocks_n = (n - 1) / thread_count + 1;
+    const rocblas_int blocks_l = (l - 1) / thread_count + 1;
+    const rocblas_int blocks_k = (k - 1) / thread_count + 1;
+
+    // 1. draw the random sketching matrix X and
+    // compute the sample of the range of A as Y = A * X
+    hipLaunchKernelGGL((gaussian_sketch<T, TT>), dim3(blocks_n, blocks_l, batch_count),
+                       dim3(thread_count, thread_count, 1), 0, stream, n, l, sketch, n, strideX);
+
+    rocblasCall_gemm<BATCHED, STRIDED>(handle, rocblas_operation_none, rocblas_operation_none, m,
+                                       l, n, &one, A, shiftA, lda, strideA, sketch, 0, n, strideX,
+                                       &zero, range, 0, m, strideY, batch_count, workArr);
+
+    // 2. power iterations, Y = (A * A') ^ q * A * X, re-orthonormalizing
+    // the bases at every step to preserve the smallest singular directions
+    for(rocblas_int it = 0; it < q; ++it)
+    {
+        local_orthonormalize<T>(handle, m, l, range, m, strideY, tau, batch_count, scalars,
+                                work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, diag_tmptr_Y,
+                                workArr);
+
+        rocblasCall_gemm<BATCHED, STRIDED>(handle, trans, rocblas_operation_none, n, l, m, &one, A,
+                                           shiftA, lda, strideA, range, 0, m, strideY, &zero,
+                                           sketch, 0, n, strideX, batch_count, workArr);
+
+        local_orthonormalize<T>(handle, n, l, sketch, n, strideX, tau, batch_count, scalars,
+                                work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, diag_tmptr_Y,
+                                workArr);
+
+        rocblasCall_gemm<BATCHED, STRIDED>(handle, rocblas_operation_none, rocblas_operation_none,
+                                           m, l, n, &one, A, shiftA, lda, strideA, sketch, 0, n,
+                                           strideX, &zero, range, 0, m, strideY, batch_count,
+                                           workArr);
+    }
+
+    // 3. orthonormal basis Q of the range
+    local_orthonormalize<T>(handle, m, l, range, m, strideY, tau, batch_count, scalars,
+                            work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, diag_tmptr_Y,
+                            workArr);
+
+    // 4. project A onto the range, B = Q' * A
+    rocblasCall_gemm<BATCHED, STRIDED>(handle, trans, rocblas_operation_none, l, n, m, &one, range,
+                                       0, m, strideY, A, shiftA, lda, strideA, &zero, proj, 0, l,
+                                       strideB, batch_count, workArr);
+
+    // 5. SVD of the small l-by-n matrix B = Ub * S * Vb'
+    // (Vb' is stored in the sketch buffer, which is not needed anymore)
+    rocsolver_gesvd_template<false, true, T>(
+        handle, left_svect, right_svect, l, n, proj, 0, l, strideB, projSE, l, projU, l, strideUb,
+        sketch, l, strideX, projE, l, rocblas_outofplace, info, batch_count, scalars, work_workArr,
+        Abyx_norms_tmptr, Abyx_norms_trfact_X, diag_tmptr_Y, tau, tempArrayT, tempArrayC, workArr);
+
+    // 6. keep the k leading singular triplets; U = Q * Ub
+    hipLaunchKernelGGL(copy_mat<TT>, dim3(blocks_k, 1, batch_count),
+                       dim3(thread_count, thread_count, 1), 0, stream, k, 1, projSE, 0, l, l, S, 0,
+                       k, strideS);
+
+    if(left_svect == rocblas_svect_singular)
+        rocblasCall_gemm<false, true>(handle, rocblas_operation_none, rocblas_operation_none, m, k,
+                                      l, &one, range, 0, m, strideY, projU, 0, l, strideUb, &zero,
+                                      U, 0, ldu, strideU, batch_count, workArr);
+
+    if(right_svect == rocblas_svect_singular)
+        hipLaunchKernelGGL(copy_mat<T>, dim3(blocks_k, blocks_n, batch_count),
+                           dim3(thread_count, thread_count, 1), 0, stream, k, n, sketch, 0, l,
+                           strideX, V, 0, ldv, strideV);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -4,7 +4,7 @@
 
 #include "roclapack_gesvd.hpp"
 
-template <typename T, typename TT, typename W>
+template <typename T, rocblas_int MAXITER = BDSVALS_MAX_ITERS, typename TT, typename W>
 rocblas_status rocsolver_gesvd_strided_batched_impl(rocblas_handle handle,
                                                     const rocblas_svect left_svect,
                                                     const rocblas_svect right_svect,
@@ -91,7 +91,7 @@ rocblas_status rocsolver_gesvd_strided_batched_impl(rocblas_handle handle,
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_gesvd_template<false, true, T>(
+    return rocsolver_gesvd_template<false, true, T, TT, W, MAXITER>(
         handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu, strideU,
         V, ldv, strideV, E, strideE, fast_alg, info, batch_count, (T*)scalars, work_workArr,
         (T*)Abyx_norms_tmptr, (T*)Abyx_norms_trfact_X, (T*)diag_tmptr_Y, (T*)tau, (T*)tempArrayT,
@@ -215,3 +215,126 @@ rocblas_status rocsolver_zgesvd_strided_batched(rocblas_handle handle,
 }
 
 } // extern C
+
+/*
+ * ===========================================================================
+ *    Test-only entry points (not part of the public API): the dqds iterations
+ *    are disabled so that every matrix goes through the fallback to BDSQR
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status
+    rocsolver_sgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                            const rocblas_svect left_svect,
+                                            const rocblas_svect right_svect,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            float* A,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            float* S,
+                                            const rocblas_stride strideS,
+                                            float* U,
+                                            const rocblas_int ldu,
+                                            const rocblas_stride strideU,
+                                            float* V,
+                                            const rocblas_int ldv,
+                                            const rocblas_stride strideV,
+                                            float* E,
+                                            const rocblas_stride strideE,
+                                            const rocblas_workmode fast_alg,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_strided_batched_impl<float, 0>(
+        handle, left_svect, right_svect, m, n, A, lda, strideA, S, strideS, U, ldu, strideU, V, ldv,
+        strideV, E, strideE, fast_alg, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status
+    rocsolver_dgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                            const rocblas_svect left_svect,
+                                            const rocblas_svect right_svect,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            double* A,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            double* S,
+                                            const rocblas_stride strideS,
+                                            double* U,
+                                            const rocblas_int ldu,
+                                            const rocblas_stride strideU,
+                                            double* V,
+                                            const rocblas_int ldv,
+                                            const rocblas_stride strideV,
+                                            double* E,
+                                            const rocblas_stride strideE,
+                                            const rocblas_workmode fast_alg,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_strided_batched_impl<double, 0>(
+        handle, left_svect, right_svect, m, n, A, lda, strideA, S, strideS, U, ldu, strideU, V, ldv,
+        strideV, E, strideE, fast_alg, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status
+    rocsolver_cgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                            const rocblas_svect left_svect,
+                                            const rocblas_svect right_svect,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            float* S,
+                                            const rocblas_stride strideS,
+                                            rocblas_float_complex* U,
+                                            const rocblas_int ldu,
+                                            const rocblas_stride strideU,
+                                            rocblas_float_complex* V,
+                                            const rocblas_int ldv,
+                                            const rocblas_stride strideV,
+                                            float* E,
+                                            const rocblas_stride strideE,
+                                            const rocblas_workmode fast_alg,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_strided_batched_impl<rocblas_float_complex, 0>(
+        handle, left_svect, right_svect, m, n, A, lda, strideA, S, strideS, U, ldu, strideU, V, ldv,
+        strideV, E, strideE, fast_alg, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status
+    rocsolver_zgesvd_strided_batched_nodqds(rocblas_handle handle,
+                                            const rocblas_svect left_svect,
+                                            const rocblas_svect right_svect,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            double* S,
+                                            const rocblas_stride strideS,
+                                            rocblas_double_complex* U,
+                                            const rocblas_int ldu,
+                                            const rocblas_stride strideU,
+                                            rocblas_double_complex* V,
+                                            const rocblas_int ldv,
+                                            const rocblas_stride strideV,
+                                            double* E,
+                                            const rocblas_stride strideE,
+                                            const rocblas_workmode fast_alg,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_strided_batched_impl<rocblas_double_complex, 0>(
+        handle, left_svect, right_svect, m, n, A, lda, strideA, S, strideS, U, ldu, strideU, V, ldv,
+        strideV, E, strideE, fast_alg, info, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,552 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gesvd.hpp"
+#include "roclapack_syevj_heevj.hpp"
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    GESVDJ implements the one-sided Jacobi SVD method. Plane rotations,
+ *    applied from the right, orthogonalize the columns of a k-by-k matrix G;
+ *    once the columns are orthogonal, G * Z = U * S, where the singular values
+ *    S are the column norms and Z accumulates the rotations. The pairs of
+ *    columns are visited with the same parallel (round-robin) ordering used by
+ *    SYEVJ, so that the k/2 rotations of every round are computed and applied
+ *    concurrently.
+ *
+ *    Square matrices are processed directly (G = A). Otherwise A is first
+ *    factorized as A = Q * R (m > n) or A = L * Q (m < n), the triangular
+ *    factor is diagonalized, and the singular vectors are back-transformed
+ *    with Q. Every matrix in the batch is processed by a single group of
+ *    threads, with G (and Z) staged in shared memory when they fit.
+ * ===========================================================================
+ */
+
+/** GESVDJ_KERNEL computes the singular values (and vectors) of the k-by-k matrix G
+    given by the leading block of A (its upper or lower triangle when uplo is upper
+    or lower). When vectors are required, the left singular vectors are written in
+    the leading k-by-k block of U, and the conjugate transpose of the right singular
+    vectors in the leading k-by-k block of V.
+    When lds is true, G, the rotations Z and the column norms are staged in shared
+    memory; otherwise they are kept in the global workspace work (strideWork elements
+    for every matrix in the batch).
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads in x. The dynamic
+    shared memory must have room for the staged data when lds is true. **/
+template <typename T, typename S, typename W>
+__global__ void __launch_bounds__(BLOCKSIZE) gesvdj_kernel(const bool vectors,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int k,
+                                                           W AA,
+                                                           const rocblas_int shiftA,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const S abstol,
+                                                           const S eps,
+                                                           S* residualA,
+                                                           const rocblas_int max_sweeps,
+                                                           rocblas_int* n_sweepsA,
+                                                           S* SS,
+                                                           const rocblas_stride strideS,
+                                                           T* UU,
+                                                           const rocblas_int ldu,
+                                                           const rocblas_stride strideU,
+                                                           T* VV,
+                                                           const rocblas_int ldv,
+                                                           const rocblas_stride strideV,
+                                                           rocblas_int* infoA,
+                                                           T* work,
+                                                           const rocblas_stride strideWork,
+                                                           const bool lds)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    S* sv = SS + b * strideS;
+    T* U = (vectors ? UU + b * strideU : nullptr);
+    T* V = (vectors ? VV + b * strideV : nullptr);
+
+    // number of players and number of rotations per round
+    const rocblas_int nn = k + (k % 2);
+    const rocblas_int half = nn / 2;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    // G is the matrix being orthogonalized, Z accumulates the rotations,
+    // (c[j], su[j]) define the j-th rotation of the current round,
+    // and nrm holds the norms of the columns of G
+    T* G = (lds ? (T*)lmem : work + b * strideWork);
+    T* Z = G + k * k;
+    T* rot = Z + (vectors ? k * k : 0);
+    T* c = rot;
+    T* su = rot + half;
+    S* nrm = (S*)(rot + nn);
+
+    // copy the referenced part of A to G, and initialize Z as the identity
+    for(rocblas_int l = tid; l < k * k; l += nthds)
+    {
+        rocblas_int i = l % k;
+        rocblas_int j = l / k;
+        bool ref = (uplo == rocblas_fill_full) || (uplo == rocblas_fill_upper ? i <= j : i >= j);
+        G[i + j * k] = (ref ? A[i + j * lda] : T(0));
+        if(vectors)
+            Z[i + j * k] = (i == j ? 1 : 0);
+    }
+    __syncthreads();
+
+    // two columns are considered orthogonal when |g_p' * g_q| <= tol * ||g_p|| * ||g_q||
+    const S tol = (abstol > 0 ? abstol : k * eps);
+
+    S off = 0;
+    rocblas_int sweeps = 0;
+    while(sweeps < max_sweeps)
+    {
+        off = 0;
+        for(rocblas_int r = 0; r < nn - 1; r++)
+        {
+            // compute the rotations of this round
+            // (c = 0 marks the pairs that are already orthogonal)
+            for(rocblas_int kk = tid; kk < half; kk += nthds)
+            {
+                rocblas_int p, q;
+                syevj_pair(nn, r, kk, p, q);
+
+                S cc = 0;
+                T ss = 0;
+                if(q < k)
+                {
+                    // entries of G' * G associated with columns p and q
+                    S alpha = 0;
+                    S beta = 0;
+                    T gamma = 0;
+                    for(rocblas_int i = 0; i < k; i++)
+                    {
+                        S t = std::abs(G[i + p * k]);
+                        alpha += t * t;
+                        t = std::abs(G[i + q * k]);
+                        beta += t * t;
+                        gamma += sconj(G[i + p * k]) * G[i + q * k];
+                    }
+
+                    S ag = std::abs(gamma);
+                    if(ag > 0)
+                    {
+                        S rel = ag / std::sqrt(alpha * beta);
+                        off = (rel > off ? rel : off);
+                        if(rel > tol)
+                            jacobi_rot(alpha, beta, gamma, cc, ss);
+                    }
+                }
+                c[kk] = cc;
+                su[kk] = ss;
+            }
+            __syncthreads();
+
+            // apply the rotations to the columns p and q of G, and accumulate them in Z
+            for(rocblas_int l = tid; l < half * k; l += nthds)
+            {
+                rocblas_int kk = l / k;
+                rocblas_int i = l % k;
+                if(std::real(c[kk]) != 0)
+                {
+                    rocblas_int p, q;
+                    syevj_pair(nn, r, kk, p, q);
+                    T cc = c[kk];
+                    T ss = su[kk];
+                    T x = G[i + p * k];
+                    T y = G[i + q * k];
+                    G[i + p * k] = cc * x - sconj(ss) * y;
+                    G[i + q * k] = ss * x + cc * y;
+
+                    if(vectors)
+                    {
+                        x = Z[i + p * k];
+                        y = Z[i + q * k];
+                        Z[i + p * k] = cc * x - sconj(ss) * y;
+                        Z[i + q * k] = ss * x + cc * y;
+                    }
+                }
+            }
+            __syncthreads();
+        }
+
+        sweeps++;
+        rocblas_int idx = 0;
+        off = block_reduce_max(off, idx, sval, sidx);
+        if(off <= tol)
+            break;
+    }
+
+    // the singular values are the norms of the columns of G
+    for(rocblas_int j = tid; j < k; j += nthds)
+    {
+        S nr = 0;
+        for(rocblas_int i = 0; i < k; i++)
+        {
+            S t = std::abs(G[i + j * k]);
+            nr += t * t;
+        }
+        nrm[j] = std::sqrt(nr);
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        residualA[b] = off;
+        n_sweepsA[b] = sweeps;
+        infoA[b] = (off > tol ? 1 : 0);
+    }
+
+    // sort the singular values in decreasing order (selection sort), together
+    // with the columns of G and Z
+    for(rocblas_int j = 0; j < k - 1; j++)
+    {
+        if(tid == 0)
+        {
+            rocblas_int m = j;
+            for(rocblas_int i = j + 1; i < k; i++)
+            {
+                if(nrm[i] > nrm[m])
+                    m = i;
+            }
+            sidx[0] = m;
+            if(m != j)
+            {
+                S t = nrm[j];
+                nrm[j] = nrm[m];
+                nrm[m] = t;
+            }
+        }
+        __syncthreads();
+
+        rocblas_int m = sidx[0];
+        if(vectors && m != j)
+        {
+            for(rocblas_int i = tid; i < k; i += nthds)
+            {
+                T t = G[i + j * k];
+                G[i + j * k] = G[i + m * k];
+                G[i + m * k] = t;
+                t = Z[i + j * k];
+                Z[i + j * k] = Z[i + m * k];
+                Z[i + m * k] = t;
+            }
+        }
+        __syncthreads();
+    }
+
+    for(rocblas_int j = tid; j < k; j += nthds)
+        sv[j] = nrm[j];
+
+    if(!vectors)
+        return;
+
+    // the left singular vectors are the normalized columns of G, and the right
+    // singular vectors are the columns of Z
+    for(rocblas_int l = tid; l < k * k; l += nthds)
+    {
+        rocblas_int i = l % k;
+        rocblas_int j = l / k;
+        U[i + j * ldu] = (nrm[j] > 0 ? G[i + j * k] * T(1 / nrm[j]) : T(0));
+        V[j + i * ldv] = sconj(Z[i + j * k]);
+    }
+    __syncthreads();
+
+    // complete the left singular vectors associated with zero singular values
+    // (Gram-Schmidt orthogonalization of the canonical vectors)
+    if(tid == 0)
+    {
+        for(rocblas_int j = 0; j < k; j++)
+        {
+            if(nrm[j] > 0)
+                continue;
+
+            for(rocblas_int e = 0; e < k; e++)
+            {
+                for(rocblas_int i = 0; i < k; i++)
+                    U[i + j * ldu] = (i == e ? 1 : 0);
+
+                for(rocblas_int pass = 0; pass < 2; pass++)
+                {
+                    for(rocblas_int l = 0; l < j; l++)
+                    {
+                        T d = 0;
+                        for(rocblas_int i = 0; i < k; i++)
+                            d += sconj(U[i + l * ldu]) * U[i + j * ldu];
+                        for(rocblas_int i = 0; i < k; i++)
+                            U[i + j * ldu] -= d * U[i + l * ldu];
+                    }
+                }
+
+                S nr = 0;
+                for(rocblas_int i = 0; i < k; i++)
+                {
+                    S t = std::abs(U[i + j * ldu]);
+                    nr += t * t;
+                }
+                nr = std::sqrt(nr);
+                if(nr > 0.5)
+                {
+                    for(rocblas_int i = 0; i < k; i++)
+                        U[i + j * ldu] = U[i + j * ldu] * T(1 / nr);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesvdj_argCheck(rocblas_handle handle,
+                                         const rocblas_svect svect,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         W A,
+                                         const rocblas_int lda,
+                                         TT* residual,
+                                         const rocblas_int max_sweeps,
+                                         rocblas_int* n_sweeps,
+                                         TT* S,
+                                         T* U,
+                                         const rocblas_int ldu,
+                                         T* V,
+                                         const rocblas_int ldv,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(svect != rocblas_svect_all && svect != rocblas_svect_singular
+       && svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || lda < m || ldu < 1 || ldv < 1 || max_sweeps <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(svect != rocblas_svect_none && ldu < m)
+        return rocblas_status_invalid_size;
+    if((svect == rocblas_svect_all && ldv < n)
+       || (svect == rocblas_svect_singular && ldv < min(m, n)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (min(m, n) && !S) || (batch_count && !residual)
+       || (batch_count && !n_sweeps) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if((svect == rocblas_svect_all && m && !U)
+       || (svect == rocblas_svect_singular && min(m, n) && !U))
+        return rocblas_status_invalid_pointer;
+    if(svect != rocblas_svect_none && n && !V)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gesvdj_getMemorySize(const rocblas_svect svect,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_work_workArr,
+                                    size_t* size_Abyx_norms_trfact,
+                                    size_t* size_diag_tmptr,
+                                    size_t* size_tau,
+                                    size_t* size_workArr)
+{
+    *size_scalars = 0;
+    *size_work_workArr = 0;
+    *size_Abyx_norms_trfact = 0;
+    *size_diag_tmptr = 0;
+    *size_tau = 0;
+    *size_workArr = 0;
+
+    // if quick return, no workspace is needed
+    if(n == 0 || m == 0 || batch_count == 0)
+        return;
+
+    const rocblas_int k = min(m, n);
+    const bool vectors = (svect != rocblas_svect_none);
+
+    size_t w[3] = {};
+    size_t x[2] = {};
+    size_t y[2] = {};
+    size_t wa[2] = {};
+    size_t unused;
+
+    // the triangular factor (and its rotations) are staged in shared memory when
+    // they fit; otherwise they are kept in global memory
+    size_t nn = k + (k % 2);
+    size_t size_mat = sizeof(T) * k * k * (vectors ? 2 : 1);
+    if(size_mat > GESVDJ_SMALL_MAXLDS)
+        w[0] = sizeof(T) * batch_count * (size_t(k) * k * (vectors ? 2 : 1) + nn + k);
+
+    // requirements for the QR (or LQ) preconditioning of non-square matrices
+    if(m != n)
+    {
+        *size_tau = sizeof(T) * k * batch_count;
+
+        if(m > n)
+            rocsolver_geqrf_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, &w[1],
+                                                      &x[0], &y[0], &wa[0]);
+        else
+            rocsolver_gelqf_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, &w[1],
+                                                      &x[0], &y[0], &wa[0]);
+
+        // workspace required to back-transform the singular vectors
+        if(vectors && m > n)
+            rocsolver_ormbr_unmbr_getMemorySize<T, BATCHED>(
+                rocblas_column_wise, rocblas_side_left, m, (svect == rocblas_svect_all ? m : k), n,
+                batch_count, &unused, &w[2], &y[1], &x[1], &wa[1]);
+        else if(vectors)
+            rocsolver_ormbr_unmbr_getMemorySize<T, BATCHED>(
+                rocblas_row_wise, rocblas_side_right, (svect == rocblas_svect_all ? n : k), n, m,
+                batch_count, &unused, &w[2], &y[1], &x[1], &wa[1]);
+    }
+
+    // get max sizes
+    *size_work_workArr = *std::max_element(std::begin(w), std::end(w));
+    *size_Abyx_norms_trfact = *std::max_element(std::begin(x), std::end(x));
+    *size_diag_tmptr = *std::max_element(std::begin(y), std::end(y));
+    *size_workArr = *std::max_element(std::begin(wa), std::end(wa));
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
+rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
+                                         const rocblas_svect svect,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         W A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const TT abstol,
+                                         TT* residual,
+                                         const rocblas_int max_sweeps,
+                                         rocblas_int* n_sweeps,
+                                         TT* S,
+                                         const rocblas_stride strideS,
+                                         T* U,
+                                         const rocblas_int ldu,
+                                         const rocblas_stride strideU,
+                                         T* V,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count,
+                                         T* scalars,
+                                         void* work_workArr,
+                                         T* Abyx_norms_trfact,
+                                         T* diag_tmptr,
+                                         T* tau,
+                                         T** workArr)
+{
+    ROCSOLVER_ENTER("gesvdj", "svect:", svect, "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "abstol:", abstol, "max_sweeps:", max_sweeps, "ldu:", ldu, "ldv:", ldv,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // quick return
+    if(n == 0 || m == 0)
+    {
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, residual, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, n_sweeps, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // auxiliary sizes and variables
+    const rocblas_int k = min(m, n);
+    const bool vectors = (svect != rocblas_svect_none);
+    const rocblas_int nu = (svect == rocblas_svect_all) ? m : k;
+    const rocblas_int nv = (svect == rocblas_svect_all) ? n : k;
+    const rocblas_operation trans
+        = is_complex<T> ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+
+    constexpr rocblas_int thread_count = 32;
+    const rocblas_int blocks_m = (m - 1) / thread_count + 1;
+    const rocblas_int blocks_n = (n - 1) / thread_count + 1;
+    const rocblas_int blocks_u = (nu - 1) / thread_count + 1;
+    const rocblas_int blocks_v = (nv - 1) / thread_count + 1;
+
+    // 1. precondition non-square matrices, A = Q * R (m > n) or A = L * Q (m < n).
+    // The singular vectors of the triangular factor are written in the leading
+    // k-by-k blocks of U and V, which are completed with the identity when all the
+    // singular vectors are required
+    rocblas_fill uplo = rocblas_fill_full;
+    if(m != n)
+    {
+        local_geqrlq_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, tau, k,
+                                                batch_count, scalars, work_workArr,
+                                                Abyx_norms_trfact, diag_tmptr, workArr, m > n);
+        uplo = (m > n) ? rocblas_fill_upper : rocblas_fill_lower;
+
+        if(vectors && m > n)
+            hipLaunchKernelGGL(init_ident<T>, dim3(blocks_m, blocks_u, batch_count),
+                               dim3(thread_count, thread_count, 1), 0, stream, m, nu, U, 0, ldu,
+                               strideU);
+        else if(vectors)
+            hipLaunchKernelGGL(init_ident<T>, dim3(blocks_v, blocks_n, batch_count),
+                               dim3(thread_count, thread_count, 1), 0, stream, nv, n, V, 0, ldv,
+                               strideV);
+    }
+
+    // 2. one-sided Jacobi SVD of the (triangular) k-by-k matrix
+    rocblas_int nn = k + (k % 2);
+    size_t size_mat = sizeof(T) * k * k * (vectors ? 2 : 1);
+    bool lds = (size_mat <= GESVDJ_SMALL_MAXLDS);
+    size_t lmemsize = (lds ? size_mat + sizeof(T) * (nn + k) : 0);
+    rocblas_stride strideWork = (lds ? 0 : rocblas_stride(k) * k * (vectors ? 2 : 1) + nn + k);
+
+    TT eps = get_epsilon<T>();
+    hipLaunchKernelGGL(gesvdj_kernel<T, TT>, dim3(batch_count), dim3(BLOCKSIZE), lmemsize, stream,
+                       vectors, uplo, k, A, shiftA, lda, strideA, abstol, eps, residual,
+                       max_sweeps, n_sweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info,
+                       (T*)work_workArr, strideWork, lds);
+
+    // 3. back-transform the singular vectors, U = Q * Ur (m > n) or V' = Vl' * Q (m < n)
+    if(vectors && m > n)
+        local_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, m, nu, n, A,
+            shiftA, lda, strideA, tau, k, U, 0, ldu, strideU, batch_count, scalars,
+            (T*)work_workArr, diag_tmptr, Abyx_norms_trfact, workArr);
+    else if(vectors && m < n)
+        local_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_row_wise, rocblas_side_right, trans, nv, n, m, A, shiftA, lda, strideA,
+            tau, k, V, 0, ldv, strideV, batch_count, scalars, (T*)work_workArr, diag_tmptr,
+            Abyx_norms_trfact, workArr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -11,6 +11,7 @@
 
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
+#include "roclapack_trtri.hpp"
 #include "rocsolver.h"
 
 #ifdef OPTIMAL
@@ -291,38 +292,6 @@ __device__ void getri_pivot(const rocblas_int n, T* a, const rocblas_int lda, ro
     }
 }
 
-template <bool COPYALL, bool INPLACE, typename T, typename U, typename V>
-__global__ void getri_trtri_update(const rocblas_int n,
-                                   U A,
-                                   const rocblas_int shifta,
-                                   const rocblas_int lda,
-                                   const rocblas_stride stridea,
-                                   const V W,
-                                   const rocblas_int shiftw,
-                                   const rocblas_int ldw,
-                                   const rocblas_stride stridew,
-                                   rocblas_int* info)
-{
-    // Processes the output of rocblas_trtri so that it matches the output of
-    // vanilla LAPACK
-    int b = hipBlockIdx_x;
-    int i = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
-    int j = hipBlockIdx_z * hipBlockDim_z + hipThreadIdx_z;
-
-    T* a = load_ptr_batch<T>(A, b, shifta, stridea);
-    T* w = load_ptr_batch<T>(W, b, shiftw, stridew);
-
-    // In-place: if A is singular, do not change A; otherwise, copy upper
-    // triangular inverse. Out-of-place: if A is singular, restore A; otherwise,
-    // copy lower triangular original
-    bool copy = COPYALL || (info[b] == 0 && INPLACE && i <= j)
-        || (info[b] == 0 && !INPLACE && i > j) || (info[b] != 0 && !INPLACE);
-    if(i < n && j < n && copy)
-    {
-        a[i + j * lda] = w[i + j * ldw];
-    }
-}
-
 template <typename T, typename U, typename V>
 __global__ void getri_kernel(const rocblas_int n,
                              U A,
@@ -428,7 +397,7 @@ __global__ void getri_kernel_large2(const rocblas_int n,
         getri_pivot(n, a, lda, p);
 }
 
-template <bool BATCHED, bool INPLACE, typename T>
+template <bool BATCHED, typename T>
 void rocsolver_getri_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
                                    size_t* size_scalars,
@@ -476,28 +445,24 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     else
         *size_workArr = 0;
 
-    size_t w1a, w1b, w2a, w2b, t1, t2;
+    size_t t1, t2;
 
     // requirements for calling TRSM
     if(n <= GETRI_SWITCHSIZE_LARGE)
     {
-        w1a = 0;
-        w2a = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
         *size_work3 = 0;
         *size_work4 = 0;
     }
     else
-        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_right, n, GETRI_BLOCKSIZE, batch_count, &w1a,
-                                         &w2a, size_work3, size_work4);
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_right, n, GETRI_BLOCKSIZE, batch_count,
+                                         size_work1, size_work2, size_work3, size_work4);
 
     // requirements for calling TRTRI
-    rocblasCall_trtri_mem<BATCHED, T>(n, batch_count, &w1b, &w2b);
-
-    *size_work1 = max(w1a, w1b);
-    *size_work2 = max(w2a, w2b);
+    rocsolver_trtri_getMemorySize<T>(rocblas_diagonal_non_unit, n, batch_count, &t1);
 
     // size of temporary array required for copies
-    t1 = (INPLACE ? n * n : 0) * sizeof(T) * batch_count;
     t2 = (n <= GETRI_SWITCHSIZE_MID ? n : n * GETRI_BLOCKSIZE) * sizeof(T) * batch_count;
     *size_tmpcopy = max(t1, t2);
 }
@@ -609,61 +574,29 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     rocblas_int blocks = (n - 1) / 32 + 1;
     rocblas_int threads = min(((n - 1) / 64 + 1) * 64, BLOCKSIZE);
 
+    // out-of-place: start from the factors in A1
+    if(A1 != nullptr)
+        hipLaunchKernelGGL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
+                           n, n, A1, shiftA1, lda1, strideA1, A, shiftA, lda, strideA);
+
 #ifdef OPTIMAL
     // if very small size, use optimized inversion kernel
     if(n <= WAVESIZE)
-    {
-        if(A1 != nullptr)
-            hipLaunchKernelGGL((getri_trtri_update<true, false, T>),
-                               dim3(batch_count, blocks, blocks), dim3(1, 32, 32), 0, stream, n, A,
-                               shiftA, lda, strideA, A1, shiftA1, lda1, strideA1, nullptr);
-
         return getri_run_small<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
                                   batch_count);
-    }
 #endif
 
-    rocblas_int ldw = n;
-    rocblas_stride strideW = n * n;
-
-    if(A1 == nullptr) // in-place trtri
-    {
-        // check for singularities
-        hipLaunchKernelGGL(check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0,
-                           stream, n, A, shiftA, lda, strideA, info);
-
-        // compute inv(U)
-        rocblasCall_trtri<BATCHED, STRIDED, T>(handle, rocblas_fill_upper, rocblas_diagonal_non_unit,
-                                               n, A, shiftA, lda, strideA, tmpcopy, 0, ldw, strideW,
-                                               batch_count, (T*)work1, (T**)work2, workArr);
-
-        // copy inv(U) to A
-        hipLaunchKernelGGL((getri_trtri_update<false, true, T>), dim3(batch_count, blocks, blocks),
-                           dim3(1, 32, 32), 0, stream, n, A, shiftA, lda, strideA, tmpcopy, 0, ldw,
-                           strideW, info);
-    }
-    else // out-of-place trtri
-    {
-        // check for singularities
-        hipLaunchKernelGGL(check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0,
-                           stream, n, A1, shiftA1, lda1, strideA1, info);
-
-        // compute inv(U)
-        rocblasCall_trtri<BATCHED, STRIDED, T>(handle, rocblas_fill_upper, rocblas_diagonal_non_unit,
-                                               n, A1, shiftA1, lda1, strideA1, A, shiftA, lda,
-                                               strideA, batch_count, (T*)work1, (T**)work2, workArr);
-
-        // restore lower triangular part of A
-        hipLaunchKernelGGL((getri_trtri_update<false, false, T>), dim3(batch_count, blocks, blocks),
-                           dim3(1, 32, 32), 0, stream, n, A, shiftA, lda, strideA, A1, shiftA1,
-                           lda1, strideA1, info);
-    }
+    // compute inv(U) (singular matrices are left unchanged)
+    rocsolver_trtri_template<BATCHED, STRIDED, T>(handle, rocblas_fill_upper,
+                                                  rocblas_diagonal_non_unit, n, A, shiftA, lda,
+                                                  strideA, info, batch_count, tmpcopy);
 
     // at this point: if A is singular, then it contains the original triangular
     // factors L and U (i.e. it is unmodified); otherwise, it contains L and
     // inv(U)
 
-    strideW = (n <= GETRI_SWITCHSIZE_MID ? n : n * GETRI_BLOCKSIZE);
+    rocblas_int ldw = n;
+    rocblas_stride strideW = (n <= GETRI_SWITCHSIZE_MID ? n : n * GETRI_BLOCKSIZE);
     if(n <= GETRI_SWITCHSIZE_LARGE)
     {
         hipLaunchKernelGGL(getri_kernel<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0, stream,
@@ -35,15 +35,14 @@ rocblas_status rocsolver_getri_batched_impl(rocblas_handle handle,
     // memory workspace sizes:
     // size for constants in rocblas calls
     size_t size_scalars;
-    // size of reusable workspace (for calling TRSM and TRTRI)
+    // size of reusable workspace (for calling TRSM)
     size_t size_work1, size_work2, size_work3, size_work4;
     // size of temporary array required for copies
     size_t size_tmpcopy;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
-    rocsolver_getri_getMemorySize<true, true, T>(n, batch_count, &size_scalars, &size_work1,
-                                                 &size_work2, &size_work3, &size_work4,
-                                                 &size_tmpcopy, &size_workArr);
+    rocsolver_getri_getMemorySize<true, T>(n, batch_count, &size_scalars, &size_work1, &size_work2,
+                                           &size_work3, &size_work4, &size_tmpcopy, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytf2.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_hetf2_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("hetf2", "--uplo", uplo, "-n", n, "--lda", lda);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sytf2_sytrf_argCheck(handle, uplo, n, lda, A, ipiv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_sytf2_template<T, S>(handle, uplo, true, n, A, shiftA, lda, strideA, ipiv,
+                                          strideP, info, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_chetf2(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_hetf2_impl<rocblas_float_complex>(handle, uplo, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_zhetf2(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_hetf2_impl<rocblas_double_complex>(handle, uplo, n, A, lda, ipiv, info);
+}
+
+} // extern C
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_hetrf_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("hetrf", "--uplo", uplo, "-n", n, "--lda", lda);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sytf2_sytrf_argCheck(handle, uplo, n, lda, A, ipiv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the workspaces for the panel factorizations and trailing updates
+    size_t size_work;
+    // size of the first non-factorized column of each matrix
+    size_t size_kk;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_sytrf_getMemorySize<false, T>(n, batch_count, &size_work, &size_kk, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_kk, size_workArr);
+
+    // memory workspace allocation
+    void *work, *kk, *workArr;
+    rocblas_device_malloc mem(handle, size_work, size_kk, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    kk = mem[1];
+    workArr = mem[2];
+
+    // execution
+    return rocsolver_sytrf_template<false, T, S>(handle, uplo, true, n, A, shiftA, lda, strideA,
+                                                 ipiv, strideP, info, batch_count, (T*)work,
+                                                 (rocblas_int*)kk, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_chetrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_hetrf_impl<rocblas_float_complex>(handle, uplo, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_zhetrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_hetrf_impl<rocblas_double_complex>(handle, uplo, n, A, lda, ipiv, info);
+}
+
+} // extern C
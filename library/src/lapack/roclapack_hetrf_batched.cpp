@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_hetrf_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            rocblas_int* ipiv,
+                                            const rocblas_stride strideP,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("hetrf_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--bsp", strideP,
+                        "--batch", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_sytf2_sytrf_argCheck(handle, uplo, n, lda, A, ipiv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size of the workspaces for the panel factorizations and trailing updates
+    size_t size_work;
+    // size of the first non-factorized column of each matrix
+    size_t size_kk;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_sytrf_getMemorySize<true, T>(n, batch_count, &size_work, &size_kk, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_kk, size_workArr);
+
+    // memory workspace allocation
+    void *work, *kk, *workArr;
+    rocblas_device_malloc mem(handle, size_work, size_kk, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    kk = mem[1];
+    workArr = mem[2];
+
+    // execution
+    return rocsolver_sytrf_template<true, T, S>(handle, uplo, true, n, A, shiftA, lda, strideA,
+                                                ipiv, strideP, info, batch_count, (T*)work,
+                                                (rocblas_int*)kk, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_chetrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_hetrf_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda, ipiv,
+                                                               strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_zhetrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_hetrf_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, ipiv,
+                                                                strideP, info, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_hetrs_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    U A,
+                                    const rocblas_int lda,
+                                    const rocblas_int* ipiv,
+                                    U B,
+                                    const rocblas_int ldb)
+{
+    ROCSOLVER_ENTER_TOP("hetrs", "--uplo", uplo, "-m", n, "-n", nrhs, "--lda", lda, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sytrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_sytrs_template<T>(handle, uplo, true, n, nrhs, A, shiftA, lda, strideA, ipiv,
+                                       strideP, B, shiftB, ldb, strideB, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_chetrs(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                const rocblas_int* ipiv,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb)
+{
+    return rocsolver_hetrs_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+rocblas_status rocsolver_zhetrs(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                const rocblas_int* ipiv,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb)
+{
+    return rocsolver_hetrs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, ipiv, B,
+                                                        ldb);
+}
+
+} // extern C
@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_hetrs_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U A,
+                                            const rocblas_int lda,
+                                            const rocblas_int* ipiv,
+                                            const rocblas_stride strideP,
+                                            U B,
+                                            const rocblas_int ldb,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("hetrs_batched", "--uplo", uplo, "-m", n, "-n", nrhs, "--lda", lda, "--bsp",
+                        strideP, "--ldb", ldb, "--batch", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_sytrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_sytrs_template<T>(handle, uplo, true, n, nrhs, A, shiftA, lda, strideA, ipiv,
+                                       strideP, B, shiftB, ldb, strideB, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_chetrs_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_float_complex* const B[],
+                                        const rocblas_int ldb,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_hetrs_batched_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, ipiv,
+                                                               strideP, B, ldb, batch_count);
+}
+
+rocblas_status rocsolver_zhetrs_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_double_complex* const B[],
+                                        const rocblas_int ldb,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_hetrs_batched_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, ipiv,
+                                                                strideP, B, ldb, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_hetrs_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("hetrs_strided_batched", "--uplo", uplo, "-m", n, "-n", nrhs, "--lda", lda,
+                        "--bsa", strideA, "--bsp", strideP, "--ldb", ldb, "--bsb", strideB,
+                        "--batch", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_sytrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_sytrs_template<T>(handle, uplo, true, n, nrhs, A, shiftA, lda, strideA, ipiv,
+                                       strideP, B, shiftB, ldb, strideB, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_chetrs_strided_batched(rocblas_handle handle,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_hetrs_strided_batched_impl<rocblas_float_complex>(
+        handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+rocblas_status rocsolver_zhetrs_strided_batched(rocblas_handle handle,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_hetrs_strided_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+} // extern C
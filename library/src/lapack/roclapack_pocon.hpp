@@ -0,0 +1,103 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "rocsolver.h"
+
+template <typename T>
+void rocsolver_pocon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the iterate x and of its signs in the 1-norm estimation
+    *size_work = sizeof(T) * 2 * n * batch_count;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_pocon_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        T* work)
+{
+    ROCSOLVER_ENTER("pocon", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:",
+                    batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions (the empty matrix is perfectly conditioned)
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, rcond,
+                           batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // every step of the estimation depends on the previous one, so the
+    // estimate for every matrix in the batch is computed by a single group of threads
+    S safmin = get_safemin<S>();
+    hipLaunchKernelGGL(con_kernel<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, con_cholesky,
+                       true, uplo, rocblas_diagonal_non_unit, n, A, shiftA, lda, strideA, anorm,
+                       rcond, work, safmin);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pocon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            const S* anorm,
+                                            S* rcond,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pocon_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--batch",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pocon_argCheck(handle, uplo, n, lda, A, anorm, rcond,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size of the iterate in the estimation of the norm of the inverse
+    size_t size_work;
+    rocsolver_pocon_getMemorySize<T>(n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_pocon_template<T>(handle, uplo, n, A, shiftA, lda, strideA, anorm, rcond,
+                                       batch_count, (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spocon_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        const float* anorm,
+                                        float* rcond,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pocon_batched_impl<float>(handle, uplo, n, A, lda, anorm, rcond, batch_count);
+}
+
+rocblas_status rocsolver_dpocon_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        const double* anorm,
+                                        double* rcond,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pocon_batched_impl<double>(handle, uplo, n, A, lda, anorm, rcond, batch_count);
+}
+
+rocblas_status rocsolver_cpocon_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        const float* anorm,
+                                        float* rcond,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pocon_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda, anorm,
+                                                               rcond, batch_count);
+}
+
+rocblas_status rocsolver_zpocon_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        const double* anorm,
+                                        double* rcond,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pocon_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, anorm,
+                                                                rcond, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,228 @@
+/************************************************************************
+ * Derived from the public domain
+ * LINPACK routine (DCHDD) --
+ *     Argonne National Laboratory
+ *     G.W. Stewart, University of Maryland
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** POTRF_DOWNDATE_KERNEL downdates the Cholesky factorization A = U'*U (or A = L*L')
+    of a n-by-n hermitian positive definite matrix to the factorization of A - X*X',
+    one column of X at a time. For each column x, the triangular system U'*a = x is
+    solved, and the rotations that reduce [a; sqrt(1 - ||a||^2)] to the last unit vector
+    are then applied to [U; 0]. If ||a(1:j)|| >= 1 for some j, the leading minor of
+    order j of the downdated matrix is not positive definite; in that case info is set
+    to j and the remaining columns of X are not processed.
+    (When uplo is lower, the rows of U = L' are the conjugated columns of L).
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) potrf_downdate_kernel(const rocblas_fill uplo,
+                                                                   const rocblas_int n,
+                                                                   const rocblas_int k,
+                                                                   U AA,
+                                                                   const rocblas_int shiftA,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   U XX,
+                                                                   const rocblas_int shiftX,
+                                                                   const rocblas_int ldx,
+                                                                   const rocblas_stride strideX,
+                                                                   rocblas_int* infoA,
+                                                                   T* WW,
+                                                                   const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* X = load_ptr_batch<T>(XX, b, shiftX, strideX);
+    rocblas_int* info = infoA + b;
+
+    // vector a (later overwritten with the sines), and cosines of the rotations
+    T* w = WW + b * strideW;
+    T* cs = w + n;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // norm of a, and positive definiteness flag, shared by all the threads
+    __shared__ S nrm;
+    __shared__ bool failed;
+
+    S rho, alpha, ci;
+    T u, e, temp;
+
+    if(tid == 0)
+        failed = false;
+
+    for(rocblas_int l = 0; l < k; ++l)
+    {
+        // solve U'*a = x (i.e. L*a = x) by forward substitution
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+            w[i] = X[i + l * ldx];
+        if(tid == 0)
+            nrm = 0;
+        __syncthreads();
+
+        for(rocblas_int j = 0; j < n; ++j)
+        {
+            if(tid == 0)
+            {
+                w[j] = w[j] / std::real(A[j + j * lda]);
+                rho = std::abs(w[j]);
+                nrm += rho * rho;
+                if(nrm >= 1)
+                {
+                    // error for non-positive definiteness
+                    failed = true;
+                    *info = j + 1; // use fortran 1-based index
+                }
+            }
+            __syncthreads();
+
+            if(failed)
+                break;
+
+            for(rocblas_int i = j + 1 + tid; i < n; i += BLOCKSIZE)
+                w[i] -= (upper ? sconj(A[j + i * lda]) : A[i + j * lda]) * w[j];
+            __syncthreads();
+        }
+
+        if(failed)
+            break;
+
+        // compute the rotations backwards, starting from alpha = sqrt(1 - ||a||^2)
+        if(tid == 0)
+        {
+            alpha = std::sqrt(1 - nrm);
+            for(rocblas_int i = n - 1; i >= 0; --i)
+            {
+                rho = std::hypot(alpha, std::abs(w[i]));
+                cs[i] = alpha / rho;
+                w[i] = w[i] / rho;
+                alpha = rho;
+            }
+        }
+        __syncthreads();
+
+        // apply the rotations to [U; 0]
+        // (every thread works on its own columns)
+        for(rocblas_int j = tid; j < n; j += BLOCKSIZE)
+        {
+            e = 0;
+            for(rocblas_int i = j; i >= 0; --i)
+            {
+                u = upper ? A[i + j * lda] : sconj(A[j + i * lda]);
+                ci = std::real(cs[i]);
+                temp = ci * u - w[i] * e;
+                e = sconj(w[i]) * u + ci * e;
+                if(upper)
+                    A[i + j * lda] = temp;
+                else
+                    A[j + i * lda] = sconj(temp);
+            }
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T>
+void rocsolver_potrf_downdate_getMemorySize(const rocblas_int n,
+                                            const rocblas_int k,
+                                            const rocblas_int batch_count,
+                                            size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the vector a, and of the cosines of the rotations
+    *size_work = sizeof(T) * 2 * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_downdate_argCheck(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int k,
+                                                 const rocblas_int lda,
+                                                 const rocblas_int ldx,
+                                                 T A,
+                                                 T X,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || k < 0 || lda < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n * k && !X) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_potrf_downdate_template(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int k,
+                                                 U A,
+                                                 const rocblas_int shiftA,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 U X,
+                                                 const rocblas_int shiftX,
+                                                 const rocblas_int ldx,
+                                                 const rocblas_stride strideX,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count,
+                                                 T* work)
+{
+    ROCSOLVER_ENTER("potrf_downdate", "uplo:", uplo, "n:", n, "k:", k, "shiftA:", shiftA,
+                    "lda:", lda, "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 (starting with a positive definite matrix)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0 || k == 0)
+        return rocblas_status_success;
+
+    rocblas_stride strideW = 2 * n;
+    hipLaunchKernelGGL(potrf_downdate_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream,
+                       uplo, n, k, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, info, work,
+                       strideW);
+
+    return rocblas_status_success;
+}
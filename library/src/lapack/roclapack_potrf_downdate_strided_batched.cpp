@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potrf_downdate.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrf_downdate_strided_batched_impl(rocblas_handle handle,
+                                                             const rocblas_fill uplo,
+                                                             const rocblas_int n,
+                                                             const rocblas_int k,
+                                                             U A,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             U X,
+                                                             const rocblas_int ldx,
+                                                             const rocblas_stride strideX,
+                                                             rocblas_int* info,
+                                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("potrf_downdate_strided_batched", "--uplo", uplo, "-n", n, "-k", k, "--lda",
+                        lda, "--ldb", ldx, "--bsa", strideA, "--bsb", strideX, "--batch",
+                        batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potrf_downdate_argCheck(handle, uplo, n, k, lda, ldx, A, X, info,
+                                                          batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftX = 0;
+
+    // memory workspace sizes:
+    // size of re-usable workspace
+    size_t size_work;
+    rocsolver_potrf_downdate_getMemorySize<T>(n, k, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_potrf_downdate_template<T, S>(handle, uplo, n, k, A, shiftA, lda, strideA, X,
+                                                   shiftX, ldx, strideX, info, batch_count,
+                                                   (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         float* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         float* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_downdate_strided_batched_impl<float>(handle, uplo, n, k, A, lda, strideA,
+                                                                X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         double* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         double* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_downdate_strided_batched_impl<double>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         rocblas_float_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_float_complex* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_downdate_strided_batched_impl<rocblas_float_complex>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         rocblas_double_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_double_complex* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_downdate_strided_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+} // extern C
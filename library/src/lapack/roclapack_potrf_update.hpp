@@ -0,0 +1,172 @@
+/************************************************************************
+ * Derived from the public domain
+ * LINPACK routine (DCHUD) --
+ *     Argonne National Laboratory
+ *     G.W. Stewart, University of Maryland
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** POTRF_UPDATE_KERNEL updates the Cholesky factorization A = U'*U (or A = L*L')
+    of a n-by-n hermitian positive definite matrix to the factorization of A + X*X',
+    one column of X at a time. Each rank-1 update x*x' is carried out with a sweep
+    of givens rotations that annihilates the row x' appended at the bottom of U.
+    (When uplo is lower, the rows of U = L' are the conjugated columns of L, and the
+    rotations are applied to the conjugated vectors).
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) potrf_update_kernel(const rocblas_fill uplo,
+                                                                 const rocblas_int n,
+                                                                 const rocblas_int k,
+                                                                 U AA,
+                                                                 const rocblas_int shiftA,
+                                                                 const rocblas_int lda,
+                                                                 const rocblas_stride strideA,
+                                                                 U XX,
+                                                                 const rocblas_int shiftX,
+                                                                 const rocblas_int ldx,
+                                                                 const rocblas_stride strideX,
+                                                                 T* WW,
+                                                                 const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* X = load_ptr_batch<T>(XX, b, shiftX, strideX);
+    T* w = WW + b * strideW;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+    const rocblas_int inca = upper ? lda : 1;
+
+    // rotation shared by all the threads
+    __shared__ S c;
+    __shared__ T s;
+
+    S f, rho;
+    T g;
+
+    for(rocblas_int l = 0; l < k; ++l)
+    {
+        // extra row x' (stored conjugated when uplo is lower)
+        for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+            w[i] = upper ? sconj(X[i + l * ldx]) : X[i + l * ldx];
+        __syncthreads();
+
+        for(rocblas_int j = 0; j < n; ++j)
+        {
+            // rotation that annihilates the j-th element of the extra row
+            // (keeping the diagonal element of U real and positive)
+            if(tid == 0)
+            {
+                f = std::real(A[j + j * lda]);
+                g = upper ? w[j] : sconj(w[j]);
+                rho = std::hypot(f, std::abs(g));
+                if(rho == 0)
+                {
+                    c = 1;
+                    s = 0;
+                }
+                else
+                {
+                    c = f / rho;
+                    s = -sconj(g) / rho;
+                    A[j + j * lda] = rho;
+                }
+                if(!upper)
+                    s = sconj(s);
+            }
+            __syncthreads();
+
+            rot(n - j - 1, A + j + j * lda + inca, inca, w + j + 1, 1, c, s);
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T>
+void rocsolver_potrf_update_getMemorySize(const rocblas_int n,
+                                          const rocblas_int k,
+                                          const rocblas_int batch_count,
+                                          size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the extra row
+    *size_work = sizeof(T) * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_update_argCheck(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int k,
+                                               const rocblas_int lda,
+                                               const rocblas_int ldx,
+                                               T A,
+                                               T X,
+                                               const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || k < 0 || lda < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n * k && !X))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_potrf_update_template(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int k,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               U X,
+                                               const rocblas_int shiftX,
+                                               const rocblas_int ldx,
+                                               const rocblas_stride strideX,
+                                               const rocblas_int batch_count,
+                                               T* work)
+{
+    ROCSOLVER_ENTER("potrf_update", "uplo:", uplo, "n:", n, "k:", k, "shiftA:", shiftA,
+                    "lda:", lda, "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || k == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_stride strideW = n;
+    hipLaunchKernelGGL(potrf_update_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream,
+                       uplo, n, k, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, work, strideW);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,222 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lauum.hpp"
+#include "rocblas.hpp"
+#include "roclapack_trtri.hpp"
+#include "rocsolver.h"
+
+/** POTRI_KERNEL_SMALL computes the inverse of an n-by-n symmetric/hermitian
+    positive definite matrix (n <= DIM) from its Cholesky factor, using
+    register arrays. Instances with info != 0 are not modified.
+    Call this kernel with DIM threads per group. **/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(WAVESIZE) potri_kernel_small(const rocblas_fill uplo,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               rocblas_int* info)
+{
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+
+    // singular instances are left unchanged
+    if(info[b] != 0)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // shared memory (for communication between threads in group)
+    __shared__ T common[DIM];
+    __shared__ T diag[DIM];
+
+    // read corresponding row (upper) or column (lower) from global memory
+    T rA[DIM];
+    tri_load_regs<DIM>(upper, i, n, A, lda, rA);
+
+    //--- TRTRI ---
+    trti2_regs<DIM>(false, i, rA, common, diag);
+
+    //--- LAUUM ---
+    // (the lower triangular case works with the conjugate transpose)
+    if(!upper)
+    {
+#pragma unroll
+        for(rocblas_int j = 0; j < DIM; j++)
+            rA[j] = sconj(rA[j]);
+    }
+
+    lauu2_regs<DIM>(i, rA, common);
+
+    // write results to global memory from local array
+    if(!upper)
+    {
+#pragma unroll
+        for(rocblas_int j = 0; j < DIM; j++)
+            rA[j] = sconj(rA[j]);
+    }
+    tri_store_regs<DIM>(upper, false, i, n, A, lda, rA);
+}
+
+template <typename T, typename U>
+void potri_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* info,
+                     const rocblas_int batch_count)
+{
+#define RUN_POTRI_SMALL(DIM)                                                                     \
+    hipLaunchKernelGGL((potri_kernel_small<DIM, T>), grid, block, 0, stream, uplo, n, A, shiftA, \
+                       lda, strideA, info)
+
+    rocblas_int dim = tri_small_dim(n);
+    dim3 grid(batch_count, 1, 1);
+    dim3 block(dim, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size of the register arrays known at
+    // compile time
+    switch(dim)
+    {
+    case 8: RUN_POTRI_SMALL(8); break;
+    case 16: RUN_POTRI_SMALL(16); break;
+    case 32: RUN_POTRI_SMALL(32); break;
+    case 64: RUN_POTRI_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+template <typename T>
+void rocsolver_potri_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_tmpcopy)
+{
+    // if quick return, or if small size, no need of workspace
+    if(n == 0 || batch_count == 0 || n <= POTRI_SWITCHSIZE)
+    {
+        *size_tmpcopy = 0;
+        return;
+    }
+
+    // size of temporary array required to restore singular matrices
+    *size_tmpcopy = sizeof(T) * n * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_potri_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename S, typename T, typename U>
+rocblas_status rocsolver_potri_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* tmpcopy)
+{
+    ROCSOLVER_ENTER("potri", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, info,
+                           batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // check for singularities
+    rocblas_int threads = min(((n - 1) / 64 + 1) * 64, BLOCKSIZE);
+    hipLaunchKernelGGL(check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0,
+                       stream, n, A, shiftA, lda, strideA, info);
+
+    // if the matrix is small, compute the inverse with a single kernel
+    if(n <= POTRI_SWITCHSIZE)
+    {
+        potri_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+        return rocblas_status_success;
+    }
+
+    rocblas_int blocks = (n - 1) / 32 + 1;
+    rocblas_int ldw = n;
+    rocblas_stride strideW = n * n;
+
+    // keep a copy of the matrix to restore the singular instances
+    hipLaunchKernelGGL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream, n,
+                       n, A, shiftA, lda, strideA, tmpcopy, 0, ldw, strideW, uplo);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // compute inv(U) or inv(L)
+    trtri_blocked<BATCHED, STRIDED, T>(handle, uplo, rocblas_diagonal_non_unit, n, A, shiftA, lda,
+                                       strideA, info, batch_count);
+
+    // compute inv(U) * inv(U)' or inv(L)' * inv(L)
+    rocsolver_lauum_template<BATCHED, STRIDED, S, T>(handle, uplo, n, A, shiftA, lda, strideA,
+                                                     batch_count);
+
+    hipLaunchKernelGGL(trtri_restore<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
+                       uplo, n, A, shiftA, lda, strideA, tmpcopy, ldw, strideW, info);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
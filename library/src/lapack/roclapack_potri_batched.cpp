@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potri.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_potri_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("potri_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--batch",
+                        batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potri_argCheck(handle, uplo, n, lda, A, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size of temporary array required to restore singular matrices
+    size_t size_tmpcopy;
+    rocsolver_potri_getMemorySize<T>(n, batch_count, &size_tmpcopy);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_tmpcopy);
+
+    // memory workspace allocation
+    void* tmpcopy;
+    rocblas_device_malloc mem(handle, size_tmpcopy);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    tmpcopy = mem[0];
+
+    // execution
+    return rocsolver_potri_template<true, false, S, T>(handle, uplo, n, A, shiftA, lda, strideA,
+                                                       info, batch_count, (T*)tmpcopy);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotri_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_potri_batched_impl<float>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+rocblas_status rocsolver_dpotri_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_potri_batched_impl<double>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+rocblas_status rocsolver_cpotri_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_potri_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda, info,
+                                                               batch_count);
+}
+
+rocblas_status rocsolver_zpotri_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_potri_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info,
+                                                                batch_count);
+}
+
+} // extern C
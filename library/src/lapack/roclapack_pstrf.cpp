@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pstrf.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pstrf_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* piv,
+                                    rocblas_int* rank,
+                                    const S tol,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("pstrf", "--uplo", uplo, "-n", n, "--lda", lda, "--tol", tol);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pstrf_argCheck(handle, uplo, n, lda, A, piv, rank, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of re-usable workspace
+    size_t size_work;
+    rocsolver_pstrf_getMemorySize<T, S>(n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_pstrf_template<T>(handle, uplo, n, A, shiftA, lda, strideA, piv, strideP, rank,
+                                       tol, info, batch_count, (S*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const float tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<float>(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+rocblas_status rocsolver_dpstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const double tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<double>(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+rocblas_status rocsolver_cpstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const float tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<rocblas_float_complex>(handle, uplo, n, A, lda, piv, rank, tol,
+                                                       info);
+}
+
+rocblas_status rocsolver_zpstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const double tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<rocblas_double_complex>(handle, uplo, n, A, lda, piv, rank, tol,
+                                                        info);
+}
+
+} // extern C
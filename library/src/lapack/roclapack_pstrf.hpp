@@ -0,0 +1,362 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** PSTF2_KERNEL computes steps j0 to j0 + jb - 1 of the Cholesky factorization with
+    complete pivoting P'*A*P = U'*U (or P'*A*P = L*L') of a n-by-n hermitian positive
+    semidefinite matrix (as LAPACK's DPSTF2 on a panel of DPSTRF).
+    The trailing matrix A(j0:n, j0:n) must have been updated with the rows 0 to j0 - 1 of U.
+    At step j, the pivot is chosen from the diagonal of the (implicitly updated) trailing
+    matrix, and row j of U is computed from the rows j0 to j - 1 of the panel. The update
+    of the trailing matrix with the jb rows of the panel is left to the caller.
+    When j0 = 0 and jb = n, this is the whole (left-looking) unblocked factorization.
+    The process stops when the largest diagonal element of the trailing matrix is not larger
+    than stop; the rank is then the number of steps completed, and info is set to 1 (later
+    calls on the same matrix then return immediately).
+    (When uplo is lower, the rows of U = L' are the conjugated columns of L).
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) pstf2_kernel(const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int j0,
+                                                          const rocblas_int jb,
+                                                          U AA,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* pivA,
+                                                          const rocblas_stride strideP,
+                                                          rocblas_int* rankA,
+                                                          const S tol,
+                                                          const S eps,
+                                                          rocblas_int* infoA,
+                                                          S* WW,
+                                                          const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    // the factorization of this matrix already stopped in a previous panel
+    if(infoA[b] != 0)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* piv = pivA + b * strideP;
+    S* w = WW + b * strideW;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // element (k,l) of U is A[k * incr + l * incc]
+    const rocblas_int incr = upper ? 1 : lda;
+    const rocblas_int incc = upper ? lda : 1;
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    S val, stop, ajj;
+    rocblas_int idx, p;
+    T temp;
+
+    // reset the squared norms of the columns of the panel rows of U
+    for(rocblas_int l = j0 + tid; l < n; l += BLOCKSIZE)
+        w[l] = 0;
+
+    if(j0 == 0)
+    {
+        // initialize the permutation, and find the largest diagonal element
+        val = -1;
+        for(rocblas_int l = tid; l < n; l += BLOCKSIZE)
+        {
+            piv[l] = l + 1;
+            if(std::real(A[l + l * lda]) > val)
+                val = std::real(A[l + l * lda]);
+        }
+        sval[tid] = val;
+        __syncthreads();
+
+        for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+        {
+            if(tid < s && sval[tid + s] > sval[tid])
+                sval[tid] = sval[tid + s];
+            __syncthreads();
+        }
+
+        // stopping criterion (non-positive pivots always stop the factorization),
+        // kept after the squared norms for the next panels
+        stop = (tol < 0) ? n * eps * sval[0] : tol;
+        stop = stop > 0 ? stop : 0;
+        if(tid == 0)
+            w[n] = stop;
+    }
+    else
+        stop = w[n];
+    __syncthreads();
+
+    for(rocblas_int j = j0; j < j0 + jb; ++j)
+    {
+        // find the pivot: the largest diagonal element of the trailing matrix
+        // (ties are resolved in favor of the smallest index)
+        val = -1;
+        idx = j;
+        for(rocblas_int l = j + tid; l < n; l += BLOCKSIZE)
+        {
+            ajj = std::real(A[l + l * lda]) - w[l];
+            if(ajj > val)
+            {
+                val = ajj;
+                idx = l;
+            }
+        }
+        sval[tid] = val;
+        sidx[tid] = idx;
+        __syncthreads();
+
+        for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+            {
+                if(sval[tid + s] > sval[tid]
+                   || (sval[tid + s] == sval[tid] && sidx[tid + s] < sidx[tid]))
+                {
+                    sval[tid] = sval[tid + s];
+                    sidx[tid] = sidx[tid + s];
+                }
+            }
+            __syncthreads();
+        }
+        ajj = sval[0];
+        p = sidx[0];
+        __syncthreads();
+
+        // the trailing matrix is numerically zero (or not positive semidefinite)
+        if(!(ajj > stop))
+        {
+            if(tid == 0)
+            {
+                A[j + j * lda] = ajj;
+                rankA[b] = j;
+                infoA[b] = 1;
+            }
+            return;
+        }
+
+        // symmetric interchange of rows and columns j and p
+        if(p != j)
+        {
+            for(rocblas_int k = tid; k < j; k += BLOCKSIZE)
+            {
+                temp = A[k * incr + j * incc];
+                A[k * incr + j * incc] = A[k * incr + p * incc];
+                A[k * incr + p * incc] = temp;
+            }
+            for(rocblas_int l = p + 1 + tid; l < n; l += BLOCKSIZE)
+            {
+                temp = A[j * incr + l * incc];
+                A[j * incr + l * incc] = A[p * incr + l * incc];
+                A[p * incr + l * incc] = temp;
+            }
+            for(rocblas_int i = j + 1 + tid; i < p; i += BLOCKSIZE)
+            {
+                temp = sconj(A[j * incr + i * incc]);
+                A[j * incr + i * incc] = sconj(A[i * incr + p * incc]);
+                A[i * incr + p * incc] = temp;
+            }
+            if(tid == 0)
+            {
+                A[j * incr + p * incc] = sconj(A[j * incr + p * incc]);
+                A[p + p * lda] = A[j + j * lda];
+
+                val = w[j];
+                w[j] = w[p];
+                w[p] = val;
+
+                idx = piv[j];
+                piv[j] = piv[p];
+                piv[p] = idx;
+            }
+            __syncthreads();
+        }
+
+        ajj = sqrt(ajj);
+        if(tid == 0)
+            A[j + j * lda] = ajj;
+
+        // compute row j of U, and update the squared norms of the trailing columns
+        // (every thread works on its own columns)
+        for(rocblas_int l = j + 1 + tid; l < n; l += BLOCKSIZE)
+        {
+            temp = upper ? A[j + l * lda] : sconj(A[l + j * lda]);
+            for(rocblas_int k = j0; k < j; ++k)
+            {
+                if(upper)
+                    temp -= sconj(A[k + j * lda]) * A[k + l * lda];
+                else
+                    temp -= A[j + k * lda] * sconj(A[l + k * lda]);
+            }
+            temp = temp / ajj;
+
+            if(upper)
+                A[j + l * lda] = temp;
+            else
+                A[l + j * lda] = sconj(temp);
+
+            val = std::abs(temp);
+            w[l] += val * val;
+        }
+        __syncthreads();
+    }
+
+    // full rank
+    if(tid == 0 && j0 + jb == n)
+        rankA[b] = n;
+}
+
+template <typename T, typename S>
+void rocsolver_pstrf_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the squared norms of the columns of U, and of the stopping criterion
+    *size_work = sizeof(S) * (n + 1) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_pstrf_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* piv,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !piv) || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pstrf_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* piv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        const S tol,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        S* work)
+{
+    ROCSOLVER_ENTER("pstrf", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda, "tol:", tol,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 and rank=0 (the kernel sets the computed rank)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // the choice of every pivot depends on all the previous steps, so every panel
+    // of a matrix in the batch is factorized by a single group of threads
+    S eps = get_epsilon<S>();
+    rocblas_stride strideW = n + 1;
+
+    // if the matrix is small, use the unblocked variant of the algorithm
+    if(n < PSTRF_PSTF2_SWITCHSIZE)
+    {
+        hipLaunchKernelGGL(pstf2_kernel<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, uplo,
+                           n, 0, n, A, shiftA, lda, strideA, piv, strideP, rank, tol, eps, info,
+                           work, strideW);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    S s_one = 1;
+    S s_minone = -1;
+
+    rocblas_int jb;
+    for(rocblas_int j = 0; j < n; j += PSTRF_BLOCKSIZE)
+    {
+        // factorize the panel (choosing the pivots among all the trailing columns)
+        jb = min(n - j, PSTRF_BLOCKSIZE);
+        hipLaunchKernelGGL(pstf2_kernel<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, uplo,
+                           n, j, jb, A, shiftA, lda, strideA, piv, strideP, rank, tol, eps, info,
+                           work, strideW);
+
+        // update the trailing matrix
+        // (if the factorization of a matrix in the batch stopped, its trailing matrix
+        //  is not referenced anymore)
+        if(j + jb < n)
+        {
+            if(uplo == rocblas_fill_upper)
+                rocblasCall_syrk_herk<S, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, n - j - jb, jb, &s_minone,
+                    A, shiftA + idx2D(j, j + jb, lda), lda, strideA, &s_one, A,
+                    shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+            else
+                rocblasCall_syrk_herk<S, T>(handle, uplo, rocblas_operation_none, n - j - jb, jb,
+                                            &s_minone, A, shiftA + idx2D(j + jb, j, lda), lda,
+                                            strideA, &s_one, A, shiftA + idx2D(j + jb, j + jb, lda),
+                                            lda, strideA, batch_count);
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
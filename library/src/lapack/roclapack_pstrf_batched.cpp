@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pstrf.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pstrf_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            rocblas_int* piv,
+                                            const rocblas_stride strideP,
+                                            rocblas_int* rank,
+                                            const S tol,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pstrf_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--bsp", strideP,
+                        "--tol", tol, "--batch", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pstrf_argCheck(handle, uplo, n, lda, A, piv, rank, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size of re-usable workspace
+    size_t size_work;
+    rocsolver_pstrf_getMemorySize<T, S>(n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_pstrf_template<T>(handle, uplo, n, A, shiftA, lda, strideA, piv, strideP, rank,
+                                       tol, info, batch_count, (S*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spstrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* piv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        const float tol,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pstrf_batched_impl<float>(handle, uplo, n, A, lda, piv, strideP, rank, tol,
+                                               info, batch_count);
+}
+
+rocblas_status rocsolver_dpstrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* piv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        const double tol,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pstrf_batched_impl<double>(handle, uplo, n, A, lda, piv, strideP, rank, tol,
+                                                info, batch_count);
+}
+
+rocblas_status rocsolver_cpstrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* piv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        const float tol,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pstrf_batched_impl<rocblas_float_complex>(
+        handle, uplo, n, A, lda, piv, strideP, rank, tol, info, batch_count);
+}
+
+rocblas_status rocsolver_zpstrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* piv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        const double tol,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pstrf_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, A, lda, piv, strideP, rank, tol, info, batch_count);
+}
+
+} // extern C
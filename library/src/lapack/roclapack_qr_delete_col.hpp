@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** QR_DELETE_COL_KERNEL updates the full QR factorization Q*R of a m-by-n
+    matrix A to the factorization of the m-by-(n-1) matrix obtained by deleting
+    the j-th column of A. Once the column is removed, R is upper Hessenberg from
+    column j on, and its triangular form is restored with a sweep of givens
+    rotations. Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) qr_delete_col_kernel(const rocblas_int m,
+                                                                  const rocblas_int n,
+                                                                  const rocblas_int j,
+                                                                  U QQ,
+                                                                  const rocblas_int shiftQ,
+                                                                  const rocblas_int ldq,
+                                                                  const rocblas_stride strideQ,
+                                                                  U RR,
+                                                                  const rocblas_int shiftR,
+                                                                  const rocblas_int ldr,
+                                                                  const rocblas_stride strideR)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* Q = load_ptr_batch<T>(QQ, b, shiftQ, strideQ);
+    T* R = load_ptr_batch<T>(RR, b, shiftR, strideR);
+
+    // rotation shared by all the threads
+    __shared__ S c;
+    __shared__ T s;
+
+    S cc;
+    T ss, f, g, r;
+
+    // move columns j:n-1 of R one position to the left
+    // (every thread works on the same rows of all the columns)
+    for(rocblas_int col = j - 1; col < n - 1; ++col)
+    {
+        for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+            R[i + col * ldr] = R[i + (col + 1) * ldr];
+    }
+    __syncthreads();
+
+    // restore the triangular form of R
+    for(rocblas_int i = j - 1; i < min(m - 1, n - 1); ++i)
+    {
+        if(tid == 0)
+        {
+            f = R[i + i * ldr];
+            g = R[(i + 1) + i * ldr];
+            lartg(f, g, cc, ss, r);
+            R[i + i * ldr] = r;
+            R[(i + 1) + i * ldr] = 0;
+            c = cc;
+            s = ss;
+        }
+        __syncthreads();
+
+        rot(n - i - 2, R + i + (i + 1) * ldr, ldr, R + (i + 1) + (i + 1) * ldr, ldr, c, s);
+        rot(m, Q + i * ldq, 1, Q + (i + 1) * ldq, 1, c, sconj(s));
+        __syncthreads();
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_qr_delete_col_argCheck(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int j,
+                                                const rocblas_int ldq,
+                                                const rocblas_int ldr,
+                                                T Q,
+                                                T R,
+                                                const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 1 || j < 1 || j > n || ldq < m || ldr < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && !Q) || (m && !R))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_qr_delete_col_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int j,
+                                                U Q,
+                                                const rocblas_int shiftQ,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                U R,
+                                                const rocblas_int shiftR,
+                                                const rocblas_int ldr,
+                                                const rocblas_stride strideR,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qr_delete_col", "m:", m, "n:", n, "j:", j, "shiftQ:", shiftQ, "ldq:", ldq,
+                    "shiftR:", shiftR, "ldr:", ldr, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    hipLaunchKernelGGL(qr_delete_col_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream,
+                       m, n, j, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR);
+
+    return rocblas_status_success;
+}
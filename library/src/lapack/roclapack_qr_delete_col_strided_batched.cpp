@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_delete_col.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_delete_col_strided_batched_impl(rocblas_handle handle,
+                                                            const rocblas_int m,
+                                                            const rocblas_int n,
+                                                            const rocblas_int j,
+                                                            U Q,
+                                                            const rocblas_int ldq,
+                                                            const rocblas_stride strideQ,
+                                                            U R,
+                                                            const rocblas_int ldr,
+                                                            const rocblas_stride strideR,
+                                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("qr_delete_col_strided_batched", "-m", m, "-n", n, "--k1", j, "--lda", ldq,
+                        "--ldb", ldr, "--bsa", strideQ, "--bsb", strideR, "--batch", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_delete_col_argCheck(handle, m, n, j, ldq, ldr, Q, R,
+                                                         batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_qr_delete_col_template<T, S>(handle, m, n, j, Q, shiftQ, ldq, strideQ, R,
+                                                  shiftR, ldr, strideR, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_delete_col_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int j,
+                                                        float* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        float* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_delete_col_strided_batched_impl<float>(handle, m, n, j, Q, ldq, strideQ, R,
+                                                               ldr, strideR, batch_count);
+}
+
+rocblas_status rocsolver_dqr_delete_col_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int j,
+                                                        double* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        double* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_delete_col_strided_batched_impl<double>(handle, m, n, j, Q, ldq, strideQ, R,
+                                                                ldr, strideR, batch_count);
+}
+
+rocblas_status rocsolver_cqr_delete_col_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int j,
+                                                        rocblas_float_complex* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        rocblas_float_complex* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_delete_col_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, j, Q, ldq, strideQ, R, ldr, strideR, batch_count);
+}
+
+rocblas_status rocsolver_zqr_delete_col_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int j,
+                                                        rocblas_double_complex* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        rocblas_double_complex* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_delete_col_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, j, Q, ldq, strideQ, R, ldr, strideR, batch_count);
+}
+
+} // extern C
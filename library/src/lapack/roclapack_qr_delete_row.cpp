@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_delete_row.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_delete_row_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int i,
+                                            U Q,
+                                            const rocblas_int ldq,
+                                            U R,
+                                            const rocblas_int ldr)
+{
+    ROCSOLVER_ENTER_TOP("qr_delete_row", "-m", m, "-n", n, "--k1", i, "--lda", ldq, "--ldb", ldr);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_delete_row_argCheck(handle, m, n, i, ldq, ldr, Q, R);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideQ = 0;
+    rocblas_stride strideR = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_qr_delete_row_template<T, S>(handle, m, n, i, Q, shiftQ, ldq, strideQ, R,
+                                                  shiftR, ldr, strideR, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_delete_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        float* Q,
+                                        const rocblas_int ldq,
+                                        float* R,
+                                        const rocblas_int ldr)
+{
+    return rocsolver_qr_delete_row_impl<float>(handle, m, n, i, Q, ldq, R, ldr);
+}
+
+rocblas_status rocsolver_dqr_delete_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        double* Q,
+                                        const rocblas_int ldq,
+                                        double* R,
+                                        const rocblas_int ldr)
+{
+    return rocsolver_qr_delete_row_impl<double>(handle, m, n, i, Q, ldq, R, ldr);
+}
+
+rocblas_status rocsolver_cqr_delete_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        rocblas_float_complex* Q,
+                                        const rocblas_int ldq,
+                                        rocblas_float_complex* R,
+                                        const rocblas_int ldr)
+{
+    return rocsolver_qr_delete_row_impl<rocblas_float_complex>(handle, m, n, i, Q, ldq, R, ldr);
+}
+
+rocblas_status rocsolver_zqr_delete_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        rocblas_double_complex* Q,
+                                        const rocblas_int ldq,
+                                        rocblas_double_complex* R,
+                                        const rocblas_int ldr)
+{
+    return rocsolver_qr_delete_row_impl<rocblas_double_complex>(handle, m, n, i, Q, ldq, R, ldr);
+}
+
+} // extern C
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** QR_DELETE_ROW_KERNEL updates the full QR factorization Q*R of a m-by-n
+    matrix A to the factorization of the (m-1)-by-n matrix obtained by deleting
+    the i-th row of A. Once the i-th row of Q is moved to the top, it is reduced
+    to a multiple of e_1 with a sweep of givens rotations (turning R into an upper
+    Hessenberg matrix). The first row and column of Q, and the first row of R, can
+    then be dropped. Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) qr_delete_row_kernel(const rocblas_int m,
+                                                                  const rocblas_int n,
+                                                                  const rocblas_int i,
+                                                                  U QQ,
+                                                                  const rocblas_int shiftQ,
+                                                                  const rocblas_int ldq,
+                                                                  const rocblas_stride strideQ,
+                                                                  U RR,
+                                                                  const rocblas_int shiftR,
+                                                                  const rocblas_int ldr,
+                                                                  const rocblas_stride strideR)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* Q = load_ptr_batch<T>(QQ, b, shiftQ, strideQ);
+    T* R = load_ptr_batch<T>(RR, b, shiftR, strideR);
+
+    // rotation shared by all the threads
+    __shared__ S c;
+    __shared__ T s;
+
+    S cc;
+    T ss, f, g, r, temp;
+
+    // move the i-th row of Q to the top
+    // (every thread works on its own columns)
+    for(rocblas_int col = tid; col < m; col += BLOCKSIZE)
+    {
+        temp = Q[(i - 1) + col * ldq];
+        for(rocblas_int p = i - 1; p > 0; --p)
+            Q[p + col * ldq] = Q[(p - 1) + col * ldq];
+        Q[col * ldq] = temp;
+    }
+    __syncthreads();
+
+    // reduce the first row of Q to a multiple of e_1 (R becomes upper Hessenberg)
+    for(rocblas_int p = m - 2; p >= 0; --p)
+    {
+        if(tid == 0)
+        {
+            f = sconj(Q[p * ldq]);
+            g = sconj(Q[(p + 1) * ldq]);
+            lartg(f, g, cc, ss, r);
+            Q[p * ldq] = sconj(r);
+            Q[(p + 1) * ldq] = 0;
+            c = cc;
+            s = ss;
+        }
+        __syncthreads();
+
+        if(p < n)
+            rot(n - p, R + p + p * ldr, ldr, R + (p + 1) + p * ldr, ldr, c, s);
+        rot(m - 1, Q + 1 + p * ldq, 1, Q + 1 + (p + 1) * ldq, 1, c, sconj(s));
+        __syncthreads();
+    }
+
+    // drop the first row and column of Q
+    for(rocblas_int col = 0; col < m - 1; ++col)
+    {
+        for(rocblas_int p = tid; p < m - 1; p += BLOCKSIZE)
+            Q[p + col * ldq] = Q[(p + 1) + (col + 1) * ldq];
+        __syncthreads();
+    }
+
+    // drop the first row of R
+    // (every thread works on its own columns)
+    for(rocblas_int col = tid; col < n; col += BLOCKSIZE)
+    {
+        for(rocblas_int p = 0; p < m - 1; ++p)
+            R[p + col * ldr] = R[(p + 1) + col * ldr];
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_qr_delete_row_argCheck(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                const rocblas_int ldq,
+                                                const rocblas_int ldr,
+                                                T Q,
+                                                T R,
+                                                const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 1 || n < 0 || i < 1 || i > m || ldq < m || ldr < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!Q || (n && !R))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_qr_delete_row_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                U Q,
+                                                const rocblas_int shiftQ,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                U R,
+                                                const rocblas_int shiftR,
+                                                const rocblas_int ldr,
+                                                const rocblas_stride strideR,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qr_delete_row", "m:", m, "n:", n, "i:", i, "shiftQ:", shiftQ, "ldq:", ldq,
+                    "shiftR:", shiftR, "ldr:", ldr, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    hipLaunchKernelGGL(qr_delete_row_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream,
+                       m, n, i, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** QR_INSERT_COL_KERNEL updates the full QR factorization Q*R of a m-by-n
+    matrix A to the factorization of the m-by-(n+1) matrix obtained by inserting
+    the vector x before the j-th column of A. The new column w = Q'*x of R is
+    reduced with a sweep of givens rotations from the bottom.
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) qr_insert_col_kernel(const rocblas_int m,
+                                                                  const rocblas_int n,
+                                                                  const rocblas_int j,
+                                                                  U QQ,
+                                                                  const rocblas_int shiftQ,
+                                                                  const rocblas_int ldq,
+                                                                  const rocblas_stride strideQ,
+                                                                  U RR,
+                                                                  const rocblas_int shiftR,
+                                                                  const rocblas_int ldr,
+                                                                  const rocblas_stride strideR,
+                                                                  U xx,
+                                                                  const rocblas_int shiftx,
+                                                                  const rocblas_int incx,
+                                                                  const rocblas_stride stridex)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* Q = load_ptr_batch<T>(QQ, b, shiftQ, strideQ);
+    T* R = load_ptr_batch<T>(RR, b, shiftR, strideR);
+    T* x = load_ptr_batch<T>(xx, b, shiftx, stridex);
+
+    // rotation shared by all the threads
+    __shared__ S c;
+    __shared__ T s;
+
+    S cc;
+    T ss, f, g, r, temp;
+
+    // move columns j-1:n-1 of R one position to the right
+    // (every thread works on the same rows of all the columns)
+    for(rocblas_int col = n - 1; col >= j - 1; --col)
+    {
+        for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+            R[i + (col + 1) * ldr] = R[i + col * ldr];
+    }
+
+    // the new column of R is w = Q' * x
+    for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+    {
+        temp = 0;
+        for(rocblas_int p = 0; p < m; ++p)
+            temp += sconj(Q[p + i * ldq]) * x[p * incx];
+        R[i + (j - 1) * ldr] = temp;
+    }
+    __syncthreads();
+
+    // zero the new column below the diagonal
+    for(rocblas_int i = m - 1; i > j - 1; --i)
+    {
+        if(tid == 0)
+        {
+            f = R[(i - 1) + (j - 1) * ldr];
+            g = R[i + (j - 1) * ldr];
+            lartg(f, g, cc, ss, r);
+            R[(i - 1) + (j - 1) * ldr] = r;
+            R[i + (j - 1) * ldr] = 0;
+            c = cc;
+            s = ss;
+        }
+        __syncthreads();
+
+        if(i < n + 1)
+            rot(n + 1 - i, R + (i - 1) + i * ldr, ldr, R + i + i * ldr, ldr, c, s);
+        rot(m, Q + (i - 1) * ldq, 1, Q + i * ldq, 1, c, sconj(s));
+        __syncthreads();
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_insert_col_argCheck(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int j,
+                                                const rocblas_int ldq,
+                                                const rocblas_int ldr,
+                                                const rocblas_int incx,
+                                                T Q,
+                                                T R,
+                                                U x,
+                                                const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || j < 1 || j > n + 1 || ldq < m || ldr < m || incx < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && !Q) || (m && !R) || (m && !x))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_qr_insert_col_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int j,
+                                                U Q,
+                                                const rocblas_int shiftQ,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                U R,
+                                                const rocblas_int shiftR,
+                                                const rocblas_int ldr,
+                                                const rocblas_stride strideR,
+                                                U x,
+                                                const rocblas_int shiftx,
+                                                const rocblas_int incx,
+                                                const rocblas_stride stridex,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qr_insert_col", "m:", m, "n:", n, "j:", j, "shiftQ:", shiftQ, "ldq:", ldq,
+                    "shiftR:", shiftR, "ldr:", ldr, "shiftx:", shiftx, "incx:", incx,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    hipLaunchKernelGGL(qr_insert_col_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream,
+                       m, n, j, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, x, shiftx, incx,
+                       stridex);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_insert_row.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_insert_row_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int i,
+                                            U Q,
+                                            const rocblas_int ldq,
+                                            U R,
+                                            const rocblas_int ldr,
+                                            U x,
+                                            const rocblas_int incx)
+{
+    ROCSOLVER_ENTER_TOP("qr_insert_row", "-m", m, "-n", n, "--k1", i, "--lda", ldq, "--ldb", ldr,
+                        "--incx", incx);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_insert_row_argCheck(handle, m, n, i, ldq, ldr, incx, Q, R, x);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+    rocblas_int shiftx = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideQ = 0;
+    rocblas_stride strideR = 0;
+    rocblas_stride stridex = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_qr_insert_row_template<T, S>(handle, m, n, i, Q, shiftQ, ldq, strideQ, R,
+                                                  shiftR, ldr, strideR, x, shiftx, incx, stridex,
+                                                  batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_insert_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        float* Q,
+                                        const rocblas_int ldq,
+                                        float* R,
+                                        const rocblas_int ldr,
+                                        float* x,
+                                        const rocblas_int incx)
+{
+    return rocsolver_qr_insert_row_impl<float>(handle, m, n, i, Q, ldq, R, ldr, x, incx);
+}
+
+rocblas_status rocsolver_dqr_insert_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        double* Q,
+                                        const rocblas_int ldq,
+                                        double* R,
+                                        const rocblas_int ldr,
+                                        double* x,
+                                        const rocblas_int incx)
+{
+    return rocsolver_qr_insert_row_impl<double>(handle, m, n, i, Q, ldq, R, ldr, x, incx);
+}
+
+rocblas_status rocsolver_cqr_insert_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        rocblas_float_complex* Q,
+                                        const rocblas_int ldq,
+                                        rocblas_float_complex* R,
+                                        const rocblas_int ldr,
+                                        rocblas_float_complex* x,
+                                        const rocblas_int incx)
+{
+    return rocsolver_qr_insert_row_impl<rocblas_float_complex>(handle, m, n, i, Q, ldq, R, ldr, x,
+                                                               incx);
+}
+
+rocblas_status rocsolver_zqr_insert_row(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int i,
+                                        rocblas_double_complex* Q,
+                                        const rocblas_int ldq,
+                                        rocblas_double_complex* R,
+                                        const rocblas_int ldr,
+                                        rocblas_double_complex* x,
+                                        const rocblas_int incx)
+{
+    return rocsolver_qr_insert_row_impl<rocblas_double_complex>(handle, m, n, i, Q, ldq, R, ldr, x,
+                                                                incx);
+}
+
+} // extern C
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** QR_INSERT_ROW_KERNEL updates the full QR factorization Q*R of a m-by-n
+    matrix A to the factorization of the (m+1)-by-n matrix obtained by inserting
+    the row x' before the i-th row of A. The row is first placed on top of R,
+    which results in an upper Hessenberg matrix that is reduced with a sweep of
+    givens rotations. Call this kernel with batch_count groups in x, and
+    BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) qr_insert_row_kernel(const rocblas_int m,
+                                                                  const rocblas_int n,
+                                                                  const rocblas_int i,
+                                                                  U QQ,
+                                                                  const rocblas_int shiftQ,
+                                                                  const rocblas_int ldq,
+                                                                  const rocblas_stride strideQ,
+                                                                  U RR,
+                                                                  const rocblas_int shiftR,
+                                                                  const rocblas_int ldr,
+                                                                  const rocblas_stride strideR,
+                                                                  U xx,
+                                                                  const rocblas_int shiftx,
+                                                                  const rocblas_int incx,
+                                                                  const rocblas_stride stridex)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* Q = load_ptr_batch<T>(QQ, b, shiftQ, strideQ);
+    T* R = load_ptr_batch<T>(RR, b, shiftR, strideR);
+    T* x = load_ptr_batch<T>(xx, b, shiftx, stridex);
+
+    // rotation shared by all the threads
+    __shared__ S c;
+    __shared__ T s;
+
+    S cc;
+    T ss, f, g, r, temp;
+
+    // Q = [1 0; 0 Q]
+    for(rocblas_int col = m - 1; col >= 0; --col)
+    {
+        for(rocblas_int p = tid; p < m; p += BLOCKSIZE)
+            Q[(p + 1) + (col + 1) * ldq] = Q[p + col * ldq];
+        __syncthreads();
+    }
+    for(rocblas_int p = tid; p < m + 1; p += BLOCKSIZE)
+    {
+        Q[p] = (p == 0) ? 1.0 : 0.0;
+        Q[p * ldq] = (p == 0) ? 1.0 : 0.0;
+    }
+
+    // R = [x'; R]
+    // (every thread works on its own columns)
+    for(rocblas_int col = tid; col < n; col += BLOCKSIZE)
+    {
+        for(rocblas_int p = m - 1; p >= 0; --p)
+            R[(p + 1) + col * ldr] = R[p + col * ldr];
+        R[col * ldr] = x[col * incx];
+    }
+    __syncthreads();
+
+    // reduce the upper Hessenberg matrix R
+    for(rocblas_int p = 0; p < min(m, n); ++p)
+    {
+        if(tid == 0)
+        {
+            f = R[p + p * ldr];
+            g = R[(p + 1) + p * ldr];
+            lartg(f, g, cc, ss, r);
+            R[p + p * ldr] = r;
+            R[(p + 1) + p * ldr] = 0;
+            c = cc;
+            s = ss;
+        }
+        __syncthreads();
+
+        rot(n - p - 1, R + p + (p + 1) * ldr, ldr, R + (p + 1) + (p + 1) * ldr, ldr, c, s);
+        rot(m + 1, Q + p * ldq, 1, Q + (p + 1) * ldq, 1, c, sconj(s));
+        __syncthreads();
+    }
+
+    // move the first row of Q to the i-th position
+    // (every thread works on its own columns)
+    for(rocblas_int col = tid; col < m + 1; col += BLOCKSIZE)
+    {
+        temp = Q[col * ldq];
+        for(rocblas_int p = 0; p < i - 1; ++p)
+            Q[p + col * ldq] = Q[(p + 1) + col * ldq];
+        Q[(i - 1) + col * ldq] = temp;
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_insert_row_argCheck(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                const rocblas_int ldq,
+                                                const rocblas_int ldr,
+                                                const rocblas_int incx,
+                                                T Q,
+                                                T R,
+                                                U x,
+                                                const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || i < 1 || i > m + 1 || ldq < m + 1 || ldr < m + 1 || incx < 1
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!Q || (n && !R) || (n && !x))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_qr_insert_row_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                U Q,
+                                                const rocblas_int shiftQ,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                U R,
+                                                const rocblas_int shiftR,
+                                                const rocblas_int ldr,
+                                                const rocblas_stride strideR,
+                                                U x,
+                                                const rocblas_int shiftx,
+                                                const rocblas_int incx,
+                                                const rocblas_stride stridex,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("qr_insert_row", "m:", m, "n:", n, "i:", i, "shiftQ:", shiftQ, "ldq:", ldq,
+                    "shiftR:", shiftR, "ldr:", ldr, "shiftx:", shiftx, "incx:", incx,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    hipLaunchKernelGGL(qr_insert_row_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream,
+                       m, n, i, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, x, shiftx, incx,
+                       stridex);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_insert_row.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_insert_row_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int i,
+                                                    U Q,
+                                                    const rocblas_int ldq,
+                                                    U R,
+                                                    const rocblas_int ldr,
+                                                    U x,
+                                                    const rocblas_int incx,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("qr_insert_row_batched", "-m", m, "-n", n, "--k1", i, "--lda", ldq, "--ldb",
+                        ldr, "--incx", incx, "--batch", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_insert_row_argCheck(handle, m, n, i, ldq, ldr, incx, Q, R, x,
+                                                         batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+    rocblas_int shiftx = 0;
+
+    // batched execution
+    rocblas_stride strideQ = 0;
+    rocblas_stride strideR = 0;
+    rocblas_stride stridex = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_qr_insert_row_template<T, S>(handle, m, n, i, Q, shiftQ, ldq, strideQ, R,
+                                                  shiftR, ldr, strideR, x, shiftx, incx, stridex,
+                                                  batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_insert_row_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                float* const Q[],
+                                                const rocblas_int ldq,
+                                                float* const R[],
+                                                const rocblas_int ldr,
+                                                float* const x[],
+                                                const rocblas_int incx,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_batched_impl<float>(handle, m, n, i, Q, ldq, R, ldr, x, incx,
+                                                       batch_count);
+}
+
+rocblas_status rocsolver_dqr_insert_row_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                double* const Q[],
+                                                const rocblas_int ldq,
+                                                double* const R[],
+                                                const rocblas_int ldr,
+                                                double* const x[],
+                                                const rocblas_int incx,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_batched_impl<double>(handle, m, n, i, Q, ldq, R, ldr, x, incx,
+                                                        batch_count);
+}
+
+rocblas_status rocsolver_cqr_insert_row_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                rocblas_float_complex* const Q[],
+                                                const rocblas_int ldq,
+                                                rocblas_float_complex* const R[],
+                                                const rocblas_int ldr,
+                                                rocblas_float_complex* const x[],
+                                                const rocblas_int incx,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_batched_impl<rocblas_float_complex>(handle, m, n, i, Q, ldq, R,
+                                                                       ldr, x, incx, batch_count);
+}
+
+rocblas_status rocsolver_zqr_insert_row_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int i,
+                                                rocblas_double_complex* const Q[],
+                                                const rocblas_int ldq,
+                                                rocblas_double_complex* const R[],
+                                                const rocblas_int ldr,
+                                                rocblas_double_complex* const x[],
+                                                const rocblas_int incx,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_batched_impl<rocblas_double_complex>(handle, m, n, i, Q, ldq, R,
+                                                                        ldr, x, incx, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_insert_row.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_insert_row_strided_batched_impl(rocblas_handle handle,
+                                                            const rocblas_int m,
+                                                            const rocblas_int n,
+                                                            const rocblas_int i,
+                                                            U Q,
+                                                            const rocblas_int ldq,
+                                                            const rocblas_stride strideQ,
+                                                            U R,
+                                                            const rocblas_int ldr,
+                                                            const rocblas_stride strideR,
+                                                            U x,
+                                                            const rocblas_int incx,
+                                                            const rocblas_stride stridex,
+                                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("qr_insert_row_strided_batched", "-m", m, "-n", n, "--k1", i, "--lda", ldq,
+                        "--ldb", ldr, "--incx", incx, "--bsa", strideQ, "--bsb", strideR, "--bsc",
+                        stridex, "--batch", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_insert_row_argCheck(handle, m, n, i, ldq, ldr, incx, Q, R, x,
+                                                         batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+    rocblas_int shiftx = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_qr_insert_row_template<T, S>(handle, m, n, i, Q, shiftQ, ldq, strideQ, R,
+                                                  shiftR, ldr, strideR, x, shiftx, incx, stridex,
+                                                  batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_insert_row_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int i,
+                                                        float* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        float* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        float* x,
+                                                        const rocblas_int incx,
+                                                        const rocblas_stride stridex,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_strided_batched_impl<float>(
+        handle, m, n, i, Q, ldq, strideQ, R, ldr, strideR, x, incx, stridex, batch_count);
+}
+
+rocblas_status rocsolver_dqr_insert_row_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int i,
+                                                        double* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        double* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        double* x,
+                                                        const rocblas_int incx,
+                                                        const rocblas_stride stridex,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_strided_batched_impl<double>(
+        handle, m, n, i, Q, ldq, strideQ, R, ldr, strideR, x, incx, stridex, batch_count);
+}
+
+rocblas_status rocsolver_cqr_insert_row_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int i,
+                                                        rocblas_float_complex* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        rocblas_float_complex* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        rocblas_float_complex* x,
+                                                        const rocblas_int incx,
+                                                        const rocblas_stride stridex,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, i, Q, ldq, strideQ, R, ldr, strideR, x, incx, stridex, batch_count);
+}
+
+rocblas_status rocsolver_zqr_insert_row_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int i,
+                                                        rocblas_double_complex* Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        rocblas_double_complex* R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        rocblas_double_complex* x,
+                                                        const rocblas_int incx,
+                                                        const rocblas_stride stridex,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver_qr_insert_row_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, i, Q, ldq, strideQ, R, ldr, strideR, x, incx, stridex, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** QR_UPDATE_KERNEL updates the full QR factorization Q*R of a m-by-n matrix
+    to the factorization of Q*R + X*Y', one column of X and Y at a time.
+    Each rank-1 update is carried out with two sweeps of givens rotations: the
+    first one reduces w = Q'*x to a multiple of e_1 (turning R into an upper
+    Hessenberg matrix), and the second one restores the triangular form of R.
+    The rotations of a sweep depend on each other, so every matrix in the batch
+    is processed by a single group of threads (as in the other QR and Cholesky
+    update kernels). Call this kernel with batch_count groups in x, and BLOCKSIZE
+    threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) qr_update_kernel(const rocblas_int m,
+                                                              const rocblas_int n,
+                                                              const rocblas_int k,
+                                                              U QQ,
+                                                              const rocblas_int shiftQ,
+                                                              const rocblas_int ldq,
+                                                              const rocblas_stride strideQ,
+                                                              U RR,
+                                                              const rocblas_int shiftR,
+                                                              const rocblas_int ldr,
+                                                              const rocblas_stride strideR,
+                                                              U XX,
+                                                              const rocblas_int shiftX,
+                                                              const rocblas_int ldx,
+                                                              const rocblas_stride strideX,
+                                                              U YY,
+                                                              const rocblas_int shiftY,
+                                                              const rocblas_int ldy,
+                                                              const rocblas_stride strideY,
+                                                              T* WW,
+                                                              const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* Q = load_ptr_batch<T>(QQ, b, shiftQ, strideQ);
+    T* R = load_ptr_batch<T>(RR, b, shiftR, strideR);
+    T* X = load_ptr_batch<T>(XX, b, shiftX, strideX);
+    T* Y = load_ptr_batch<T>(YY, b, shiftY, strideY);
+    T* w = WW + b * strideW;
+
+    // rotation shared by all the threads
+    __shared__ S c;
+    __shared__ T s;
+
+    S cc;
+    T ss, f, g, r, temp;
+
+    for(rocblas_int l = 0; l < k; ++l)
+    {
+        // w = Q' * x
+        for(rocblas_int i = tid; i < m; i += BLOCKSIZE)
+        {
+            temp = 0;
+            for(rocblas_int p = 0; p < m; ++p)
+                temp += sconj(Q[p + i * ldq]) * X[p + l * ldx];
+            w[i] = temp;
+        }
+        __syncthreads();
+
+        // reduce w to a multiple of e_1 (R becomes upper Hessenberg)
+        for(rocblas_int i = m - 1; i > 0; --i)
+        {
+            if(tid == 0)
+            {
+                f = w[i - 1];
+                g = w[i];
+                lartg(f, g, cc, ss, r);
+                w[i - 1] = r;
+                c = cc;
+                s = ss;
+            }
+            __syncthreads();
+
+            if(i - 1 < n)
+                rot(n - i + 1, R + (i - 1) + (i - 1) * ldr, ldr, R + i + (i - 1) * ldr, ldr, c, s);
+            rot(m, Q + (i - 1) * ldq, 1, Q + i * ldq, 1, c, sconj(s));
+            __syncthreads();
+        }
+
+        // add the rank-1 update to the first row of R
+        for(rocblas_int j = tid; j < n; j += BLOCKSIZE)
+            R[j * ldr] += w[0] * sconj(Y[j + l * ldy]);
+        __syncthreads();
+
+        // restore the triangular form of R
+        for(rocblas_int i = 0; i < min(m - 1, n); ++i)
+        {
+            if(tid == 0)
+            {
+                f = R[i + i * ldr];
+                g = R[(i + 1) + i * ldr];
+                lartg(f, g, cc, ss, r);
+                R[i + i * ldr] = r;
+                R[(i + 1) + i * ldr] = 0;
+                c = cc;
+                s = ss;
+            }
+            __syncthreads();
+
+            rot(n - i - 1, R + i + (i + 1) * ldr, ldr, R + (i + 1) + (i + 1) * ldr, ldr, c, s);
+            rot(m, Q + i * ldq, 1, Q + (i + 1) * ldq, 1, c, sconj(s));
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T>
+void rocsolver_qr_update_getMemorySize(const rocblas_int m,
+                                       const rocblas_int n,
+                                       const rocblas_int k,
+                                       const rocblas_int batch_count,
+                                       size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the vector w = Q'*x
+    *size_work = sizeof(T) * m * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_qr_update_argCheck(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            const rocblas_int ldq,
+                                            const rocblas_int ldr,
+                                            const rocblas_int ldx,
+                                            const rocblas_int ldy,
+                                            T Q,
+                                            T R,
+                                            T X,
+                                            T Y,
+                                            const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || k < 0 || ldq < m || ldr < m || ldx < m || ldy < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && !Q) || (m * n && !R) || (m * k && !X) || (n * k && !Y))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_qr_update_template(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            U Q,
+                                            const rocblas_int shiftQ,
+                                            const rocblas_int ldq,
+                                            const rocblas_stride strideQ,
+                                            U R,
+                                            const rocblas_int shiftR,
+                                            const rocblas_int ldr,
+                                            const rocblas_stride strideR,
+                                            U X,
+                                            const rocblas_int shiftX,
+                                            const rocblas_int ldx,
+                                            const rocblas_stride strideX,
+                                            U Y,
+                                            const rocblas_int shiftY,
+                                            const rocblas_int ldy,
+                                            const rocblas_stride strideY,
+                                            const rocblas_int batch_count,
+                                            T* work)
+{
+    ROCSOLVER_ENTER("qr_update", "m:", m, "n:", n, "k:", k, "shiftQ:", shiftQ, "ldq:", ldq,
+                    "shiftR:", shiftR, "ldr:", ldr, "shiftX:", shiftX, "ldx:", ldx,
+                    "shiftY:", shiftY, "ldy:", ldy, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_stride strideW = m;
+    hipLaunchKernelGGL(qr_update_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, m, n,
+                       k, Q, shiftQ, ldq, strideQ, R, shiftR, ldr, strideR, X, shiftX, ldx,
+                       strideX, Y, shiftY, ldy, strideY, work, strideW);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_update.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_update_batched_impl(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int k,
+                                                U Q,
+                                                const rocblas_int ldq,
+                                                U R,
+                                                const rocblas_int ldr,
+                                                U X,
+                                                const rocblas_int ldx,
+                                                U Y,
+                                                const rocblas_int ldy,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("qr_update_batched", "-m", m, "-n", n, "-k", k, "--lda", ldq, "--ldb", ldr,
+                        "--ldc", ldx, "--ldv", ldy, "--batch", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_update_argCheck(handle, m, n, k, ldq, ldr, ldx, ldy, Q, R, X,
+                                                     Y, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+    rocblas_int shiftX = 0;
+    rocblas_int shiftY = 0;
+
+    // batched execution
+    rocblas_stride strideQ = 0;
+    rocblas_stride strideR = 0;
+    rocblas_stride strideX = 0;
+    rocblas_stride strideY = 0;
+
+    // memory workspace sizes:
+    // size of re-usable workspace
+    size_t size_work;
+    rocsolver_qr_update_getMemorySize<T>(m, n, k, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_qr_update_template<T, S>(handle, m, n, k, Q, shiftQ, ldq, strideQ, R, shiftR,
+                                              ldr, strideR, X, shiftX, ldx, strideX, Y, shiftY, ldy,
+                                              strideY, batch_count, (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_update_batched(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            float* const Q[],
+                                            const rocblas_int ldq,
+                                            float* const R[],
+                                            const rocblas_int ldr,
+                                            float* const X[],
+                                            const rocblas_int ldx,
+                                            float* const Y[],
+                                            const rocblas_int ldy,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_batched_impl<float>(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy,
+                                                   batch_count);
+}
+
+rocblas_status rocsolver_dqr_update_batched(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            double* const Q[],
+                                            const rocblas_int ldq,
+                                            double* const R[],
+                                            const rocblas_int ldr,
+                                            double* const X[],
+                                            const rocblas_int ldx,
+                                            double* const Y[],
+                                            const rocblas_int ldy,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_batched_impl<double>(handle, m, n, k, Q, ldq, R, ldr, X, ldx, Y, ldy,
+                                                    batch_count);
+}
+
+rocblas_status rocsolver_cqr_update_batched(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            rocblas_float_complex* const Q[],
+                                            const rocblas_int ldq,
+                                            rocblas_float_complex* const R[],
+                                            const rocblas_int ldr,
+                                            rocblas_float_complex* const X[],
+                                            const rocblas_int ldx,
+                                            rocblas_float_complex* const Y[],
+                                            const rocblas_int ldy,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_batched_impl<rocblas_float_complex>(handle, m, n, k, Q, ldq, R, ldr,
+                                                                   X, ldx, Y, ldy, batch_count);
+}
+
+rocblas_status rocsolver_zqr_update_batched(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            rocblas_double_complex* const Q[],
+                                            const rocblas_int ldq,
+                                            rocblas_double_complex* const R[],
+                                            const rocblas_int ldr,
+                                            rocblas_double_complex* const X[],
+                                            const rocblas_int ldx,
+                                            rocblas_double_complex* const Y[],
+                                            const rocblas_int ldy,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_batched_impl<rocblas_double_complex>(handle, m, n, k, Q, ldq, R, ldr,
+                                                                    X, ldx, Y, ldy, batch_count);
+}
+
+} // extern C
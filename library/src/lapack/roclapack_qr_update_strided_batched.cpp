@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_qr_update.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_qr_update_strided_batched_impl(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        const rocblas_int k,
+                                                        U Q,
+                                                        const rocblas_int ldq,
+                                                        const rocblas_stride strideQ,
+                                                        U R,
+                                                        const rocblas_int ldr,
+                                                        const rocblas_stride strideR,
+                                                        U X,
+                                                        const rocblas_int ldx,
+                                                        const rocblas_stride strideX,
+                                                        U Y,
+                                                        const rocblas_int ldy,
+                                                        const rocblas_stride strideY,
+                                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("qr_update_strided_batched", "-m", m, "-n", n, "-k", k, "--lda", ldq,
+                        "--ldb", ldr, "--ldc", ldx, "--ldv", ldy, "--bsa", strideQ, "--bsb",
+                        strideR, "--bsc", strideX, "--bsp", strideY, "--batch", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_qr_update_argCheck(handle, m, n, k, ldq, ldr, ldx, ldy, Q, R, X,
+                                                     Y, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftQ = 0;
+    rocblas_int shiftR = 0;
+    rocblas_int shiftX = 0;
+    rocblas_int shiftY = 0;
+
+    // memory workspace sizes:
+    // size of re-usable workspace
+    size_t size_work;
+    rocsolver_qr_update_getMemorySize<T>(m, n, k, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_qr_update_template<T, S>(handle, m, n, k, Q, shiftQ, ldq, strideQ, R, shiftR,
+                                              ldr, strideR, X, shiftX, ldx, strideX, Y, shiftY, ldy,
+                                              strideY, batch_count, (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sqr_update_strided_batched(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int k,
+                                                    float* Q,
+                                                    const rocblas_int ldq,
+                                                    const rocblas_stride strideQ,
+                                                    float* R,
+                                                    const rocblas_int ldr,
+                                                    const rocblas_stride strideR,
+                                                    float* X,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    float* Y,
+                                                    const rocblas_int ldy,
+                                                    const rocblas_stride strideY,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_strided_batched_impl<float>(handle, m, n, k, Q, ldq, strideQ, R, ldr,
+                                                           strideR, X, ldx, strideX, Y, ldy,
+                                                           strideY, batch_count);
+}
+
+rocblas_status rocsolver_dqr_update_strided_batched(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int k,
+                                                    double* Q,
+                                                    const rocblas_int ldq,
+                                                    const rocblas_stride strideQ,
+                                                    double* R,
+                                                    const rocblas_int ldr,
+                                                    const rocblas_stride strideR,
+                                                    double* X,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    double* Y,
+                                                    const rocblas_int ldy,
+                                                    const rocblas_stride strideY,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_strided_batched_impl<double>(handle, m, n, k, Q, ldq, strideQ, R,
+                                                            ldr, strideR, X, ldx, strideX, Y, ldy,
+                                                            strideY, batch_count);
+}
+
+rocblas_status rocsolver_cqr_update_strided_batched(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int k,
+                                                    rocblas_float_complex* Q,
+                                                    const rocblas_int ldq,
+                                                    const rocblas_stride strideQ,
+                                                    rocblas_float_complex* R,
+                                                    const rocblas_int ldr,
+                                                    const rocblas_stride strideR,
+                                                    rocblas_float_complex* X,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    rocblas_float_complex* Y,
+                                                    const rocblas_int ldy,
+                                                    const rocblas_stride strideY,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, k, Q, ldq, strideQ, R, ldr, strideR, X, ldx, strideX, Y, ldy, strideY,
+        batch_count);
+}
+
+rocblas_status rocsolver_zqr_update_strided_batched(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int k,
+                                                    rocblas_double_complex* Q,
+                                                    const rocblas_int ldq,
+                                                    const rocblas_stride strideQ,
+                                                    rocblas_double_complex* R,
+                                                    const rocblas_int ldr,
+                                                    const rocblas_stride strideR,
+                                                    rocblas_double_complex* X,
+                                                    const rocblas_int ldx,
+                                                    const rocblas_stride strideX,
+                                                    rocblas_double_complex* Y,
+                                                    const rocblas_int ldy,
+                                                    const rocblas_stride strideY,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_qr_update_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, k, Q, ldq, strideQ, R, ldr, strideR, X, ldx, strideX, Y, ldy, strideY,
+        batch_count);
+}
+
+} // extern C
@@ -12,6 +12,7 @@
 #include "auxiliary/rocauxiliary_orgtr_ungtr.hpp"
 #include "auxiliary/rocauxiliary_steqr.hpp"
 #include "auxiliary/rocauxiliary_sterf.hpp"
+#include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver.h"
@@ -59,6 +60,170 @@ __global__ void scalar_case(const rocblas_evect evect,
     }
 }
 
+/** SYEV_SMALL_KERNEL computes the eigenvalues (and eigenvectors) of the N-by-N
+    (N = 2 or 3) hermitian matrices in the batch. Every matrix is kept in registers
+    and diagonalized by a single thread with cyclic Jacobi rotations: one rotation
+    is the closed-form solution when N = 2, and at most SYEV_SMALL_MAX_SWEEPS sweeps
+    are executed when N = 3. Call this kernel with one thread per matrix. **/
+template <rocblas_int N, typename T, typename S, typename U>
+__global__ void syev_small_kernel(const rocblas_evect evect,
+                                  const rocblas_fill uplo,
+                                  U AA,
+                                  const rocblas_int shiftA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride strideA,
+                                  S* DD,
+                                  const rocblas_stride strideD,
+                                  S* EE,
+                                  const rocblas_stride strideE,
+                                  const S eps,
+                                  const rocblas_int bc)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < bc)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        S* D = DD + b * strideD;
+        S* E = EE + b * strideE;
+
+        // load the full hermitian matrix and initialize the eigenvectors
+        T a[N * N];
+        T v[N * N];
+        S norm = 0;
+#pragma unroll
+        for(rocblas_int j = 0; j < N; j++)
+        {
+#pragma unroll
+            for(rocblas_int i = 0; i < N; i++)
+            {
+                if(i == j)
+                    a[i + j * N] = std::real(A[i + j * lda]);
+                else if(uplo == rocblas_fill_upper)
+                    a[i + j * N] = (i < j ? A[i + j * lda] : sconj(A[j + i * lda]));
+                else
+                    a[i + j * N] = (i > j ? A[i + j * lda] : sconj(A[j + i * lda]));
+                v[i + j * N] = (i == j ? 1 : 0);
+
+                S t = std::abs(a[i + j * N]);
+                norm += t * t;
+            }
+        }
+        const S tol = eps * eps * norm;
+
+        // Jacobi sweeps
+        for(rocblas_int sweep = 0; sweep < SYEV_SMALL_MAX_SWEEPS; sweep++)
+        {
+            S off = 0;
+#pragma unroll
+            for(rocblas_int j = 0; j < N; j++)
+            {
+#pragma unroll
+                for(rocblas_int i = 0; i < j; i++)
+                {
+                    S t = std::abs(a[i + j * N]);
+                    off += 2 * t * t;
+                }
+            }
+            if(off <= tol)
+                break;
+
+#pragma unroll
+            for(rocblas_int p = 0; p < N - 1; p++)
+            {
+#pragma unroll
+                for(rocblas_int q = p + 1; q < N; q++)
+                {
+                    S c;
+                    T s;
+                    jacobi_rot(std::real(a[p + p * N]), std::real(a[q + q * N]), a[p + q * N], c,
+                               s);
+
+                    // rows p and q
+#pragma unroll
+                    for(rocblas_int j = 0; j < N; j++)
+                    {
+                        T x = a[p + j * N];
+                        T y = a[q + j * N];
+                        a[p + j * N] = c * x - s * y;
+                        a[q + j * N] = sconj(s) * x + c * y;
+                    }
+
+                    // columns p and q
+#pragma unroll
+                    for(rocblas_int i = 0; i < N; i++)
+                    {
+                        T x = a[i + p * N];
+                        T y = a[i + q * N];
+                        a[i + p * N] = c * x - sconj(s) * y;
+                        a[i + q * N] = s * x + c * y;
+
+                        x = v[i + p * N];
+                        y = v[i + q * N];
+                        v[i + p * N] = c * x - sconj(s) * y;
+                        v[i + q * N] = s * x + c * y;
+                    }
+                    a[p + q * N] = 0;
+                    a[q + p * N] = 0;
+                }
+            }
+        }
+
+        // sort the eigenvalues in increasing order
+        S w[N];
+        rocblas_int idx[N];
+#pragma unroll
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            w[i] = std::real(a[i + i * N]);
+            idx[i] = i;
+        }
+#pragma unroll
+        for(rocblas_int j = 0; j < N - 1; j++)
+        {
+#pragma unroll
+            for(rocblas_int i = 0; i < N - 1 - j; i++)
+            {
+                if(w[i + 1] < w[i])
+                {
+                    S t = w[i];
+                    w[i] = w[i + 1];
+                    w[i + 1] = t;
+                    rocblas_int k = idx[i];
+                    idx[i] = idx[i + 1];
+                    idx[i + 1] = k;
+                }
+            }
+        }
+
+        // write results
+#pragma unroll
+        for(rocblas_int i = 0; i < N; i++)
+            D[i] = w[i];
+#pragma unroll
+        for(rocblas_int i = 0; i < N - 1; i++)
+            E[i] = 0;
+
+        if(evect == rocblas_evect_original)
+        {
+#pragma unroll
+            for(rocblas_int j = 0; j < N; j++)
+            {
+#pragma unroll
+                for(rocblas_int i = 0; i < N; i++)
+                {
+#pragma unroll
+                    for(rocblas_int k = 0; k < N; k++)
+                    {
+                        if(idx[j] == k)
+                            A[i + j * lda] = v[i + k * N];
+                    }
+                }
+            }
+        }
+    }
+}
+
 /** Argument checking **/
 template <typename W, typename S>
 rocblas_status rocsolver_syev_heev_argCheck(rocblas_handle handle,
@@ -107,8 +272,9 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
                                        size_t* size_tau,
                                        size_t* size_workArr)
 {
-    // if quick return, set workspace to zero
-    if(n == 0 || batch_count == 0)
+    // if quick return, or if the matrices are solved with the closed-form
+    // kernels (n <= 3), set workspace to zero
+    if(n <= 3 || batch_count == 0)
     {
         *size_scalars = 0;
         *size_work_stack = 0;
@@ -139,8 +305,11 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
     }
     else
     {
-        // extra requirements for computing only the eigenvalues (sterf)
-        rocsolver_sterf_getMemorySize<T>(n, batch_count, &w2);
+        // extra requirements for computing only the eigenvalues (sterf or bisection)
+        if(n < SYEV_BISECTION_SWITCHSIZE)
+            rocsolver_sterf_getMemorySize<S>(n, batch_count, &w2);
+        else
+            rocsolver_sterf_bisect_getMemorySize<S>(n, batch_count, &w2);
     }
 
     // get max values
@@ -203,6 +372,21 @@ rocblas_status rocsolver_syev_heev_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // closed-form kernels for 2-by-2 and 3-by-3 matrices (one thread per matrix)
+    if(n <= 3)
+    {
+        S eps = get_epsilon<T>();
+        if(n == 2)
+            hipLaunchKernelGGL((syev_small_kernel<2, T>), gridReset, threads, 0, stream, evect,
+                               uplo, A, shiftA, lda, strideA, D, strideD, E, strideE, eps,
+                               batch_count);
+        else
+            hipLaunchKernelGGL((syev_small_kernel<3, T>), gridReset, threads, 0, stream, evect,
+                               uplo, A, shiftA, lda, strideA, D, strideD, E, strideE, eps,
+                               batch_count);
+        return rocblas_status_success;
+    }
+
     // reduce A to tridiagonal form
     rocsolver_sytrd_hetrd_template(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE,
                                    tau, n, batch_count, scalars, (T*)work_stack, Abyx_norms_tmptr,
@@ -211,8 +395,12 @@ rocblas_status rocsolver_syev_heev_template(rocblas_handle handle,
     if(evect != rocblas_evect_original)
     {
         // only compute eigenvalues
-        rocsolver_sterf_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info, batch_count,
-                                    (rocblas_int*)work_stack);
+        if(n < SYEV_BISECTION_SWITCHSIZE)
+            rocsolver_sterf_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info,
+                                        batch_count, (rocblas_int*)work_stack);
+        else
+            rocsolver_sterf_bisect_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info,
+                                               batch_count, (S*)work_stack);
     }
     else
     {
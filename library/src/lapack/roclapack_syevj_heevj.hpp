@@ -0,0 +1,482 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    SYEVJ/HEEVJ implement the cyclic Jacobi eigenvalue algorithm with a
+ *    parallel (round-robin) ordering. Indices 0, ..., nn-1 (with nn = n rounded
+ *    up to an even number) play a tournament of nn-1 rounds; in every round
+ *    each index is paired with exactly one other, so that the nn/2 rotations of
+ *    the round annihilate disjoint pairs of off-diagonal elements and can be
+ *    computed and applied concurrently. A sweep is a full tournament, i.e. every
+ *    off-diagonal element is annihilated once. (When n is odd, the pairs that
+ *    involve the extra index nn-1 = n are skipped).
+ *
+ *    Every matrix in the batch is processed by a single group of threads. Small
+ *    matrices (and their eigenvectors) are staged in shared memory, so that
+ *    all the sweeps are done on chip with a single kernel launch.
+ * ===========================================================================
+ */
+
+/** SYEVJ_PAIR returns the pair of indices p < q annihilated by the k-th rotation
+    of round r of a tournament with nn (even) players **/
+__device__ inline void syevj_pair(const rocblas_int nn,
+                                  const rocblas_int r,
+                                  const rocblas_int k,
+                                  rocblas_int& p,
+                                  rocblas_int& q)
+{
+    if(k == 0)
+    {
+        p = nn - 1;
+        q = r;
+    }
+    else
+    {
+        p = (r + k) % (nn - 1);
+        q = (r - k + nn - 1) % (nn - 1);
+    }
+
+    if(p > q)
+    {
+        rocblas_int t = p;
+        p = q;
+        q = t;
+    }
+}
+
+/** SYEVJ_REDUCE_SUM returns the sum of the values val given by all the threads
+    in the group. The number of threads must be a power of 2, and sval must have
+    room for one value per thread **/
+template <typename S>
+__device__ S syevj_reduce_sum(S val, S* sval)
+{
+    const auto tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int s = hipBlockDim_x / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+            sval[tid] += sval[tid + s];
+        __syncthreads();
+    }
+
+    val = sval[0];
+    __syncthreads();
+    return val;
+}
+
+/** SYEVJ_OFFNORM computes the Frobenius norm of the off-diagonal part of the
+    n-by-n matrix M, and (if norm is not null) the Frobenius norm of the whole matrix **/
+template <typename T, typename S>
+__device__ S
+    syevj_offnorm(const rocblas_int n, T* M, const rocblas_int ldm, S* sval, S* norm = nullptr)
+{
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    S off = 0;
+    S diag = 0;
+    for(rocblas_int l = tid; l < n * n; l += nthds)
+    {
+        rocblas_int i = l % n;
+        rocblas_int j = l / n;
+        S v = std::abs(M[i + j * ldm]);
+        if(i == j)
+            diag += v * v;
+        else
+            off += v * v;
+    }
+
+    off = syevj_reduce_sum<S>(off, sval);
+    if(norm)
+        *norm = sqrt(off + syevj_reduce_sum<S>(diag, sval));
+
+    return sqrt(off);
+}
+
+/** SYEVJ_KERNEL computes the eigenvalues (and eigenvectors) of every matrix in the batch.
+    When lds is true, the matrix, the eigenvectors and the rotations are staged in shared
+    memory; otherwise A is rotated in place and the eigenvectors and the rotations are kept in
+    the global workspace work (strideWork elements for every matrix in the batch).
+    Call this kernel with batch_count groups in x, and a power of 2 number of threads (at
+    most SYEVJ_MAX_THDS). The dynamic shared memory must have room for one real value per
+    thread, plus the staged data when lds is true. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(SYEVJ_MAX_THDS) syevj_kernel(const rocblas_evect evect,
+                                                               const rocblas_fill uplo,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               const S abstol,
+                                                               const S eps,
+                                                               S* residualA,
+                                                               const rocblas_int max_sweeps,
+                                                               rocblas_int* n_sweepsA,
+                                                               S* WW,
+                                                               const rocblas_stride strideW,
+                                                               rocblas_int* infoA,
+                                                               T* work,
+                                                               const rocblas_stride strideWork,
+                                                               const bool lds)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    S* W = WW + b * strideW;
+
+    const bool vectors = (evect == rocblas_evect_original);
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // number of players and number of rotations per round
+    const rocblas_int nn = n + (n % 2);
+    const rocblas_int half = nn / 2;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    __shared__ rocblas_int sidx;
+
+    // M is the matrix being diagonalized, V accumulates the rotations,
+    // and (c[k], su[k]) define the k-th rotation of the current round
+    T* M;
+    T* V;
+    T* rot;
+    rocblas_int ldm;
+    if(lds)
+    {
+        M = (T*)lmem;
+        ldm = n;
+        V = M + n * n;
+        rot = V + (vectors ? n * n : 0);
+    }
+    else
+    {
+        M = A;
+        ldm = lda;
+        V = work + b * strideWork;
+        rot = V + (vectors ? n * n : 0);
+    }
+    T* c = rot;
+    T* su = rot + half;
+    S* sval = (S*)(lds ? rot + nn : (T*)lmem);
+
+    // copy the referenced triangle to the full hermitian matrix M,
+    // and initialize V as the identity
+    for(rocblas_int l = tid; l < n * n; l += nthds)
+    {
+        rocblas_int i = l % n;
+        rocblas_int j = l / n;
+        if(upper ? i <= j : i >= j)
+        {
+            T a = A[i + j * lda];
+            if(i == j)
+                M[i + i * ldm] = std::real(a);
+            else
+            {
+                M[i + j * ldm] = a;
+                M[j + i * ldm] = sconj(a);
+            }
+        }
+        if(vectors)
+            V[i + j * n] = (i == j ? 1 : 0);
+    }
+    __syncthreads();
+
+    // convergence tolerance
+    S norm;
+    S off = syevj_offnorm<T, S>(n, M, ldm, sval, &norm);
+    const S tol = (abstol > 0 ? abstol : eps) * norm;
+
+    rocblas_int sweeps = 0;
+    while(off > tol && sweeps < max_sweeps)
+    {
+        for(rocblas_int r = 0; r < nn - 1; r++)
+        {
+            // compute the rotations of this round
+            for(rocblas_int k = tid; k < half; k += nthds)
+            {
+                rocblas_int p, q;
+                syevj_pair(nn, r, k, p, q);
+
+                S cc = 1;
+                T ss = 0;
+                if(q < n)
+                {
+                    T g = M[p + q * ldm];
+                    S ag = std::abs(g);
+                    if(ag > 0)
+                    {
+                        S app = std::real(M[p + p * ldm]);
+                        S aqq = std::real(M[q + q * ldm]);
+                        S theta = (aqq - app) / (2 * ag);
+                        S t = 1 / (abs(theta) + sqrt(1 + theta * theta));
+                        if(theta < 0)
+                            t = -t;
+                        cc = 1 / sqrt(1 + t * t);
+                        ss = g * T(t * cc / ag);
+                    }
+                }
+                c[k] = cc;
+                su[k] = ss;
+            }
+            __syncthreads();
+
+            // apply the rotations from the left (rows p and q)
+            for(rocblas_int l = tid; l < half * n; l += nthds)
+            {
+                rocblas_int k = l / n;
+                rocblas_int j = l % n;
+                rocblas_int p, q;
+                syevj_pair(nn, r, k, p, q);
+                if(q < n)
+                {
+                    T cc = c[k];
+                    T ss = su[k];
+                    T x = M[p + j * ldm];
+                    T y = M[q + j * ldm];
+                    M[p + j * ldm] = cc * x - ss * y;
+                    M[q + j * ldm] = sconj(ss) * x + cc * y;
+                }
+            }
+            __syncthreads();
+
+            // apply the rotations from the right (columns p and q), and
+            // accumulate them in V
+            for(rocblas_int l = tid; l < half * n; l += nthds)
+            {
+                rocblas_int k = l / n;
+                rocblas_int i = l % n;
+                rocblas_int p, q;
+                syevj_pair(nn, r, k, p, q);
+                if(q < n)
+                {
+                    T cc = c[k];
+                    T ss = su[k];
+                    T x = M[i + p * ldm];
+                    T y = M[i + q * ldm];
+                    M[i + p * ldm] = (i == q ? T(0) : cc * x - sconj(ss) * y);
+                    M[i + q * ldm] = (i == p ? T(0) : ss * x + cc * y);
+
+                    if(vectors)
+                    {
+                        x = V[i + p * n];
+                        y = V[i + q * n];
+                        V[i + p * n] = cc * x - sconj(ss) * y;
+                        V[i + q * n] = ss * x + cc * y;
+                    }
+                }
+            }
+            __syncthreads();
+        }
+
+        sweeps++;
+        off = syevj_offnorm<T, S>(n, M, ldm, sval);
+    }
+
+    // the eigenvalues are the diagonal of M
+    for(rocblas_int i = tid; i < n; i += nthds)
+        W[i] = std::real(M[i + i * ldm]);
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        residualA[b] = off;
+        n_sweepsA[b] = sweeps;
+        infoA[b] = (off > tol ? 1 : 0);
+    }
+
+    // sort the eigenvalues in increasing order (selection sort), together
+    // with the eigenvectors
+    for(rocblas_int j = 0; j < n - 1; j++)
+    {
+        if(tid == 0)
+        {
+            rocblas_int m = j;
+            for(rocblas_int i = j + 1; i < n; i++)
+            {
+                if(W[i] < W[m])
+                    m = i;
+            }
+            sidx = m;
+            if(m != j)
+            {
+                S t = W[j];
+                W[j] = W[m];
+                W[m] = t;
+            }
+        }
+        __syncthreads();
+
+        rocblas_int m = sidx;
+        if(vectors && m != j)
+        {
+            for(rocblas_int i = tid; i < n; i += nthds)
+            {
+                T t = V[i + j * n];
+                V[i + j * n] = V[i + m * n];
+                V[i + m * n] = t;
+            }
+        }
+        __syncthreads();
+    }
+
+    // copy the eigenvectors back to A
+    if(vectors)
+    {
+        for(rocblas_int l = tid; l < n * n; l += nthds)
+        {
+            rocblas_int i = l % n;
+            rocblas_int j = l / n;
+            A[i + j * lda] = V[i + j * n];
+        }
+    }
+}
+
+/** Helper to calculate workspace sizes **/
+template <typename T>
+void rocsolver_syevj_heevj_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_work,
+                                         size_t* size_lds)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        *size_lds = 0;
+        return;
+    }
+
+    // the matrix and the eigenvectors are staged in shared memory when they fit;
+    // otherwise the eigenvectors and the rotations are kept in global memory
+    size_t nn = n + (n % 2);
+    size_t size_mat = sizeof(T) * n * n * (evect == rocblas_evect_original ? 2 : 1);
+    if(size_mat <= SYEVJ_SMALL_MAXLDS)
+    {
+        *size_lds = size_mat + sizeof(T) * nn;
+        *size_work = 0;
+    }
+    else
+    {
+        *size_lds = 0;
+        *size_work = sizeof(T) * batch_count
+            * ((evect == rocblas_evect_original ? size_t(n) * n : 0) + nn);
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_syevj_heevj_argCheck(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T A,
+                                              const rocblas_int lda,
+                                              S* residual,
+                                              const rocblas_int max_sweeps,
+                                              rocblas_int* n_sweeps,
+                                              S* W,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(evect != rocblas_evect_original && evect != rocblas_evect_none)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || max_sweeps <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !W) || (batch_count && !residual) || (batch_count && !n_sweeps)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              const S abstol,
+                                              S* residual,
+                                              const rocblas_int max_sweeps,
+                                              rocblas_int* n_sweeps,
+                                              S* W,
+                                              const rocblas_stride strideW,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* work)
+{
+    ROCSOLVER_ENTER("syevj_heevj", "evect:", evect, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "abstol:", abstol, "max_sweeps:", max_sweeps,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // quick return
+    if(n == 0)
+    {
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, residual, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, n_sweeps, batch_count, 0);
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // number of threads: enough to update all the rows (or columns) touched by
+    // one round of rotations at once, up to SYEVJ_MAX_THDS
+    rocblas_int nn = n + (n % 2);
+    rocblas_int nthds = 64;
+    while(nthds < (nn / 2) * n && nthds < SYEVJ_MAX_THDS)
+        nthds *= 2;
+
+    size_t size_work, size_lds;
+    rocsolver_syevj_heevj_getMemorySize<T>(evect, n, batch_count, &size_work, &size_lds);
+    size_t lmemsize = size_lds + sizeof(S) * nthds;
+    rocblas_stride strideWork
+        = (size_lds > 0 ? 0 : (evect == rocblas_evect_original ? rocblas_stride(n) * n : 0) + nn);
+
+    // every matrix in the batch is diagonalized by a single group of threads
+    S eps = get_epsilon<T>();
+    hipLaunchKernelGGL(syevj_kernel<T, S>, dim3(batch_count), dim3(nthds), lmemsize, stream, evect,
+                       uplo, n, A, shiftA, lda, strideA, abstol, eps, residual, max_sweeps,
+                       n_sweeps, W, strideW, info, work, strideWork, size_lds > 0);
+
+    return rocblas_status_success;
+}
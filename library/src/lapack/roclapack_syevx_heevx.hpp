@@ -0,0 +1,339 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
+#include "auxiliary/rocauxiliary_stebz.hpp"
+#include "auxiliary/rocauxiliary_stein.hpp"
+#include "rocblas.hpp"
+#include "roclapack_syev_heev.hpp"
+#include "roclapack_sytrd_hetrd.hpp"
+#include "rocsolver.h"
+
+/** SYEVX_SORT_VECTORS sorts the computed eigenvalues (grouped by blocks) in increasing
+    order, permuting the eigenvectors and updating the indices in ifail accordingly.
+    Call this kernel with batch_count groups in y, and BLOCKSIZE threads in x **/
+template <typename T, typename S, typename U>
+__global__ void syevx_sort_vectors(const rocblas_int n,
+                                   rocblas_int* nevA,
+                                   S* WW,
+                                   const rocblas_stride strideW,
+                                   U ZZ,
+                                   const rocblas_int shiftZ,
+                                   const rocblas_int ldz,
+                                   const rocblas_stride strideZ,
+                                   rocblas_int* ifailA,
+                                   const rocblas_stride strideF,
+                                   rocblas_int* info)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    S* W = WW + (bid * strideW);
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    rocblas_int* ifail = ifailA + (bid * strideF);
+    rocblas_int nev = nevA[bid];
+    rocblas_int nfail = info[bid];
+
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    for(rocblas_int j = 0; j < nev - 1; j++)
+    {
+        // find the smallest remaining eigenvalue (the negated largest)
+        S val = -W[j];
+        rocblas_int idx = j;
+        for(rocblas_int i = j + 1 + tid; i < nev; i += BLOCKSIZE)
+        {
+            if(-W[i] > val)
+            {
+                val = -W[i];
+                idx = i;
+            }
+        }
+        block_reduce_max(val, idx, sval, sidx);
+
+        if(idx != j)
+        {
+            for(rocblas_int i = tid; i < n; i += BLOCKSIZE)
+            {
+                T temp = Z[i + j * ldz];
+                Z[i + j * ldz] = Z[i + idx * ldz];
+                Z[i + idx * ldz] = temp;
+            }
+
+            if(tid == 0)
+            {
+                S temp = W[j];
+                W[j] = W[idx];
+                W[idx] = temp;
+
+                for(rocblas_int k = 0; k < nfail; k++)
+                {
+                    if(ifail[k] == j + 1)
+                        ifail[k] = idx + 1;
+                    else if(ifail[k] == idx + 1)
+                        ifail[k] = j + 1;
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    // restore increasing order of the indices in ifail
+    if(tid == 0)
+    {
+        for(rocblas_int i = 1; i < nfail; i++)
+        {
+            rocblas_int f = ifail[i];
+            rocblas_int k = i;
+            for(; k > 0 && ifail[k - 1] > f; k--)
+                ifail[k] = ifail[k - 1];
+            ifail[k] = f;
+        }
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_syevx_heevx_argCheck(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_erange erange,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T A,
+                                              const rocblas_int lda,
+                                              const S vl,
+                                              const S vu,
+                                              const rocblas_int il,
+                                              const rocblas_int iu,
+                                              rocblas_int* nev,
+                                              S* W,
+                                              T Z,
+                                              const rocblas_int ldz,
+                                              rocblas_int* ifail,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(evect != rocblas_evect_original && evect != rocblas_evect_none)
+        return rocblas_status_invalid_value;
+    if(erange != rocblas_erange_all && erange != rocblas_erange_value
+       && erange != rocblas_erange_index)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(evect == rocblas_evect_original && ldz < n)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_value && vl >= vu)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (il < 1 || iu < 0))
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (iu > n || (n > 0 && il > iu)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !W) || (batch_count && !nev) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if(evect == rocblas_evect_original && ((n && !Z) || (n && !ifail)))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work1,
+                                         size_t* size_work2,
+                                         size_t* size_work3,
+                                         size_t* size_D_E,
+                                         size_t* size_iblock_isplit,
+                                         size_t* size_tau,
+                                         size_t* size_nsplit_workArr)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_D_E = 0;
+        *size_iblock_isplit = 0;
+        *size_tau = 0;
+        *size_nsplit_workArr = 0;
+        return;
+    }
+
+    size_t unused;
+    size_t w1 = 0, w2 = 0, w3 = 0, w4 = 0;
+    size_t a1 = 0, a2 = 0, a3 = 0, a4 = 0;
+    size_t t1 = 0, t2 = 0;
+    size_t r1 = 0, r2 = 0;
+
+    // requirements for tridiagonalization (sytrd/hetrd)
+    rocsolver_sytrd_hetrd_getMemorySize<T, BATCHED>(n, batch_count, size_scalars, &w1, &a1, &t1,
+                                                    &r1);
+
+    // requirements for computing the eigenvalues (stebz)
+    rocsolver_stebz_getMemorySize<S>(n, batch_count, &w2, &a2);
+
+    if(evect == rocblas_evect_original)
+    {
+        // extra requirements for computing the eigenvectors (stein)
+        rocsolver_stein_getMemorySize<S>(n, batch_count, &w3, &a3);
+
+        // extra requirements for ormtr/unmtr
+        rocsolver_ormtr_unmtr_getMemorySize<T, BATCHED>(rocblas_side_left, uplo, n, n, batch_count,
+                                                        &unused, &w4, &a4, &t2, &r2);
+    }
+
+    // get max values
+    *size_work1 = std::max({w1, w2, w3, w4});
+    *size_work2 = std::max({a1, a2, a3, a4});
+    *size_work3 = std::max(t1, t2);
+
+    // size of arrays for the tridiagonal matrix
+    *size_D_E = sizeof(S) * 2 * n * batch_count;
+
+    // size of arrays for the block indices and split points
+    *size_iblock_isplit = sizeof(rocblas_int) * 2 * n * batch_count;
+
+    // size of array for temporary householder scalars
+    *size_tau = sizeof(T) * n * batch_count;
+
+    // size of array for the number of blocks, or of array of pointers (only for batched case)
+    *size_nsplit_workArr = std::max({r1, r2, sizeof(rocblas_int) * batch_count});
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_erange erange,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              const S vl,
+                                              const S vu,
+                                              const rocblas_int il,
+                                              const rocblas_int iu,
+                                              const S abstol,
+                                              rocblas_int* nev,
+                                              S* W,
+                                              const rocblas_stride strideW,
+                                              U Z,
+                                              const rocblas_int shiftZ,
+                                              const rocblas_int ldz,
+                                              const rocblas_stride strideZ,
+                                              rocblas_int* ifail,
+                                              const rocblas_stride strideF,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* scalars,
+                                              void* work1,
+                                              void* work2,
+                                              void* work3,
+                                              S* D_E,
+                                              rocblas_int* iblock_isplit,
+                                              T* tau,
+                                              void* nsplit_workArr)
+{
+    ROCSOLVER_ENTER("syevx_heevx", "evect:", evect, "erange:", erange, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "vl:", vl, "vu:", vu, "il:", il, "iu:", iu,
+                    "abstol:", abstol, "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info = 0
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+    {
+        // nev = 0
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nev, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // workspace arrays
+    S* D = D_E;
+    S* E = D_E + n * batch_count;
+    rocblas_int* iblock = iblock_isplit;
+    rocblas_int* isplit = iblock_isplit + n * batch_count;
+    rocblas_int* nsplit = (rocblas_int*)nsplit_workArr;
+    rocblas_stride strideD = n;
+
+    // reduce A to tridiagonal form
+    if(n == 1)
+        hipLaunchKernelGGL(scalar_case<T>, gridReset, threads, 0, stream, rocblas_evect_none, A,
+                           strideA, D, strideD, batch_count);
+    else
+        rocsolver_sytrd_hetrd_template(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E,
+                                       strideD, tau, n, batch_count, scalars, (T*)work1, (T*)work2,
+                                       (T*)work3, (T**)nsplit_workArr);
+
+    // compute the selected eigenvalues (grouped by blocks if eigenvectors are required)
+    rocblas_eorder eorder
+        = (evect == rocblas_evect_original ? rocblas_eorder_blocks : rocblas_eorder_entire);
+    rocsolver_stebz_template<S>(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, 0, strideD, E,
+                                0, strideD, nev, nsplit, W, strideW, iblock, strideD, isplit,
+                                strideD, info, batch_count, (S*)work1, (rocblas_int*)work2);
+
+    if(evect == rocblas_evect_original)
+    {
+        // compute the eigenvectors of the tridiagonal matrix
+        rocsolver_stein_template<T>(handle, n, D, 0, strideD, E, 0, strideD, nev, W, 0, strideW,
+                                    iblock, strideD, isplit, strideD, Z, shiftZ, ldz, strideZ,
+                                    ifail, strideF, info, batch_count, (S*)work1,
+                                    (rocblas_int*)work2);
+
+        // back-transform only the selected eigenvectors (the number of columns is known in
+        // advance only when the eigenvalues are selected by index)
+        rocblas_int ncols = (erange == rocblas_erange_index ? iu - il + 1 : n);
+        if(n > 1)
+            rocsolver_ormtr_unmtr_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, n, ncols, A, shiftA, lda,
+                strideA, tau, n, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1,
+                (T*)work2, (T*)work3, (T**)nsplit_workArr);
+
+        // sort eigenvalues and eigenvectors in increasing order
+        hipLaunchKernelGGL((syevx_sort_vectors<T>), dim3(1, batch_count), threads, 0, stream, n,
+                           nev, W, strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info);
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,304 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_sygst_hegst.hpp"
+#include "roclapack_syevx_heevx.hpp"
+#include "rocsolver.h"
+
+/** SYGVX_UPDATE_INFO combines the info from POTRF with the info from SYEVX/HEEVX.
+    No eigenvalues are returned if B is not positive definite **/
+template <typename T>
+__global__ void
+    sygvx_update_info(T* info, T* iinfo, T* nev, const rocblas_int n, const rocblas_int bc)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < bc)
+    {
+        if(info[b] != 0)
+        {
+            info[b] += n;
+            nev[b] = 0;
+        }
+        else
+            info[b] = iinfo[b];
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_sygvx_hegvx_getMemorySize(const rocblas_eform itype,
+                                         const rocblas_evect evect,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work1,
+                                         size_t* size_work2,
+                                         size_t* size_work3,
+                                         size_t* size_work4,
+                                         size_t* size_D_E,
+                                         size_t* size_iblock_isplit,
+                                         size_t* size_tau,
+                                         size_t* size_pivots_workArr,
+                                         size_t* size_iinfo)
+{
+    // if quick return no need of workspace
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_D_E = 0;
+        *size_iblock_isplit = 0;
+        *size_tau = 0;
+        *size_pivots_workArr = 0;
+        *size_iinfo = 0;
+        return;
+    }
+
+    size_t unused, temp1, temp2, temp3, temp4, temp5;
+
+    // requirements for calling POTRF
+    rocsolver_potrf_getMemorySize<BATCHED, T>(n, uplo, batch_count, size_scalars, size_work1,
+                                              size_work2, size_work3, size_work4,
+                                              size_pivots_workArr, size_iinfo);
+    *size_iinfo = max(*size_iinfo, sizeof(rocblas_int) * batch_count);
+
+    // requirements for calling SYGST/HEGST
+    rocsolver_sygst_hegst_getMemorySize<T, BATCHED>(itype, n, batch_count, &unused, &temp1, &temp2,
+                                                    &temp3, &temp4);
+    *size_work1 = max(*size_work1, temp1);
+    *size_work2 = max(*size_work2, temp2);
+    *size_work3 = max(*size_work3, temp3);
+    *size_work4 = max(*size_work4, temp4);
+
+    // requirements for calling SYEVX/HEEVX
+    rocsolver_syevx_heevx_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, &unused,
+                                                       &temp1, &temp2, &temp3, size_D_E,
+                                                       size_iblock_isplit, size_tau, &temp5);
+    *size_work1 = max(*size_work1, temp1);
+    *size_work2 = max(*size_work2, temp2);
+    *size_work3 = max(*size_work3, temp3);
+    *size_pivots_workArr = max(*size_pivots_workArr, temp5);
+
+    if(evect == rocblas_evect_original)
+    {
+        if(itype == rocblas_eform_ax || itype == rocblas_eform_abx)
+        {
+            // requirements for calling TRSM
+            rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, n, n, batch_count, &temp1, &temp2,
+                                             &temp3, &temp4);
+            *size_work1 = max(*size_work1, temp1);
+            *size_work2 = max(*size_work2, temp2);
+            *size_work3 = max(*size_work3, temp3);
+            *size_work4 = max(*size_work4, temp4);
+        }
+    }
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_sygvx_hegvx_argCheck(rocblas_handle handle,
+                                              const rocblas_eform itype,
+                                              const rocblas_evect evect,
+                                              const rocblas_erange erange,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T A,
+                                              const rocblas_int lda,
+                                              T B,
+                                              const rocblas_int ldb,
+                                              const S vl,
+                                              const S vu,
+                                              const rocblas_int il,
+                                              const rocblas_int iu,
+                                              rocblas_int* nev,
+                                              S* W,
+                                              T Z,
+                                              const rocblas_int ldz,
+                                              rocblas_int* ifail,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(itype != rocblas_eform_ax && itype != rocblas_eform_abx && itype != rocblas_eform_bax)
+        return rocblas_status_invalid_value;
+    if(evect != rocblas_evect_none && evect != rocblas_evect_original)
+        return rocblas_status_invalid_value;
+    if(erange != rocblas_erange_all && erange != rocblas_erange_value
+       && erange != rocblas_erange_index)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(evect == rocblas_evect_original && ldz < n)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_value && vl >= vu)
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (il < 1 || iu < 0))
+        return rocblas_status_invalid_size;
+    if(erange == rocblas_erange_index && (iu > n || (n > 0 && il > iu)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !B) || (n && !W) || (batch_count && !nev) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if(evect == rocblas_evect_original && ((n && !Z) || (n && !ifail)))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_sygvx_hegvx_template(rocblas_handle handle,
+                                              const rocblas_eform itype,
+                                              const rocblas_evect evect,
+                                              const rocblas_erange erange,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              U B,
+                                              const rocblas_int shiftB,
+                                              const rocblas_int ldb,
+                                              const rocblas_stride strideB,
+                                              const S vl,
+                                              const S vu,
+                                              const rocblas_int il,
+                                              const rocblas_int iu,
+                                              const S abstol,
+                                              rocblas_int* nev,
+                                              S* W,
+                                              const rocblas_stride strideW,
+                                              U Z,
+                                              const rocblas_int shiftZ,
+                                              const rocblas_int ldz,
+                                              const rocblas_stride strideZ,
+                                              rocblas_int* ifail,
+                                              const rocblas_stride strideF,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* scalars,
+                                              void* work1,
+                                              void* work2,
+                                              void* work3,
+                                              void* work4,
+                                              S* D_E,
+                                              rocblas_int* iblock_isplit,
+                                              T* tau,
+                                              void* pivots_workArr,
+                                              rocblas_int* iinfo,
+                                              bool optim_mem)
+{
+    ROCSOLVER_ENTER("sygvx_hegvx", "itype:", itype, "evect:", evect, "erange:", erange,
+                    "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB,
+                    "ldb:", ldb, "vl:", vl, "vu:", vu, "il:", il, "iu:", iu, "abstol:", abstol,
+                    "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 (starting with no errors)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+    {
+        // nev = 0
+        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, nev, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T one = 1;
+
+    // perform Cholesky factorization of B
+    rocsolver_potrf_template<BATCHED, S, T>(handle, uplo, n, B, shiftB, ldb, strideB, info,
+                                            batch_count, scalars, work1, work2, work3, work4,
+                                            (T*)pivots_workArr, iinfo, optim_mem);
+
+    /** (TODO: Strictly speaking, computations should stop here is B is not positive definite.
+        A should not be modified in this case as no eigenvalues or eigenvectors can be computed.
+        Need to find a way to do this efficiently; for now A will be destroyed in the non
+        positive-definite case) **/
+
+    // reduce to standard eigenvalue problem and solve
+    rocsolver_sygst_hegst_template<BATCHED, STRIDED, S, T>(
+        handle, itype, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
+        scalars, work1, work2, work3, work4, optim_mem);
+
+    rocsolver_syevx_heevx_template<BATCHED, STRIDED, T>(
+        handle, evect, erange, uplo, n, A, shiftA, lda, strideA, vl, vu, il, iu, abstol, nev, W,
+        strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, iinfo, batch_count, scalars, work1,
+        work2, work3, D_E, iblock_isplit, tau, pivots_workArr);
+
+    // combine info from POTRF with info from SYEVX/HEEVX
+    hipLaunchKernelGGL(sygvx_update_info, gridReset, threads, 0, stream, info, iinfo, nev, n,
+                       batch_count);
+
+    // backtransform the selected eigenvectors (the number of columns is known in advance only
+    // when the eigenvalues are selected by index)
+    if(evect == rocblas_evect_original)
+    {
+        rocblas_int ncols = (erange == rocblas_erange_index ? iu - il + 1 : n);
+
+        if(itype == rocblas_eform_ax || itype == rocblas_eform_abx)
+        {
+            rocblas_operation trans
+                = (uplo == rocblas_fill_upper ? rocblas_operation_none
+                                              : rocblas_operation_conjugate_transpose);
+            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo, trans,
+                                         rocblas_diagonal_non_unit, n, ncols, &one, B, shiftB, ldb,
+                                         strideB, Z, shiftZ, ldz, strideZ, batch_count, optim_mem,
+                                         work1, work2, work3, work4);
+        }
+        else
+        {
+            rocblas_operation trans
+                = (uplo == rocblas_fill_upper ? rocblas_operation_conjugate_transpose
+                                              : rocblas_operation_none);
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, trans, rocblas_diagonal_non_unit, n, ncols, &one,
+                0, B, shiftB, ldb, strideB, Z, shiftZ, ldz, strideZ, batch_count,
+                (T**)pivots_workArr);
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sysv.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_sysv_impl(rocblas_handle handle,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   U A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   U B,
+                                   const rocblas_int ldb,
+                                   rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("sysv", "--uplo", uplo, "-m", n, "-n", nrhs, "--lda", lda, "--ldb", ldb);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sysv_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the workspaces for the panel factorizations and trailing updates
+    size_t size_work;
+    // size of the first non-factorized column of each matrix
+    size_t size_kk;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_sysv_getMemorySize<false, T>(n, nrhs, batch_count, &size_work, &size_kk,
+                                           &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_kk, size_workArr);
+
+    // memory workspace allocation
+    void *work, *kk, *workArr;
+    rocblas_device_malloc mem(handle, size_work, size_kk, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    kk = mem[1];
+    workArr = mem[2];
+
+    // execution
+    return rocsolver_sysv_template<false, T, S>(
+        handle, uplo, false, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb,
+        strideB, info, batch_count, (T*)work, (rocblas_int*)kk, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssysv(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               float* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               float* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_sysv_impl<float>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+rocblas_status rocsolver_dsysv(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               double* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               double* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_sysv_impl<double>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+rocblas_status rocsolver_csysv(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               rocblas_float_complex* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               rocblas_float_complex* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_sysv_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                                                      info);
+}
+
+rocblas_status rocsolver_zsysv(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               rocblas_double_complex* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               rocblas_double_complex* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_sysv_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                                                       info);
+}
+
+} // extern C
@@ -0,0 +1,111 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_sytrf.hpp"
+#include "roclapack_sytrs.hpp"
+#include "rocsolver.h"
+
+template <typename T>
+rocblas_status rocsolver_sysv_argCheck(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int lda,
+                                       const rocblas_int ldb,
+                                       T A,
+                                       T B,
+                                       const rocblas_int* ipiv,
+                                       const rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs * n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_sysv_getMemorySize(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_int batch_count,
+                                  size_t* size_work,
+                                  size_t* size_kk,
+                                  size_t* size_workArr)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        *size_kk = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // workspace required for calling SYTRF (SYTRS needs no workspace)
+    rocsolver_sytrf_getMemorySize<BATCHED, T>(n, batch_count, size_work, size_kk, size_workArr);
+}
+
+template <bool BATCHED, typename T, typename S, typename U>
+rocblas_status rocsolver_sysv_template(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const bool herm,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       rocblas_int* ipiv,
+                                       const rocblas_stride strideP,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* work,
+                                       rocblas_int* kk,
+                                       T** workArr)
+{
+    ROCSOLVER_ENTER(herm ? "hesv" : "sysv", "uplo:", uplo, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // compute the factorization (this also initializes info)
+    rocsolver_sytrf_template<BATCHED, T, S>(handle, uplo, herm, n, A, shiftA, lda, strideA,
+                                            ipiv, strideP, info, batch_count, work, kk, workArr);
+
+    // solve the system, skipping the singular matrices in the batch
+    rocsolver_sytrs_template<T>(handle, uplo, herm, n, nrhs, A, shiftA, lda, strideA, ipiv,
+                                strideP, B, shiftB, ldb, strideB, batch_count, info);
+
+    return rocblas_status_success;
+}
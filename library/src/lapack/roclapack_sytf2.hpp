@@ -0,0 +1,817 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    The symmetric indefinite factorizations work on the lower triangle of
+ *    B = J*A*J when uplo is upper (where J is the exchange matrix that reverses
+ *    the order of the rows), or on the lower triangle of B = A otherwise.
+ *    Element (i,j) of B is then stored in Bp[i * incr + j * incc], and the upper
+ *    case reduces to the lower one with the same pivoting strategy (the
+ *    diagonal blocks of the factorization are processed in the order LAPACK
+ *    would process them). Indices in B are mapped back to the ipiv and info
+ *    arrays following the conventions of LAPACK.
+ *    The same code computes the factorizations of complex Hermitian matrices
+ *    (HETF2 and HETRF) when herm is true. In that case the elements of B above
+ *    the diagonal are the conjugates of those below it, the diagonal of B is
+ *    real (its imaginary part is ignored on input and set to zero on output),
+ *    and the transposes become conjugate transposes.
+ * ===========================================================================
+ */
+
+#define SYTF2_ALPHA(S) ((S(1) + sqrt(S(17))) / S(8))
+
+/** SYTF2_PIVPOS returns the position in ipiv of the index k of B **/
+__device__ inline rocblas_int
+    sytf2_pivpos(const bool upper, const rocblas_int n, const rocblas_int k)
+{
+    return upper ? n - 1 - k : k;
+}
+
+/** SYTF2_PIVVAL returns the (1-based) row of A corresponding to the row p of B **/
+__device__ inline rocblas_int
+    sytf2_pivval(const bool upper, const rocblas_int n, const rocblas_int p)
+{
+    return upper ? n - p : p + 1;
+}
+
+/** SYTF2_BETTER returns true if the candidate (val1, idx1) must be selected as pivot
+    over (val2, idx2). Ties are resolved in favor of the first index in the order
+    of the rows of A, as in LAPACK. **/
+template <typename S>
+__device__ inline bool sytf2_better(const bool upper,
+                                    const S val1,
+                                    const rocblas_int idx1,
+                                    const S val2,
+                                    const rocblas_int idx2)
+{
+    return val1 > val2 || (val1 == val2 && (upper ? idx1 > idx2 : idx1 < idx2));
+}
+
+/** SYTF2_IAMAX_REDUCE reduces the candidates (val, idx) of all the threads in the
+    group. The result is left in sval[0] and sidx[0]. **/
+template <typename S>
+__device__ void sytf2_iamax_reduce(const rocblas_int tid,
+                                   const bool upper,
+                                   const S val,
+                                   const rocblas_int idx,
+                                   S* sval,
+                                   rocblas_int* sidx)
+{
+    sval[tid] = val;
+    sidx[tid] = idx;
+    __syncthreads();
+
+    for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+    {
+        if(tid < s && sytf2_better(upper, sval[tid + s], sidx[tid + s], sval[tid], sidx[tid]))
+        {
+            sval[tid] = sval[tid + s];
+            sidx[tid] = sidx[tid + s];
+        }
+        __syncthreads();
+    }
+}
+
+/** SYTF2_CONJ returns the conjugate of x when the matrix is Hermitian, and x
+    otherwise **/
+template <typename T>
+__device__ inline T sytf2_conj(const bool herm, const T x)
+{
+    return herm ? sconj(x) : x;
+}
+
+/** SYTF2_DIAG returns the diagonal element x of the matrix, which only has a
+    real part when the matrix is Hermitian **/
+template <typename T>
+__device__ inline T sytf2_diag(const bool herm, const T x)
+{
+    return herm ? T(std::real(x)) : x;
+}
+
+/** SYTF2_PIVOT2 computes the coefficients of the inverse of the 2-by-2 pivot with
+    elements b00, b10 and b11 (lower triangle), so that row j of the columns of L is
+    given by d * (d11 * x0 - d21 * x1) and d * (d22 * x1 - conj(d21) * x0), where
+    (x0, x1) is row j of the columns of L*D **/
+template <typename T>
+__device__ inline void sytf2_pivot2(const bool herm,
+                                    const T b00,
+                                    const T b10,
+                                    const T b11,
+                                    T& d11,
+                                    T& d21,
+                                    T& d22,
+                                    T& d)
+{
+    using S = decltype(std::real(T{}));
+
+    if(herm)
+    {
+        S t = std::abs(b10);
+        S r11 = std::real(b11) / t;
+        S r22 = std::real(b00) / t;
+        d11 = r11;
+        d22 = r22;
+        d21 = b10 / t;
+        d = (S(1) / (r11 * r22 - S(1))) / t;
+    }
+    else
+    {
+        d11 = b11 / b10;
+        d22 = b00 / b10;
+        d21 = 1;
+        d = (T(1) / (d11 * d22 - T(1))) / b10;
+    }
+}
+
+/** SYTF2_DEVICE computes the Bunch-Kaufman factorization of the n-by-n symmetric
+    matrix B stored in Bp, using rank-1 and rank-2 updates of the trailing matrix
+    (right-looking algorithm). All the threads in the group collaborate, distributing
+    the rows of the trailing matrix. **/
+template <typename T, typename S>
+__device__ void sytf2_device(const rocblas_int tid,
+                             const bool upper,
+                             const bool herm,
+                             const rocblas_int n,
+                             T* Bp,
+                             const rocblas_int incr,
+                             const rocblas_int incc,
+                             rocblas_int* ipiv,
+                             rocblas_int* info,
+                             S* sval,
+                             rocblas_int* sidx)
+{
+    const S alpha = SYTF2_ALPHA(S);
+
+    rocblas_int k = 0;
+    rocblas_int kstep, kk, kp, imax, idx;
+    S absakk, colmax, rowmax, val, t;
+    T r1, d, d11, d21, d22, wk, wkp1, temp;
+
+    while(k < n)
+    {
+        kstep = 1;
+        absakk = aabs<S>(sytf2_diag(herm, Bp[k * incr + k * incc]));
+
+        // largest off-diagonal element in column k
+        val = -1;
+        idx = -1;
+        for(rocblas_int i = k + 1 + tid; i < n; i += BLOCKSIZE)
+        {
+            t = aabs<S>(Bp[i * incr + k * incc]);
+            if(sytf2_better(upper, t, i, val, idx))
+            {
+                val = t;
+                idx = i;
+            }
+        }
+        sytf2_iamax_reduce(tid, upper, val, idx, sval, sidx);
+        imax = sidx[0];
+        colmax = (k < n - 1) ? sval[0] : 0;
+        __syncthreads();
+
+        if(max(absakk, colmax) == 0)
+        {
+            // column k is zero: D(k,k) is exactly zero
+            if(tid == 0 && *info == 0)
+                *info = upper ? n - k : k + 1;
+            kp = k;
+        }
+        else
+        {
+            if(absakk >= alpha * colmax)
+                kp = k;
+            else
+            {
+                // largest off-diagonal element in row/column imax
+                val = -1;
+                idx = -1;
+                for(rocblas_int j = k + tid; j < n; j += BLOCKSIZE)
+                {
+                    if(j == imax)
+                        continue;
+                    t = aabs<S>(j < imax ? Bp[imax * incr + j * incc] : Bp[j * incr + imax * incc]);
+                    if(sytf2_better(upper, t, j, val, idx))
+                    {
+                        val = t;
+                        idx = j;
+                    }
+                }
+                sytf2_iamax_reduce(tid, upper, val, idx, sval, sidx);
+                rowmax = sval[0];
+
+                if(absakk >= alpha * colmax * (colmax / rowmax))
+                    kp = k;
+                else if(aabs<S>(sytf2_diag(herm, Bp[imax * incr + imax * incc])) >= alpha * rowmax)
+                    kp = imax;
+                else
+                {
+                    kp = imax;
+                    kstep = 2;
+                }
+            }
+            __syncthreads();
+
+            // interchange rows and columns kk and kp in the trailing matrix
+            kk = k + kstep - 1;
+            if(kp != kk)
+            {
+                for(rocblas_int i = kp + 1 + tid; i < n; i += BLOCKSIZE)
+                {
+                    temp = Bp[i * incr + kk * incc];
+                    Bp[i * incr + kk * incc] = Bp[i * incr + kp * incc];
+                    Bp[i * incr + kp * incc] = temp;
+                }
+                for(rocblas_int j = kk + 1 + tid; j < kp; j += BLOCKSIZE)
+                {
+                    temp = sytf2_conj(herm, Bp[j * incr + kk * incc]);
+                    Bp[j * incr + kk * incc] = sytf2_conj(herm, Bp[kp * incr + j * incc]);
+                    Bp[kp * incr + j * incc] = temp;
+                }
+                if(tid == 0)
+                {
+                    Bp[kp * incr + kk * incc] = sytf2_conj(herm, Bp[kp * incr + kk * incc]);
+                    temp = Bp[kk * incr + kk * incc];
+                    Bp[kk * incr + kk * incc] = Bp[kp * incr + kp * incc];
+                    Bp[kp * incr + kp * incc] = temp;
+                    if(kstep == 2)
+                    {
+                        temp = Bp[(k + 1) * incr + k * incc];
+                        Bp[(k + 1) * incr + k * incc] = Bp[kp * incr + k * incc];
+                        Bp[kp * incr + k * incc] = temp;
+                    }
+                }
+                __syncthreads();
+            }
+
+            // update the trailing matrix
+            // (every thread works on its own rows)
+            if(kstep == 1)
+            {
+                // rank-1 update with the column of L times D(k,k)
+                r1 = T(1) / sytf2_diag(herm, Bp[k * incr + k * incc]);
+                for(rocblas_int i = k + 1 + tid; i < n; i += BLOCKSIZE)
+                {
+                    temp = r1 * Bp[i * incr + k * incc];
+                    for(rocblas_int j = k + 1; j <= i; ++j)
+                        Bp[i * incr + j * incc] -= temp * sytf2_conj(herm, Bp[j * incr + k * incc]);
+                }
+                __syncthreads();
+
+                for(rocblas_int i = k + 1 + tid; i < n; i += BLOCKSIZE)
+                    Bp[i * incr + k * incc] *= r1;
+            }
+            else if(k < n - 2)
+            {
+                // rank-2 update with the columns of L times D(k:k+1,k:k+1)
+                sytf2_pivot2(herm, Bp[k * incr + k * incc], Bp[(k + 1) * incr + k * incc],
+                             Bp[(k + 1) * incr + (k + 1) * incc], d11, d21, d22, d);
+                for(rocblas_int i = k + 2 + tid; i < n; i += BLOCKSIZE)
+                {
+                    for(rocblas_int j = k + 2; j <= i; ++j)
+                    {
+                        wk = d
+                            * (d11 * Bp[j * incr + k * incc] - d21 * Bp[j * incr + (k + 1) * incc]);
+                        wkp1 = d
+                            * (d22 * Bp[j * incr + (k + 1) * incc]
+                               - sytf2_conj(herm, d21) * Bp[j * incr + k * incc]);
+                        Bp[i * incr + j * incc] -= Bp[i * incr + k * incc] * sytf2_conj(herm, wk)
+                            + Bp[i * incr + (k + 1) * incc] * sytf2_conj(herm, wkp1);
+                    }
+                }
+                __syncthreads();
+
+                for(rocblas_int i = k + 2 + tid; i < n; i += BLOCKSIZE)
+                {
+                    wk = d * (d11 * Bp[i * incr + k * incc] - d21 * Bp[i * incr + (k + 1) * incc]);
+                    wkp1 = d
+                        * (d22 * Bp[i * incr + (k + 1) * incc]
+                           - sytf2_conj(herm, d21) * Bp[i * incr + k * incc]);
+                    Bp[i * incr + k * incc] = wk;
+                    Bp[i * incr + (k + 1) * incc] = wkp1;
+                }
+            }
+            __syncthreads();
+        }
+
+        // store the interchanges (and the real diagonal of D)
+        if(tid == 0)
+        {
+            Bp[k * incr + k * incc] = sytf2_diag(herm, Bp[k * incr + k * incc]);
+            if(kstep == 1)
+                ipiv[sytf2_pivpos(upper, n, k)] = sytf2_pivval(upper, n, kp);
+            else
+            {
+                Bp[(k + 1) * incr + (k + 1) * incc]
+                    = sytf2_diag(herm, Bp[(k + 1) * incr + (k + 1) * incc]);
+                ipiv[sytf2_pivpos(upper, n, k)] = -sytf2_pivval(upper, n, kp);
+                ipiv[sytf2_pivpos(upper, n, k + 1)] = -sytf2_pivval(upper, n, kp);
+            }
+        }
+        k += kstep;
+    }
+}
+
+/** SYTF2_KERNEL computes the unblocked Bunch-Kaufman factorization of every matrix
+    in the batch.
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) sytf2_kernel(const rocblas_fill uplo,
+                                                          const bool herm,
+                                                          const rocblas_int n,
+                                                          U AA,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipivA,
+                                                          const rocblas_stride strideP,
+                                                          rocblas_int* infoA)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + b * strideP;
+    rocblas_int* info = infoA + b;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // lower triangle of B = J*A*J (upper) or B = A (lower)
+    T* Bp = upper ? A + (n - 1) + (n - 1) * lda : A;
+    const rocblas_int incr = upper ? -1 : 1;
+    const rocblas_int incc = upper ? -lda : lda;
+
+    // shared memory for the reductions
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+
+    sytf2_device<T>(tid, upper, herm, n, Bp, incr, incc, ipiv, info, sval, sidx);
+}
+
+/** SYTF2_KERNEL_SMALL computes the Bunch-Kaufman factorization of an n-by-n
+    symmetric or Hermitian matrix (n <= DIM) using register arrays. Thread i keeps row i of the
+    lower triangle of B in rA; the columns and rows needed to choose the pivots and
+    to update the trailing matrix are shared through LDS, and every thread repeats
+    the pivot search so that no reduction is needed.
+    Call this kernel with batch_count groups in x, and DIM threads. **/
+template <rocblas_int DIM, typename T, typename S, typename U>
+__global__ void __launch_bounds__(WAVESIZE) sytf2_kernel_small(const rocblas_fill uplo,
+                                                               const bool herm,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               rocblas_int* ipivA,
+                                                               const rocblas_stride strideP,
+                                                               rocblas_int* infoA)
+{
+    const auto b = hipBlockIdx_x;
+    const rocblas_int i = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + b * strideP;
+    rocblas_int* info = infoA + b;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // lower triangle of B = J*A*J (upper) or B = A (lower)
+    T* Bp = upper ? A + (n - 1) + (n - 1) * lda : A;
+    const rocblas_int incr = upper ? -1 : 1;
+    const rocblas_int incc = upper ? -lda : lda;
+
+    // shared memory (for communication between threads in group)
+    __shared__ T col[DIM];
+    __shared__ T col2[DIM];
+    __shared__ T row[DIM];
+
+    // read row i of the lower triangle of B into the local array
+    T rA[DIM];
+#pragma unroll
+    for(rocblas_int j = 0; j < DIM; j++)
+        rA[j] = (i < n && j <= i) ? Bp[i * incr + j * incc] : 0;
+
+    const S alpha = SYTF2_ALPHA(S);
+
+    rocblas_int k = 0;
+    rocblas_int kstep, kk, kp, imax, idx;
+    S absakk, colmax, rowmax, val, t;
+    T r1, d, d11, d21, d22, wk, wkp1, aik, aik1;
+
+    while(k < n)
+    {
+        // share column k
+        if(i >= k && i < n)
+        {
+#pragma unroll
+            for(rocblas_int j = 0; j < DIM; j++)
+            {
+                if(j == k)
+                    col[i] = rA[j];
+            }
+        }
+        __syncthreads();
+
+        kstep = 1;
+        absakk = aabs<S>(sytf2_diag(herm, col[k]));
+
+        // largest off-diagonal element in column k
+        val = -1;
+        idx = -1;
+        for(rocblas_int l = k + 1; l < n; l++)
+        {
+            t = aabs<S>(col[l]);
+            if(sytf2_better(upper, t, l, val, idx))
+            {
+                val = t;
+                idx = l;
+            }
+        }
+        imax = idx;
+        colmax = (k < n - 1) ? val : 0;
+
+        if(max(absakk, colmax) == 0)
+        {
+            // column k is zero: D(k,k) is exactly zero
+            if(i == 0 && *info == 0)
+                *info = upper ? n - k : k + 1;
+            kp = k;
+        }
+        else
+        {
+            if(absakk >= alpha * colmax)
+                kp = k;
+            else
+            {
+                // share row/column imax (the elements of the lower triangle to the left
+                // of the diagonal are kept by thread imax, and the others by the threads
+                // of the corresponding rows)
+                if(i == imax)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j >= k && j <= imax)
+                            row[j] = rA[j];
+                    }
+                }
+                if(i > imax && i < n)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == imax)
+                            row[i] = rA[j];
+                    }
+                }
+                __syncthreads();
+
+                // largest off-diagonal element in row/column imax
+                val = -1;
+                idx = -1;
+                for(rocblas_int l = k; l < n; l++)
+                {
+                    if(l == imax)
+                        continue;
+                    t = aabs<S>(row[l]);
+                    if(sytf2_better(upper, t, l, val, idx))
+                    {
+                        val = t;
+                        idx = l;
+                    }
+                }
+                rowmax = val;
+
+                if(absakk >= alpha * colmax * (colmax / rowmax))
+                    kp = k;
+                else if(aabs<S>(sytf2_diag(herm, row[imax])) >= alpha * rowmax)
+                    kp = imax;
+                else
+                {
+                    kp = imax;
+                    kstep = 2;
+                }
+            }
+            __syncthreads();
+
+            // interchange rows and columns kk and kp in the trailing matrix
+            kk = k + kstep - 1;
+            if(kp != kk)
+            {
+                // share the elements that move to another thread
+                if(i == kp)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j >= k && j <= kp)
+                            row[j] = rA[j];
+                    }
+                }
+                if(i == kk)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j >= k && j <= kk)
+                            col2[j] = rA[j];
+                    }
+                }
+                if(i > kk && i < kp)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == kk)
+                            col2[i] = rA[j];
+                    }
+                }
+                __syncthreads();
+
+                if(i > kp && i < n)
+                {
+                    // swap elements in columns kk and kp
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == kk)
+                            aik = rA[j];
+                        if(j == kp)
+                            aik1 = rA[j];
+                    }
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == kk)
+                            rA[j] = aik1;
+                        if(j == kp)
+                            rA[j] = aik;
+                    }
+                }
+                if(i > kk && i < kp)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == kk)
+                            rA[j] = sytf2_conj(herm, row[i]);
+                    }
+                }
+                if(i == kp)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j > kk && j < kp)
+                            rA[j] = sytf2_conj(herm, col2[j]);
+                        if(j == kk)
+                            rA[j] = sytf2_conj(herm, rA[j]);
+                        if(j == kp)
+                            rA[j] = col2[kk];
+                        if(j == k && kstep == 2)
+                            rA[j] = col2[k];
+                    }
+                }
+                if(i == kk)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == kk)
+                            rA[j] = row[kp];
+                        if(j == k && kstep == 2)
+                            rA[j] = row[k];
+                    }
+                }
+                __syncthreads();
+            }
+
+            // share columns k and k+1 of the trailing matrix
+            if(i >= k && i < n)
+            {
+#pragma unroll
+                for(rocblas_int j = 0; j < DIM; j++)
+                {
+                    if(j == k)
+                        col[i] = rA[j];
+                    if(j == k + 1)
+                        col2[i] = rA[j];
+                }
+            }
+            __syncthreads();
+
+            // update the trailing matrix
+            // (every thread works on its own row)
+            if(kstep == 1)
+            {
+                // rank-1 update with the column of L times D(k,k)
+                r1 = T(1) / sytf2_diag(herm, col[k]);
+                if(i > k && i < n)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == k)
+                            aik = r1 * rA[j];
+                    }
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j > k && j <= i)
+                            rA[j] -= aik * sytf2_conj(herm, col[j]);
+                        if(j == k)
+                            rA[j] = aik;
+                    }
+                }
+            }
+            else if(k < n - 2)
+            {
+                // rank-2 update with the columns of L times D(k:k+1,k:k+1)
+                sytf2_pivot2(herm, col[k], col[k + 1], col2[k + 1], d11, d21, d22, d);
+                if(i > k + 1 && i < n)
+                {
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j == k)
+                            aik = rA[j];
+                        if(j == k + 1)
+                            aik1 = rA[j];
+                    }
+#pragma unroll
+                    for(rocblas_int j = 0; j < DIM; j++)
+                    {
+                        if(j > k + 1 && j <= i)
+                        {
+                            wk = d * (d11 * col[j] - d21 * col2[j]);
+                            wkp1 = d * (d22 * col2[j] - sytf2_conj(herm, d21) * col[j]);
+                            rA[j] -= aik * sytf2_conj(herm, wk) + aik1 * sytf2_conj(herm, wkp1);
+                        }
+                        if(j == k)
+                            rA[j] = d * (d11 * aik - d21 * aik1);
+                        if(j == k + 1)
+                            rA[j] = d * (d22 * aik1 - sytf2_conj(herm, d21) * aik);
+                    }
+                }
+            }
+        }
+        __syncthreads();
+
+        // store the interchanges
+        if(i == 0)
+        {
+            if(kstep == 1)
+                ipiv[sytf2_pivpos(upper, n, k)] = sytf2_pivval(upper, n, kp);
+            else
+            {
+                ipiv[sytf2_pivpos(upper, n, k)] = -sytf2_pivval(upper, n, kp);
+                ipiv[sytf2_pivpos(upper, n, k + 1)] = -sytf2_pivval(upper, n, kp);
+            }
+        }
+        k += kstep;
+    }
+
+    // write results to global memory (with the real diagonal of D)
+    if(i < n)
+    {
+#pragma unroll
+        for(rocblas_int j = 0; j < DIM; j++)
+        {
+            if(j < i)
+                Bp[i * incr + j * incc] = rA[j];
+            if(j == i)
+                Bp[i * incr + j * incc] = sytf2_diag(herm, rA[j]);
+        }
+    }
+}
+
+template <typename T, typename S, typename U>
+void sytf2_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const bool herm,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* ipiv,
+                     const rocblas_stride strideP,
+                     rocblas_int* info,
+                     const rocblas_int batch_count)
+{
+#define RUN_SYTF2_SMALL(DIM)                                                                      \
+    hipLaunchKernelGGL((sytf2_kernel_small<DIM, T, S>), grid, block, 0, stream, uplo, herm, n, A, \
+                       shiftA, lda, strideA, ipiv, strideP, info)
+
+    rocblas_int dim = tri_small_dim(n);
+    dim3 grid(batch_count, 1, 1);
+    dim3 block(dim, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size of the register arrays known at
+    // compile time
+    switch(dim)
+    {
+    case 8: RUN_SYTF2_SMALL(8); break;
+    case 16: RUN_SYTF2_SMALL(16); break;
+    case 32: RUN_SYTF2_SMALL(32); break;
+    case 64: RUN_SYTF2_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_sytf2_sytrf_argCheck(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              const rocblas_int lda,
+                                              T A,
+                                              rocblas_int* ipiv,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sytf2_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const bool herm,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER(herm ? "hetf2" : "sytf2", "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // small matrices are factorized in registers
+    if(n <= SYTF2_SWITCHSIZE)
+    {
+        sytf2_run_small<T, S>(handle, uplo, herm, n, A, shiftA, lda, strideA, ipiv, strideP,
+                              info, batch_count);
+        return rocblas_status_success;
+    }
+
+    // the choice of every pivot depends on all the previous steps, so every matrix
+    // in the batch is factorized by a single group of threads
+    hipLaunchKernelGGL(sytf2_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, uplo,
+                       herm, n, A, shiftA, lda, strideA, ipiv, strideP, info);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,445 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_sytf2.hpp"
+#include "rocsolver.h"
+
+/** LASYF_KERNEL factorizes a panel of at most nb-1 columns (or all the remaining columns
+    if they are at most nb) of the trailing matrix of every matrix in the batch, starting
+    at column kk, using the Bunch-Kaufman pivoting strategy (see roclapack_sytf2.hpp for
+    the notation). As in LAPACK, the columns of the panel are updated on the fly and the
+    products L*D are accumulated in W, so that the rest of the trailing matrix can be updated
+    later as A22 = A22 - L21*W21'.
+    As the number of factorized columns depends on the pivots of each matrix (a 2-by-2 pivot
+    can end the panel one column later), rows r to n-1 of L and W are returned masked: only
+    the entries that correspond to factorized columns and to rows of the trailing matrix
+    are kept, and the rest are set to zero. The trailing update can then be done for all
+    the matrices in the batch, starting at row r, as A22 = A22 - (L*W' + W*L')/2.
+    When herm is true, the matrix is Hermitian and the transposes are conjugate transposes.
+    On exit, kk is set to the first column that is not yet factorized.
+    Call this kernel with batch_count groups in x, and BLOCKSIZE threads. **/
+template <typename T, typename S, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) lasyf_kernel(const rocblas_fill uplo,
+                                                          const bool herm,
+                                                          const rocblas_int n,
+                                                          const rocblas_int nb,
+                                                          const rocblas_int r,
+                                                          U AA,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipivA,
+                                                          const rocblas_stride strideP,
+                                                          rocblas_int* infoA,
+                                                          rocblas_int* kkA,
+                                                          T* WW,
+                                                          T* LL,
+                                                          const rocblas_int ldw,
+                                                          const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + b * strideP;
+    rocblas_int* info = infoA + b;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+    const S alpha = SYTF2_ALPHA(S);
+
+    // lower triangle of B = J*A*J (upper) or B = A (lower)
+    T* Bp = upper ? A + (n - 1) + (n - 1) * lda : A;
+    const rocblas_int incr = upper ? -1 : 1;
+    const rocblas_int incc = upper ? -lda : lda;
+
+    // element (i,c) of W (or L) is Wp[i * incw + c * ldw]; the rows of W and L
+    // are stored in the same order as the rows of A
+    T* Wp = WW + b * strideW + (upper ? n - 1 : 0);
+    T* Lp = LL + b * strideW + (upper ? n - 1 : 0);
+    const rocblas_int incw = upper ? -1 : 1;
+
+    // shared memory for the reductions, and the interchanges done in the panel
+    __shared__ S sval[BLOCKSIZE];
+    __shared__ rocblas_int sidx[BLOCKSIZE];
+    __shared__ rocblas_int spiv[SYTRF_BLOCKSIZE];
+
+    const rocblas_int k0 = kkA[b];
+
+    // this matrix is already factorized; nothing to update
+    if(k0 >= n)
+    {
+        for(rocblas_int i = r + tid; i < n; i += BLOCKSIZE)
+        {
+            for(rocblas_int c = 0; c < nb; ++c)
+            {
+                Wp[i * incw + c * ldw] = 0;
+                Lp[i * incw + c * ldw] = 0;
+            }
+        }
+        return;
+    }
+
+    // the last panel factorizes all the remaining columns
+    const bool last = (n - k0 <= nb);
+
+    rocblas_int k = k0;
+    rocblas_int c, kstep, kk, kp, imax, idx;
+    S absakk, colmax, rowmax, val, t;
+    T r1, d11, d21, d22, temp;
+
+    while((last || k - k0 < nb - 1) && k < n)
+    {
+        c = k - k0;
+        kstep = 1;
+
+        // copy column k of the trailing matrix into column c of W, and update it
+        for(rocblas_int i = k + tid; i < n; i += BLOCKSIZE)
+        {
+            temp = (i == k) ? sytf2_diag(herm, Bp[i * incr + k * incc]) : Bp[i * incr + k * incc];
+            for(rocblas_int cc = 0; cc < c; ++cc)
+                temp -= Bp[i * incr + (k0 + cc) * incc] * sytf2_conj(herm, Wp[k * incw + cc * ldw]);
+            Wp[i * incw + c * ldw] = (i == k) ? sytf2_diag(herm, temp) : temp;
+        }
+        __syncthreads();
+
+        absakk = aabs<S>(Wp[k * incw + c * ldw]);
+
+        // largest off-diagonal element in column k
+        val = -1;
+        idx = -1;
+        for(rocblas_int i = k + 1 + tid; i < n; i += BLOCKSIZE)
+        {
+            t = aabs<S>(Wp[i * incw + c * ldw]);
+            if(sytf2_better(upper, t, i, val, idx))
+            {
+                val = t;
+                idx = i;
+            }
+        }
+        sytf2_iamax_reduce(tid, upper, val, idx, sval, sidx);
+        imax = sidx[0];
+        colmax = (k < n - 1) ? sval[0] : 0;
+        __syncthreads();
+
+        if(max(absakk, colmax) == 0)
+        {
+            // column k is zero: D(k,k) is exactly zero
+            if(tid == 0 && *info == 0)
+                *info = upper ? n - k : k + 1;
+            kp = k;
+
+            for(rocblas_int i = k + tid; i < n; i += BLOCKSIZE)
+                Bp[i * incr + k * incc] = Wp[i * incw + c * ldw];
+            __syncthreads();
+        }
+        else
+        {
+            if(absakk >= alpha * colmax)
+                kp = k;
+            else
+            {
+                // copy column imax of the trailing matrix into column c+1 of W, and
+                // update it
+                for(rocblas_int i = k + tid; i < n; i += BLOCKSIZE)
+                {
+                    if(i < imax)
+                        temp = sytf2_conj(herm, Bp[imax * incr + i * incc]);
+                    else if(i == imax)
+                        temp = sytf2_diag(herm, Bp[i * incr + imax * incc]);
+                    else
+                        temp = Bp[i * incr + imax * incc];
+                    for(rocblas_int cc = 0; cc < c; ++cc)
+                        temp -= Bp[i * incr + (k0 + cc) * incc]
+                            * sytf2_conj(herm, Wp[imax * incw + cc * ldw]);
+                    Wp[i * incw + (c + 1) * ldw] = (i == imax) ? sytf2_diag(herm, temp) : temp;
+                }
+                __syncthreads();
+
+                // largest off-diagonal element in row/column imax
+                val = -1;
+                idx = -1;
+                for(rocblas_int i = k + tid; i < n; i += BLOCKSIZE)
+                {
+                    if(i == imax)
+                        continue;
+                    t = aabs<S>(Wp[i * incw + (c + 1) * ldw]);
+                    if(sytf2_better(upper, t, i, val, idx))
+                    {
+                        val = t;
+                        idx = i;
+                    }
+                }
+                sytf2_iamax_reduce(tid, upper, val, idx, sval, sidx);
+                rowmax = sval[0];
+
+                if(absakk >= alpha * colmax * (colmax / rowmax))
+                    kp = k;
+                else if(aabs<S>(Wp[imax * incw + (c + 1) * ldw]) >= alpha * rowmax)
+                {
+                    kp = imax;
+                    for(rocblas_int i = k + tid; i < n; i += BLOCKSIZE)
+                        Wp[i * incw + c * ldw] = Wp[i * incw + (c + 1) * ldw];
+                }
+                else
+                {
+                    kp = imax;
+                    kstep = 2;
+                }
+            }
+            __syncthreads();
+
+            kk = k + kstep - 1;
+            if(kp != kk)
+            {
+                // copy the non-updated column kk into column kp of the trailing matrix
+                for(rocblas_int j = kk + 1 + tid; j < kp; j += BLOCKSIZE)
+                    Bp[kp * incr + j * incc] = sytf2_conj(herm, Bp[j * incr + kk * incc]);
+                for(rocblas_int i = kp + 1 + tid; i < n; i += BLOCKSIZE)
+                    Bp[i * incr + kp * incc] = Bp[i * incr + kk * incc];
+                if(tid == 0)
+                    Bp[kp * incr + kp * incc] = sytf2_diag(herm, Bp[kk * incr + kk * incc]);
+
+                // interchange rows kk and kp in the panel columns of A and W
+                for(rocblas_int j = k0 + tid; j < kk; j += BLOCKSIZE)
+                {
+                    temp = Bp[kk * incr + j * incc];
+                    Bp[kk * incr + j * incc] = Bp[kp * incr + j * incc];
+                    Bp[kp * incr + j * incc] = temp;
+                }
+                for(rocblas_int cc = tid; cc <= kk - k0; cc += BLOCKSIZE)
+                {
+                    temp = Wp[kk * incw + cc * ldw];
+                    Wp[kk * incw + cc * ldw] = Wp[kp * incw + cc * ldw];
+                    Wp[kp * incw + cc * ldw] = temp;
+                }
+                __syncthreads();
+            }
+
+            // store the columns of L (and the diagonal block D) in the panel
+            if(kstep == 1)
+            {
+                r1 = T(1) / sytf2_diag(herm, Wp[k * incw + c * ldw]);
+                for(rocblas_int i = k + tid; i < n; i += BLOCKSIZE)
+                    Bp[i * incr + k * incc]
+                        = (i == k) ? Wp[i * incw + c * ldw] : r1 * Wp[i * incw + c * ldw];
+            }
+            else
+            {
+                d21 = Wp[(k + 1) * incw + c * ldw];
+                d11 = Wp[(k + 1) * incw + (c + 1) * ldw] / d21;
+                d22 = Wp[k * incw + c * ldw] / sytf2_conj(herm, d21);
+                temp = herm ? T(S(1) / (std::real(d11 * d22) - S(1))) : T(1) / (d11 * d22 - T(1));
+                d21 = temp / d21;
+                for(rocblas_int i = k + 2 + tid; i < n; i += BLOCKSIZE)
+                {
+                    Bp[i * incr + k * incc] = sytf2_conj(herm, d21)
+                        * (d11 * Wp[i * incw + c * ldw] - Wp[i * incw + (c + 1) * ldw]);
+                    Bp[i * incr + (k + 1) * incc]
+                        = d21 * (d22 * Wp[i * incw + (c + 1) * ldw] - Wp[i * incw + c * ldw]);
+                }
+                if(tid == 0)
+                {
+                    Bp[k * incr + k * incc] = sytf2_diag(herm, Wp[k * incw + c * ldw]);
+                    Bp[(k + 1) * incr + k * incc] = Wp[(k + 1) * incw + c * ldw];
+                    Bp[(k + 1) * incr + (k + 1) * incc]
+                        = sytf2_diag(herm, Wp[(k + 1) * incw + (c + 1) * ldw]);
+                }
+            }
+            __syncthreads();
+        }
+
+        // store the interchanges
+        if(tid == 0)
+        {
+            if(kstep == 1)
+            {
+                spiv[c] = kp + 1;
+                ipiv[sytf2_pivpos(upper, n, k)] = sytf2_pivval(upper, n, kp);
+            }
+            else
+            {
+                spiv[c] = -(kp + 1);
+                spiv[c + 1] = -(kp + 1);
+                ipiv[sytf2_pivpos(upper, n, k)] = -sytf2_pivval(upper, n, kp);
+                ipiv[sytf2_pivpos(upper, n, k + 1)] = -sytf2_pivval(upper, n, kp);
+            }
+        }
+        k += kstep;
+    }
+    __syncthreads();
+
+    // masked copies of L and W for the update of the trailing matrix
+    for(rocblas_int i = r + tid; i < n; i += BLOCKSIZE)
+    {
+        for(rocblas_int cc = 0; cc < nb; ++cc)
+        {
+            if(i >= k && cc < k - k0)
+                Lp[i * incw + cc * ldw] = Bp[i * incr + (k0 + cc) * incc];
+            else
+            {
+                Lp[i * incw + cc * ldw] = 0;
+                Wp[i * incw + cc * ldw] = 0;
+            }
+        }
+    }
+    __syncthreads();
+
+    // put L21 in standard form by partially undoing the interchanges in the panel
+    rocblas_int j = k - 1;
+    rocblas_int jj, jp;
+    while(j > k0)
+    {
+        jj = j;
+        jp = spiv[j - k0];
+        if(jp < 0)
+        {
+            jp = -jp;
+            j--;
+        }
+        jp--;
+        j--;
+        if(jp != jj && j >= k0)
+        {
+            for(rocblas_int l = k0 + tid; l <= j; l += BLOCKSIZE)
+            {
+                temp = Bp[jp * incr + l * incc];
+                Bp[jp * incr + l * incc] = Bp[jj * incr + l * incc];
+                Bp[jj * incr + l * incc] = temp;
+            }
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        kkA[b] = k;
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_sytrf_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_kk,
+                                   size_t* size_workArr)
+{
+    // if quick return, or if the unblocked variant is used, no workspace is needed
+    if(n < SYTRF_SYTF2_SWITCHSIZE || batch_count == 0)
+    {
+        *size_work = 0;
+        *size_kk = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // size of the workspaces W and L
+    *size_work = sizeof(T) * 2 * n * SYTRF_BLOCKSIZE * batch_count;
+
+    // size of the first non-factorized column of each matrix
+    *size_kk = sizeof(rocblas_int) * batch_count;
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * 2 * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <bool BATCHED, typename T, typename S, typename U>
+rocblas_status rocsolver_sytrf_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const bool herm,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* work,
+                                        rocblas_int* kk,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER(herm ? "hetrf" : "sytrf", "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // if the matrix is small, use the unblocked variant of the algorithm
+    if(n < SYTRF_SYTF2_SWITCHSIZE)
+        return rocsolver_sytf2_template<T, S>(handle, uplo, herm, n, A, shiftA, lda, strideA,
+                                              ipiv, strideP, info, batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix), and kk=0 (no column factorized)
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, kk, batch_count, 0);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T t_one = 1;
+    T t_minhalf = -0.5;
+    S s_one = 1;
+
+    const rocblas_int nb = SYTRF_BLOCKSIZE;
+    const rocblas_int ldw = n;
+    const rocblas_stride strideW = n * nb;
+    T* W = work;
+    T* L = work + strideW * batch_count;
+
+    rocblas_int r, off;
+    rocblas_int j = 0;
+    while(true)
+    {
+        // factorize the next panel of each matrix; at least nb-1 columns are
+        // factorized, so that all the matrices have at least reached column r
+        r = min(j + nb - 1, n);
+        hipLaunchKernelGGL(lasyf_kernel<T, S>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, uplo,
+                           herm, n, nb, r, A, shiftA, lda, strideA, ipiv, strideP, info, kk, W, L,
+                           ldw, strideW);
+
+        // update the trailing matrix
+        if(r < n)
+        {
+            off = (uplo == rocblas_fill_upper) ? 0 : r;
+            if(herm)
+                rocblasCall_syr2k_her2k<T>(handle, uplo, rocblas_operation_none, n - r, nb,
+                                           &t_minhalf, L, off, ldw, strideW, W, off, ldw, strideW,
+                                           &s_one, A, shiftA + idx2D(off, off, lda), lda, strideA,
+                                           batch_count, workArr);
+            else
+                rocblasCall_syr2k<T>(handle, uplo, rocblas_operation_none, n - r, nb, &t_minhalf,
+                                     L, off, ldw, strideW, W, off, ldw, strideW, &t_one, A,
+                                     shiftA + idx2D(off, off, lda), lda, strideA, batch_count,
+                                     workArr);
+        }
+
+        if(n - j <= nb)
+            break;
+        j += nb - 1;
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
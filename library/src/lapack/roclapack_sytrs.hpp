@@ -0,0 +1,248 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_sytf2.hpp"
+#include "rocsolver.h"
+
+/** SYTRS_KERNEL solves A*X = B for one right-hand side, using the factorization
+    A = U*D*U' (or A = L*D*L') computed by SYTRF (see roclapack_sytf2.hpp for the notation).
+    In terms of B = J*A*J, the factorization is always lower, and the rows of the
+    right-hand side are reversed when uplo is upper.
+    When herm is true, A is Hermitian and the factorization, computed by HETRF, is
+    A = U*D*U^H (or A = L*D*L^H).
+    If info is not null, the matrices with info != 0 are skipped.
+    Call this kernel with nrhs groups in x, batch_count groups in y, and BLOCKSIZE
+    threads. **/
+template <typename T, typename U>
+__global__ void __launch_bounds__(BLOCKSIZE) sytrs_kernel(const rocblas_fill uplo,
+                                                          const bool herm,
+                                                          const rocblas_int n,
+                                                          U AA,
+                                                          const rocblas_int shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          const rocblas_int* ipivA,
+                                                          const rocblas_stride strideP,
+                                                          U BB,
+                                                          const rocblas_int shiftB,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB,
+                                                          const rocblas_int* info)
+{
+    const auto col = hipBlockIdx_x;
+    const auto b = hipBlockIdx_y;
+    const auto tid = hipThreadIdx_x;
+
+    if(info && info[b] != 0)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* Bc = load_ptr_batch<T>(BB, b, shiftB, strideB) + col * ldb;
+    const rocblas_int* ipiv = ipivA + b * strideP;
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // lower triangle of B = J*A*J (upper) or B = A (lower)
+    T* Ap = upper ? A + (n - 1) + (n - 1) * lda : A;
+    const rocblas_int incr = upper ? -1 : 1;
+    const rocblas_int incc = upper ? -lda : lda;
+
+    // element i of the right-hand side (in the order of B) is x[i * incx]
+    T* x = upper ? Bc + (n - 1) : Bc;
+    const rocblas_int incx = upper ? -1 : 1;
+
+    // shared memory for the reductions
+    __shared__ T sum1[BLOCKSIZE];
+    __shared__ T sum2[BLOCKSIZE];
+
+    rocblas_int k, kp, v;
+    T temp, akm1k, akm1, ak, denom, bkm1, bk;
+
+    // solve L*D*X = B, overwriting B with X
+    k = 0;
+    while(k < n)
+    {
+        v = ipiv[sytf2_pivpos(upper, n, k)];
+        kp = upper ? n - abs(v) : abs(v) - 1;
+
+        if(v > 0)
+        {
+            // 1-by-1 diagonal block: interchange rows k and kp, and apply the
+            // transformation stored in column k of A
+            if(tid == 0 && kp != k)
+            {
+                temp = x[k * incx];
+                x[k * incx] = x[kp * incx];
+                x[kp * incx] = temp;
+            }
+            __syncthreads();
+
+            for(rocblas_int i = k + 1 + tid; i < n; i += BLOCKSIZE)
+                x[i * incx] -= Ap[i * incr + k * incc] * x[k * incx];
+            __syncthreads();
+
+            if(tid == 0)
+                x[k * incx] = x[k * incx] / sytf2_diag(herm, Ap[k * incr + k * incc]);
+            k++;
+        }
+        else
+        {
+            // 2-by-2 diagonal block: interchange rows k+1 and kp, and apply the
+            // transformations stored in columns k and k+1 of A
+            if(tid == 0 && kp != k + 1)
+            {
+                temp = x[(k + 1) * incx];
+                x[(k + 1) * incx] = x[kp * incx];
+                x[kp * incx] = temp;
+            }
+            __syncthreads();
+
+            for(rocblas_int i = k + 2 + tid; i < n; i += BLOCKSIZE)
+                x[i * incx] -= Ap[i * incr + k * incc] * x[k * incx]
+                    + Ap[i * incr + (k + 1) * incc] * x[(k + 1) * incx];
+            __syncthreads();
+
+            if(tid == 0)
+            {
+                akm1k = Ap[(k + 1) * incr + k * incc];
+                akm1 = sytf2_diag(herm, Ap[k * incr + k * incc]) / sytf2_conj(herm, akm1k);
+                ak = sytf2_diag(herm, Ap[(k + 1) * incr + (k + 1) * incc]) / akm1k;
+                denom = akm1 * ak - T(1);
+                bkm1 = x[k * incx] / sytf2_conj(herm, akm1k);
+                bk = x[(k + 1) * incx] / akm1k;
+                x[k * incx] = (ak * bkm1 - bk) / denom;
+                x[(k + 1) * incx] = (akm1 * bk - bkm1) / denom;
+            }
+            k += 2;
+        }
+        __syncthreads();
+    }
+
+    // solve L'*X = B (or L^H*X = B), overwriting B with X
+    k = n - 1;
+    while(k >= 0)
+    {
+        v = ipiv[sytf2_pivpos(upper, n, k)];
+        kp = upper ? n - abs(v) : abs(v) - 1;
+
+        // partial sums of the products with columns k (and k-1) of A
+        sum1[tid] = 0;
+        sum2[tid] = 0;
+        for(rocblas_int i = k + 1 + tid; i < n; i += BLOCKSIZE)
+        {
+            sum1[tid] += sytf2_conj(herm, Ap[i * incr + k * incc]) * x[i * incx];
+            if(v < 0)
+                sum2[tid] += sytf2_conj(herm, Ap[i * incr + (k - 1) * incc]) * x[i * incx];
+        }
+        __syncthreads();
+
+        for(rocblas_int s = BLOCKSIZE / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+            {
+                sum1[tid] += sum1[tid + s];
+                sum2[tid] += sum2[tid + s];
+            }
+            __syncthreads();
+        }
+
+        // update the rows of the block, and interchange rows k and kp
+        if(tid == 0)
+        {
+            x[k * incx] -= sum1[0];
+            if(v < 0)
+                x[(k - 1) * incx] -= sum2[0];
+
+            if(kp != k)
+            {
+                temp = x[k * incx];
+                x[k * incx] = x[kp * incx];
+                x[kp * incx] = temp;
+            }
+        }
+        __syncthreads();
+
+        k -= (v > 0) ? 1 : 2;
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_sytrs_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs * n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_sytrs_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const bool herm,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        const rocblas_int* info = nullptr)
+{
+    ROCSOLVER_ENTER(herm ? "hetrs" : "sytrs", "uplo:", uplo, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the interchanges and the 2-by-2 blocks are applied in sequence, so every
+    // right-hand side is solved by a single group of threads
+    hipLaunchKernelGGL(sytrs_kernel<T>, dim3(nrhs, batch_count), dim3(BLOCKSIZE), 0, stream, uplo,
+                       herm, n, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB,
+                       info);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_trcon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_trcon_impl(rocblas_handle handle,
+                                    const rocblas_norm_type norm_type,
+                                    const rocblas_fill uplo,
+                                    const rocblas_diagonal diag,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    S* rcond)
+{
+    ROCSOLVER_ENTER_TOP("trcon", "--norm", norm_type, "--uplo", uplo, "--diag", diag, "-n", n,
+                        "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_trcon_argCheck(handle, norm_type, uplo, diag, n, lda, A, rcond);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the iterate in the estimation of the norm of the inverse
+    size_t size_work;
+    // size to store the norms of the matrices
+    size_t size_norm;
+    rocsolver_trcon_getMemorySize<T, S>(n, batch_count, &size_work, &size_norm);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_norm);
+
+    // memory workspace allocation
+    void *work, *norm;
+    rocblas_device_malloc mem(handle, size_work, size_norm);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    norm = mem[1];
+
+    // execution
+    return rocsolver_trcon_template<T>(handle, norm_type, uplo, diag, n, A, shiftA, lda, strideA,
+                                       rcond, batch_count, (T*)work, (S*)norm);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_strcon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                float* rcond)
+{
+    return rocsolver_trcon_impl<float>(handle, norm_type, uplo, diag, n, A, lda, rcond);
+}
+
+rocblas_status rocsolver_dtrcon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                double* rcond)
+{
+    return rocsolver_trcon_impl<double>(handle, norm_type, uplo, diag, n, A, lda, rcond);
+}
+
+rocblas_status rocsolver_ctrcon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                float* rcond)
+{
+    return rocsolver_trcon_impl<rocblas_float_complex>(handle, norm_type, uplo, diag, n, A, lda,
+                                                       rcond);
+}
+
+rocblas_status rocsolver_ztrcon(rocblas_handle handle,
+                                const rocblas_norm_type norm_type,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                double* rcond)
+{
+    return rocsolver_trcon_impl<rocblas_double_complex>(handle, norm_type, uplo, diag, n, A, lda,
+                                                        rcond);
+}
+
+} // extern C
@@ -0,0 +1,119 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lange.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "rocsolver.h"
+
+template <typename T, typename S>
+void rocsolver_trcon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_norm)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        *size_norm = 0;
+        return;
+    }
+
+    // size of the iterate x and of its signs in the 1-norm estimation
+    *size_work = sizeof(T) * 2 * n * batch_count;
+
+    // size of the norms of the matrices
+    *size_norm = sizeof(S) * batch_count;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_trcon_argCheck(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(diag != rocblas_diagonal_non_unit && diag != rocblas_diagonal_unit)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_trcon_template(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        T* work,
+                                        S* norm)
+{
+    ROCSOLVER_ENTER("trcon", "norm_type:", norm_type, "uplo:", uplo, "diag:", diag, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions (the empty matrix is perfectly conditioned)
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, rcond,
+                           batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // compute the norm of the triangular matrices
+    hipLaunchKernelGGL(lange_kernel<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, norm_type,
+                       uplo, diag, n, n, A, shiftA, lda, strideA, norm);
+
+    // estimate the norm of their inverses
+    S safmin = get_safemin<S>();
+    hipLaunchKernelGGL(con_kernel<T>, dim3(batch_count), dim3(BLOCKSIZE), 0, stream, con_triangular,
+                       norm_type == rocblas_norm_one, uplo, diag, n, A, shiftA, lda, strideA, norm,
+                       rcond, work, safmin);
+
+    return rocblas_status_success;
+}
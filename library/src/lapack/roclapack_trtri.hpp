@@ -0,0 +1,314 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** TRTI2_KERNEL_SMALL inverts the DIM-by-DIM diagonal blocks of a triangular
+    matrix using register arrays. Group hipBlockIdx_y of each instance works on
+    the block that starts at row and column hipBlockIdx_y * DIM (the last block
+    can be smaller). Instances with info != 0 are not modified.
+    Call this kernel with DIM threads per group. **/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(WAVESIZE) trti2_kernel_small(const rocblas_fill uplo,
+                                                               const rocblas_diagonal diag,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               rocblas_int* info)
+{
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+    rocblas_int k = hipBlockIdx_y * DIM;
+    rocblas_int nb = min(DIM, n - k);
+
+    // singular instances are left unchanged
+    if(info[b] != 0)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA + idx2D(k, k, lda), strideA);
+    const bool upper = (uplo == rocblas_fill_upper);
+    const bool unit = (diag == rocblas_diagonal_unit);
+
+    // shared memory (for communication between threads in group)
+    __shared__ T common[DIM];
+    __shared__ T diagA[DIM];
+
+    // read corresponding row (upper) or column (lower) from global memory
+    T rA[DIM];
+    tri_load_regs<DIM>(upper, i, nb, A, lda, rA);
+
+    // invert block
+    trti2_regs<DIM>(unit, i, rA, common, diagA);
+
+    // write results to global memory from local array
+    tri_store_regs<DIM>(upper, unit, i, nb, A, lda, rA);
+}
+
+/** TRTRI_RESTORE copies the triangular part of the saved matrices in W back
+    into A for the instances in the batch that were found to be singular. **/
+template <typename T, typename U>
+__global__ void trtri_restore(const rocblas_fill uplo,
+                              const rocblas_int n,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              T* W,
+                              const rocblas_int ldw,
+                              const rocblas_stride strideW,
+                              rocblas_int* info)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    if(info[b] != 0 && i < n && j < n && ((upper && j >= i) || (!upper && i >= j)))
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T* Wp = W + b * strideW;
+        Ap[i + j * lda] = Wp[i + j * ldw];
+    }
+}
+
+template <typename T, typename U>
+void trti2_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_diagonal diag,
+                     const rocblas_int n,
+                     const rocblas_int dim,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* info,
+                     const rocblas_int batch_count)
+{
+#define RUN_TRTI2_SMALL(DIM)                                                                    \
+    hipLaunchKernelGGL((trti2_kernel_small<DIM, T>), grid, block, 0, stream, uplo, diag, n, A, \
+                       shiftA, lda, strideA, info)
+
+    rocblas_int blocks = (n - 1) / dim + 1;
+    dim3 grid(batch_count, blocks, 1);
+    dim3 block(dim, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size of the blocks known at compile time
+    switch(dim)
+    {
+    case 8: RUN_TRTI2_SMALL(8); break;
+    case 16: RUN_TRTI2_SMALL(16); break;
+    case 32: RUN_TRTI2_SMALL(32); break;
+    case 64: RUN_TRTI2_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+/** TRTRI_BLOCKED computes the inverse of the triangular matrix A once its
+    diagonal blocks have been inverted. Singular instances (info != 0) are
+    also modified and should be restored by the caller.
+    (Scalars must be on the host) **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void trtri_blocked(rocblas_handle handle,
+                   const rocblas_fill uplo,
+                   const rocblas_diagonal diag,
+                   const rocblas_int n,
+                   U A,
+                   const rocblas_int shiftA,
+                   const rocblas_int lda,
+                   const rocblas_stride strideA,
+                   rocblas_int* info,
+                   const rocblas_int batch_count)
+{
+    // constants for rocblas functions calls
+    T one = 1;
+    T minone = -1;
+
+    rocblas_int jb, nb = TRTRI_BLOCKSIZE;
+
+    // invert all the diagonal blocks at once
+    trti2_run_small<T>(handle, uplo, diag, n, nb, A, shiftA, lda, strideA, info, batch_count);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // compute block column j: inv(A11) * A12 * -inv(A22)
+        for(rocblas_int j = nb; j < n; j += nb)
+        {
+            jb = min(n - j, nb);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, diag, j, jb, &one, 0, A,
+                shiftA, lda, strideA, A, shiftA + idx2D(0, j, lda), lda, strideA, batch_count);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(handle, rocblas_side_right, uplo,
+                                                  rocblas_operation_none, diag, j, jb, &minone, 0,
+                                                  A, shiftA + idx2D(j, j, lda), lda, strideA, A,
+                                                  shiftA + idx2D(0, j, lda), lda, strideA,
+                                                  batch_count);
+        }
+    }
+    else
+    {
+        // compute block row j: -inv(A22) * A21 * inv(A11)
+        rocblas_int nn = ((n - 1) / nb) * nb;
+        for(rocblas_int j = nn - nb; j >= 0; j -= nb)
+        {
+            jb = min(n - j, nb);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, diag, n - j - jb, jb,
+                &one, 0, A, shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, A,
+                shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(handle, rocblas_side_right, uplo,
+                                                  rocblas_operation_none, diag, n - j - jb, jb,
+                                                  &minone, 0, A, shiftA + idx2D(j, j, lda), lda,
+                                                  strideA, A, shiftA + idx2D(j + jb, j, lda), lda,
+                                                  strideA, batch_count);
+        }
+    }
+}
+
+template <typename T>
+void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_tmpcopy)
+{
+    // if quick return, no need of workspace
+    if(n == 0 || batch_count == 0)
+    {
+        *size_tmpcopy = 0;
+        return;
+    }
+
+    // small matrices are inverted by a single kernel that leaves singular
+    // instances untouched; otherwise, a copy of the matrix is needed to restore
+    // them (a unit triangular matrix is never singular)
+    if(n <= TRTRI_SWITCHSIZE || diag == rocblas_diagonal_unit)
+        *size_tmpcopy = 0;
+    else
+        *size_tmpcopy = sizeof(T) * n * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_trtri_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(diag != rocblas_diagonal_non_unit && diag != rocblas_diagonal_unit)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_trtri_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* tmpcopy)
+{
+    ROCSOLVER_ENTER("trtri", "uplo:", uplo, "diag:", diag, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions, or if the matrix cannot be singular
+    if(n == 0 || diag == rocblas_diagonal_unit)
+    {
+        rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream, info,
+                           batch_count, 0);
+    }
+    if(n == 0)
+        return rocblas_status_success;
+
+    // check for singularities
+    if(diag == rocblas_diagonal_non_unit)
+    {
+        rocblas_int threads = min(((n - 1) / 64 + 1) * 64, BLOCKSIZE);
+        hipLaunchKernelGGL(check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0,
+                           stream, n, A, shiftA, lda, strideA, info);
+    }
+
+    // if the matrix is small, invert it with a single kernel
+    if(n <= TRTRI_SWITCHSIZE)
+    {
+        trti2_run_small<T>(handle, uplo, diag, n, tri_small_dim(n), A, shiftA, lda, strideA, info,
+                           batch_count);
+        return rocblas_status_success;
+    }
+
+    rocblas_int blocks = (n - 1) / 32 + 1;
+    rocblas_int ldw = n;
+    rocblas_stride strideW = n * n;
+
+    // keep a copy of the matrix to restore the singular instances
+    if(diag == rocblas_diagonal_non_unit)
+        hipLaunchKernelGGL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
+                           n, n, A, shiftA, lda, strideA, tmpcopy, 0, ldw, strideW, uplo);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    trtri_blocked<BATCHED, STRIDED, T>(handle, uplo, diag, n, A, shiftA, lda, strideA, info,
+                                       batch_count);
+
+    if(diag == rocblas_diagonal_non_unit)
+        hipLaunchKernelGGL(trtri_restore<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0,
+                           stream, uplo, n, A, shiftA, lda, strideA, tmpcopy, ldw, strideW, info);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}